@@ -0,0 +1,47 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+#include "include/sha_mb_mgr.h"
+#include "include/arch_avx_type1.h"
+
+#define NUM_SHA1_LANES                  AVX_NUM_SHA1_LANES
+#define NUM_SHA256_LANES                AVX_NUM_SHA256_LANES
+#define SHA1_MB_KERNEL                  call_sha1_mult_avx_from_c
+#define SHA256_MB_KERNEL                call_sha_256_mult_avx_from_c
+#define SHA1_ONE_BLOCK                  sha1_block_avx
+#define SHA256_ONE_BLOCK                sha256_block_avx
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_1   submit_job_aes_cbc_hmac_sha_1_avx
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_1    flush_job_aes_cbc_hmac_sha_1_avx
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_256 submit_job_aes_cbc_hmac_sha_256_avx
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_256  flush_job_aes_cbc_hmac_sha_256_avx
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_1   submit_job_aes_ctr_hmac_sha_1_avx
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_1    flush_job_aes_ctr_hmac_sha_1_avx
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_256 submit_job_aes_ctr_hmac_sha_256_avx
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_256  flush_job_aes_ctr_hmac_sha_256_avx
+
+#include "include/aes_cbc_hmac_mb_mgr.h"
@@ -0,0 +1,42 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+#include "include/arch_avx_type1.h"
+
+#define NUM_CFB_LANES             AVX_NUM_CFB_LANES
+#define SUBMIT_JOB_AES128_CFB_ENC submit_job_aes128_cfb_enc_avx
+#define FLUSH_JOB_AES128_CFB_ENC  flush_job_aes128_cfb_enc_avx
+#define SUBMIT_JOB_AES128_CFB_DEC submit_job_aes128_cfb_dec_avx
+#define SUBMIT_JOB_AES192_CFB_ENC submit_job_aes192_cfb_enc_avx
+#define FLUSH_JOB_AES192_CFB_ENC  flush_job_aes192_cfb_enc_avx
+#define SUBMIT_JOB_AES192_CFB_DEC submit_job_aes192_cfb_dec_avx
+#define SUBMIT_JOB_AES256_CFB_ENC submit_job_aes256_cfb_enc_avx
+#define FLUSH_JOB_AES256_CFB_ENC  flush_job_aes256_cfb_enc_avx
+#define SUBMIT_JOB_AES256_CFB_DEC submit_job_aes256_cfb_dec_avx
+
+#include "include/aes_cfb_mb_mgr.h"
@@ -0,0 +1,39 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+#include "include/arch_avx_type1.h"
+
+#define NUM_CHACHA20_LANES              AVX_NUM_CHACHA20_LANES
+#define SUBMIT_JOB_CHACHA20_MB          submit_job_chacha20_mb_avx
+#define FLUSH_JOB_CHACHA20_MB           flush_job_chacha20_mb_avx
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB submit_job_chacha20_poly1305_mb_avx
+#define FLUSH_JOB_CHACHA20_POLY1305_MB  flush_job_chacha20_poly1305_mb_avx
+#define SUBMIT_JOB_POLY1305_MB          submit_job_poly1305_mb_avx
+#define FLUSH_JOB_POLY1305_MB           flush_job_poly1305_mb_avx
+
+#include "include/chacha20_poly1305_mb_mgr.h"
@@ -44,6 +44,8 @@
 #include "include/cpu_feature.h"
 #include "include/aesni_emu.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 #include "include/arch_avx_type1.h"
 #include "include/ooo_mgr_reset.h"
 
@@ -118,6 +120,64 @@
 #define SUBMIT_JOB_AES_GCM_DEC submit_job_aes_gcm_dec_avx
 #define SUBMIT_JOB_AES_GCM_ENC submit_job_aes_gcm_enc_avx
 
+#define SUBMIT_JOB_AES128_GCM submit_job_aes128_gcm_avx
+#define FLUSH_JOB_AES128_GCM  flush_job_aes128_gcm_avx
+#define SUBMIT_JOB_AES192_GCM submit_job_aes192_gcm_avx
+#define FLUSH_JOB_AES192_GCM  flush_job_aes192_gcm_avx
+#define SUBMIT_JOB_AES256_GCM submit_job_aes256_gcm_avx
+#define FLUSH_JOB_AES256_GCM  flush_job_aes256_gcm_avx
+
+#define SUBMIT_JOB_AES128_XTS_ENC  submit_job_aes128_xts_enc_avx
+#define FLUSH_JOB_AES128_XTS_ENC   flush_job_aes128_xts_enc_avx
+#define SUBMIT_JOB_AES128_XTS_DEC  submit_job_aes128_xts_dec_avx
+#define FLUSH_JOB_AES128_XTS_DEC   flush_job_aes128_xts_dec_avx
+#define SUBMIT_JOB_AES256_XTS_ENC  submit_job_aes256_xts_enc_avx
+#define FLUSH_JOB_AES256_XTS_ENC   flush_job_aes256_xts_enc_avx
+#define SUBMIT_JOB_AES256_XTS_DEC  submit_job_aes256_xts_dec_avx
+#define FLUSH_JOB_AES256_XTS_DEC   flush_job_aes256_xts_dec_avx
+
+#define SUBMIT_JOB_AES128_CFB_ENC  submit_job_aes128_cfb_enc_avx
+#define FLUSH_JOB_AES128_CFB_ENC   flush_job_aes128_cfb_enc_avx
+#define SUBMIT_JOB_AES128_CFB_DEC  submit_job_aes128_cfb_dec_avx
+#define SUBMIT_JOB_AES192_CFB_ENC  submit_job_aes192_cfb_enc_avx
+#define FLUSH_JOB_AES192_CFB_ENC   flush_job_aes192_cfb_enc_avx
+#define SUBMIT_JOB_AES192_CFB_DEC  submit_job_aes192_cfb_dec_avx
+#define SUBMIT_JOB_AES256_CFB_ENC  submit_job_aes256_cfb_enc_avx
+#define FLUSH_JOB_AES256_CFB_ENC   flush_job_aes256_cfb_enc_avx
+#define SUBMIT_JOB_AES256_CFB_DEC  submit_job_aes256_cfb_dec_avx
+
+#define SUBMIT_JOB_DES_CBC_ENC submit_job_des_cbc_enc_avx
+#define FLUSH_JOB_DES_CBC_ENC  flush_job_des_cbc_enc_avx
+
+#define SUBMIT_JOB_DES_CBC_DEC submit_job_des_cbc_dec_avx
+#define FLUSH_JOB_DES_CBC_DEC  flush_job_des_cbc_dec_avx
+
+#define SUBMIT_JOB_3DES_CBC_ENC submit_job_3des_cbc_enc_avx
+#define FLUSH_JOB_3DES_CBC_ENC  flush_job_3des_cbc_enc_avx
+
+#define SUBMIT_JOB_3DES_CBC_DEC submit_job_3des_cbc_dec_avx
+#define FLUSH_JOB_3DES_CBC_DEC  flush_job_3des_cbc_dec_avx
+
+#define SUBMIT_JOB_DOCSIS_DES_ENC submit_job_docsis_des_enc_avx
+#define FLUSH_JOB_DOCSIS_DES_ENC  flush_job_docsis_des_enc_avx
+
+#define SUBMIT_JOB_DOCSIS_DES_DEC submit_job_docsis_des_dec_avx
+#define FLUSH_JOB_DOCSIS_DES_DEC  flush_job_docsis_des_dec_avx
+
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_1   submit_job_aes_cbc_hmac_sha_1_avx
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_1    flush_job_aes_cbc_hmac_sha_1_avx
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_256 submit_job_aes_cbc_hmac_sha_256_avx
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_256  flush_job_aes_cbc_hmac_sha_256_avx
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_1   submit_job_aes_ctr_hmac_sha_1_avx
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_1    flush_job_aes_ctr_hmac_sha_1_avx
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_256 submit_job_aes_ctr_hmac_sha_256_avx
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_256  flush_job_aes_ctr_hmac_sha_256_avx
+#define SUBMIT_JOB_AES_CTR_CMAC         submit_job_aes_ctr_cmac_avx
+#define FLUSH_JOB_AES_CTR_CMAC          flush_job_aes_ctr_cmac_avx
+
+#define SUBMIT_JOB_CRC                  submit_job_crc_avx
+#define FLUSH_JOB_CRC                   flush_job_crc_avx
+
 #define SUBMIT_JOB_AES_XCBC   submit_job_aes_xcbc_avx
 #define FLUSH_JOB_AES_XCBC    flush_job_aes_xcbc_avx
 
@@ -148,6 +208,13 @@
 #define SUBMIT_JOB_CHACHA20_POLY1305_SGL aead_chacha20_poly1305_sgl_avx
 #define POLY1305_MAC poly1305_mac_scalar
 
+#define SUBMIT_JOB_CHACHA20_MB submit_job_chacha20_mb_avx
+#define FLUSH_JOB_CHACHA20_MB  flush_job_chacha20_mb_avx
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB submit_job_chacha20_poly1305_mb_avx
+#define FLUSH_JOB_CHACHA20_POLY1305_MB  flush_job_chacha20_poly1305_mb_avx
+#define SUBMIT_JOB_POLY1305_MB submit_job_poly1305_mb_avx
+#define FLUSH_JOB_POLY1305_MB  flush_job_poly1305_mb_avx
+
 #define SUBMIT_JOB_SNOW_V snow_v_avx
 #define SUBMIT_JOB_SNOW_V_AEAD snow_v_aead_init_avx
 
@@ -188,6 +255,8 @@
 
 #define AES_CFB_128_ONE    aes_cfb_128_one_avx
 #define AES_CFB_256_ONE    aes_cfb_256_one_avx
+#define AES_CBC_ENC_128_MB aes_cbc_enc_128_x8
+#define AES_CBC_ENC_256_MB aes_cbc_enc_256_x8
 
 
 #define AES128_CBC_MAC     aes128_cbc_mac_x8
@@ -428,6 +497,53 @@ reset_ooo_mgrs(IMB_MGR *state)
         ooo_mgr_ccm_reset(state->aes_ccm_ooo, 8);
         ooo_mgr_ccm_reset(state->aes256_ccm_ooo, 8);
 
+        /* Init AES-GCM out-of-order fields */
+        ooo_mgr_gcm_reset(state->aes128_gcm_ooo, AVX_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes192_gcm_ooo, AVX_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes256_gcm_ooo, AVX_NUM_GCM_LANES);
+
+        /* Init AES-XTS out-of-order fields */
+        ooo_mgr_aes_xts_reset(state->aes128_xts_enc_ooo, AVX_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes128_xts_dec_ooo, AVX_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_enc_ooo, AVX_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_dec_ooo, AVX_NUM_XTS_LANES);
+
+        /* Init AES-CFB out-of-order fields */
+        ooo_mgr_aes_cfb_reset(state->aes128_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes192_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes256_cfb_ooo, AVX_NUM_CFB_LANES);
+
+        /* DES, 3DES and DOCSIS DES (DES CBC + DES CFB for partial block) */
+        ooo_mgr_des_reset(state->des_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des_dec_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_dec_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_dec_ooo, AVX_NUM_DES_LANES);
+
+        /* Stitched AES-CBC/CTR + HMAC-SHA1/SHA256 and AES-CTR + AES-CMAC */
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_1_ooo,
+                                   AVX_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_256_ooo,
+                                   AVX_NUM_SHA256_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_1_ooo,
+                                   AVX_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_256_ooo,
+                                   AVX_NUM_SHA256_LANES);
+        ooo_mgr_aes_ctr_cmac_reset(state->aes_ctr_cmac_ooo,
+                                   AVX_NUM_CTR_CMAC_LANES);
+
+        /* CRC */
+        ooo_mgr_crc_reset(state->crc_ooo, AVX_NUM_CRC_LANES);
+
+        /* Init ChaCha20, ChaCha20-Poly1305 and Poly1305 out-of-order fields */
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_ooo,
+                                        AVX_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_poly1305_ooo,
+                                        AVX_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->poly1305_ooo,
+                                        AVX_NUM_CHACHA20_LANES);
+
         /* Init AES-CMAC auth out-of-order fields */
         ooo_mgr_cmac_reset(state->aes_cmac_ooo, 8);
         ooo_mgr_cmac_reset(state->aes256_cmac_ooo, 8);
@@ -483,10 +599,12 @@ init_mb_mgr_avx_internal(IMB_MGR *state, const int reset_mgrs)
 
         if (reset_mgrs) {
                 reset_ooo_mgrs(state);
+                reset_ooo_stats(state);
 
                 /* Init "in order" components */
                 state->next_job = 0;
                 state->earliest_job = -1;
+                completion_ring_reset(state);
         }
 
         /* set AVX handlers */
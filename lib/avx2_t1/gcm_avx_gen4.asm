@@ -127,25 +127,36 @@
 %endif
 %endif
 
+;; Decide on the instruction set to compile for.
+;; GCM_VAES_AVX2 selects 256-bit VAES and VPCLMULQDQ for the 8 block
+;; parallel loops (2 blocks per instruction) with the same key layout.
+%ifdef GCM_VAES_AVX2
+%define ARCH_SUFFIX vaes_avx2
+%else
+%define ARCH_SUFFIX avx_gen4
+%endif
+
 ;; Decide on AES-GCM key size to compile for
 %ifdef GCM128_MODE
 %define NROUNDS 9
-%define FN_NAME(x,y) aes_gcm_ %+ x %+ _128 %+ y %+ avx_gen4
-%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _128_ %+ avx_gen4
+%define FN_NAME(x,y) aes_gcm_ %+ x %+ _128 %+ y %+ ARCH_SUFFIX
+%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _128_ %+ ARCH_SUFFIX
 %endif
 
 %ifdef GCM192_MODE
 %define NROUNDS 11
-%define FN_NAME(x,y) aes_gcm_ %+ x %+ _192 %+ y %+ avx_gen4
-%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _192_ %+ avx_gen4
+%define FN_NAME(x,y) aes_gcm_ %+ x %+ _192 %+ y %+ ARCH_SUFFIX
+%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _192_ %+ ARCH_SUFFIX
 %endif
 
 %ifdef GCM256_MODE
 %define NROUNDS 13
-%define FN_NAME(x,y) aes_gcm_ %+ x %+ _256 %+ y %+ avx_gen4
-%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _256_ %+ avx_gen4
+%define FN_NAME(x,y) aes_gcm_ %+ x %+ _256 %+ y %+ ARCH_SUFFIX
+%define GMAC_FN_NAME(x) imb_aes_gmac_ %+ x %+ _256_ %+ ARCH_SUFFIX
 %endif
 
+%define GHASH_FN_NAME ghash_ %+ ARCH_SUFFIX
+
 mksection .text
 default rel
 
@@ -292,6 +303,40 @@ default rel
         cmp     %%T2, 128
         jl      %%_exit_AAD_loop128
 
+%ifdef GCM_VAES_AVX2
+        ;; 2 blocks per YMM register: blocks 2i:2i+1 are multiplied by
+        ;; HashKey_(8-2i):HashKey_(7-2i), which are adjacent in the key structure
+        vmovdqa         %%XTMP4, %%AAD_HASH                             ; clears the upper lane
+        vmovdqu         YWORD(%%XTMP0), [%%T1 + 32*0]
+        vpshufb         YWORD(%%XTMP0), YWORD(%%XTMP0), [rel SHUF_MASK]
+        vpxor           YWORD(%%XTMP0), YWORD(%%XTMP0), YWORD(%%XTMP4)
+
+        GHASH_SINGLE_MUL %%GDATA_KEY, HashKey_8, YWORD(%%XTMP0), \
+                         YWORD(%%XTMP1), YWORD(%%XTMP2), YWORD(%%XTMP3), \
+                         YWORD(%%XTMP5), YWORD(%%XTMP4), first
+
+%assign i 1
+%assign j 6
+%rep 3
+        vmovdqu         YWORD(%%XTMP0), [%%T1 + 32*i]
+        vpshufb         YWORD(%%XTMP0), YWORD(%%XTMP0), [rel SHUF_MASK]
+
+        GHASH_SINGLE_MUL %%GDATA_KEY, HashKey_ %+ j, YWORD(%%XTMP0), \
+                         YWORD(%%XTMP1), YWORD(%%XTMP2), YWORD(%%XTMP3), \
+                         YWORD(%%XTMP5), YWORD(%%XTMP4), not_first
+%assign i (i + 1)
+%assign j (j - 2)
+%endrep
+
+        ;; fold the two lanes of the partial products
+        vextracti128    %%XTMP4, YWORD(%%XTMP1), 1
+        vpxor           %%XTMP1, %%XTMP1, %%XTMP4
+        vextracti128    %%XTMP4, YWORD(%%XTMP2), 1
+        vpxor           %%XTMP2, %%XTMP2, %%XTMP4
+        vextracti128    %%XTMP4, YWORD(%%XTMP3), 1
+        vpxor           %%XTMP3, %%XTMP3, %%XTMP4
+        vzeroupper
+%else
         vmovdqu         %%XTMP0, [%%T1 + 16*0]
         vpshufb         %%XTMP0, [rel SHUF_MASK]
 
@@ -324,6 +369,7 @@ default rel
 %assign i (i + 1)
 %assign j (j - 1)
 %endrep
+%endif ; GCM_VAES_AVX2
 
         vpslldq         %%XTMP4, %%XTMP3, 8                             ; shift-L 2 DWs
         vpsrldq         %%XTMP3, %%XTMP3, 8                             ; shift-R 2 DWs
@@ -1519,6 +1565,225 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
 
 %endmacro                       ; INITIAL_BLOCKS_PARTIAL
 
+%ifdef GCM_VAES_AVX2
+;; Last AES round for a pair of blocks held in one YMM register, XOR with
+;; the input and, for ENC, store the ciphertext. On exit %%STATE holds
+;; the 2 ciphertext blocks to be hashed in the next iteration.
+;; For the partial case the second block of the last pair is neither read
+;; nor written and its lane is left with the encrypted counter block.
+%macro  VAES_LAST_ROUND_X2 10
+%define %%STATE                 %1      ; [in/out] YMM with 2 AES states
+%define %%KEY                   %2      ; [in] YMM with last round key broadcast
+%define %%T1                    %3      ; [clobbered] YMM temporary
+%define %%T2                    %4      ; [clobbered] YMM temporary
+%define %%CYPH_PLAIN_OUT        %5      ; [in] output pointer
+%define %%PLAIN_CYPH_IN         %6      ; [in] input pointer
+%define %%DATA_OFFSET           %7      ; [in] data offset
+%define %%PAIR                  %8      ; [in] pair index (0 to 3)
+%define %%ENC_DEC               %9      ; [in] ENC/DEC selector
+%define %%PARTIAL               %10     ; [in] "partial" for the last pair with a partial block
+
+%ifidn %%PARTIAL, partial
+        ;; Block 7: key XOR input, block 8: key only
+    %ifdef  NT_LD
+        VXLDR   XWORD(%%T1), [%%PLAIN_CYPH_IN + %%DATA_OFFSET + 32*%%PAIR]
+        vpxor   XWORD(%%T1), XWORD(%%T1), XWORD(%%KEY)
+    %else
+        vpxor   XWORD(%%T1), XWORD(%%KEY), [%%PLAIN_CYPH_IN + %%DATA_OFFSET + 32*%%PAIR]
+    %endif
+        vinserti128     %%T1, %%T1, XWORD(%%KEY), 1
+
+    %ifidn %%ENC_DEC, ENC
+        vaesenclast     %%STATE, %%STATE, %%T1
+        ;; Avoid writing past the buffer if handling a partial block
+        VXSTR   [%%CYPH_PLAIN_OUT + %%DATA_OFFSET + 32*%%PAIR], XWORD(%%STATE)
+    %else
+        vaesenclast     %%T2, %%STATE, %%T1
+        VXSTR   [%%CYPH_PLAIN_OUT + %%DATA_OFFSET + 32*%%PAIR], XWORD(%%T2)
+        ;; ciphertext of block 7 and the encrypted counter of block 8
+        vpxor           %%T1, %%T1, %%KEY
+        vpblendd        %%STATE, %%T1, %%T2, 0xf0
+    %endif
+%else
+    %ifdef  NT_LD
+        VXLDR   %%T1, [%%PLAIN_CYPH_IN + %%DATA_OFFSET + 32*%%PAIR]
+        vpxor   %%T1, %%T1, %%KEY
+    %else
+        vpxor   %%T1, %%KEY, [%%PLAIN_CYPH_IN + %%DATA_OFFSET + 32*%%PAIR]
+    %endif
+
+    %ifidn %%ENC_DEC, ENC
+        vaesenclast     %%STATE, %%STATE, %%T1
+        VXSTR   [%%CYPH_PLAIN_OUT + %%DATA_OFFSET + 32*%%PAIR], %%STATE
+    %else
+        vaesenclast     %%T2, %%STATE, %%T1
+        vpxor   %%STATE, %%T1, %%KEY
+        VXSTR   [%%CYPH_PLAIN_OUT + %%DATA_OFFSET + 32*%%PAIR], %%T2
+    %endif
+%endif
+%endmacro
+
+; encrypt 8 blocks at a time, 2 blocks per 256-bit VAES instruction
+; ghash the 8 previously encrypted ciphertext blocks, 2 blocks per 256-bit
+; VPCLMULQDQ instruction, with a single reduction for all 8 blocks
+; The interface is the same as for the 128-bit version below.
+; %%GDATA (KEY), %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN are used as pointers only, not modified
+; %%DATA_OFFSET is the data offset value
+%macro  GHASH_8_ENCRYPT_8_PARALLEL 23
+%define %%GDATA                 %1
+%define %%CYPH_PLAIN_OUT        %2
+%define %%PLAIN_CYPH_IN         %3
+%define %%DATA_OFFSET           %4
+%define %%T1    %5
+%define %%T2    %6
+%define %%T3    %7
+%define %%T4    %8
+%define %%T5    %9
+%define %%T6    %10
+%define %%CTR   %11
+%define %%XMM1  %12
+%define %%XMM2  %13
+%define %%XMM3  %14
+%define %%XMM4  %15
+%define %%XMM5  %16
+%define %%XMM6  %17
+%define %%XMM7  %18
+%define %%XMM8  %19
+%define %%T7    %20
+%define %%loop_idx      %21
+%define %%ENC_DEC       %22
+%define %%FULL_PARTIAL  %23
+
+        ;; Previous ciphertext blocks are packed in pairs into XMM1/3/5/7
+        ;; and new counter blocks are prepared in pairs in XMM2/4/6/8
+        vinserti128     YWORD(%%XMM1), YWORD(%%XMM1), %%XMM2, 1
+        vinserti128     YWORD(%%XMM3), YWORD(%%XMM3), %%XMM4, 1
+        vinserti128     YWORD(%%XMM5), YWORD(%%XMM5), %%XMM6, 1
+        vinserti128     YWORD(%%XMM7), YWORD(%%XMM7), %%XMM8, 1
+
+                vinserti128     YWORD(%%T5), YWORD(%%CTR), %%CTR, 1
+%ifidn %%loop_idx, in_order
+                vpaddd  YWORD(%%XMM2), YWORD(%%T5), [rel ddq_add_1234]
+                vpaddd  YWORD(%%XMM4), YWORD(%%T5), [rel ddq_add_1234 + 32]
+                vpaddd  YWORD(%%XMM6), YWORD(%%T5), [rel ddq_add_5678]
+                vpaddd  YWORD(%%XMM8), YWORD(%%T5), [rel ddq_add_5678 + 32]
+                vextracti128    %%CTR, YWORD(%%XMM8), 1
+
+                vmovdqa YWORD(%%T5), [rel SHUF_MASK]
+                vpshufb YWORD(%%XMM2), YWORD(%%XMM2), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM4), YWORD(%%XMM4), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM6), YWORD(%%XMM6), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM8), YWORD(%%XMM8), YWORD(%%T5)     ; perform a 16Byte swap
+%else
+                vpaddd  YWORD(%%XMM2), YWORD(%%T5), [rel ddq_addbe_1234]
+                vpaddd  YWORD(%%XMM4), YWORD(%%T5), [rel ddq_addbe_1234 + 32]
+                vpaddd  YWORD(%%XMM6), YWORD(%%T5), [rel ddq_addbe_5678]
+                vpaddd  YWORD(%%XMM8), YWORD(%%T5), [rel ddq_addbe_5678 + 32]
+                vextracti128    %%CTR, YWORD(%%XMM8), 1
+%endif
+
+        ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+                vbroadcasti128  YWORD(%%T1), [%%GDATA + 16*0]
+                vpxor   YWORD(%%XMM2), YWORD(%%XMM2), YWORD(%%T1)
+                vpxor   YWORD(%%XMM4), YWORD(%%XMM4), YWORD(%%T1)
+                vpxor   YWORD(%%XMM6), YWORD(%%XMM6), YWORD(%%T1)
+                vpxor   YWORD(%%XMM8), YWORD(%%XMM8), YWORD(%%T1)
+
+        ;; AES rounds interleaved with the GHASH of the previous 8 blocks:
+        ;; <T4:T7> accumulates the high/low products and T6 the middle ones
+%assign i 1
+%rep NROUNDS
+                vbroadcasti128  YWORD(%%T1), [%%GDATA + 16*i]
+                vaesenc YWORD(%%XMM2), YWORD(%%XMM2), YWORD(%%T1)
+                vaesenc YWORD(%%XMM4), YWORD(%%XMM4), YWORD(%%T1)
+                vaesenc YWORD(%%XMM6), YWORD(%%XMM6), YWORD(%%T1)
+                vaesenc YWORD(%%XMM8), YWORD(%%XMM8), YWORD(%%T1)
+
+%if i == 1
+        GHASH_SINGLE_MUL %%GDATA, HashKey_8, YWORD(%%XMM1), \
+                         YWORD(%%T4), YWORD(%%T7), YWORD(%%T6), \
+                         YWORD(%%T5), YWORD(%%T3), first
+%elif i == 2
+        GHASH_SINGLE_MUL %%GDATA, HashKey_6, YWORD(%%XMM3), \
+                         YWORD(%%T4), YWORD(%%T7), YWORD(%%T6), \
+                         YWORD(%%T5), YWORD(%%T3), not_first
+%elif i == 3
+        GHASH_SINGLE_MUL %%GDATA, HashKey_4, YWORD(%%XMM5), \
+                         YWORD(%%T4), YWORD(%%T7), YWORD(%%T6), \
+                         YWORD(%%T5), YWORD(%%T3), not_first
+%elif i == 4
+        GHASH_SINGLE_MUL %%GDATA, HashKey_2, YWORD(%%XMM7), \
+                         YWORD(%%T4), YWORD(%%T7), YWORD(%%T6), \
+                         YWORD(%%T5), YWORD(%%T3), not_first
+%elif i == 5
+        ;; fold the two lanes of the partial products
+        vextracti128    %%T3, YWORD(%%T4), 1
+        vpxor           %%T4, %%T4, %%T3
+        vextracti128    %%T3, YWORD(%%T7), 1
+        vpxor           %%T7, %%T7, %%T3
+        vextracti128    %%T3, YWORD(%%T6), 1
+        vpxor           %%T6, %%T6, %%T3
+
+        vpslldq         %%T3, %%T6, 8                           ; shift-L %%T3 2 DWs
+        vpsrldq         %%T6, %%T6, 8                           ; shift-R %%T6 2 DWs
+        vpxor           %%T7, %%T7, %%T3
+        vpxor           %%T4, %%T4, %%T6                        ; accumulate the results in %%T4:%%T7
+%elif i == 6
+        ;first phase of the reduction
+        vmovdqa         %%T3, [rel POLY2]
+
+        vpclmulqdq      %%T2, %%T3, %%T7, 0x01
+        vpslldq         %%T2, %%T2, 8                           ; shift-L %%T2 2 DWs
+
+        vpxor           %%T7, %%T7, %%T2                        ; first phase of the reduction complete
+%elif i == 7
+        ;second phase of the reduction
+        vpclmulqdq      %%T2, %%T3, %%T7, 0x00
+        vpsrldq         %%T2, %%T2, 4                           ; shift-R %%T2 1 DW (Shift-R only 1-DW to obtain 2-DWs shift-R)
+
+        vpclmulqdq      %%T6, %%T3, %%T7, 0x10
+        vpslldq         %%T6, %%T6, 4                           ; shift-L %%T6 1 DW (Shift-L 1-DW to obtain result with no shifts)
+
+        vpxor           %%T6, %%T6, %%T2                        ; second phase of the reduction complete
+        vpxor           %%T4, %%T4, %%T6                        ; the result is in %%T4
+%endif
+%assign i (i + 1)
+%endrep
+
+                vbroadcasti128  YWORD(%%T5), [%%GDATA + 16*(NROUNDS + 1)]
+
+        VAES_LAST_ROUND_X2 YWORD(%%XMM2), YWORD(%%T5), YWORD(%%T2), YWORD(%%T3), \
+                           %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN, %%DATA_OFFSET, 0, %%ENC_DEC, full
+        VAES_LAST_ROUND_X2 YWORD(%%XMM4), YWORD(%%T5), YWORD(%%T2), YWORD(%%T3), \
+                           %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN, %%DATA_OFFSET, 1, %%ENC_DEC, full
+        VAES_LAST_ROUND_X2 YWORD(%%XMM6), YWORD(%%T5), YWORD(%%T2), YWORD(%%T3), \
+                           %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN, %%DATA_OFFSET, 2, %%ENC_DEC, full
+        VAES_LAST_ROUND_X2 YWORD(%%XMM8), YWORD(%%T5), YWORD(%%T2), YWORD(%%T3), \
+                           %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN, %%DATA_OFFSET, 3, %%ENC_DEC, %%FULL_PARTIAL
+
+                vmovdqa YWORD(%%T5), [rel SHUF_MASK]
+                vpshufb YWORD(%%XMM2), YWORD(%%XMM2), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM4), YWORD(%%XMM4), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM6), YWORD(%%XMM6), YWORD(%%T5)     ; perform a 16Byte swap
+                vpshufb YWORD(%%XMM8), YWORD(%%XMM8), YWORD(%%T5)     ; perform a 16Byte swap
+
+        ;; unpack the pairs back to one block per register
+        vmovdqa         %%XMM1, %%XMM2
+        vextracti128    %%XMM2, YWORD(%%XMM2), 1
+        vmovdqa         %%XMM3, %%XMM4
+        vextracti128    %%XMM4, YWORD(%%XMM4), 1
+        vmovdqa         %%XMM5, %%XMM6
+        vextracti128    %%XMM6, YWORD(%%XMM6), 1
+        vmovdqa         %%XMM7, %%XMM8
+        vextracti128    %%XMM8, YWORD(%%XMM8), 1
+
+        vpxor   %%XMM1, %%XMM1, %%T4
+
+%endmacro                       ; GHASH_8_ENCRYPT_8_PARALLEL
+
+%else                           ; GCM_VAES_AVX2
+
 ; encrypt 8 blocks at a time
 ; ghash the 8 previously encrypted ciphertext blocks
 ; %%GDATA (KEY), %%CYPH_PLAIN_OUT, %%PLAIN_CYPH_IN are used as pointers only, not modified
@@ -1968,6 +2233,7 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
         vpxor   %%XMM1, %%T1
 
 %endmacro                       ; GHASH_8_ENCRYPT_8_PARALLEL
+%endif                          ; GCM_VAES_AVX2
 
 ; GHASH the last 4 ciphertext blocks.
 %macro  GHASH_LAST_8 16
@@ -1988,6 +2254,34 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
 %define %%XMM7  %15
 %define %%XMM8  %16
 
+%ifdef GCM_VAES_AVX2
+        ;; pack the blocks in pairs and multiply by adjacent hash key pairs
+        vinserti128     YWORD(%%XMM1), YWORD(%%XMM1), %%XMM2, 1
+        vinserti128     YWORD(%%XMM3), YWORD(%%XMM3), %%XMM4, 1
+        vinserti128     YWORD(%%XMM5), YWORD(%%XMM5), %%XMM6, 1
+        vinserti128     YWORD(%%XMM7), YWORD(%%XMM7), %%XMM8, 1
+
+        GHASH_SINGLE_MUL %%GDATA, HashKey_8, YWORD(%%XMM1), \
+                         YWORD(%%T6), YWORD(%%T7), YWORD(%%T2), \
+                         YWORD(%%T5), YWORD(%%T4), first
+        GHASH_SINGLE_MUL %%GDATA, HashKey_6, YWORD(%%XMM3), \
+                         YWORD(%%T6), YWORD(%%T7), YWORD(%%T2), \
+                         YWORD(%%T5), YWORD(%%T4), not_first
+        GHASH_SINGLE_MUL %%GDATA, HashKey_4, YWORD(%%XMM5), \
+                         YWORD(%%T6), YWORD(%%T7), YWORD(%%T2), \
+                         YWORD(%%T5), YWORD(%%T4), not_first
+        GHASH_SINGLE_MUL %%GDATA, HashKey_2, YWORD(%%XMM7), \
+                         YWORD(%%T6), YWORD(%%T7), YWORD(%%T2), \
+                         YWORD(%%T5), YWORD(%%T4), not_first
+
+        ;; fold the two lanes of the partial products
+        vextracti128    %%T4, YWORD(%%T6), 1
+        vpxor           %%T6, %%T6, %%T4
+        vextracti128    %%T4, YWORD(%%T7), 1
+        vpxor           %%T7, %%T7, %%T4
+        vextracti128    %%T4, YWORD(%%T2), 1
+        vpxor           %%T2, %%T2, %%T4
+%else
         ;; Karatsuba Method
 
         vmovdqu         %%T5, [%%GDATA + HashKey_8]
@@ -2129,6 +2423,7 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
         vpxor           %%XMM1, %%XMM1, %%T2
         vpxor           %%XMM1, %%XMM1, %%T6
         vpxor           %%T2, %%XMM1, %%T7
+%endif ; GCM_VAES_AVX2
 
         vpslldq %%T4, %%T2, 8
         vpsrldq %%T2, %%T2, 8
@@ -2488,6 +2783,9 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
         clear_scratch_gps_asm
         clear_scratch_ymms_asm
 %endif
+%ifdef GCM_VAES_AVX2
+        vzeroupper
+%endif
 %ifidn __OUTPUT_FORMAT__, win64
         vmovdqu xmm15, [rsp + LOCAL_STORAGE + 9*16]
         vmovdqu xmm14, [rsp + LOCAL_STORAGE + 8*16]
@@ -4277,15 +4575,15 @@ skip_aad_check_error_dec_IV:
 
 %ifdef GCM128_MODE
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-;void   ghash_avx_gen4
+;void   ghash_avx_gen4 / ghash_vaes_avx2
 ;        const struct gcm_key_data *key_data,
 ;        const void   *in,
 ;        const u64    in_len,
 ;        void         *io_tag,
 ;        const u64    tag_len);
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-MKGLOBAL(ghash_avx_gen4,function,)
-ghash_avx_gen4:
+MKGLOBAL(GHASH_FN_NAME,function,)
+GHASH_FN_NAME:
         endbranch64
         FUNC_SAVE
 
@@ -4453,7 +4751,7 @@ error_ghash:
 
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 ;void   imb_aes_gmac_update_128_avx_gen4 / imb_aes_gmac_update_192_avx_gen4 /
-;       imb_aes_gmac_update_256_avx_gen4
+;       imb_aes_gmac_update_256_avx_gen4 (or _vaes_avx2)
 ;        const struct gcm_key_data *key_data,
 ;        struct gcm_context_data *context_data,
 ;        const   u8 *in,
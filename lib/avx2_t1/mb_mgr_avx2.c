@@ -46,6 +46,8 @@
 #include "include/noaesni.h"
 #include "include/aesni_emu.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 
 #include "include/arch_sse_type1.h" /* poly1305 */
 #include "include/arch_avx_type1.h"
@@ -76,8 +78,8 @@
 #define SUBMIT_JOB_AES_ECB_256_ENC submit_job_aes_ecb_256_enc_avx2
 #define SUBMIT_JOB_AES_ECB_256_DEC submit_job_aes_ecb_256_dec_avx2
 
-#define SUBMIT_JOB_AES_CNTR   submit_job_aes_cntr_avx
-#define SUBMIT_JOB_AES_CNTR_BIT   submit_job_aes_cntr_bit_avx
+#define SUBMIT_JOB_AES_CNTR   submit_job_aes_cntr_avx2
+#define SUBMIT_JOB_AES_CNTR_BIT   submit_job_aes_cntr_bit_avx2
 
 #define SUBMIT_JOB_ZUC_EEA3   submit_job_zuc_eea3_avx2
 #define FLUSH_JOB_ZUC_EEA3    flush_job_zuc_eea3_avx2
@@ -88,16 +90,16 @@
 #define SUBMIT_JOB_ZUC256_EIA3   submit_job_zuc256_eia3_avx2
 #define FLUSH_JOB_ZUC256_EIA3    flush_job_zuc256_eia3_avx2
 
-#define AES_CBC_DEC_128       aes_cbc_dec_128_avx
-#define AES_CBC_DEC_192       aes_cbc_dec_192_avx
-#define AES_CBC_DEC_256       aes_cbc_dec_256_avx
+#define AES_CBC_DEC_128       aes_cbc_dec_128_avx2
+#define AES_CBC_DEC_192       aes_cbc_dec_192_avx2
+#define AES_CBC_DEC_256       aes_cbc_dec_256_avx2
 
-#define AES_CNTR_128       aes_cntr_128_avx
-#define AES_CNTR_192       aes_cntr_192_avx
-#define AES_CNTR_256       aes_cntr_256_avx
+#define AES_CNTR_128       aes_cntr_128_avx2
+#define AES_CNTR_192       aes_cntr_192_avx2
+#define AES_CNTR_256       aes_cntr_256_avx2
 
-#define AES_CNTR_CCM_128   aes_cntr_ccm_128_avx
-#define AES_CNTR_CCM_256   aes_cntr_ccm_256_avx
+#define AES_CNTR_CCM_128   aes_cntr_ccm_128_avx2
+#define AES_CNTR_CCM_256   aes_cntr_ccm_256_avx2
 
 #define AES_ECB_ENC_128       aes_ecb_enc_128_avx2
 #define AES_ECB_ENC_192       aes_ecb_enc_192_avx2
@@ -118,6 +120,13 @@
 #define AES_GCM_DEC_256   aes_gcm_dec_256_avx_gen4
 #define AES_GCM_ENC_256   aes_gcm_enc_256_avx_gen4
 
+#define AES_GCM_DEC_128_VAES aes_gcm_dec_128_vaes_avx2
+#define AES_GCM_ENC_128_VAES aes_gcm_enc_128_vaes_avx2
+#define AES_GCM_DEC_192_VAES aes_gcm_dec_192_vaes_avx2
+#define AES_GCM_ENC_192_VAES aes_gcm_enc_192_vaes_avx2
+#define AES_GCM_DEC_256_VAES aes_gcm_dec_256_vaes_avx2
+#define AES_GCM_ENC_256_VAES aes_gcm_enc_256_vaes_avx2
+
 #define AES_GCM_DEC_IV_128   aes_gcm_dec_var_iv_128_avx_gen4
 #define AES_GCM_ENC_IV_128   aes_gcm_enc_var_iv_128_avx_gen4
 #define AES_GCM_DEC_IV_192   aes_gcm_dec_var_iv_192_avx_gen4
@@ -125,9 +134,74 @@
 #define AES_GCM_DEC_IV_256   aes_gcm_dec_var_iv_256_avx_gen4
 #define AES_GCM_ENC_IV_256   aes_gcm_enc_var_iv_256_avx_gen4
 
+#define AES_GCM_DEC_IV_128_VAES aes_gcm_dec_var_iv_128_vaes_avx2
+#define AES_GCM_ENC_IV_128_VAES aes_gcm_enc_var_iv_128_vaes_avx2
+#define AES_GCM_DEC_IV_192_VAES aes_gcm_dec_var_iv_192_vaes_avx2
+#define AES_GCM_ENC_IV_192_VAES aes_gcm_enc_var_iv_192_vaes_avx2
+#define AES_GCM_DEC_IV_256_VAES aes_gcm_dec_var_iv_256_vaes_avx2
+#define AES_GCM_ENC_IV_256_VAES aes_gcm_enc_var_iv_256_vaes_avx2
+
 #define SUBMIT_JOB_AES_GCM_DEC submit_job_aes_gcm_dec_avx2
 #define SUBMIT_JOB_AES_GCM_ENC submit_job_aes_gcm_enc_avx2
 
+#define SUBMIT_JOB_AES128_GCM submit_job_aes128_gcm_avx2
+#define FLUSH_JOB_AES128_GCM  flush_job_aes128_gcm_avx2
+#define SUBMIT_JOB_AES192_GCM submit_job_aes192_gcm_avx2
+#define FLUSH_JOB_AES192_GCM  flush_job_aes192_gcm_avx2
+#define SUBMIT_JOB_AES256_GCM submit_job_aes256_gcm_avx2
+#define FLUSH_JOB_AES256_GCM  flush_job_aes256_gcm_avx2
+
+#define SUBMIT_JOB_AES128_XTS_ENC  submit_job_aes128_xts_enc_avx2
+#define FLUSH_JOB_AES128_XTS_ENC   flush_job_aes128_xts_enc_avx2
+#define SUBMIT_JOB_AES128_XTS_DEC  submit_job_aes128_xts_dec_avx2
+#define FLUSH_JOB_AES128_XTS_DEC   flush_job_aes128_xts_dec_avx2
+#define SUBMIT_JOB_AES256_XTS_ENC  submit_job_aes256_xts_enc_avx2
+#define FLUSH_JOB_AES256_XTS_ENC   flush_job_aes256_xts_enc_avx2
+#define SUBMIT_JOB_AES256_XTS_DEC  submit_job_aes256_xts_dec_avx2
+#define FLUSH_JOB_AES256_XTS_DEC   flush_job_aes256_xts_dec_avx2
+
+#define SUBMIT_JOB_AES128_CFB_ENC  submit_job_aes128_cfb_enc_avx
+#define FLUSH_JOB_AES128_CFB_ENC   flush_job_aes128_cfb_enc_avx
+#define SUBMIT_JOB_AES128_CFB_DEC  submit_job_aes128_cfb_dec_avx
+#define SUBMIT_JOB_AES192_CFB_ENC  submit_job_aes192_cfb_enc_avx
+#define FLUSH_JOB_AES192_CFB_ENC   flush_job_aes192_cfb_enc_avx
+#define SUBMIT_JOB_AES192_CFB_DEC  submit_job_aes192_cfb_dec_avx
+#define SUBMIT_JOB_AES256_CFB_ENC  submit_job_aes256_cfb_enc_avx
+#define FLUSH_JOB_AES256_CFB_ENC   flush_job_aes256_cfb_enc_avx
+#define SUBMIT_JOB_AES256_CFB_DEC  submit_job_aes256_cfb_dec_avx
+
+#define SUBMIT_JOB_DES_CBC_ENC submit_job_des_cbc_enc_avx
+#define FLUSH_JOB_DES_CBC_ENC  flush_job_des_cbc_enc_avx
+
+#define SUBMIT_JOB_DES_CBC_DEC submit_job_des_cbc_dec_avx
+#define FLUSH_JOB_DES_CBC_DEC  flush_job_des_cbc_dec_avx
+
+#define SUBMIT_JOB_3DES_CBC_ENC submit_job_3des_cbc_enc_avx
+#define FLUSH_JOB_3DES_CBC_ENC  flush_job_3des_cbc_enc_avx
+
+#define SUBMIT_JOB_3DES_CBC_DEC submit_job_3des_cbc_dec_avx
+#define FLUSH_JOB_3DES_CBC_DEC  flush_job_3des_cbc_dec_avx
+
+#define SUBMIT_JOB_DOCSIS_DES_ENC submit_job_docsis_des_enc_avx
+#define FLUSH_JOB_DOCSIS_DES_ENC  flush_job_docsis_des_enc_avx
+
+#define SUBMIT_JOB_DOCSIS_DES_DEC submit_job_docsis_des_dec_avx
+#define FLUSH_JOB_DOCSIS_DES_DEC  flush_job_docsis_des_dec_avx
+
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_1   submit_job_aes_cbc_hmac_sha_1_avx2
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_1    flush_job_aes_cbc_hmac_sha_1_avx2
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_256 submit_job_aes_cbc_hmac_sha_256_avx2
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_256  flush_job_aes_cbc_hmac_sha_256_avx2
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_1   submit_job_aes_ctr_hmac_sha_1_avx2
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_1    flush_job_aes_ctr_hmac_sha_1_avx2
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_256 submit_job_aes_ctr_hmac_sha_256_avx2
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_256  flush_job_aes_ctr_hmac_sha_256_avx2
+#define SUBMIT_JOB_AES_CTR_CMAC         submit_job_aes_ctr_cmac_avx
+#define FLUSH_JOB_AES_CTR_CMAC          flush_job_aes_ctr_cmac_avx
+
+#define SUBMIT_JOB_CRC                  submit_job_crc_avx
+#define FLUSH_JOB_CRC                   flush_job_crc_avx
+
 #define SUBMIT_JOB_AES_XCBC   submit_job_aes_xcbc_avx
 #define FLUSH_JOB_AES_XCBC    flush_job_aes_xcbc_avx
 
@@ -156,9 +230,21 @@
 #define SUBMIT_JOB_CHACHA20_POLY1305_SGL aead_chacha20_poly1305_sgl_avx2
 #define POLY1305_MAC poly1305_mac_scalar
 
+#define SUBMIT_JOB_CHACHA20_MB submit_job_chacha20_mb_avx2
+#define FLUSH_JOB_CHACHA20_MB  flush_job_chacha20_mb_avx2
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB submit_job_chacha20_poly1305_mb_avx2
+#define FLUSH_JOB_CHACHA20_POLY1305_MB  flush_job_chacha20_poly1305_mb_avx2
+#define SUBMIT_JOB_POLY1305_MB submit_job_poly1305_mb_avx2
+#define FLUSH_JOB_POLY1305_MB  flush_job_poly1305_mb_avx2
+
 #define SUBMIT_JOB_SNOW_V snow_v_avx
 #define SUBMIT_JOB_SNOW_V_AEAD snow_v_aead_init_avx
 
+#define SUBMIT_JOB_SNOW_V_MB         submit_job_snow_v_mb_avx2
+#define FLUSH_JOB_SNOW_V_MB          flush_job_snow_v_mb_avx2
+#define SUBMIT_JOB_SNOW_V_AEAD_MB    submit_job_snow_v_aead_mb_avx2
+#define FLUSH_JOB_SNOW_V_AEAD_MB     flush_job_snow_v_aead_mb_avx2
+
 #define SUBMIT_JOB_HMAC               submit_job_hmac_avx2
 #define FLUSH_JOB_HMAC                flush_job_hmac_avx2
 #define SUBMIT_JOB_HMAC_SHA_224       submit_job_hmac_sha_224_avx2
@@ -196,6 +282,8 @@
 
 #define AES_CFB_128_ONE    aes_cfb_128_one_avx2
 #define AES_CFB_256_ONE    aes_cfb_256_one_avx2
+#define AES_CBC_ENC_128_MB aes_cbc_enc_128_x8
+#define AES_CBC_ENC_256_MB aes_cbc_enc_256_x8
 
 #define AES128_CBC_MAC     aes128_cbc_mac_x8
 
@@ -262,11 +350,190 @@ static void
 
 /* ====================================================================== */
 
+/*
+ * AES-CBC decrypt, AES-CTR and AES-CCM (cipher) function pointers
+ */
+static void
+(*aes_cbc_dec_128_avx2) (const void *in, const uint8_t *IV,
+                const void *keys, void *out, uint64_t len_bytes) =
+                aes_cbc_dec_128_avx;
+
+static void
+(*aes_cbc_dec_192_avx2) (const void *in, const uint8_t *IV,
+                const void *keys, void *out, uint64_t len_bytes) =
+                aes_cbc_dec_192_avx;
+
+static void
+(*aes_cbc_dec_256_avx2) (const void *in, const uint8_t *IV,
+                const void *keys, void *out, uint64_t len_bytes) =
+                aes_cbc_dec_256_avx;
+
+static void
+(*aes_cntr_128_avx2) (const void *in, const void *IV, const void *keys,
+                void *out, uint64_t len_bytes, uint64_t IV_len) =
+                aes_cntr_128_avx;
+
+static void
+(*aes_cntr_192_avx2) (const void *in, const void *IV, const void *keys,
+                void *out, uint64_t len_bytes, uint64_t IV_len) =
+                aes_cntr_192_avx;
+
+static void
+(*aes_cntr_256_avx2) (const void *in, const void *IV, const void *keys,
+                void *out, uint64_t len_bytes, uint64_t IV_len) =
+                aes_cntr_256_avx;
+
+static IMB_JOB *
+(*aes_cntr_ccm_128_avx2) (IMB_JOB *job) = aes_cntr_ccm_128_avx;
+
+static IMB_JOB *
+(*aes_cntr_ccm_256_avx2) (IMB_JOB *job) = aes_cntr_ccm_256_avx;
+
+static IMB_JOB *(*submit_job_aes_cntr_avx2)
+        (IMB_JOB *job) = submit_job_aes_cntr_avx;
+static IMB_JOB *(*submit_job_aes_cntr_bit_avx2)
+        (IMB_JOB *job) = submit_job_aes_cntr_bit_avx;
+
+static IMB_JOB *
+vaes_submit_cntr_avx2(IMB_JOB *job)
+{
+        const uint8_t *src = job->src + job->cipher_start_src_offset_in_bytes;
+
+        if (16 == job->key_len_in_bytes)
+                aes_cntr_128_vaes_avx2(src, job->iv, job->enc_keys,
+                                       job->dst,
+                                       job->msg_len_to_cipher_in_bytes,
+                                       job->iv_len_in_bytes);
+        else if (24 == job->key_len_in_bytes)
+                aes_cntr_192_vaes_avx2(src, job->iv, job->enc_keys,
+                                       job->dst,
+                                       job->msg_len_to_cipher_in_bytes,
+                                       job->iv_len_in_bytes);
+        else /* assume 32 bytes */
+                aes_cntr_256_vaes_avx2(src, job->iv, job->enc_keys,
+                                       job->dst,
+                                       job->msg_len_to_cipher_in_bytes,
+                                       job->iv_len_in_bytes);
+
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+        return job;
+}
+
+static IMB_JOB *
+vaes_submit_cntr_bit_avx2(IMB_JOB *job)
+{
+        const uint8_t *src = job->src + job->cipher_start_src_offset_in_bytes;
+
+        if (16 == job->key_len_in_bytes)
+                aes_cntr_bit_128_vaes_avx2(src, job->iv, job->enc_keys,
+                                           job->dst,
+                                           job->msg_len_to_cipher_in_bits,
+                                           job->iv_len_in_bytes);
+        else if (24 == job->key_len_in_bytes)
+                aes_cntr_bit_192_vaes_avx2(src, job->iv, job->enc_keys,
+                                           job->dst,
+                                           job->msg_len_to_cipher_in_bits,
+                                           job->iv_len_in_bytes);
+        else /* assume 32 bytes */
+                aes_cntr_bit_256_vaes_avx2(src, job->iv, job->enc_keys,
+                                           job->dst,
+                                           job->msg_len_to_cipher_in_bits,
+                                           job->iv_len_in_bytes);
+
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+        return job;
+}
+
+/* ====================================================================== */
+
+/*
+ * AES-XTS function pointers
+ */
+static IMB_JOB *
+(*submit_job_aes128_xts_enc_avx2)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes128_xts_enc_avx;
+
+static IMB_JOB *
+(*flush_job_aes128_xts_enc_avx2)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes128_xts_enc_avx;
+
+static IMB_JOB *
+(*submit_job_aes128_xts_dec_avx2)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes128_xts_dec_avx;
+
+static IMB_JOB *
+(*flush_job_aes128_xts_dec_avx2)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes128_xts_dec_avx;
+
+static IMB_JOB *
+(*submit_job_aes256_xts_enc_avx2)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes256_xts_enc_avx;
+
+static IMB_JOB *
+(*flush_job_aes256_xts_enc_avx2)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes256_xts_enc_avx;
+
+static IMB_JOB *
+(*submit_job_aes256_xts_dec_avx2)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes256_xts_dec_avx;
+
+static IMB_JOB *
+(*flush_job_aes256_xts_dec_avx2)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes256_xts_dec_avx;
+
+/* ====================================================================== */
+
+/*
+ * ZUC-EEA3/EIA3 function pointers
+ */
+static IMB_JOB *
+(*submit_job_zuc_eea3_avx2)
+        (MB_MGR_ZUC_OOO *state, IMB_JOB *job) =
+                        submit_job_zuc_eea3_no_gfni_avx2;
+
+static IMB_JOB *
+(*flush_job_zuc_eea3_avx2)
+        (MB_MGR_ZUC_OOO *state) = flush_job_zuc_eea3_no_gfni_avx2;
+
+static IMB_JOB *
+(*submit_job_zuc_eia3_avx2)
+        (MB_MGR_ZUC_OOO *state, IMB_JOB *job) =
+                        submit_job_zuc_eia3_no_gfni_avx2;
+
+static IMB_JOB *
+(*flush_job_zuc_eia3_avx2)
+        (MB_MGR_ZUC_OOO *state) = flush_job_zuc_eia3_no_gfni_avx2;
+
+static IMB_JOB *
+(*submit_job_zuc256_eea3_avx2)
+        (MB_MGR_ZUC_OOO *state, IMB_JOB *job) =
+                        submit_job_zuc256_eea3_no_gfni_avx2;
+
+static IMB_JOB *
+(*flush_job_zuc256_eea3_avx2)
+        (MB_MGR_ZUC_OOO *state) = flush_job_zuc256_eea3_no_gfni_avx2;
+
+static IMB_JOB *
+(*submit_job_zuc256_eia3_avx2)
+        (MB_MGR_ZUC_OOO *state, IMB_JOB *job, const uint64_t tag_sz) =
+                        submit_job_zuc256_eia3_no_gfni_avx2;
+
+static IMB_JOB *
+(*flush_job_zuc256_eia3_avx2)
+        (MB_MGR_ZUC_OOO *state, const uint64_t tag_sz) =
+                        flush_job_zuc256_eia3_no_gfni_avx2;
+
+/* ====================================================================== */
+
 /*
  * GCM submit / flush API for AVX2 arch
  */
 static IMB_JOB *
-submit_job_aes_gcm_dec_avx2(IMB_MGR *state, IMB_JOB *job)
+plain_submit_gcm_dec_avx2(IMB_MGR *state, IMB_JOB *job)
 {
         DECLARE_ALIGNED(struct gcm_context_data ctx, 16);
         (void) state;
@@ -311,7 +578,7 @@ submit_job_aes_gcm_dec_avx2(IMB_MGR *state, IMB_JOB *job)
 }
 
 static IMB_JOB *
-submit_job_aes_gcm_enc_avx2(IMB_MGR *state, IMB_JOB *job)
+plain_submit_gcm_enc_avx2(IMB_MGR *state, IMB_JOB *job)
 {
         DECLARE_ALIGNED(struct gcm_context_data ctx, 16);
         (void) state;
@@ -355,6 +622,100 @@ submit_job_aes_gcm_enc_avx2(IMB_MGR *state, IMB_JOB *job)
         return job;
 }
 
+static IMB_JOB *
+vaes_submit_gcm_dec_avx2(IMB_MGR *state, IMB_JOB *job)
+{
+        DECLARE_ALIGNED(struct gcm_context_data ctx, 16);
+        (void) state;
+
+        if (16 == job->key_len_in_bytes)
+                AES_GCM_DEC_IV_128_VAES(job->dec_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+        else if (24 == job->key_len_in_bytes)
+                AES_GCM_DEC_IV_192_VAES(job->dec_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+        else /* assume 32 bytes */
+                AES_GCM_DEC_IV_256_VAES(job->dec_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+
+        job->status = IMB_STATUS_COMPLETED;
+        return job;
+}
+
+static IMB_JOB *
+vaes_submit_gcm_enc_avx2(IMB_MGR *state, IMB_JOB *job)
+{
+        DECLARE_ALIGNED(struct gcm_context_data ctx, 16);
+        (void) state;
+
+        if (16 == job->key_len_in_bytes)
+                AES_GCM_ENC_IV_128_VAES(job->enc_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+        else if (24 == job->key_len_in_bytes)
+                AES_GCM_ENC_IV_192_VAES(job->enc_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+        else /* assume 32 bytes */
+                AES_GCM_ENC_IV_256_VAES(job->enc_keys, &ctx,
+                                        job->dst,
+                                        job->src +
+                                        job->cipher_start_src_offset_in_bytes,
+                                        job->msg_len_to_cipher_in_bytes,
+                                        job->iv, job->iv_len_in_bytes,
+                                        job->u.GCM.aad,
+                                        job->u.GCM.aad_len_in_bytes,
+                                        job->auth_tag_output,
+                                        job->auth_tag_output_len_in_bytes);
+
+        job->status = IMB_STATUS_COMPLETED;
+        return job;
+}
+
+static IMB_JOB *(*submit_job_aes_gcm_enc_avx2)
+        (IMB_MGR *state, IMB_JOB *job) = plain_submit_gcm_enc_avx2;
+
+static IMB_JOB *(*submit_job_aes_gcm_dec_avx2)
+        (IMB_MGR *state, IMB_JOB *job) = plain_submit_gcm_dec_avx2;
+
 /* ====================================================================== */
 
 static void
@@ -408,6 +769,57 @@ reset_ooo_mgrs(IMB_MGR *state)
         ooo_mgr_ccm_reset(state->aes_ccm_ooo, 8);
         ooo_mgr_ccm_reset(state->aes256_ccm_ooo, 8);
 
+        /* Init AES-GCM out-of-order fields */
+        ooo_mgr_gcm_reset(state->aes128_gcm_ooo, AVX2_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes192_gcm_ooo, AVX2_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes256_gcm_ooo, AVX2_NUM_GCM_LANES);
+
+        /* Init AES-XTS out-of-order fields */
+        ooo_mgr_aes_xts_reset(state->aes128_xts_enc_ooo, AVX2_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes128_xts_dec_ooo, AVX2_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_enc_ooo, AVX2_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_dec_ooo, AVX2_NUM_XTS_LANES);
+
+        /* Init AES-CFB out-of-order fields */
+        ooo_mgr_aes_cfb_reset(state->aes128_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes192_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes256_cfb_ooo, AVX_NUM_CFB_LANES);
+
+        /* DES, 3DES and DOCSIS DES (DES CBC + DES CFB for partial block) */
+        ooo_mgr_des_reset(state->des_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des_dec_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_dec_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_enc_ooo, AVX_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_dec_ooo, AVX_NUM_DES_LANES);
+
+        /* Stitched AES-CBC/CTR + HMAC-SHA1/SHA256 and AES-CTR + AES-CMAC */
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_1_ooo,
+                                   AVX2_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_256_ooo,
+                                   AVX2_NUM_SHA256_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_1_ooo,
+                                   AVX2_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_256_ooo,
+                                   AVX2_NUM_SHA256_LANES);
+        ooo_mgr_aes_ctr_cmac_reset(state->aes_ctr_cmac_ooo,
+                                   AVX_NUM_CTR_CMAC_LANES);
+
+        /* CRC */
+        ooo_mgr_crc_reset(state->crc_ooo, AVX_NUM_CRC_LANES);
+
+        /* Init ChaCha20, ChaCha20-Poly1305 and Poly1305 out-of-order fields */
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_ooo,
+                                        AVX2_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_poly1305_ooo,
+                                        AVX2_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->poly1305_ooo,
+                                        AVX2_NUM_CHACHA20_LANES);
+
+        /* Init SNOW-V and SNOW-V-AEAD out-of-order fields */
+        ooo_mgr_snow_v_reset(state->snow_v_ooo, AVX2_NUM_SNOW_V_LANES);
+        ooo_mgr_snow_v_reset(state->snow_v_aead_ooo, AVX2_NUM_SNOW_V_LANES);
+
         /* Init AES-CMAC auth out-of-order fields */
         ooo_mgr_cmac_reset(state->aes_cmac_ooo, 8);
         ooo_mgr_cmac_reset(state->aes256_cmac_ooo, 8);
@@ -469,14 +881,58 @@ init_mb_mgr_avx2_internal(IMB_MGR *state, const int reset_mgrs)
                 aes_ecb_dec_128_avx2 = aes_ecb_dec_128_vaes_avx2;
                 aes_ecb_dec_192_avx2 = aes_ecb_dec_192_vaes_avx2;
                 aes_ecb_dec_256_avx2 = aes_ecb_dec_256_vaes_avx2;
+
+                aes_cbc_dec_128_avx2 = aes_cbc_dec_128_vaes_avx2;
+                aes_cbc_dec_192_avx2 = aes_cbc_dec_192_vaes_avx2;
+                aes_cbc_dec_256_avx2 = aes_cbc_dec_256_vaes_avx2;
+                aes_cntr_128_avx2 = aes_cntr_128_vaes_avx2;
+                aes_cntr_192_avx2 = aes_cntr_192_vaes_avx2;
+                aes_cntr_256_avx2 = aes_cntr_256_vaes_avx2;
+                aes_cntr_ccm_128_avx2 = aes_cntr_ccm_128_vaes_avx2;
+                aes_cntr_ccm_256_avx2 = aes_cntr_ccm_256_vaes_avx2;
+                submit_job_aes_cntr_avx2 = vaes_submit_cntr_avx2;
+                submit_job_aes_cntr_bit_avx2 = vaes_submit_cntr_bit_avx2;
+
+                submit_job_aes128_xts_enc_avx2 =
+                        submit_job_aes128_xts_enc_vaes_avx2;
+                flush_job_aes128_xts_enc_avx2 =
+                        flush_job_aes128_xts_enc_vaes_avx2;
+                submit_job_aes128_xts_dec_avx2 =
+                        submit_job_aes128_xts_dec_vaes_avx2;
+                flush_job_aes128_xts_dec_avx2 =
+                        flush_job_aes128_xts_dec_vaes_avx2;
+                submit_job_aes256_xts_enc_avx2 =
+                        submit_job_aes256_xts_enc_vaes_avx2;
+                flush_job_aes256_xts_enc_avx2 =
+                        flush_job_aes256_xts_enc_vaes_avx2;
+                submit_job_aes256_xts_dec_avx2 =
+                        submit_job_aes256_xts_dec_vaes_avx2;
+                flush_job_aes256_xts_dec_avx2 =
+                        flush_job_aes256_xts_dec_vaes_avx2;
+        }
+
+        if ((state->features & (IMB_FEATURE_GFNI | IMB_FEATURE_VAES)) ==
+            (IMB_FEATURE_GFNI | IMB_FEATURE_VAES)) {
+                submit_job_zuc_eea3_avx2 = submit_job_zuc_eea3_gfni_avx2;
+                flush_job_zuc_eea3_avx2 = flush_job_zuc_eea3_gfni_avx2;
+                submit_job_zuc_eia3_avx2 = submit_job_zuc_eia3_gfni_avx2;
+                flush_job_zuc_eia3_avx2 = flush_job_zuc_eia3_gfni_avx2;
+                submit_job_zuc256_eea3_avx2 =
+                        submit_job_zuc256_eea3_gfni_avx2;
+                flush_job_zuc256_eea3_avx2 = flush_job_zuc256_eea3_gfni_avx2;
+                submit_job_zuc256_eia3_avx2 =
+                        submit_job_zuc256_eia3_gfni_avx2;
+                flush_job_zuc256_eia3_avx2 = flush_job_zuc256_eia3_gfni_avx2;
         }
 
         if (reset_mgrs) {
                 reset_ooo_mgrs(state);
+                reset_ooo_stats(state);
 
                 /* Init "in order" components */
                 state->next_job = 0;
                 state->earliest_job = -1;
+                completion_ring_reset(state);
         }
 
         /* set handlers */
@@ -514,9 +970,15 @@ init_mb_mgr_avx2_internal(IMB_MGR *state, const int reset_mgrs)
 
         state->eea3_1_buffer       = zuc_eea3_1_buffer_avx2;
         state->eea3_4_buffer       = zuc_eea3_4_buffer_avx;
-        state->eea3_n_buffer       = zuc_eea3_n_buffer_avx2;
         state->eia3_1_buffer       = zuc_eia3_1_buffer_avx2;
-        state->eia3_n_buffer       = zuc_eia3_n_buffer_avx2;
+        if ((state->features & (IMB_FEATURE_GFNI | IMB_FEATURE_VAES)) ==
+            (IMB_FEATURE_GFNI | IMB_FEATURE_VAES)) {
+                state->eea3_n_buffer       = zuc_eea3_n_buffer_gfni_avx2;
+                state->eia3_n_buffer       = zuc_eia3_n_buffer_gfni_avx2;
+        } else {
+                state->eea3_n_buffer       = zuc_eea3_n_buffer_avx2;
+                state->eia3_n_buffer       = zuc_eia3_n_buffer_avx2;
+        }
 
         state->f8_1_buffer         = kasumi_f8_1_buffer_avx;
         state->f8_1_buffer_bit     = kasumi_f8_1_buffer_bit_avx;
@@ -542,48 +1004,100 @@ init_mb_mgr_avx2_internal(IMB_MGR *state, const int reset_mgrs)
         state->snow3g_init_key_sched = snow3g_init_key_sched_avx2;
         state->snow3g_key_sched_size = snow3g_key_sched_size_avx2;
 
-        state->gcm128_enc          = aes_gcm_enc_128_avx_gen4;
-        state->gcm192_enc          = aes_gcm_enc_192_avx_gen4;
-        state->gcm256_enc          = aes_gcm_enc_256_avx_gen4;
-        state->gcm128_dec          = aes_gcm_dec_128_avx_gen4;
-        state->gcm192_dec          = aes_gcm_dec_192_avx_gen4;
-        state->gcm256_dec          = aes_gcm_dec_256_avx_gen4;
-        state->gcm128_init         = aes_gcm_init_128_avx_gen4;
-        state->gcm192_init         = aes_gcm_init_192_avx_gen4;
-        state->gcm256_init         = aes_gcm_init_256_avx_gen4;
-        state->gcm128_init_var_iv  = aes_gcm_init_var_iv_128_avx_gen4;
-        state->gcm192_init_var_iv  = aes_gcm_init_var_iv_192_avx_gen4;
-        state->gcm256_init_var_iv  = aes_gcm_init_var_iv_256_avx_gen4;
-        state->gcm128_enc_update   = aes_gcm_enc_128_update_avx_gen4;
-        state->gcm192_enc_update   = aes_gcm_enc_192_update_avx_gen4;
-        state->gcm256_enc_update   = aes_gcm_enc_256_update_avx_gen4;
-        state->gcm128_dec_update   = aes_gcm_dec_128_update_avx_gen4;
-        state->gcm192_dec_update   = aes_gcm_dec_192_update_avx_gen4;
-        state->gcm256_dec_update   = aes_gcm_dec_256_update_avx_gen4;
-        state->gcm128_enc_finalize = aes_gcm_enc_128_finalize_avx_gen4;
-        state->gcm192_enc_finalize = aes_gcm_enc_192_finalize_avx_gen4;
-        state->gcm256_enc_finalize = aes_gcm_enc_256_finalize_avx_gen4;
-        state->gcm128_dec_finalize = aes_gcm_dec_128_finalize_avx_gen4;
-        state->gcm192_dec_finalize = aes_gcm_dec_192_finalize_avx_gen4;
-        state->gcm256_dec_finalize = aes_gcm_dec_256_finalize_avx_gen4;
-        state->gcm128_precomp      = aes_gcm_precomp_128_avx_gen4;
-        state->gcm192_precomp      = aes_gcm_precomp_192_avx_gen4;
-        state->gcm256_precomp      = aes_gcm_precomp_256_avx_gen4;
-        state->gcm128_pre          = aes_gcm_pre_128_avx_gen4;
-        state->gcm192_pre          = aes_gcm_pre_192_avx_gen4;
-        state->gcm256_pre          = aes_gcm_pre_256_avx_gen4;
-        state->ghash               = ghash_avx_gen4;
-        state->ghash_pre           = ghash_pre_avx_gen2;
-
-        state->gmac128_init        = imb_aes_gmac_init_128_avx_gen4;
-        state->gmac192_init        = imb_aes_gmac_init_192_avx_gen4;
-        state->gmac256_init        = imb_aes_gmac_init_256_avx_gen4;
-        state->gmac128_update      = imb_aes_gmac_update_128_avx_gen4;
-        state->gmac192_update      = imb_aes_gmac_update_192_avx_gen4;
-        state->gmac256_update      = imb_aes_gmac_update_256_avx_gen4;
-        state->gmac128_finalize    = imb_aes_gmac_finalize_128_avx_gen4;
-        state->gmac192_finalize    = imb_aes_gmac_finalize_192_avx_gen4;
-        state->gmac256_finalize    = imb_aes_gmac_finalize_256_avx_gen4;
+        if ((state->features & (IMB_FEATURE_VAES | IMB_FEATURE_VPCLMULQDQ)) ==
+            (IMB_FEATURE_VAES | IMB_FEATURE_VPCLMULQDQ)) {
+                state->gcm128_enc          = aes_gcm_enc_128_vaes_avx2;
+                state->gcm192_enc          = aes_gcm_enc_192_vaes_avx2;
+                state->gcm256_enc          = aes_gcm_enc_256_vaes_avx2;
+                state->gcm128_dec          = aes_gcm_dec_128_vaes_avx2;
+                state->gcm192_dec          = aes_gcm_dec_192_vaes_avx2;
+                state->gcm256_dec          = aes_gcm_dec_256_vaes_avx2;
+                state->gcm128_init         = aes_gcm_init_128_vaes_avx2;
+                state->gcm192_init         = aes_gcm_init_192_vaes_avx2;
+                state->gcm256_init         = aes_gcm_init_256_vaes_avx2;
+                state->gcm128_init_var_iv  = aes_gcm_init_var_iv_128_vaes_avx2;
+                state->gcm192_init_var_iv  = aes_gcm_init_var_iv_192_vaes_avx2;
+                state->gcm256_init_var_iv  = aes_gcm_init_var_iv_256_vaes_avx2;
+                state->gcm128_enc_update   = aes_gcm_enc_128_update_vaes_avx2;
+                state->gcm192_enc_update   = aes_gcm_enc_192_update_vaes_avx2;
+                state->gcm256_enc_update   = aes_gcm_enc_256_update_vaes_avx2;
+                state->gcm128_dec_update   = aes_gcm_dec_128_update_vaes_avx2;
+                state->gcm192_dec_update   = aes_gcm_dec_192_update_vaes_avx2;
+                state->gcm256_dec_update   = aes_gcm_dec_256_update_vaes_avx2;
+                state->gcm128_enc_finalize = aes_gcm_enc_128_finalize_vaes_avx2;
+                state->gcm192_enc_finalize = aes_gcm_enc_192_finalize_vaes_avx2;
+                state->gcm256_enc_finalize = aes_gcm_enc_256_finalize_vaes_avx2;
+                state->gcm128_dec_finalize = aes_gcm_dec_128_finalize_vaes_avx2;
+                state->gcm192_dec_finalize = aes_gcm_dec_192_finalize_vaes_avx2;
+                state->gcm256_dec_finalize = aes_gcm_dec_256_finalize_vaes_avx2;
+                state->gcm128_precomp      = aes_gcm_precomp_128_vaes_avx2;
+                state->gcm192_precomp      = aes_gcm_precomp_192_vaes_avx2;
+                state->gcm256_precomp      = aes_gcm_precomp_256_vaes_avx2;
+                state->gcm128_pre          = aes_gcm_pre_128_avx_gen4;
+                state->gcm192_pre          = aes_gcm_pre_192_avx_gen4;
+                state->gcm256_pre          = aes_gcm_pre_256_avx_gen4;
+                state->ghash               = ghash_vaes_avx2;
+                state->ghash_pre           = ghash_pre_avx_gen2;
+
+                submit_job_aes_gcm_enc_avx2 = vaes_submit_gcm_enc_avx2;
+                submit_job_aes_gcm_dec_avx2 = vaes_submit_gcm_dec_avx2;
+
+                state->gmac128_init        = imb_aes_gmac_init_128_avx_gen4;
+                state->gmac192_init        = imb_aes_gmac_init_192_avx_gen4;
+                state->gmac256_init        = imb_aes_gmac_init_256_avx_gen4;
+                state->gmac128_update      = imb_aes_gmac_update_128_vaes_avx2;
+                state->gmac192_update      = imb_aes_gmac_update_192_vaes_avx2;
+                state->gmac256_update      = imb_aes_gmac_update_256_vaes_avx2;
+                state->gmac128_finalize    = imb_aes_gmac_finalize_128_avx_gen4;
+                state->gmac192_finalize    = imb_aes_gmac_finalize_192_avx_gen4;
+                state->gmac256_finalize    = imb_aes_gmac_finalize_256_avx_gen4;
+        } else {
+                state->gcm128_enc          = aes_gcm_enc_128_avx_gen4;
+                state->gcm192_enc          = aes_gcm_enc_192_avx_gen4;
+                state->gcm256_enc          = aes_gcm_enc_256_avx_gen4;
+                state->gcm128_dec          = aes_gcm_dec_128_avx_gen4;
+                state->gcm192_dec          = aes_gcm_dec_192_avx_gen4;
+                state->gcm256_dec          = aes_gcm_dec_256_avx_gen4;
+                state->gcm128_init         = aes_gcm_init_128_avx_gen4;
+                state->gcm192_init         = aes_gcm_init_192_avx_gen4;
+                state->gcm256_init         = aes_gcm_init_256_avx_gen4;
+                state->gcm128_init_var_iv  = aes_gcm_init_var_iv_128_avx_gen4;
+                state->gcm192_init_var_iv  = aes_gcm_init_var_iv_192_avx_gen4;
+                state->gcm256_init_var_iv  = aes_gcm_init_var_iv_256_avx_gen4;
+                state->gcm128_enc_update   = aes_gcm_enc_128_update_avx_gen4;
+                state->gcm192_enc_update   = aes_gcm_enc_192_update_avx_gen4;
+                state->gcm256_enc_update   = aes_gcm_enc_256_update_avx_gen4;
+                state->gcm128_dec_update   = aes_gcm_dec_128_update_avx_gen4;
+                state->gcm192_dec_update   = aes_gcm_dec_192_update_avx_gen4;
+                state->gcm256_dec_update   = aes_gcm_dec_256_update_avx_gen4;
+                state->gcm128_enc_finalize = aes_gcm_enc_128_finalize_avx_gen4;
+                state->gcm192_enc_finalize = aes_gcm_enc_192_finalize_avx_gen4;
+                state->gcm256_enc_finalize = aes_gcm_enc_256_finalize_avx_gen4;
+                state->gcm128_dec_finalize = aes_gcm_dec_128_finalize_avx_gen4;
+                state->gcm192_dec_finalize = aes_gcm_dec_192_finalize_avx_gen4;
+                state->gcm256_dec_finalize = aes_gcm_dec_256_finalize_avx_gen4;
+                state->gcm128_precomp      = aes_gcm_precomp_128_avx_gen4;
+                state->gcm192_precomp      = aes_gcm_precomp_192_avx_gen4;
+                state->gcm256_precomp      = aes_gcm_precomp_256_avx_gen4;
+                state->gcm128_pre          = aes_gcm_pre_128_avx_gen4;
+                state->gcm192_pre          = aes_gcm_pre_192_avx_gen4;
+                state->gcm256_pre          = aes_gcm_pre_256_avx_gen4;
+                state->ghash               = ghash_avx_gen4;
+                state->ghash_pre           = ghash_pre_avx_gen2;
+
+                submit_job_aes_gcm_enc_avx2 = plain_submit_gcm_enc_avx2;
+                submit_job_aes_gcm_dec_avx2 = plain_submit_gcm_dec_avx2;
+
+                state->gmac128_init        = imb_aes_gmac_init_128_avx_gen4;
+                state->gmac192_init        = imb_aes_gmac_init_192_avx_gen4;
+                state->gmac256_init        = imb_aes_gmac_init_256_avx_gen4;
+                state->gmac128_update      = imb_aes_gmac_update_128_avx_gen4;
+                state->gmac192_update      = imb_aes_gmac_update_192_avx_gen4;
+                state->gmac256_update      = imb_aes_gmac_update_256_avx_gen4;
+                state->gmac128_finalize    = imb_aes_gmac_finalize_128_avx_gen4;
+                state->gmac192_finalize    = imb_aes_gmac_finalize_192_avx_gen4;
+                state->gmac256_finalize    = imb_aes_gmac_finalize_256_avx_gen4;
+        }
         state->hec_32              = hec_32_avx;
         state->hec_64              = hec_64_avx;
         state->crc32_ethernet_fcs  = ethernet_fcs_avx;
@@ -107,6 +107,64 @@ find_min_length32(const uint32_t length[NUM_AVX2_BUFS],
         return _mm_extract_epi16(length1, 0);
 }
 
+static inline void
+init_8(ZucKey8_t *keys, const uint8_t *ivs, ZucState8_t *state,
+       const uint64_t key_sz, const uint64_t tag_sz,
+       void *T, const unsigned use_gfni)
+{
+        if (key_sz == 128) {
+                if (use_gfni)
+                        asm_ZucInitialization_8_gfni_avx2(keys, ivs, state);
+                else
+                        asm_ZucInitialization_8_avx2(keys, ivs, state);
+        } else {
+                if (use_gfni)
+                        asm_Zuc256Initialization_8_gfni_avx2(keys, ivs,
+                                                             state, T, tag_sz);
+                else
+                        asm_Zuc256Initialization_8_avx2(keys, ivs, state, T,
+                                                        tag_sz);
+        }
+}
+
+static inline void
+keygen_8(ZucState8_t *state, uint32_t **pKeyStrArr,
+         const uint64_t numKeyStrBytes, const unsigned use_gfni)
+{
+        if (use_gfni) {
+                if (numKeyStrBytes == 4)
+                        asm_ZucGenKeystream4B_8_gfni_avx2(state, pKeyStrArr);
+                else if (numKeyStrBytes == 8)
+                        asm_ZucGenKeystream8B_8_gfni_avx2(state, pKeyStrArr);
+                else if (numKeyStrBytes == 16)
+                        asm_ZucGenKeystream16B_8_gfni_avx2(state, pKeyStrArr);
+                else /* 32 */
+                        asm_ZucGenKeystream32B_8_gfni_avx2(state, pKeyStrArr);
+        } else {
+                if (numKeyStrBytes == 4)
+                        asm_ZucGenKeystream4B_8_avx2(state, pKeyStrArr);
+                else if (numKeyStrBytes == 8)
+                        asm_ZucGenKeystream8B_8_avx2(state, pKeyStrArr);
+                else if (numKeyStrBytes == 16)
+                        asm_ZucGenKeystream16B_8_avx2(state, pKeyStrArr);
+                else /* 32 */
+                        asm_ZucGenKeystream32B_8_avx2(state, pKeyStrArr);
+        }
+}
+
+static inline void
+cipher_8(ZucState8_t *state, const uint64_t *pIn[NUM_AVX2_BUFS],
+         uint64_t *pOut[NUM_AVX2_BUFS],
+         const uint16_t lengths[NUM_AVX2_BUFS],
+         const uint64_t minLength, const unsigned use_gfni)
+{
+        if (use_gfni)
+                asm_ZucCipher_8_gfni_avx2(state, pIn, pOut, lengths,
+                                          minLength);
+        else
+                asm_ZucCipher_8_avx2(state, pIn, pOut, lengths, minLength);
+}
+
 static inline
 void _zuc_eea3_1_buffer_avx2(const void *pKey,
                             const void *pIv,
@@ -182,12 +240,13 @@ void _zuc_eea3_1_buffer_avx2(const void *pKey,
 #endif
 }
 
-IMB_DLL_LOCAL
-void _zuc_eea3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
-                            const void * const pIv[NUM_AVX2_BUFS],
-                            const void * const pBufferIn[NUM_AVX2_BUFS],
-                            void *pBufferOut[NUM_AVX2_BUFS],
-                            const uint32_t length[NUM_AVX2_BUFS])
+static inline
+void _zuc_eea3_8_buffer(const void * const pKey[NUM_AVX2_BUFS],
+                        const void * const pIv[NUM_AVX2_BUFS],
+                        const void * const pBufferIn[NUM_AVX2_BUFS],
+                        void *pBufferOut[NUM_AVX2_BUFS],
+                        const uint32_t length[NUM_AVX2_BUFS],
+                        const unsigned use_gfni)
 {
         DECLARE_ALIGNED(ZucState8_t state, 64);
         DECLARE_ALIGNED(ZucState_t singlePktState, 64);
@@ -216,14 +275,14 @@ void _zuc_eea3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 memcpy(ivs + i*32, pIv[i], 16);
         }
 
-        asm_ZucInitialization_8_avx2(&keys, ivs, &state);
+        init_8(&keys, ivs, &state, 128, 0, NULL, use_gfni);
 
         for (i = 0; i < NUM_AVX2_BUFS; i++) {
                 pOut64[i] = (uint64_t *) pBufferOut[i];
                 pIn64[i] = (const uint64_t *) pBufferIn[i];
         }
 
-        asm_ZucCipher_8_avx2(&state, pIn64, pOut64, remainBytes, bytes);
+        cipher_8(&state, pIn64, pOut64, remainBytes, bytes, use_gfni);
 
         /* process each packet separately for the remaining bytes */
         for (i = 0; i < NUM_AVX2_BUFS; i++) {
@@ -323,6 +382,16 @@ void _zuc_eea3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
 #endif
 }
 
+IMB_DLL_LOCAL
+void _zuc_eea3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
+                            const void * const pIv[NUM_AVX2_BUFS],
+                            const void * const pBufferIn[NUM_AVX2_BUFS],
+                            void *pBufferOut[NUM_AVX2_BUFS],
+                            const uint32_t length[NUM_AVX2_BUFS])
+{
+        _zuc_eea3_8_buffer(pKey, pIv, pBufferIn, pBufferOut, length, 0);
+}
+
 void zuc_eea3_1_buffer_avx2(const void *pKey,
                             const void *pIv,
                             const void *pBufferIn,
@@ -375,10 +444,12 @@ void zuc_eea3_1_buffer_avx2(const void *pKey,
 #endif
 }
 
-void zuc_eea3_n_buffer_avx2(const void * const pKey[], const void * const pIv[],
-                            const void * const pBufferIn[], void *pBufferOut[],
-                            const uint32_t length[],
-                            const uint32_t numBuffers)
+static inline
+void _zuc_eea3_n_buffer(const void * const pKey[], const void * const pIv[],
+                        const void * const pBufferIn[], void *pBufferOut[],
+                        const uint32_t length[],
+                        const uint32_t numBuffers,
+                        const unsigned use_gfni)
 {
 #ifndef LINUX
         DECLARE_ALIGNED(imb_uint128_t xmm_save[10], 16);
@@ -452,11 +523,12 @@ void zuc_eea3_n_buffer_avx2(const void * const pKey[], const void * const pIv[],
 
         while(packetCount >= 8) {
                 packetCount -=8;
-                _zuc_eea3_8_buffer_avx2(&pKey[i],
-                                        &pIv[i],
-                                        &pBufferIn[i],
-                                        &pBufferOut[i],
-                                        &length[i]);
+                _zuc_eea3_8_buffer(&pKey[i],
+                                   &pIv[i],
+                                   &pBufferIn[i],
+                                   &pBufferOut[i],
+                                   &length[i],
+                                   use_gfni);
                 i+=8;
         }
 
@@ -488,6 +560,26 @@ void zuc_eea3_n_buffer_avx2(const void * const pKey[], const void * const pIv[],
 #endif
 }
 
+void zuc_eea3_n_buffer_avx2(const void * const pKey[], const void * const pIv[],
+                            const void * const pBufferIn[], void *pBufferOut[],
+                            const uint32_t length[],
+                            const uint32_t numBuffers)
+{
+        _zuc_eea3_n_buffer(pKey, pIv, pBufferIn, pBufferOut, length,
+                           numBuffers, 0);
+}
+
+void zuc_eea3_n_buffer_gfni_avx2(const void * const pKey[],
+                                 const void * const pIv[],
+                                 const void * const pBufferIn[],
+                                 void *pBufferOut[],
+                                 const uint32_t length[],
+                                 const uint32_t numBuffers)
+{
+        _zuc_eea3_n_buffer(pKey, pIv, pBufferIn, pBufferOut, length,
+                           numBuffers, 1);
+}
+
 static inline
 void _zuc_eia3_1_buffer_avx2(const void *pKey,
                              const void *pIv,
@@ -535,12 +627,13 @@ void _zuc_eia3_1_buffer_avx2(const void *pKey,
 #endif
 }
 
-IMB_DLL_LOCAL
-void _zuc_eia3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
-                             const void * const pIv[NUM_AVX2_BUFS],
-                             const void * const pBufferIn[NUM_AVX2_BUFS],
-                             const uint32_t lengthInBits[NUM_AVX2_BUFS],
-                             uint32_t *pMacI[NUM_AVX2_BUFS])
+static inline
+void _zuc_eia3_8_buffer(const void * const pKey[NUM_AVX2_BUFS],
+                        const void * const pIv[NUM_AVX2_BUFS],
+                        const void * const pBufferIn[NUM_AVX2_BUFS],
+                        const uint32_t lengthInBits[NUM_AVX2_BUFS],
+                        uint32_t *pMacI[NUM_AVX2_BUFS],
+                        const unsigned use_gfni)
 {
         unsigned int i = 0;
         DECLARE_ALIGNED(ZucState8_t state, 64);
@@ -567,10 +660,10 @@ void _zuc_eia3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 memcpy(ivs + i*32, pIv[i], 16);
         }
 
-        asm_ZucInitialization_8_avx2(&keys, ivs, &state);
+        init_8(&keys, ivs, &state, 128, 0, NULL, use_gfni);
 
         /* Generate 32 bytes at a time */
-        asm_ZucGenKeystream32B_8_avx2(&state, (uint32_t **)pKeyStrArr);
+        keygen_8(&state, pKeyStrArr, 32, use_gfni);
 
         /* Point at the next 32 bytes of the key */
         for (i = 0; i < NUM_AVX2_BUFS; i++)
@@ -581,11 +674,9 @@ void _zuc_eia3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 numKeyStr++;
                 /* Generate the next key stream 8 bytes or 32 bytes */
                 if (!remainCommonBits && allCommonBits)
-                        asm_ZucGenKeystream8B_8_avx2(&state,
-                                                     (uint32_t **)pKeyStrArr);
+                        keygen_8(&state, pKeyStrArr, 8, use_gfni);
                 else
-                        asm_ZucGenKeystream32B_8_avx2(&state,
-                                                      (uint32_t **)pKeyStrArr);
+                        keygen_8(&state, pKeyStrArr, 32, use_gfni);
                 for (i = 0; i < NUM_AVX2_BUFS; i++) {
                         asm_Eia3Round32B_avx(&T[i], &keyStr[i][0], pIn8[i], 4);
                         pIn8[i] = &pIn8[i][KEYSTR_ROUND_LEN];
@@ -661,6 +752,16 @@ void _zuc_eia3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
 #endif
 }
 
+IMB_DLL_LOCAL
+void _zuc_eia3_8_buffer_avx2(const void * const pKey[NUM_AVX2_BUFS],
+                             const void * const pIv[NUM_AVX2_BUFS],
+                             const void * const pBufferIn[NUM_AVX2_BUFS],
+                             const uint32_t lengthInBits[NUM_AVX2_BUFS],
+                             uint32_t *pMacI[NUM_AVX2_BUFS])
+{
+        _zuc_eia3_8_buffer(pKey, pIv, pBufferIn, lengthInBits, pMacI, 0);
+}
+
 void zuc_eia3_1_buffer_avx2(const void *pKey,
                             const void *pIv,
                             const void *pBufferIn,
@@ -713,12 +814,14 @@ void zuc_eia3_1_buffer_avx2(const void *pKey,
 #endif
 }
 
-void zuc_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
-                                const uint8_t *ivs,
-                                const void * const pBufferIn[NUM_AVX2_BUFS],
-                                uint32_t *pMacI[NUM_AVX2_BUFS],
-                                const uint16_t lengthInBits[NUM_AVX2_BUFS],
-                                const void * const job_in_lane[NUM_AVX2_BUFS])
+static inline
+void _zuc_eia3_8_buffer_job(const void * const pKey[NUM_AVX2_BUFS],
+                            const uint8_t *ivs,
+                            const void * const pBufferIn[NUM_AVX2_BUFS],
+                            uint32_t *pMacI[NUM_AVX2_BUFS],
+                            const uint16_t lengthInBits[NUM_AVX2_BUFS],
+                            const void * const job_in_lane[NUM_AVX2_BUFS],
+                            const unsigned use_gfni)
 {
         unsigned int i = 0;
         DECLARE_ALIGNED(ZucState8_t state, 64);
@@ -742,10 +845,10 @@ void zuc_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 keys.pKeys[i] = pKey[i];
         }
 
-        asm_ZucInitialization_8_avx2(&keys, ivs, &state);
+        init_8(&keys, ivs, &state, 128, 0, NULL, use_gfni);
 
         /* Generate 32 bytes at a time */
-        asm_ZucGenKeystream32B_8_avx2(&state, (uint32_t **)pKeyStrArr);
+        keygen_8(&state, pKeyStrArr, 32, use_gfni);
 
         /* Point at the next 32 bytes of the key */
         for (i = 0; i < NUM_AVX2_BUFS; i++)
@@ -756,11 +859,9 @@ void zuc_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 numKeyStr++;
                 /* Generate the next key stream 8 bytes or 32 bytes */
                 if (!remainCommonBits && allCommonBits)
-                        asm_ZucGenKeystream8B_8_avx2(&state,
-                                                     (uint32_t **)pKeyStrArr);
+                        keygen_8(&state, pKeyStrArr, 8, use_gfni);
                 else
-                        asm_ZucGenKeystream32B_8_avx2(&state,
-                                                      (uint32_t **)pKeyStrArr);
+                        keygen_8(&state, pKeyStrArr, 32, use_gfni);
                 for (i = 0; i < NUM_AVX2_BUFS; i++) {
                         if (job_in_lane[i] == NULL)
                                 continue;
@@ -843,13 +944,37 @@ void zuc_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
 #endif
 }
 
-void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
+void zuc_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
                                 const uint8_t *ivs,
                                 const void * const pBufferIn[NUM_AVX2_BUFS],
-                                void *pMacI[NUM_AVX2_BUFS],
+                                uint32_t *pMacI[NUM_AVX2_BUFS],
                                 const uint16_t lengthInBits[NUM_AVX2_BUFS],
-                                const void * const job_in_lane[NUM_AVX2_BUFS],
-                                const uint64_t tag_size)
+                                const void * const job_in_lane[NUM_AVX2_BUFS])
+{
+        _zuc_eia3_8_buffer_job(pKey, ivs, pBufferIn, pMacI, lengthInBits,
+                               job_in_lane, 0);
+}
+
+void zuc_eia3_8_buffer_job_gfni_avx2(const void * const pKey[NUM_AVX2_BUFS],
+                                const uint8_t *ivs,
+                                const void * const pBufferIn[NUM_AVX2_BUFS],
+                                uint32_t *pMacI[NUM_AVX2_BUFS],
+                                const uint16_t lengthInBits[NUM_AVX2_BUFS],
+                                const void * const job_in_lane[NUM_AVX2_BUFS])
+{
+        _zuc_eia3_8_buffer_job(pKey, ivs, pBufferIn, pMacI, lengthInBits,
+                               job_in_lane, 1);
+}
+
+static inline
+void _zuc256_eia3_8_buffer_job(const void * const pKey[NUM_AVX2_BUFS],
+                               const uint8_t *ivs,
+                               const void * const pBufferIn[NUM_AVX2_BUFS],
+                               void *pMacI[NUM_AVX2_BUFS],
+                               const uint16_t lengthInBits[NUM_AVX2_BUFS],
+                               const void * const job_in_lane[NUM_AVX2_BUFS],
+                               const uint64_t tag_size,
+                               const unsigned use_gfni)
 {
         unsigned int i = 0;
         DECLARE_ALIGNED(ZucState8_t state, 64);
@@ -873,10 +998,10 @@ void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 keys.pKeys[i] = pKey[i];
         }
 
-        asm_Zuc256Initialization_8_avx2(&keys, ivs, &state, T, tag_size);
+        init_8(&keys, ivs, &state, 256, tag_size, T, use_gfni);
 
         /* Generate 32 bytes at a time */
-        asm_ZucGenKeystream32B_8_avx2(&state, (uint32_t **)pKeyStrArr);
+        keygen_8(&state, pKeyStrArr, 32, use_gfni);
 
         /* Point at the next 32 bytes of the key */
         for (i = 0; i < NUM_AVX2_BUFS; i++)
@@ -888,17 +1013,13 @@ void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
                 /* Generate the next key stream 4/8/16 bytes or 32 bytes */
                 if (!remainCommonBits && allCommonBits) {
                         if (tag_size == 4)
-                                asm_ZucGenKeystream4B_8_avx2(&state,
-                                                             pKeyStrArr);
+                                keygen_8(&state, pKeyStrArr, 4, use_gfni);
                         else if (tag_size == 8)
-                                asm_ZucGenKeystream8B_8_avx2(&state,
-                                                             pKeyStrArr);
+                                keygen_8(&state, pKeyStrArr, 8, use_gfni);
                         else
-                                asm_ZucGenKeystream16B_8_avx2(&state,
-                                                              pKeyStrArr);
+                                keygen_8(&state, pKeyStrArr, 16, use_gfni);
                 } else
-                        asm_ZucGenKeystream32B_8_avx2(&state,
-                                                      (uint32_t **)pKeyStrArr);
+                        keygen_8(&state, pKeyStrArr, 32, use_gfni);
                 for (i = 0; i < NUM_AVX2_BUFS; i++) {
                         void *tag = (void *) &T[i*tag_size];
 
@@ -991,12 +1112,38 @@ void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
 #endif
 }
 
-void zuc_eia3_n_buffer_avx2(const void * const pKey[],
-                            const void * const pIv[],
-                            const void * const pBufferIn[],
-                            const uint32_t lengthInBits[],
-                            uint32_t *pMacI[],
-                            const uint32_t numBuffers)
+void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[NUM_AVX2_BUFS],
+                                const uint8_t *ivs,
+                                const void * const pBufferIn[NUM_AVX2_BUFS],
+                                void *pMacI[NUM_AVX2_BUFS],
+                                const uint16_t lengthInBits[NUM_AVX2_BUFS],
+                                const void * const job_in_lane[NUM_AVX2_BUFS],
+                                const uint64_t tag_size)
+{
+        _zuc256_eia3_8_buffer_job(pKey, ivs, pBufferIn, pMacI, lengthInBits,
+                                  job_in_lane, tag_size, 0);
+}
+
+void zuc256_eia3_8_buffer_job_gfni_avx2(const void * const pKey[NUM_AVX2_BUFS],
+                                const uint8_t *ivs,
+                                const void * const pBufferIn[NUM_AVX2_BUFS],
+                                void *pMacI[NUM_AVX2_BUFS],
+                                const uint16_t lengthInBits[NUM_AVX2_BUFS],
+                                const void * const job_in_lane[NUM_AVX2_BUFS],
+                                const uint64_t tag_size)
+{
+        _zuc256_eia3_8_buffer_job(pKey, ivs, pBufferIn, pMacI, lengthInBits,
+                                  job_in_lane, tag_size, 1);
+}
+
+static inline
+void _zuc_eia3_n_buffer(const void * const pKey[],
+                        const void * const pIv[],
+                        const void * const pBufferIn[],
+                        const uint32_t lengthInBits[],
+                        uint32_t *pMacI[],
+                        const uint32_t numBuffers,
+                        const unsigned use_gfni)
 {
 #ifndef LINUX
         DECLARE_ALIGNED(imb_uint128_t xmm_save[10], 16);
@@ -1070,11 +1217,12 @@ void zuc_eia3_n_buffer_avx2(const void * const pKey[],
 
         while(packetCount >= 8) {
                 packetCount -= 8;
-                _zuc_eia3_8_buffer_avx2(&pKey[i],
-                                        &pIv[i],
-                                        &pBufferIn[i],
-                                        &lengthInBits[i],
-                                        &pMacI[i]);
+                _zuc_eia3_8_buffer(&pKey[i],
+                                   &pIv[i],
+                                   &pBufferIn[i],
+                                   &lengthInBits[i],
+                                   &pMacI[i],
+                                   use_gfni);
                 i += 8;
         }
 
@@ -1106,3 +1254,25 @@ void zuc_eia3_n_buffer_avx2(const void * const pKey[],
         RESTORE_XMMS(xmm_save);
 #endif
 }
+
+void zuc_eia3_n_buffer_avx2(const void * const pKey[],
+                            const void * const pIv[],
+                            const void * const pBufferIn[],
+                            const uint32_t lengthInBits[],
+                            uint32_t *pMacI[],
+                            const uint32_t numBuffers)
+{
+        _zuc_eia3_n_buffer(pKey, pIv, pBufferIn, lengthInBits, pMacI,
+                           numBuffers, 0);
+}
+
+void zuc_eia3_n_buffer_gfni_avx2(const void * const pKey[],
+                                 const void * const pIv[],
+                                 const void * const pBufferIn[],
+                                 const uint32_t lengthInBits[],
+                                 uint32_t *pMacI[],
+                                 const uint32_t numBuffers)
+{
+        _zuc_eia3_n_buffer(pKey, pIv, pBufferIn, lengthInBits, pMacI,
+                           numBuffers, 1);
+}
@@ -0,0 +1,232 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+; routine to do AES CBC decrypt on 16n bytes doing AES by 16
+
+; YMM registers are clobbered. Saving/restoring must be done at a higher level
+
+; void aes_cbc_dec_x_vaes_avx2(void    *in,
+;                              void    *IV,
+;                              UINT128  keys[],
+;                              void    *out,
+;                              UINT64   len_bytes);
+;
+; x = key size (128/192/256)
+; arg 1: IN:   pointer to input (cipher text)
+; arg 2: IV:   pointer to IV
+; arg 3: KEYS: pointer to expanded decryption keys
+; arg 4: OUT:  pointer to output (plain text)
+; arg 5: LEN:  length in bytes (multiple of 16)
+;
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/aes_common.asm"
+%include "include/cet.inc"
+
+%ifdef LINUX
+%define IN      rdi
+%define IV      rsi
+%define KEYS    rdx
+%define OUT     rcx
+%define LEN     r8
+%else
+%define IN      rcx
+%define IV      rdx
+%define KEYS    r8
+%define OUT     r9
+%define LEN     r10
+%endif
+%define IDX     rax
+%define TMP     r11
+
+%define YKEY1       ymm1
+%define YDATA0      ymm2
+%define YDATA1      ymm3
+%define YDATA2      ymm4
+%define YDATA3      ymm5
+%define YDATA4      ymm6
+%define YDATA5      ymm7
+%define YDATA6      ymm8
+%define YDATA7      ymm9
+%define YIV         ymm10
+%define YTMP        ymm11
+
+%ifndef AES_CBC_NROUNDS
+%define AES_CBC_NROUNDS 10
+%endif
+
+%if AES_CBC_NROUNDS == 10
+%define KEYSIZE 128
+%elif AES_CBC_NROUNDS == 12
+%define KEYSIZE 192
+%else
+%define KEYSIZE 256
+%endif
+
+%define AES_CBC_DEC aes_cbc_dec_ %+ KEYSIZE %+ _vaes_avx2
+
+;; Decrypts NUM_BLOCKS blocks from IN + IDX into OUT + IDX.
+;; YIV holds the previous cipher text block in the low lane on input
+;; and is updated with the last cipher text block on output.
+%macro AES_CBC_DEC_BLOCKS 1
+%define %%NUM_BLOCKS    %1 ; [in] numerical value, number of AES blocks (1 to 16)
+
+        YMM_LOAD_BLOCKS_AVX2_0_16 %%NUM_BLOCKS, IN, IDX, YDATA0,\
+                YDATA1, YDATA2, YDATA3, YDATA4, YDATA5,\
+                YDATA6, YDATA7
+
+%assign %%I 0
+%rep (AES_CBC_NROUNDS + 1)          ; 10/12/14
+        vbroadcasti128      YKEY1, [KEYS + %%I*16]
+        YMM_AESDEC_ROUND_BLOCKS_AVX2_0_16 YDATA0, YDATA1, YDATA2, YDATA3,\
+                YDATA4, YDATA5, YDATA6, YDATA7, YKEY1, %%I, no_data,\
+                no_data, no_data, no_data, no_data, no_data,\
+                no_data, no_data, %%NUM_BLOCKS, (AES_CBC_NROUNDS - 1)
+%assign %%I (%%I + 1)
+%endrep
+
+        ;; XOR with the previous cipher text blocks. All input is read
+        ;; before the first store to allow in-place operation.
+%if %%NUM_BLOCKS == 1
+        vpxor           XWORD(YDATA0), XWORD(YDATA0), XWORD(YIV)
+%else
+        vinserti128     YTMP, YIV, [IN + IDX], 1
+        vpxor           YDATA0, YDATA0, YTMP
+%endif
+
+%assign %%J 1
+%if %%NUM_BLOCKS >= 4
+%rep ((%%NUM_BLOCKS / 2) - 1)
+%xdefine %%YDATA YDATA %+ %%J
+        vpxor           %%YDATA, %%YDATA, [IN + IDX + %%J*32 - 16]
+%undef %%YDATA
+%assign %%J (%%J + 1)
+%endrep
+%endif
+
+%if (%%NUM_BLOCKS > 1) && ((%%NUM_BLOCKS % 2) == 1)
+%xdefine %%YDATA YDATA %+ %%J
+        vpxor           XWORD(%%YDATA), XWORD(%%YDATA), [IN + IDX + %%J*32 - 16]
+%undef %%YDATA
+%endif
+
+        vmovdqu         XWORD(YIV), [IN + IDX + (%%NUM_BLOCKS - 1)*16]
+
+        YMM_STORE_BLOCKS_AVX2_0_16 %%NUM_BLOCKS, OUT, IDX, YDATA0, YDATA1,\
+                YDATA2, YDATA3, YDATA4, YDATA5, YDATA6, YDATA7
+
+        add     IDX, %%NUM_BLOCKS*16
+%endmacro
+
+%macro AES_CBC_DEC_BY16 0
+%ifndef LINUX
+        mov     LEN, [rsp + 8*5]
+%endif
+        or      LEN, LEN
+        jz      %%done
+
+        vmovdqu XWORD(YIV), [IV]
+
+        xor     IDX, IDX
+        mov     TMP, LEN
+        and     TMP, 255    ; number of initial bytes (0 to 15 AES blocks)
+        jz      %%main_loop
+
+        ; branch to different code block based on remainder
+        cmp     TMP, 8*16
+        je      %%initial_num_blocks_is_8
+        jb      %%initial_num_blocks_is_7_1
+        cmp     TMP, 12*16
+        je      %%initial_num_blocks_is_12
+        jb      %%initial_num_blocks_is_11_9
+        ;; 15, 14 or 13
+        cmp     TMP, 14*16
+        ja      %%initial_num_blocks_is_15
+        je      %%initial_num_blocks_is_14
+        jmp     %%initial_num_blocks_is_13
+%%initial_num_blocks_is_11_9:
+        ;; 11, 10 or 9
+        cmp     TMP, 10*16
+        ja      %%initial_num_blocks_is_11
+        je      %%initial_num_blocks_is_10
+        jmp     %%initial_num_blocks_is_9
+%%initial_num_blocks_is_7_1:
+        cmp     TMP, 4*16
+        je      %%initial_num_blocks_is_4
+        jb      %%initial_num_blocks_is_3_1
+        ;; 7, 6 or 5
+        cmp     TMP, 6*16
+        ja      %%initial_num_blocks_is_7
+        je      %%initial_num_blocks_is_6
+        jmp     %%initial_num_blocks_is_5
+%%initial_num_blocks_is_3_1:
+        ;; 3, 2 or 1
+        cmp     TMP, 2*16
+        ja      %%initial_num_blocks_is_3
+        je      %%initial_num_blocks_is_2
+        ;; fall through for `jmp %%initial_num_blocks_is_1`
+
+%assign num_blocks 1
+%rep 15
+
+        %%initial_num_blocks_is_ %+ num_blocks :
+        AES_CBC_DEC_BLOCKS num_blocks
+
+        cmp     IDX, LEN
+        je      %%done
+
+%assign num_blocks (num_blocks + 1)
+        jmp     %%main_loop
+%endrep
+
+align 16
+%%main_loop:
+        AES_CBC_DEC_BLOCKS 16
+
+        cmp     IDX, LEN
+        jne     %%main_loop
+
+%%done:
+
+%ifdef SAFE_DATA
+        clear_all_ymms_asm
+%else
+        vzeroupper
+%endif
+%endmacro
+
+mksection .text
+align 16
+MKGLOBAL(AES_CBC_DEC,function,internal)
+AES_CBC_DEC:
+        endbranch64
+        AES_CBC_DEC_BY16
+        ret
+
+mksection stack-noexec
@@ -0,0 +1,471 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+; routine to do AES CNTR, CNTR_BIT and CCM (counter part) enc/decrypt "by16"
+
+; YMM registers are clobbered. Saving/restoring must be done at a higher level
+
+%include "include/os.asm"
+%include "include/imb_job.asm"
+%include "include/memcpy.asm"
+%include "include/const.inc"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/aes_common.asm"
+%include "include/cet.inc"
+
+mksection .rodata
+default rel
+
+align 32
+byteswap_const_x2:
+        ;DDQ 0x000102030405060708090A0B0C0D0E0F (x2)
+        DQ 0x08090A0B0C0D0E0F, 0x0001020304050607
+        DQ 0x08090A0B0C0D0E0F, 0x0001020304050607
+
+align 16
+set_byte15:
+        DQ 0x0000000000000000, 0x0100000000000000
+
+;; counter increments for a pair of blocks: (2*i, 2*i + 1) for i = 0 to 7
+align 32
+ddq_add_pairs:
+%assign i 0
+%rep 8
+        DQ (2*i), 0x0000000000000000
+        DQ (2*i + 1), 0x0000000000000000
+%assign i (i + 1)
+%endrep
+
+;; counter increments from 1 to 16
+align 16
+ddq_add_1_16:
+%assign i 1
+%rep 16
+        DQ i, 0x0000000000000000
+%assign i (i + 1)
+%endrep
+
+mksection .text
+
+%define YDATA0          ymm0
+%define YDATA1          ymm1
+%define YDATA2          ymm2
+%define YDATA3          ymm3
+%define YDATA4          ymm4
+%define YDATA5          ymm5
+%define YDATA6          ymm6
+%define YDATA7          ymm7
+%define YCNT            ymm8
+%define YBSWAP          ymm9
+%define YKEY            ymm10
+%define YTMP            ymm11
+
+%define xcounter        XWORD(YCNT)
+%define xbyteswap       XWORD(YBSWAP)
+%define xdata0          XWORD(YDATA0)
+%define xpart           XWORD(YDATA1)
+
+%ifdef CNTR_CCM_AVX2
+%ifdef LINUX
+%define job       rdi
+%define p_in      rsi
+%define p_keys    rdx
+%define p_out     rcx
+%define num_bytes r8
+%define p_ivlen   r9
+%else ;; LINUX
+%define job       rcx
+%define p_in      rdx
+%define p_keys    r8
+%define p_out     r9
+%define num_bytes r10
+%define p_ivlen   rax
+%endif ;; LINUX
+%define p_IV    r11
+%else ;; CNTR_CCM_AVX2
+%ifdef LINUX
+%define p_in      rdi
+%define p_IV      rsi
+%define p_keys    rdx
+%define p_out     rcx
+%define num_bytes r8
+%define num_bits  r8
+%define p_ivlen   r9
+%else ;; LINUX
+%define p_in      rcx
+%define p_IV      rdx
+%define p_keys    r8
+%define p_out     r9
+%define num_bytes r10
+%define num_bits  r10
+%define p_ivlen   qword [rsp + 8*6]
+%endif ;; LINUX
+%endif ;; CNTR_CCM_AVX2
+
+%define tmp     r11
+%define flags   r11
+
+%define r_bits    r12 ; number of bits in the last byte, then mask of bits to keep
+%define old_bits  r13 ; bits of the last output byte to keep
+%define last_byte r14 ; pointer to the last output byte
+
+%ifndef AES_CNTR_NROUNDS
+%define AES_CNTR_NROUNDS 10
+%endif
+
+%if AES_CNTR_NROUNDS == 10
+%define KEYSIZE 128
+%elif AES_CNTR_NROUNDS == 12
+%define KEYSIZE 192
+%else
+%define KEYSIZE 256
+%endif
+
+%define AES_CNTR        aes_cntr_ %+ KEYSIZE %+ _vaes_avx2
+%define AES_CNTR_BIT    aes_cntr_bit_ %+ KEYSIZE %+ _vaes_avx2
+%define AES_CNTR_CCM    aes_cntr_ccm_ %+ KEYSIZE %+ _vaes_avx2
+
+;; Encrypts NUM_BLOCKS counter blocks (2 blocks per YMM register),
+;; XOR's them with the input and stores the result.
+;; Input/output pointers, the counter and the length are updated.
+%macro CNTR_BLOCKS 2
+%define %%NUM_BLOCKS    %1 ; [in] numerical value, number of AES blocks (1 to 16)
+%define %%CNTR_TYPE     %2 ; [in] CNTR/CNTR_BIT/CCM
+
+%ifidn %%CNTR_TYPE, CNTR_BIT
+%define %%VPADD vpaddq
+%else
+%define %%VPADD vpaddd
+%endif
+
+        ;; prepare counter blocks
+        vinserti128     YTMP, YCNT, xcounter, 1
+%assign %%J 0
+%rep ((%%NUM_BLOCKS + 1) / 2)
+%xdefine %%YDATA YDATA %+ %%J
+        %%VPADD         %%YDATA, YTMP, [rel ddq_add_pairs + %%J*32]
+        vpshufb         %%YDATA, %%YDATA, YBSWAP
+%undef %%YDATA
+%assign %%J (%%J + 1)
+%endrep
+        %%VPADD         xcounter, xcounter, [rel ddq_add_1_16 + (%%NUM_BLOCKS - 1)*16]
+
+%assign %%I 0
+%rep (AES_CNTR_NROUNDS + 1)          ; 10/12/14
+        vbroadcasti128  YKEY, [p_keys + %%I*16]
+        YMM_AESENC_ROUND_BLOCKS_AVX2_0_16 YDATA0, YDATA1, YDATA2, YDATA3,\
+                YDATA4, YDATA5, YDATA6, YDATA7, YKEY, %%I, no_data,\
+                no_data, no_data, no_data, no_data, no_data,\
+                no_data, no_data, %%NUM_BLOCKS, (AES_CNTR_NROUNDS - 1)
+%assign %%I (%%I + 1)
+%endrep
+
+        ;; XOR key stream with the input
+%assign %%J 0
+%rep (%%NUM_BLOCKS / 2)
+%xdefine %%YDATA YDATA %+ %%J
+        vpxor           %%YDATA, %%YDATA, [p_in + %%J*32]
+%undef %%YDATA
+%assign %%J (%%J + 1)
+%endrep
+%if (%%NUM_BLOCKS % 2) == 1
+%xdefine %%YDATA YDATA %+ %%J
+        vpxor           XWORD(%%YDATA), XWORD(%%YDATA), [p_in + %%J*32]
+%undef %%YDATA
+%endif
+
+        YMM_STORE_BLOCKS_AVX2_0_16 %%NUM_BLOCKS, p_out, 0, YDATA0, YDATA1,\
+                YDATA2, YDATA3, YDATA4, YDATA5, YDATA6, YDATA7
+
+        add     p_in, %%NUM_BLOCKS*16
+        add     p_out, %%NUM_BLOCKS*16
+        sub     num_bytes, %%NUM_BLOCKS*16
+%endmacro
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+;; Macro performing AES-CTR.
+;;
+%macro DO_CNTR 1
+%define %%CNTR_TYPE %1 ; [in] Type of CNTR operation to do (CNTR/CNTR_BIT/CCM)
+
+%ifidn %%CNTR_TYPE, CCM
+        mov     p_in, [job + _src]
+        add     p_in, [job + _cipher_start_src_offset_in_bytes]
+        mov     p_ivlen, [job + _iv_len_in_bytes]
+        mov     num_bytes, [job + _msg_len_to_cipher_in_bytes]
+        mov     p_keys, [job + _enc_keys]
+        mov     p_out, [job + _dst]
+
+        vmovdqa YBSWAP, [rel byteswap_const_x2]
+        ;; Prepare IV ;;
+
+        ;; Byte 0: flags with L'
+        ;; Calculate L' = 15 - Nonce length - 1 = 14 - IV length
+        mov     flags, 14
+        sub     flags, p_ivlen
+        vmovd   xcounter, DWORD(flags)
+        ;; Bytes 1 - 13: Nonce (7 - 13 bytes long)
+
+        ;; Bytes 1 - 7 are always copied (first 7 bytes)
+        mov     p_IV, [job + _iv]
+        vpinsrb xcounter, [p_IV], 1
+        vpinsrw xcounter, [p_IV + 1], 1
+        vpinsrd xcounter, [p_IV + 3], 1
+
+        cmp     p_ivlen, 7
+        je      %%_finish_nonce_move
+
+        cmp     p_ivlen, 8
+        je      %%_iv_length_8
+        cmp     p_ivlen, 9
+        je      %%_iv_length_9
+        cmp     p_ivlen, 10
+        je      %%_iv_length_10
+        cmp     p_ivlen, 11
+        je      %%_iv_length_11
+        cmp     p_ivlen, 12
+        je      %%_iv_length_12
+
+        ;; Bytes 8 - 13
+%%_iv_length_13:
+        vpinsrb xcounter, [p_IV + 12], 13
+%%_iv_length_12:
+        vpinsrb xcounter, [p_IV + 11], 12
+%%_iv_length_11:
+        vpinsrd xcounter, [p_IV + 7], 2
+        jmp     %%_finish_nonce_move
+%%_iv_length_10:
+        vpinsrb xcounter, [p_IV + 9], 10
+%%_iv_length_9:
+        vpinsrb xcounter, [p_IV + 8], 9
+%%_iv_length_8:
+        vpinsrb xcounter, [p_IV + 7], 8
+
+%%_finish_nonce_move:
+        ; last byte = 1
+        vpor    xcounter, [rel set_byte15]
+%else ;; CNTR/CNTR_BIT
+%ifndef LINUX
+        mov     num_bytes, [rsp + 8*5] ; arg5
+%endif
+
+%ifidn %%CNTR_TYPE, CNTR_BIT
+        push    r12
+        push    r13
+        push    r14
+%endif
+
+        vmovdqa YBSWAP, [rel byteswap_const_x2]
+%ifidn %%CNTR_TYPE, CNTR
+        test    p_ivlen, 16
+        jnz     %%iv_is_16_bytes
+        ; Read 12 bytes: Nonce + ESP IV. Then pad with block counter 0x00000001
+        mov     DWORD(tmp), 0x01000000
+        vpinsrq xcounter, [p_IV], 0
+        vpinsrd xcounter, [p_IV + 8], 2
+        vpinsrd xcounter, DWORD(tmp), 3
+
+%else ;; CNTR_BIT
+        ; Read 16 byte IV: Nonce + 8-byte block counter (BE)
+        vmovdqu xcounter, [p_IV]
+%endif
+%endif ;; CNTR/CNTR_BIT/CCM
+%%bswap_iv:
+        vpshufb xcounter, xbyteswap
+
+%ifidn %%CNTR_TYPE, CNTR_BIT
+        ;; convert bits to bytes (message length in bits for CNTR_BIT)
+        mov     r_bits, num_bits
+        add     num_bits, 7
+        shr     num_bits, 3 ; "num_bits" and "num_bytes" registers are the same
+        and     r_bits, 7   ; Check if there are remainder bits (0-7)
+        jz      %%no_partial_byte
+
+        ;; Save the bits of the last output byte that are not to be ciphered,
+        ;; they get restored once all the data has been written
+        lea     last_byte, [p_out + num_bytes - 1]
+        ;; Save RCX in temporary GP register
+        mov     tmp, rcx
+        mov     cl, BYTE(r_bits)
+        mov     DWORD(r_bits), 0xff
+        shr     DWORD(r_bits), cl ;; e.g. 3 remaining bits -> mask = 00011111
+        mov     rcx, tmp
+        movzx   DWORD(old_bits), byte [last_byte]
+        and     DWORD(old_bits), DWORD(r_bits)
+%%no_partial_byte:
+%endif
+
+        or      num_bytes, num_bytes
+        jz      %%do_return
+
+        mov     tmp, num_bytes
+        and     tmp, 15*16  ; number of initial full blocks (0 to 15)
+        jz      %%main_loop
+
+        ; branch to different code block based on remainder
+        cmp     tmp, 8*16
+        je      %%initial_num_blocks_is_8
+        jb      %%initial_num_blocks_is_7_1
+        cmp     tmp, 12*16
+        je      %%initial_num_blocks_is_12
+        jb      %%initial_num_blocks_is_11_9
+        ;; 15, 14 or 13
+        cmp     tmp, 14*16
+        ja      %%initial_num_blocks_is_15
+        je      %%initial_num_blocks_is_14
+        jmp     %%initial_num_blocks_is_13
+%%initial_num_blocks_is_11_9:
+        ;; 11, 10 or 9
+        cmp     tmp, 10*16
+        ja      %%initial_num_blocks_is_11
+        je      %%initial_num_blocks_is_10
+        jmp     %%initial_num_blocks_is_9
+%%initial_num_blocks_is_7_1:
+        cmp     tmp, 4*16
+        je      %%initial_num_blocks_is_4
+        jb      %%initial_num_blocks_is_3_1
+        ;; 7, 6 or 5
+        cmp     tmp, 6*16
+        ja      %%initial_num_blocks_is_7
+        je      %%initial_num_blocks_is_6
+        jmp     %%initial_num_blocks_is_5
+%%initial_num_blocks_is_3_1:
+        ;; 3, 2 or 1
+        cmp     tmp, 2*16
+        ja      %%initial_num_blocks_is_3
+        je      %%initial_num_blocks_is_2
+        ;; fall through for `jmp %%initial_num_blocks_is_1`
+
+%assign num_blocks 1
+%rep 15
+
+        %%initial_num_blocks_is_ %+ num_blocks :
+        CNTR_BLOCKS num_blocks, %%CNTR_TYPE
+%assign num_blocks (num_blocks + 1)
+        jmp     %%main_loop
+%endrep
+
+align 32
+%%main_loop:
+        ; num_bytes is a multiple of 16 blocks + partial bytes
+        cmp     num_bytes, 16*16
+        jb      %%check_partial
+        CNTR_BLOCKS 16, %%CNTR_TYPE
+        jmp     %%main_loop
+
+%%check_partial:
+        ; Check if there is a partial block
+        or      num_bytes, num_bytes
+        jz      %%do_return
+
+        ; load partial block into XMM register
+        simd_load_avx_15_1 xpart, p_in, num_bytes
+
+        ; Encryption of a single partial block
+        vpshufb xdata0, xcounter, xbyteswap
+        vpxor   xdata0, [p_keys + 16*0]
+%assign i 1
+%rep (AES_CNTR_NROUNDS - 1)
+        vaesenc xdata0, [p_keys + 16*i]
+%assign i (i + 1)
+%endrep
+        ; created keystream
+        vaesenclast xdata0, [p_keys + 16*i]
+
+        ; xor keystream with the message (scratch)
+        vpxor   xdata0, xpart
+
+        ; copy result into the output buffer
+        simd_store_avx_15 p_out, xdata0, num_bytes, tmp, rax
+
+%%do_return:
+%ifidn %%CNTR_TYPE, CNTR_BIT
+        ;; Restore the bits of the last byte that are not to be ciphered
+        or      r_bits, r_bits
+        jz      %%skip_preserve
+        movzx   DWORD(tmp), byte [last_byte]
+        not     DWORD(r_bits)
+        and     DWORD(tmp), DWORD(r_bits)
+        or      DWORD(tmp), DWORD(old_bits)
+        mov     [last_byte], BYTE(tmp)
+%%skip_preserve:
+        pop     r14
+        pop     r13
+        pop     r12
+%endif
+
+%ifidn %%CNTR_TYPE, CCM
+        mov     rax, job
+        or      dword [rax + _status], IMB_STATUS_COMPLETED_CIPHER
+%endif
+
+%ifdef SAFE_DATA
+        clear_all_ymms_asm
+%else
+        vzeroupper
+%endif ;; SAFE_DATA
+
+        ret
+
+%ifidn %%CNTR_TYPE, CNTR
+%%iv_is_16_bytes:
+        ; Read 16 byte IV: Nonce + ESP IV + block counter (BE)
+        vmovdqu xcounter, [p_IV]
+        jmp     %%bswap_iv
+%endif
+%endmacro
+
+align 32
+%ifdef CNTR_CCM_AVX2
+; IMB_JOB * aes_cntr_ccm_x_vaes_avx2(IMB_JOB *job)
+; arg 1 : job
+MKGLOBAL(AES_CNTR_CCM,function,internal)
+AES_CNTR_CCM:
+        endbranch64
+        DO_CNTR CCM
+%else
+;; aes_cntr_x_vaes_avx2(void *in, void *IV, void *keys, void *out,
+;;                      UINT64 num_bytes, UINT64 iv_len)
+MKGLOBAL(AES_CNTR,function,internal)
+AES_CNTR:
+        endbranch64
+        DO_CNTR CNTR
+
+;; aes_cntr_bit_x_vaes_avx2(void *in, void *IV, void *keys, void *out,
+;;                          UINT64 num_bits, UINT64 iv_len)
+align 32
+MKGLOBAL(AES_CNTR_BIT,function,internal)
+AES_CNTR_BIT:
+        endbranch64
+        DO_CNTR CNTR_BIT
+%endif ;; CNTR_CCM_AVX2
+
+mksection stack-noexec
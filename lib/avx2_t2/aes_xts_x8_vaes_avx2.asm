@@ -0,0 +1,251 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+
+;; AES-XTS (IEEE 1619) encryption and decryption of 8 independent
+;; data units (lanes) using VAES and AVX2
+;;
+;; Each YMM register holds 2 consecutive blocks of one lane,
+;; so the AES rounds of 16 blocks are done with 8 VAESENC/VAESDEC.
+;; Round keys of each lane are broadcast to both 128-bit lanes.
+;;
+;; Preserves all general purpose registers except RAX, R10, R11 and arg2
+;; Clobbers YMM0-13 (YMM6-13 are saved and restored on Windows)
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+
+mksection .text
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%else
+%define arg1	rcx
+%define arg2	rdx
+%endif
+
+%define ARGS		arg1
+%define NUM_BLOCKS	arg2
+
+%define IDX		r10	;; offset of the blocks in the lanes
+%define PTR		r11
+%define KEYS		rax
+
+;; offsets of the fields in AES_XTS_ARGS
+%define _in		0
+%define _out		(16 * 8)
+%define _keys		(16 * 8 * 2)
+%define _tweak		(16 * 8 * 3)
+
+%define XMM_STORAGE	(16 * 8)
+%define XMM_SAVE_START	6
+
+;; =============================================================================
+;; Save/restore XMM6-XMM13 on Windows
+;; =============================================================================
+%macro FUNC_SAVE 0
+%ifndef LINUX
+	sub		rsp, XMM_STORAGE
+%assign i 0
+%rep 8
+%assign j (i + XMM_SAVE_START)
+	vmovdqu		[rsp + i*16], xmm %+ j
+%assign i (i + 1)
+%endrep
+%endif
+%endmacro
+
+%macro FUNC_RESTORE 0
+%ifndef LINUX
+%ifdef SAFE_DATA
+	clear_scratch_ymms_asm
+%endif
+%assign i 0
+%rep 8
+%assign j (i + XMM_SAVE_START)
+	vmovdqu		xmm %+ j, [rsp + i*16]
+%ifdef SAFE_DATA
+	vmovdqu		[rsp + i*16], xmm0
+%endif
+%assign i (i + 1)
+%endrep
+	add		rsp, XMM_STORAGE
+%else
+%ifdef SAFE_DATA
+	clear_scratch_ymms_asm
+%endif
+%endif
+	vzeroupper
+%endmacro
+
+;; =============================================================================
+;; Multiplies 2 tweaks (one per 128-bit lane) by alpha^2
+;; =============================================================================
+%macro XTS_NEXT_TWEAKS_X2 4
+%define %%T	%1	;; [in/out] YMM with 2 tweaks
+%define %%C	%2	;; [clobbered] YMM temp
+%define %%D	%3	;; [clobbered] YMM temp
+%define %%E	%4	;; [clobbered] YMM temp
+
+	vpsrlq		%%C, %%T, 62
+	vpsllq		%%T, %%T, 2
+	;; carry of each quad word goes to the other quad word
+	vpshufd		%%C, %%C, 0x4e
+	;; carry out of the tweak is reduced: C x 0x87 (carry-less)
+	vpsllq		%%D, %%C, 1
+	vpsllq		%%E, %%C, 2
+	vpxor		%%D, %%D, %%E
+	vpsllq		%%E, %%C, 7
+	vpxor		%%D, %%D, %%E
+	vpxor		%%D, %%D, %%C
+	vpblendd	%%C, %%D, %%C, 0xcc
+	vpxor		%%T, %%T, %%C
+%endmacro
+
+;; =============================================================================
+;; Encrypts/decrypts NUM_BLOCKS blocks (multiple of 2) of 8 lanes
+;; =============================================================================
+%macro AES_XTS_X8 2
+%define %%NROUNDS	%1	;; [in] number of AES rounds (10 or 14)
+%define %%DIR		%2	;; [in] ENC or DEC
+
+	shr		NUM_BLOCKS, 1
+	jz		%%_exit
+
+	FUNC_SAVE
+
+	xor		IDX, IDX
+%%_main_loop:
+	;; load 2 blocks of each lane and XOR them with their tweaks
+%assign i 0
+%rep 8
+	mov		PTR, [ARGS + _in + 8*i]
+	vmovdqu		ymm %+ i, [PTR + IDX]
+	vpxor		ymm %+ i, ymm %+ i, [ARGS + _tweak + 64*i]
+%assign i (i + 1)
+%endrep
+
+	;; AES rounds of all lanes
+%assign r 0
+%rep (%%NROUNDS + 1)
+%assign i 0
+%rep 8
+%assign k (8 + (i % 6))
+	mov		KEYS, [ARGS + _keys + 8*i]
+	vbroadcasti128	ymm %+ k, [KEYS + 16*r]
+%if r == 0
+	vpxor		ymm %+ i, ymm %+ i, ymm %+ k
+%elif r == %%NROUNDS
+%ifidn %%DIR, ENC
+	vaesenclast	ymm %+ i, ymm %+ i, ymm %+ k
+%else
+	vaesdeclast	ymm %+ i, ymm %+ i, ymm %+ k
+%endif
+%else
+%ifidn %%DIR, ENC
+	vaesenc		ymm %+ i, ymm %+ i, ymm %+ k
+%else
+	vaesdec		ymm %+ i, ymm %+ i, ymm %+ k
+%endif
+%endif
+%assign i (i + 1)
+%endrep
+%assign r (r + 1)
+%endrep
+
+	;; XOR the blocks with their tweaks, store them
+	;; and compute the tweaks of the next 2 blocks
+%assign i 0
+%rep 8
+	vmovdqu		ymm8, [ARGS + _tweak + 64*i]
+	vpxor		ymm %+ i, ymm %+ i, ymm8
+	mov		PTR, [ARGS + _out + 8*i]
+	vmovdqu		[PTR + IDX], ymm %+ i
+	XTS_NEXT_TWEAKS_X2 ymm8, ymm9, ymm10, ymm11
+	vmovdqu		[ARGS + _tweak + 64*i], ymm8
+%assign i (i + 1)
+%endrep
+
+	add		IDX, 32
+	dec		NUM_BLOCKS
+	jnz		%%_main_loop
+
+	;; update input and output pointers
+%assign i 0
+%rep 8
+	add		[ARGS + _in + 8*i], IDX
+	add		[ARGS + _out + 8*i], IDX
+%assign i (i + 1)
+%endrep
+
+	FUNC_RESTORE
+%%_exit:
+%endmacro
+
+align 32
+;; void aes_xts_enc_128_x8_vaes_avx2(AES_XTS_ARGS *args,
+;;                                   const uint64_t num_blocks)
+;; arg 1 : ARGS - input/output pointers, keys and tweaks of 8 lanes,
+;;         pointers and tweaks updated on output
+;; arg 2 : NUM_BLOCKS - number of blocks per lane (multiple of 2)
+MKGLOBAL(aes_xts_enc_128_x8_vaes_avx2,function,internal)
+aes_xts_enc_128_x8_vaes_avx2:
+        endbranch64
+	AES_XTS_X8 10, ENC
+	ret
+
+align 32
+;; void aes_xts_dec_128_x8_vaes_avx2(AES_XTS_ARGS *args,
+;;                                   const uint64_t num_blocks)
+MKGLOBAL(aes_xts_dec_128_x8_vaes_avx2,function,internal)
+aes_xts_dec_128_x8_vaes_avx2:
+        endbranch64
+	AES_XTS_X8 10, DEC
+	ret
+
+align 32
+;; void aes_xts_enc_256_x8_vaes_avx2(AES_XTS_ARGS *args,
+;;                                   const uint64_t num_blocks)
+MKGLOBAL(aes_xts_enc_256_x8_vaes_avx2,function,internal)
+aes_xts_enc_256_x8_vaes_avx2:
+        endbranch64
+	AES_XTS_X8 14, ENC
+	ret
+
+align 32
+;; void aes_xts_dec_256_x8_vaes_avx2(AES_XTS_ARGS *args,
+;;                                   const uint64_t num_blocks)
+MKGLOBAL(aes_xts_dec_256_x8_vaes_avx2,function,internal)
+aes_xts_dec_256_x8_vaes_avx2:
+        endbranch64
+	AES_XTS_X8 14, DEC
+	ret
+
+mksection stack-noexec
@@ -0,0 +1,358 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+
+;; SNOW-V for 4 independent streams using VAES and AVX2
+;;
+;; Each 128-bit lane of a YMM register holds the state of one stream,
+;; so the FSM AES rounds of 2 streams are done with one VAESENC.
+;; The 4 streams are processed as 2 pairs.
+;;
+;; Implementation based on
+;; Patrik Ekdahl1, Thomas Johansson2, Alexander Maximov1 and Jing Yang2
+;; abstract : 'A new SNOW stream cipher called SNOW-V'
+;; https://eprint.iacr.org/2018/1143.pdf
+;;
+;; Preserves all general purpose registers except RAX, R10 and R11
+;; Clobbers YMM0-5 (YMM6-14 are saved and restored on Windows)
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+
+mksection .rodata
+default rel
+
+align 32
+;; permutation: [ 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 ]
+sigma:
+dq 0xd0905010c080400, 0xf0b07030e0a0602
+dq 0xd0905010c080400, 0xf0b07030e0a0602
+
+align 32
+alpha:
+times 16 dw 0x990f
+
+align 32
+alpha_inv:
+times 16 dw 0xcc87
+
+align 32
+beta:
+times 16 dw 0xc963
+
+align 32
+beta_inv:
+times 16 dw 0xe4b1
+
+mksection .text
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%define arg3	rdx
+%else
+%define arg1	rcx
+%define arg2	rdx
+%define arg3	r8
+%endif
+
+%define STATE		arg1
+%define KS		arg2
+%define NUM_BLOCKS	arg3
+
+%define PAIR		r10	;; offset of the stream pair in the state rows
+%define KS_PTR		r11
+
+;; offsets of the state rows in SNOW_V_X4_STATE (4 streams x 16 bytes each)
+%define _lfsr_a_lo	(0 * 64)
+%define _lfsr_a_hi	(1 * 64)
+%define _lfsr_b_lo	(2 * 64)
+%define _lfsr_b_hi	(3 * 64)
+%define _fsm_r1		(4 * 64)
+%define _fsm_r2		(5 * 64)
+%define _fsm_r3		(6 * 64)
+
+%define LFSR_A_LO	ymm0	;; LFSR A: (a7, ..., a0) of 2 streams
+%define LFSR_A_HI	ymm1	;; LFSR A: (a15, ..., a8) of 2 streams
+%define LFSR_B_LO	ymm2	;; LFSR B: (b7, ..., b0) of 2 streams
+%define LFSR_B_HI	ymm3	;; LFSR B: (b15, ..., b8) of 2 streams
+%define FSM_R1		ymm4
+%define FSM_R2		ymm5
+%define FSM_R3		ymm6
+%define KEYSTREAM	ymm7
+%define TEMP1		ymm8
+%define TEMP2		ymm9
+%define TEMP3		ymm10
+%define ZERO		ymm11
+%define SIGMA		ymm12
+%define KEY_LO		ymm13
+%define KEY_HI		ymm14
+
+%define XMM_STORAGE	(16 * 9)
+%define XMM_SAVE_START	6
+
+;; =============================================================================
+;; Save/restore XMM6-XMM14 on Windows
+;; =============================================================================
+%macro FUNC_SAVE 0
+%ifndef LINUX
+	sub		rsp, XMM_STORAGE
+%assign i 0
+%rep 9
+%assign j (i + XMM_SAVE_START)
+	vmovdqu		[rsp + i*16], xmm %+ j
+%assign i (i + 1)
+%endrep
+%endif
+%endmacro
+
+%macro FUNC_RESTORE 0
+%ifndef LINUX
+%ifdef SAFE_DATA
+	clear_scratch_ymms_asm
+%endif
+%assign i 0
+%rep 9
+%assign j (i + XMM_SAVE_START)
+	vmovdqu		xmm %+ j, [rsp + i*16]
+%ifdef SAFE_DATA
+	vmovdqu		[rsp + i*16], xmm0
+%endif
+%assign i (i + 1)
+%endrep
+	add		rsp, XMM_STORAGE
+%else
+%ifdef SAFE_DATA
+	clear_scratch_ymms_asm
+%endif
+%endif
+	vzeroupper
+%endmacro
+
+;; =============================================================================
+;; Load/store LFSR and FSM of the stream pair
+;; =============================================================================
+%macro SNOW_V_X2_LOAD_STATE 0
+	vmovdqu		LFSR_A_LO, [STATE + PAIR + _lfsr_a_lo]
+	vmovdqu		LFSR_A_HI, [STATE + PAIR + _lfsr_a_hi]
+	vmovdqu		LFSR_B_LO, [STATE + PAIR + _lfsr_b_lo]
+	vmovdqu		LFSR_B_HI, [STATE + PAIR + _lfsr_b_hi]
+	vmovdqu		FSM_R1, [STATE + PAIR + _fsm_r1]
+	vmovdqu		FSM_R2, [STATE + PAIR + _fsm_r2]
+	vmovdqu		FSM_R3, [STATE + PAIR + _fsm_r3]
+%endmacro
+
+%macro SNOW_V_X2_STORE_STATE 0
+	vmovdqu		[STATE + PAIR + _lfsr_a_lo], LFSR_A_LO
+	vmovdqu		[STATE + PAIR + _lfsr_a_hi], LFSR_A_HI
+	vmovdqu		[STATE + PAIR + _lfsr_b_lo], LFSR_B_LO
+	vmovdqu		[STATE + PAIR + _lfsr_b_hi], LFSR_B_HI
+	vmovdqu		[STATE + PAIR + _fsm_r1], FSM_R1
+	vmovdqu		[STATE + PAIR + _fsm_r2], FSM_R2
+	vmovdqu		[STATE + PAIR + _fsm_r3], FSM_R3
+%endmacro
+
+;; =============================================================================
+;; Calculate 128-bit keystream of 2 streams: z = (b15...b8 + R1) xor R2
+;; =============================================================================
+%macro SNOW_V_X2_KEYSTREAM 0
+	vpaddd		KEYSTREAM, LFSR_B_HI, FSM_R1
+	vpxor		KEYSTREAM, KEYSTREAM, FSM_R2
+%endmacro
+
+;; =============================================================================
+;; Update FSM of 2 streams
+;; =============================================================================
+%macro SNOW_V_X2_FSM_UPDATE 0
+	vpxor		TEMP1, LFSR_A_LO, FSM_R3	;; TEMP1 = R3 XOR LSFR_A [0:7]
+	vpaddd		TEMP1, TEMP1, FSM_R2		;; TEMP1 += R2
+	vaesenc		FSM_R3, FSM_R2, ZERO		;; R3 = AESR(R2) (round key C1 = 0)
+	vaesenc		FSM_R2, FSM_R1, ZERO		;; R2 = AESR(R1) (round key C2 = 0)
+	vpshufb		FSM_R1, TEMP1, SIGMA		;; R1 = sigma(TEMP1)
+%endmacro
+
+;; =============================================================================
+;; Update LFSR of 2 streams
+;;
+;; for i in [0,7]:
+;;    tmpa_i = alpha*a_i + alpha^-1*a_(i+8) + b_i + a_(i+1) mod g^A(alpha)
+;;    tmpb_i =  beta*b_i +  beta^-1*b_(i+8) + a_i + b_(i+3) mod g^B(beta)
+;;
+;; (a15, a14, ..., a0) = (tmpa_7, ..., tmpa_0, a15, ..., a8)
+;; (b15, b14, ..., b0) = (tmpb_7, ..., tmpb_0, b15, ..., b8)
+;;
+;; alpha*x      = (x << 1) xor ((x >>> 15) and gA)
+;; (alpha^-1)*x = (x >> 1) xor (((x << 15) >>> 15) and inv_gA)
+;; (>>> is an arithmetic shift)
+;; =============================================================================
+%macro SNOW_V_X2_LFSR_UPDATE 0
+	;; TEMP1 = mulx_A
+	vpsraw		TEMP1, LFSR_A_LO, 15
+	vpand		TEMP1, TEMP1, [rel alpha]
+	vpsllw		TEMP2, LFSR_A_LO, 1
+	vpxor		TEMP1, TEMP1, TEMP2
+
+	;; TEMP1 = mulx_A xor invx_A
+	vpsllw		TEMP2, LFSR_A_HI, 15
+	vpsraw		TEMP2, TEMP2, 15
+	vpand		TEMP2, TEMP2, [rel alpha_inv]
+	vpxor		TEMP1, TEMP1, TEMP2
+	vpsrlw		TEMP2, LFSR_A_HI, 1
+	vpxor		TEMP1, TEMP1, TEMP2
+
+	;; TEMP1 = tmpa = mulx_A xor invx_A xor (a8, ..., a1) xor (b7, ..., b0)
+	vpalignr	TEMP2, LFSR_A_HI, LFSR_A_LO, 2	;; (a8, ..., a1)
+	vpxor		TEMP1, TEMP1, TEMP2
+	vpxor		TEMP1, TEMP1, LFSR_B_LO
+
+	;; TEMP2 = mulx_B
+	vpsraw		TEMP2, LFSR_B_LO, 15
+	vpand		TEMP2, TEMP2, [rel beta]
+	vpsllw		TEMP3, LFSR_B_LO, 1
+	vpxor		TEMP2, TEMP2, TEMP3
+
+	;; TEMP2 = mulx_B xor (a7, ..., a0) xor (b10, ..., b3)
+	vpxor		TEMP2, TEMP2, LFSR_A_LO
+	vpalignr	TEMP3, LFSR_B_HI, LFSR_B_LO, 6	;; (b10, ..., b3)
+	vpxor		TEMP2, TEMP2, TEMP3
+
+	;; TEMP2 = tmpb = mulx_B xor invx_B xor (a7, ..., a0) xor (b10, ..., b3)
+	vpsllw		TEMP3, LFSR_B_HI, 15
+	vpsraw		TEMP3, TEMP3, 15
+	vpand		TEMP3, TEMP3, [rel beta_inv]
+	vpxor		TEMP2, TEMP2, TEMP3
+	vpsrlw		TEMP3, LFSR_B_HI, 1
+	vpxor		TEMP2, TEMP2, TEMP3
+
+	vmovdqa		LFSR_A_LO, LFSR_A_HI
+	vmovdqa		LFSR_A_HI, TEMP1
+	vmovdqa		LFSR_B_LO, LFSR_B_HI
+	vmovdqa		LFSR_B_HI, TEMP2
+%endmacro
+
+;; =============================================================================
+;; One initialization round of 2 streams
+;; =============================================================================
+%macro SNOW_V_X2_INIT_ROUND 0
+	SNOW_V_X2_KEYSTREAM
+	SNOW_V_X2_FSM_UPDATE
+	SNOW_V_X2_LFSR_UPDATE
+	vpxor		LFSR_A_HI, LFSR_A_HI, KEYSTREAM
+%endmacro
+
+align 32
+;; void snow_v_init_x4_vaes_avx2(SNOW_V_X4_STATE *state)
+;; arg 1 : STATE - on input LFSR_A_LO holds the IVs, LFSR_A_HI and LFSR_B_HI
+;;         hold the keys (bytes 0-15 and 16-31), LFSR_B_LO is zero
+;;         (or the AEAD constant); on output initialized LFSR and FSM
+MKGLOBAL(snow_v_init_x4_vaes_avx2,function,internal)
+snow_v_init_x4_vaes_avx2:
+        endbranch64
+	FUNC_SAVE
+
+	vpxor		ZERO, ZERO, ZERO
+	vmovdqa		SIGMA, [rel sigma]
+
+	xor		PAIR, PAIR
+init_x2_pair_loop:
+	vmovdqu		LFSR_A_LO, [STATE + PAIR + _lfsr_a_lo]
+	vmovdqu		LFSR_A_HI, [STATE + PAIR + _lfsr_a_hi]
+	vmovdqu		LFSR_B_LO, [STATE + PAIR + _lfsr_b_lo]
+	vmovdqu		LFSR_B_HI, [STATE + PAIR + _lfsr_b_hi]
+	vmovdqa		KEY_LO, LFSR_A_HI
+	vmovdqa		KEY_HI, LFSR_B_HI
+
+	;; Init FSM: R1 = R2 = R3 = 0
+	vpxor		FSM_R1, FSM_R1, FSM_R1
+	vpxor		FSM_R2, FSM_R2, FSM_R2
+	vpxor		FSM_R3, FSM_R3, FSM_R3
+
+	mov		eax, 15
+init_x2_loop:
+	SNOW_V_X2_INIT_ROUND
+	dec		eax
+	jnz		init_x2_loop
+
+	vpxor		FSM_R1, FSM_R1, KEY_LO
+	SNOW_V_X2_INIT_ROUND
+	vpxor		FSM_R1, FSM_R1, KEY_HI
+
+	SNOW_V_X2_STORE_STATE
+
+	add		PAIR, 32
+	cmp		PAIR, 64
+	jne		init_x2_pair_loop
+
+	FUNC_RESTORE
+	ret
+
+align 32
+;; void snow_v_keystream_x4_vaes_avx2(SNOW_V_X4_STATE *state, uint8_t *ks,
+;;                                   const uint64_t num_blocks)
+;; arg 1 : STATE - LFSR and FSM of 4 streams, updated on output
+;; arg 2 : KS - output keystream, num_blocks x 64 bytes
+;;         (16 bytes of each of the 4 streams per block)
+;; arg 3 : NUM_BLOCKS - number of 16-byte keystream blocks per stream
+MKGLOBAL(snow_v_keystream_x4_vaes_avx2,function,internal)
+snow_v_keystream_x4_vaes_avx2:
+        endbranch64
+	or		NUM_BLOCKS, NUM_BLOCKS
+	jz		keystream_x2_exit
+
+	FUNC_SAVE
+
+	vpxor		ZERO, ZERO, ZERO
+	vmovdqa		SIGMA, [rel sigma]
+
+	xor		PAIR, PAIR
+keystream_x2_pair_loop:
+	SNOW_V_X2_LOAD_STATE
+
+	lea		KS_PTR, [KS + PAIR]
+	mov		rax, NUM_BLOCKS
+keystream_x2_loop:
+	SNOW_V_X2_KEYSTREAM
+	vmovdqu		[KS_PTR], KEYSTREAM
+	SNOW_V_X2_FSM_UPDATE
+	SNOW_V_X2_LFSR_UPDATE
+	add		KS_PTR, 64
+	dec		rax
+	jnz		keystream_x2_loop
+
+	SNOW_V_X2_STORE_STATE
+
+	add		PAIR, 32
+	cmp		PAIR, 64
+	jne		keystream_x2_pair_loop
+
+	FUNC_RESTORE
+keystream_x2_exit:
+	ret
+
+mksection stack-noexec
@@ -0,0 +1,68 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+#include "include/kasumi_mb_mgr.h"
+#include "include/arch_avx512_type1.h"
+
+/* ========================================================================== */
+/*
+ * KASUMI-UEA1 MB API
+ */
+
+IMB_DLL_LOCAL
+IMB_JOB *submit_job_kasumi_uea1_avx512(MB_MGR_KASUMI_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_kasumi(state, job, AVX512_NUM_KASUMI_LANES, 1,
+                                       KASUMI_MB_F8, kasumi_x16_avx512);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *flush_job_kasumi_uea1_avx512(MB_MGR_KASUMI_OOO *state)
+{
+        return submit_flush_job_kasumi(state, NULL, AVX512_NUM_KASUMI_LANES, 0,
+                                       KASUMI_MB_F8, kasumi_x16_avx512);
+}
+
+/* ========================================================================== */
+/*
+ * KASUMI-UIA1 MB API
+ */
+
+IMB_DLL_LOCAL
+IMB_JOB *submit_job_kasumi_uia1_avx512(MB_MGR_KASUMI_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_kasumi(state, job, AVX512_NUM_KASUMI_LANES, 1,
+                                       KASUMI_MB_F9, kasumi_x16_avx512);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *flush_job_kasumi_uia1_avx512(MB_MGR_KASUMI_OOO *state)
+{
+        return submit_flush_job_kasumi(state, NULL, AVX512_NUM_KASUMI_LANES, 0,
+                                       KASUMI_MB_F9, kasumi_x16_avx512);
+}
@@ -0,0 +1,362 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+;; 16-lane KASUMI block cipher using AVX512
+;;
+;; S-box lookups are done in constant time with VPERMI2W word permutes
+;; over 64-entry slices of the expanded S7/S9 tables.
+;;
+;; Preserves all general purpose registers
+;; Clobbers ZMM0-5, ZMM16-31
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+
+mksection .rodata
+default rel
+
+align 64
+kasumi_S7e:
+	dw	0x6c00, 0x6601, 0x7802, 0x7603, 0x2404, 0x4e05, 0xb006, 0xce07
+	dw	0x5c08, 0x1e09, 0x6a0a, 0xac0b, 0x1c0c, 0x3e0d, 0xea0e, 0x5c0f
+	dw	0x4e10, 0xc011, 0x6a12, 0xc213, 0x0214, 0xac15, 0xae16, 0x3617
+	dw	0x6e18, 0xa019, 0x681a, 0x001b, 0x0a1c, 0xe41d, 0xc41e, 0x9c1f
+	dw	0x2a20, 0x5021, 0xb622, 0xd823, 0x2024, 0x3225, 0x3826, 0x2e27
+	dw	0x9a28, 0xac29, 0x042a, 0xa62b, 0x882c, 0xd62d, 0xd22e, 0x082f
+	dw	0x4830, 0x9631, 0xf432, 0x1c33, 0x4634, 0xb035, 0x7636, 0xa637
+	dw	0xea38, 0x7039, 0x543a, 0x783b, 0xdc3c, 0x6e3d, 0xae3e, 0xba3f
+	dw	0x6a40, 0x6a41, 0x1c42, 0x9043, 0x3a44, 0x5e45, 0x8c46, 0x7447
+	dw	0x7c48, 0x5449, 0x384a, 0x1c4b, 0xa44c, 0xe84d, 0x604e, 0x304f
+	dw	0x4050, 0xc451, 0x8652, 0xac53, 0x1654, 0xb655, 0x1856, 0x0657
+	dw	0x0658, 0xa259, 0xf25a, 0x785b, 0xf85c, 0x785d, 0x845e, 0x3a5f
+	dw	0x0c60, 0xfc61, 0xf062, 0x9c63, 0x5e64, 0xc265, 0x6666, 0x7667
+	dw	0x9a68, 0x4669, 0x746a, 0xb46b, 0x506c, 0xe06d, 0x3a6e, 0x866f
+	dw	0x6070, 0x3471, 0x3c72, 0xd673, 0x3474, 0x4c75, 0xa476, 0x7277
+	dw	0xa478, 0xd479, 0xea7a, 0xa47b, 0x487c, 0x147d, 0x8a7e, 0xf87f
+	dw	0x6c00, 0x6601, 0x7802, 0x7603, 0x2404, 0x4e05, 0xb006, 0xce07
+	dw	0x5c08, 0x1e09, 0x6a0a, 0xac0b, 0x1c0c, 0x3e0d, 0xea0e, 0x5c0f
+	dw	0x4e10, 0xc011, 0x6a12, 0xc213, 0x0214, 0xac15, 0xae16, 0x3617
+	dw	0x6e18, 0xa019, 0x681a, 0x001b, 0x0a1c, 0xe41d, 0xc41e, 0x9c1f
+	dw	0x2a20, 0x5021, 0xb622, 0xd823, 0x2024, 0x3225, 0x3826, 0x2e27
+	dw	0x9a28, 0xac29, 0x042a, 0xa62b, 0x882c, 0xd62d, 0xd22e, 0x082f
+	dw	0x4830, 0x9631, 0xf432, 0x1c33, 0x4634, 0xb035, 0x7636, 0xa637
+	dw	0xea38, 0x7039, 0x543a, 0x783b, 0xdc3c, 0x6e3d, 0xae3e, 0xba3f
+	dw	0x6a40, 0x6a41, 0x1c42, 0x9043, 0x3a44, 0x5e45, 0x8c46, 0x7447
+	dw	0x7c48, 0x5449, 0x384a, 0x1c4b, 0xa44c, 0xe84d, 0x604e, 0x304f
+	dw	0x4050, 0xc451, 0x8652, 0xac53, 0x1654, 0xb655, 0x1856, 0x0657
+	dw	0x0658, 0xa259, 0xf25a, 0x785b, 0xf85c, 0x785d, 0x845e, 0x3a5f
+	dw	0x0c60, 0xfc61, 0xf062, 0x9c63, 0x5e64, 0xc265, 0x6666, 0x7667
+	dw	0x9a68, 0x4669, 0x746a, 0xb46b, 0x506c, 0xe06d, 0x3a6e, 0x866f
+	dw	0x6070, 0x3471, 0x3c72, 0xd673, 0x3474, 0x4c75, 0xa476, 0x7277
+	dw	0xa478, 0xd479, 0xea7a, 0xa47b, 0x487c, 0x147d, 0x8a7e, 0xf87f
+
+align 64
+kasumi_S9e:
+	dw	0x4ea7, 0xdeef, 0x42a1, 0xf77b, 0x0f87, 0x9d4e, 0x1209, 0xa552
+	dw	0x4c26, 0xc4e2, 0x6030, 0xcd66, 0x89c4, 0x0381, 0xb45a, 0x1b8d
+	dw	0x6eb7, 0xfafd, 0x2693, 0x974b, 0x3f9f, 0xa954, 0x6633, 0xd56a
+	dw	0x6532, 0xe9f4, 0x0d06, 0xa452, 0xb0d8, 0x3e9f, 0xc964, 0x62b1
+	dw	0x5eaf, 0xe2f1, 0xd3e9, 0x4a25, 0x9cce, 0x2211, 0x0000, 0x9b4d
+	dw	0x582c, 0xfcfe, 0xf57a, 0x743a, 0x1e8f, 0xb8dc, 0xa251, 0x2190
+	dw	0xbe5f, 0x0603, 0x773b, 0xeaf5, 0x6c36, 0xd6eb, 0xb4da, 0x2b95
+	dw	0xb1d8, 0x1108, 0x58ac, 0xddee, 0xe773, 0x4522, 0x1f8f, 0x984c
+	dw	0x4aa5, 0x8ac5, 0x178b, 0xf279, 0x0301, 0xc1e0, 0x4fa7, 0xa8d4
+	dw	0xe0f0, 0x381c, 0x9dce, 0x60b0, 0x2d96, 0xf7fb, 0x4120, 0xbedf
+	dw	0xebf5, 0x2f97, 0xf2f9, 0x1309, 0xb259, 0x74ba, 0xbadd, 0x59ac
+	dw	0x48a4, 0x944a, 0x71b8, 0x88c4, 0x95ca, 0x4ba5, 0xbd5e, 0x46a3
+	dw	0xd0e8, 0x3c9e, 0x0c86, 0xc562, 0x1a0d, 0xf4fa, 0xd7eb, 0x1c8e
+	dw	0x7ebf, 0x8a45, 0x82c1, 0x53a9, 0x3098, 0xc6e3, 0xdd6e, 0x0e87
+	dw	0xb158, 0x592c, 0x2914, 0xe4f2, 0x6bb5, 0x8140, 0xe271, 0x2d16
+	dw	0x160b, 0xe6f3, 0xae57, 0x7b3d, 0x4824, 0xba5d, 0xe1f0, 0x361b
+	dw	0xcfe7, 0x7dbe, 0xc5e2, 0x5229, 0x8844, 0x389c, 0x93c9, 0x0683
+	dw	0x8d46, 0x2793, 0xa753, 0x2814, 0x4e27, 0xe673, 0x75ba, 0xf87c
+	dw	0xb7db, 0x0180, 0xf9fc, 0x6a35, 0xe070, 0x54aa, 0xbfdf, 0x2e97
+	dw	0xfc7e, 0x52a9, 0x9249, 0x190c, 0x2f17, 0x8341, 0x50a8, 0xd96c
+	dw	0xd76b, 0x4924, 0x5c2e, 0xe7f3, 0x1389, 0x8f47, 0x8944, 0x3018
+	dw	0x91c8, 0x170b, 0x3a9d, 0x99cc, 0xd1e8, 0x55aa, 0x6b35, 0xcae5
+	dw	0x6fb7, 0xf5fa, 0xa0d0, 0x1f0f, 0xbb5d, 0x2391, 0x65b2, 0xd8ec
+	dw	0x2010, 0xa2d1, 0xcf67, 0x6834, 0x7038, 0xf078, 0x8ec7, 0x2b15
+	dw	0xa3d1, 0x41a0, 0xf8fc, 0x3f1f, 0xecf6, 0x0c06, 0xa653, 0x6331
+	dw	0x49a4, 0xb359, 0x3299, 0xedf6, 0x8241, 0x7a3d, 0xe8f4, 0x351a
+	dw	0x5aad, 0xbcde, 0x45a2, 0x8643, 0x0582, 0xe170, 0x0b05, 0xca65
+	dw	0xb9dc, 0x4723, 0x86c3, 0x5dae, 0x6231, 0x9e4f, 0x4ca6, 0x954a
+	dw	0x3118, 0xff7f, 0xeb75, 0x0080, 0xfd7e, 0x3198, 0x369b, 0xdfef
+	dw	0xdf6f, 0x0984, 0x2512, 0xd66b, 0x97cb, 0x43a1, 0x7c3e, 0x8dc6
+	dw	0x0884, 0xc2e1, 0x96cb, 0x793c, 0xd4ea, 0x1c0e, 0x5b2d, 0xb65b
+	dw	0xeff7, 0x3d1e, 0x51a8, 0xa6d3, 0xb75b, 0x6733, 0x188c, 0xed76
+	dw	0x4623, 0xce67, 0xfa7d, 0x57ab, 0x2613, 0xacd6, 0x8bc5, 0x2492
+	dw	0xe5f2, 0x753a, 0x79bc, 0xcce6, 0x0100, 0x9349, 0x8cc6, 0x3b1d
+	dw	0x6432, 0xe874, 0x9c4e, 0x359a, 0x140a, 0x9acd, 0xfdfe, 0x56ab
+	dw	0xcee7, 0x5a2d, 0x168b, 0xa7d3, 0x3a1d, 0xac56, 0xf3f9, 0x4020
+	dw	0x9048, 0x341a, 0xad56, 0x2c96, 0x7339, 0xd5ea, 0x5faf, 0xdcee
+	dw	0x379b, 0x8b45, 0x2a95, 0xb3d9, 0x5028, 0xee77, 0x5cae, 0xc763
+	dw	0x72b9, 0xd2e9, 0x0b85, 0x8e47, 0x81c0, 0x2311, 0xe974, 0x6e37
+	dw	0xdc6e, 0x64b2, 0x8542, 0x180c, 0xabd5, 0x1188, 0xe371, 0x7cbe
+	dw	0x0201, 0xda6d, 0xef77, 0x1289, 0x6ab5, 0xb058, 0x964b, 0x6934
+	dw	0x0904, 0xc9e4, 0xc462, 0x2110, 0xe572, 0x2713, 0x399c, 0xde6f
+	dw	0xa150, 0x7d3e, 0x0804, 0xf1f8, 0xd9ec, 0x0703, 0x6130, 0x9a4d
+	dw	0xa351, 0x67b3, 0x2a15, 0xcb65, 0x5f2f, 0x994c, 0xc7e3, 0x2412
+	dw	0x5e2f, 0xaa55, 0x3219, 0xe3f1, 0xb5da, 0x4321, 0xc864, 0x1b0d
+	dw	0x5128, 0xbdde, 0x1d0e, 0xd46a, 0x3e1f, 0xd068, 0x63b1, 0xa854
+	dw	0x3d9e, 0xcde6, 0x158a, 0xc060, 0xc663, 0x349a, 0xffff, 0x2894
+	dw	0x3b9d, 0xd369, 0x3399, 0xfeff, 0x44a2, 0xaed7, 0x5d2e, 0x92c9
+	dw	0x150a, 0xbf5f, 0xaf57, 0x2090, 0x73b9, 0xdb6d, 0xd86c, 0x552a
+	dw	0xf6fb, 0x4422, 0x6cb6, 0xfbfd, 0x148a, 0xa4d2, 0x9f4f, 0x0a85
+	dw	0x6f37, 0xc160, 0x9148, 0x1a8d, 0x198c, 0xb55a, 0xf67b, 0x7f3f
+	dw	0x85c2, 0x3319, 0x5bad, 0xc8e4, 0x77bb, 0xc3e1, 0xb85c, 0x2994
+	dw	0xcbe5, 0x4da6, 0xf0f8, 0x5329, 0x2e17, 0xaad5, 0x0482, 0xa5d2
+	dw	0x2c16, 0xb2d9, 0x371b, 0x8c46, 0x4d26, 0xd168, 0x47a3, 0xfe7f
+	dw	0x7138, 0xf379, 0x0e07, 0xa9d4, 0x84c2, 0x0402, 0xea75, 0x4f27
+	dw	0x9fcf, 0x0502, 0xc0e0, 0x7fbf, 0xeef7, 0x76bb, 0xa050, 0x1d8e
+	dw	0x391c, 0xc361, 0xd269, 0x0d86, 0x572b, 0xafd7, 0xadd6, 0x70b8
+	dw	0x7239, 0x90c8, 0xb95c, 0x7e3f, 0x98cc, 0x78bc, 0x4221, 0x87c3
+	dw	0xc261, 0x3c1e, 0x6d36, 0xb6db, 0xbc5e, 0x40a0, 0x0281, 0xdbed
+	dw	0x8040, 0x66b3, 0x0f07, 0xcc66, 0x7abd, 0x9ecf, 0xe472, 0x2592
+	dw	0x6db6, 0xbbdd, 0x0783, 0xf47a, 0x80c0, 0x542a, 0xfb7d, 0x0a05
+	dw	0x2291, 0xec76, 0x68b4, 0x83c1, 0x4b25, 0x8743, 0x1088, 0xf97c
+	dw	0x562b, 0x8442, 0x783c, 0x8fc7, 0xab55, 0x7bbd, 0x94ca, 0x61b0
+	dw	0x1008, 0xdaed, 0x1e0f, 0xf178, 0x69b4, 0xa1d0, 0x763b, 0x9bcd
+
+align 64
+;; dword indices to interleave low/high dwords of the 16 lanes into qwords
+interleave_lanes_0_7:
+	dd	0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23
+interleave_lanes_8_15:
+	dd	8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31
+
+align 4
+chunk_ids:
+	dd	0, 1, 2, 3, 4, 5, 6, 7
+dw_ffff:
+	dd	0x0000ffff
+dw_ff:
+	dd	0x000000ff
+dw_1ff:
+	dd	0x000001ff
+
+mksection .text
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%else
+%define arg1	rcx
+%define arg2	rdx
+%endif
+
+%define KS	arg1
+%define DATA	arg2
+
+;; Block words (16 lanes, one 16-bit word per dword)
+%define D0	zmm0
+%define D1	zmm1
+%define D2	zmm2
+%define D3	zmm3
+%define H	zmm4
+%define L	zmm5
+
+%define KEY	zmm16
+%define IDX7	zmm17
+%define IDX9	zmm18
+%define RES7	zmm19
+%define RES9	zmm20
+%define ZPERM	zmm21
+%define ZTAB	zmm22
+%define CHUNK	zmm23
+%define MASK16	zmm24
+%define MASK8	zmm25
+%define MASK9	zmm26
+%define ZT0	zmm27
+%define ZT1	zmm28
+
+;;
+;; Constant time lookup of 16 x 16-bit values in a 16-bit table
+;; (NUM_CHUNKS x 64 entries). Indices and results are stored in dwords.
+;;
+%macro LOOKUP16_X16 4
+%define %%IDX		%1	;; [in] zmm with 16 x 32-bit indices
+%define %%RET		%2	;; [out] zmm with 16 x 32-bit looked up values
+%define %%TABLE		%3	;; [in] table label
+%define %%NUM_CHUNKS	%4	;; [in] number of 64-entry slices in the table
+
+%if %%NUM_CHUNKS > 1
+	vpsrld		CHUNK, %%IDX, 6
+%endif
+%assign %%c 0
+%rep %%NUM_CHUNKS
+	vmovdqu16	ZTAB, [rel %%TABLE + %%c*128]
+	vmovdqa64	ZPERM, %%IDX
+	vpermi2w	ZPERM, ZTAB, [rel %%TABLE + %%c*128 + 64]
+%if %%c == 0
+	vmovdqa64	%%RET, ZPERM
+%else
+	vpcmpd		k1, CHUNK, [rel chunk_ids + 4*%%c]{1to16}, 0
+	vmovdqa32	%%RET{k1}, ZPERM
+%endif
+%assign %%c (%%c + 1)
+%endrep
+	;; upper words got permuted too, keep the looked up word only
+	vpandd		%%RET, %%RET, MASK16
+%endmacro
+
+;;
+;; 16-bit rotate left of 16 words held in dwords
+;;
+%macro ROL16_X16 3
+%define %%IN_OUT	%1	;; [in/out] zmm
+%define %%NROT		%2	;; [in] number of bits to rotate
+%define %%TMP		%3	;; [clobbered] zmm
+
+	vpslld		%%TMP, %%IN_OUT, %%NROT
+	vpsrld		%%IN_OUT, %%IN_OUT, (16 - %%NROT)
+	vpternlogd	%%IN_OUT, %%TMP, MASK16, 0xA8	; (IN_OUT | TMP) & MASK16
+%endmacro
+
+;;
+;; FI function: DATA = FI(DATA ^ KEY1, KEY2) ^ KEY3
+;;
+%macro FI_X16 4
+%define %%DATA		%1	;; [in/out] zmm
+%define %%KEY1		%2	;; [in] key schedule row of subkey 1
+%define %%KEY2		%3	;; [in] key schedule row of subkey 2
+%define %%KEY3		%4	;; [in] zmm with 3rd value to XOR
+
+	vpmovzxwd	KEY, [KS + %%KEY1*32]
+	vpxord		%%DATA, %%DATA, KEY
+	vpandd		IDX7, %%DATA, MASK8
+	vpsrld		IDX9, %%DATA, 7
+	LOOKUP16_X16	IDX7, RES7, kasumi_S7e, 4
+	LOOKUP16_X16	IDX9, RES9, kasumi_S9e, 8
+	vpmovzxwd	KEY, [KS + %%KEY2*32]
+	vpternlogd	RES7, RES9, KEY, 0x96
+	vpsrld		IDX7, RES7, 9
+	vpandd		IDX9, RES7, MASK9
+	LOOKUP16_X16	IDX7, %%DATA, kasumi_S7e, 2
+	LOOKUP16_X16	IDX9, RES9, kasumi_S9e, 8
+	vpternlogd	%%DATA, RES9, %%KEY3, 0x96
+%endmacro
+
+;;
+;; FL function on (H, L) with subkeys at rows ROW and ROW + 1
+;;
+%macro FL_X16 1
+%define %%ROW		%1
+
+	vpmovzxwd	KEY, [KS + %%ROW*32]
+	vpandd		ZT0, L, KEY			; r = l & k1
+	ROL16_X16	ZT0, 1, ZT1
+	vpxord		ZT0, ZT0, H			; r = h ^ rol(r, 1)
+	vpmovzxwd	KEY, [KS + (%%ROW + 1)*32]
+	vpord		H, ZT0, KEY			; l' = r | k2
+	ROL16_X16	H, 1, ZT1
+	vpxord		H, H, L				; h = l ^ rol(l', 1)
+	vmovdqa64	L, ZT0				; l = r
+%endmacro
+
+;;
+;; FO function on (H, L) with subkeys at rows ROW + 2 ... ROW + 7
+;;
+%macro FO_X16 1
+%define %%ROW		%1
+
+	FI_X16	H, (%%ROW + 2), (%%ROW + 3), L
+	FI_X16	L, (%%ROW + 4), (%%ROW + 5), H
+	FI_X16	H, (%%ROW + 6), (%%ROW + 7), L
+%endmacro
+
+align 64
+;; void kasumi_x16_avx512(const uint16_t *ks, uint64_t *data)
+;; arg 1 : KS - key schedules of 16 lanes, transposed: ks[64][16]
+;; arg 2 : DATA - 16 blocks (one per lane) to encrypt in place, in the same
+;;         word layout as kasumi_union_t (b16[0] is the least significant word)
+MKGLOBAL(kasumi_x16_avx512,function,internal)
+kasumi_x16_avx512:
+        endbranch64
+	vpbroadcastd	MASK16, [rel dw_ffff]
+	vpbroadcastd	MASK8, [rel dw_ff]
+	vpbroadcastd	MASK9, [rel dw_1ff]
+
+	;; split 16 x 64-bit blocks into 4 rows of 16-bit words
+	vmovdqu64	ZT0, [DATA]
+	vmovdqu64	ZT1, [DATA + 64]
+	vpmovqd		YWORD(D0), ZT0
+	vpmovqd		YWORD(D1), ZT1
+	vinserti64x4	D0, D0, YWORD(D1), 1	; low dwords of the blocks
+	vpsrlq		ZT0, ZT0, 32
+	vpsrlq		ZT1, ZT1, 32
+	vpmovqd		YWORD(D2), ZT0
+	vpmovqd		YWORD(D3), ZT1
+	vinserti64x4	D2, D2, YWORD(D3), 1	; high dwords of the blocks
+	vpsrld		D1, D0, 16
+	vpandd		D0, D0, MASK16
+	vpsrld		D3, D2, 16
+	vpandd		D2, D2, MASK16
+
+	;; 4 iterations odd/even
+%assign ROW 0
+%rep 4
+	;; even round
+	vmovdqa64	L, D3
+	vmovdqa64	H, D2
+	FL_X16		ROW
+	FO_X16		ROW
+	vpxord		D1, D1, L
+	vpxord		D0, D0, H
+%assign ROW (ROW + 8)
+
+	;; odd round
+	vmovdqa64	H, D1
+	vmovdqa64	L, D0
+	FO_X16		ROW
+	FL_X16		ROW
+	vpxord		D3, D3, H
+	vpxord		D2, D2, L
+%assign ROW (ROW + 8)
+%endrep
+
+	;; merge the 4 rows of words back into 16 x 64-bit blocks
+	vpslld		D1, D1, 16
+	vpord		D0, D0, D1
+	vpslld		D3, D3, 16
+	vpord		D2, D2, D3
+	vmovdqa64	ZT0, [rel interleave_lanes_0_7]
+	vmovdqa64	ZT1, [rel interleave_lanes_8_15]
+	vpermi2d	ZT0, D0, D2
+	vpermi2d	ZT1, D0, D2
+	vmovdqu64	[DATA], ZT0
+	vmovdqu64	[DATA + 64], ZT1
+
+%ifdef SAFE_DATA
+	clear_scratch_zmms_asm
+%else
+	vzeroupper
+%endif
+	ret
+
+mksection stack-noexec
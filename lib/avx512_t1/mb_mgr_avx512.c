@@ -48,9 +48,10 @@
 #include "include/noaesni.h"
 #include "include/aesni_emu.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 
 #include "include/arch_avx_type1.h" /* AESNI */
-#include "include/arch_avx2_type1.h" /* MD5 */
 #include "include/arch_avx512_type1.h"
 #include "include/arch_avx512_type2.h"
 
@@ -145,6 +146,11 @@
 #define SUBMIT_JOB_DOCSIS_DES_DEC submit_job_docsis_des_dec_avx512
 #define FLUSH_JOB_DOCSIS_DES_DEC flush_job_docsis_des_dec_avx512
 
+#define SUBMIT_JOB_CRC submit_job_crc_avx512
+#define FLUSH_JOB_CRC  flush_job_crc_avx512
+#define SUBMIT_JOB_CRC_MIN_LEN AVX512_CRC_MB_MIN_LEN
+#define SUBMIT_JOB_CRC_MAX_LEN AVX512_CRC_MB_MAX_LEN
+
 #define SUBMIT_JOB_AES_ENC SUBMIT_JOB_AES_ENC_AVX512
 #define FLUSH_JOB_AES_ENC  FLUSH_JOB_AES_ENC_AVX512
 #define SUBMIT_JOB_AES_DEC SUBMIT_JOB_AES_DEC_AVX512
@@ -154,9 +160,42 @@
 #define SUBMIT_JOB_CHACHA20_POLY1305_SGL aead_chacha20_poly1305_sgl_avx512
 #define POLY1305_MAC poly1305_mac_avx512
 
+#define SUBMIT_JOB_CHACHA20_MB submit_job_chacha20_mb_avx512
+#define FLUSH_JOB_CHACHA20_MB  flush_job_chacha20_mb_avx512
+
+static IMB_JOB *(*submit_chacha20_poly1305_mb_avx512_ptr)
+        (MB_MGR_CHACHA20_POLY1305_OOO *state, IMB_JOB *job) =
+                submit_job_chacha20_poly1305_mb_avx512;
+
+static IMB_JOB *(*flush_chacha20_poly1305_mb_avx512_ptr)
+        (MB_MGR_CHACHA20_POLY1305_OOO *state) =
+                flush_job_chacha20_poly1305_mb_avx512;
+
+static IMB_JOB *(*submit_poly1305_mb_avx512_ptr)
+        (MB_MGR_CHACHA20_POLY1305_OOO *state, IMB_JOB *job) =
+                submit_job_poly1305_mb_avx512;
+
+static IMB_JOB *(*flush_poly1305_mb_avx512_ptr)
+        (MB_MGR_CHACHA20_POLY1305_OOO *state) = flush_job_poly1305_mb_avx512;
+
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB submit_chacha20_poly1305_mb_avx512_ptr
+#define FLUSH_JOB_CHACHA20_POLY1305_MB  flush_chacha20_poly1305_mb_avx512_ptr
+#define SUBMIT_JOB_POLY1305_MB submit_poly1305_mb_avx512_ptr
+#define FLUSH_JOB_POLY1305_MB  flush_poly1305_mb_avx512_ptr
+
+#define SUBMIT_JOB_KASUMI_UEA1_MB submit_job_kasumi_uea1_avx512
+#define FLUSH_JOB_KASUMI_UEA1_MB  flush_job_kasumi_uea1_avx512
+#define SUBMIT_JOB_KASUMI_UIA1_MB submit_job_kasumi_uia1_avx512
+#define FLUSH_JOB_KASUMI_UIA1_MB  flush_job_kasumi_uia1_avx512
+
 #define SUBMIT_JOB_SNOW_V snow_v_avx
 #define SUBMIT_JOB_SNOW_V_AEAD snow_v_aead_init_avx
 
+#define SUBMIT_JOB_SNOW_V_MB         submit_job_snow_v_mb_avx512
+#define FLUSH_JOB_SNOW_V_MB          flush_job_snow_v_mb_avx512
+#define SUBMIT_JOB_SNOW_V_AEAD_MB    submit_job_snow_v_aead_mb_avx512
+#define FLUSH_JOB_SNOW_V_AEAD_MB     flush_job_snow_v_aead_mb_avx512
+
 static IMB_JOB *submit_snow3g_uea2_job_vaes_avx512(IMB_MGR *state, IMB_JOB *job)
 {
         MB_MGR_SNOW3G_OOO *snow3g_uea2_ooo = state->snow3g_uea2_ooo;
@@ -243,8 +282,8 @@ SUBMIT_JOB_DOCSIS_SEC_CRC_DEC(MB_MGR_DOCSIS_AES_OOO *state, IMB_JOB *job,
 #define FLUSH_JOB_HMAC_SHA_384        flush_job_hmac_sha_384_avx512
 #define SUBMIT_JOB_HMAC_SHA_512       submit_job_hmac_sha_512_avx512
 #define FLUSH_JOB_HMAC_SHA_512        flush_job_hmac_sha_512_avx512
-#define SUBMIT_JOB_HMAC_MD5           submit_job_hmac_md5_avx2
-#define FLUSH_JOB_HMAC_MD5            flush_job_hmac_md5_avx2
+#define SUBMIT_JOB_HMAC_MD5           submit_job_hmac_md5_avx512
+#define FLUSH_JOB_HMAC_MD5            flush_job_hmac_md5_avx512
 
 #define AES_GCM_DEC_128   aes_gcm_dec_128_avx512
 #define AES_GCM_ENC_128   aes_gcm_enc_128_avx512
@@ -277,6 +316,25 @@ SUBMIT_JOB_DOCSIS_SEC_CRC_DEC(MB_MGR_DOCSIS_AES_OOO *state, IMB_JOB *job,
 #define SUBMIT_JOB_AES_GCM_DEC submit_job_aes_gcm_dec_avx512
 #define SUBMIT_JOB_AES_GCM_ENC submit_job_aes_gcm_enc_avx512
 
+#define SUBMIT_JOB_AES128_XTS_ENC  submit_job_aes128_xts_enc_avx512
+#define FLUSH_JOB_AES128_XTS_ENC   flush_job_aes128_xts_enc_avx512
+#define SUBMIT_JOB_AES128_XTS_DEC  submit_job_aes128_xts_dec_avx512
+#define FLUSH_JOB_AES128_XTS_DEC   flush_job_aes128_xts_dec_avx512
+#define SUBMIT_JOB_AES256_XTS_ENC  submit_job_aes256_xts_enc_avx512
+#define FLUSH_JOB_AES256_XTS_ENC   flush_job_aes256_xts_enc_avx512
+#define SUBMIT_JOB_AES256_XTS_DEC  submit_job_aes256_xts_dec_avx512
+#define FLUSH_JOB_AES256_XTS_DEC   flush_job_aes256_xts_dec_avx512
+
+#define SUBMIT_JOB_AES128_CFB_ENC  submit_job_aes128_cfb_enc_avx
+#define FLUSH_JOB_AES128_CFB_ENC   flush_job_aes128_cfb_enc_avx
+#define SUBMIT_JOB_AES128_CFB_DEC  submit_job_aes128_cfb_dec_avx
+#define SUBMIT_JOB_AES192_CFB_ENC  submit_job_aes192_cfb_enc_avx
+#define FLUSH_JOB_AES192_CFB_ENC   flush_job_aes192_cfb_enc_avx
+#define SUBMIT_JOB_AES192_CFB_DEC  submit_job_aes192_cfb_dec_avx
+#define SUBMIT_JOB_AES256_CFB_ENC  submit_job_aes256_cfb_enc_avx
+#define FLUSH_JOB_AES256_CFB_ENC   flush_job_aes256_cfb_enc_avx
+#define SUBMIT_JOB_AES256_CFB_DEC  submit_job_aes256_cfb_dec_avx
+
 /* ====================================================================== */
 
 #define SUBMIT_JOB         submit_job_avx512
@@ -334,6 +392,47 @@ ethernet_fcs_avx_local(const void *msg, const uint64_t len,
 
 /* ====================================================================== */
 
+/*
+ * AES-XTS function pointers
+ */
+static IMB_JOB *
+(*submit_job_aes128_xts_enc_avx512)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes128_xts_enc_avx;
+
+static IMB_JOB *
+(*flush_job_aes128_xts_enc_avx512)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes128_xts_enc_avx;
+
+static IMB_JOB *
+(*submit_job_aes128_xts_dec_avx512)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes128_xts_dec_avx;
+
+static IMB_JOB *
+(*flush_job_aes128_xts_dec_avx512)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes128_xts_dec_avx;
+
+static IMB_JOB *
+(*submit_job_aes256_xts_enc_avx512)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes256_xts_enc_avx;
+
+static IMB_JOB *
+(*flush_job_aes256_xts_enc_avx512)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes256_xts_enc_avx;
+
+static IMB_JOB *
+(*submit_job_aes256_xts_dec_avx512)
+        (MB_MGR_AES_XTS_OOO *state,
+         IMB_JOB *job) = submit_job_aes256_xts_dec_avx;
+
+static IMB_JOB *
+(*flush_job_aes256_xts_dec_avx512)
+        (MB_MGR_AES_XTS_OOO *state) = flush_job_aes256_xts_dec_avx;
+
+/* ====================================================================== */
+
 /*
  * GCM submit / flush API for AVX512 arch
  */
@@ -919,6 +1018,9 @@ reset_ooo_mgrs(IMB_MGR *state)
         ooo_mgr_des_reset(state->docsis_des_enc_ooo, AVX512_NUM_DES_LANES);
         ooo_mgr_des_reset(state->docsis_des_dec_ooo, AVX512_NUM_DES_LANES);
 
+        /* CRC */
+        ooo_mgr_crc_reset(state->crc_ooo, AVX512_NUM_CRC_LANES);
+
         /* Init ZUC out-of-order fields */
         ooo_mgr_zuc_reset(state->zuc_eea3_ooo, 16);
         ooo_mgr_zuc_reset(state->zuc_eia3_ooo, 16);
@@ -945,7 +1047,7 @@ reset_ooo_mgrs(IMB_MGR *state)
                                   AVX512_NUM_SHA512_LANES);
 
         /* Init HMAC/MD5 out-of-order fields */
-        ooo_mgr_hmac_md5_reset(state->hmac_md5_ooo, AVX2_NUM_MD5_LANES);
+        ooo_mgr_hmac_md5_reset(state->hmac_md5_ooo, AVX512_NUM_MD5_LANES);
 
         /* Init AES/XCBC OOO fields */
         if ((state->features & IMB_FEATURE_VAES) == IMB_FEATURE_VAES)
@@ -964,6 +1066,50 @@ reset_ooo_mgrs(IMB_MGR *state)
                 ooo_mgr_ccm_reset(state->aes256_ccm_ooo, 8);
         }
 
+        /* Init AES-XTS out-of-order fields */
+        if ((state->features & IMB_FEATURE_VAES) == IMB_FEATURE_VAES) {
+                /* init 16 lanes */
+                ooo_mgr_aes_xts_reset(state->aes128_xts_enc_ooo,
+                                      AVX512_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes128_xts_dec_ooo,
+                                      AVX512_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes256_xts_enc_ooo,
+                                      AVX512_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes256_xts_dec_ooo,
+                                      AVX512_NUM_XTS_LANES);
+        } else {
+                /* init 8 lanes */
+                ooo_mgr_aes_xts_reset(state->aes128_xts_enc_ooo,
+                                      AVX_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes128_xts_dec_ooo,
+                                      AVX_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes256_xts_enc_ooo,
+                                      AVX_NUM_XTS_LANES);
+                ooo_mgr_aes_xts_reset(state->aes256_xts_dec_ooo,
+                                      AVX_NUM_XTS_LANES);
+        }
+
+        /* Init AES-CFB out-of-order fields */
+        ooo_mgr_aes_cfb_reset(state->aes128_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes192_cfb_ooo, AVX_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes256_cfb_ooo, AVX_NUM_CFB_LANES);
+
+        /* Init ChaCha20, ChaCha20-Poly1305 and Poly1305 out-of-order fields */
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_ooo,
+                                        AVX512_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_poly1305_ooo,
+                                        AVX512_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->poly1305_ooo,
+                                        AVX512_NUM_CHACHA20_LANES);
+
+        /* Init KASUMI-UEA1 and KASUMI-UIA1 out-of-order fields */
+        ooo_mgr_kasumi_reset(state->kasumi_uea1_ooo, AVX512_NUM_KASUMI_LANES);
+        ooo_mgr_kasumi_reset(state->kasumi_uia1_ooo, AVX512_NUM_KASUMI_LANES);
+
+        /* Init SNOW-V and SNOW-V-AEAD out-of-order fields */
+        ooo_mgr_snow_v_reset(state->snow_v_ooo, AVX512_NUM_SNOW_V_LANES);
+        ooo_mgr_snow_v_reset(state->snow_v_aead_ooo, AVX512_NUM_SNOW_V_LANES);
+
         /* Init AES-CMAC auth out-of-order fields */
         if ((state->features & IMB_FEATURE_VAES) == IMB_FEATURE_VAES) {
                 /* init 16 lanes */
@@ -1099,6 +1245,23 @@ init_mb_mgr_avx512_internal(IMB_MGR *state, const int reset_mgrs)
                         submit_snow3g_uea2_job_vaes_avx512;
                 flush_job_snow3g_uea2_avx512_ptr =
                         flush_snow3g_uea2_job_vaes_avx512;
+
+                submit_job_aes128_xts_enc_avx512 =
+                        submit_job_aes128_xts_enc_vaes_avx512;
+                flush_job_aes128_xts_enc_avx512 =
+                        flush_job_aes128_xts_enc_vaes_avx512;
+                submit_job_aes128_xts_dec_avx512 =
+                        submit_job_aes128_xts_dec_vaes_avx512;
+                flush_job_aes128_xts_dec_avx512 =
+                        flush_job_aes128_xts_dec_vaes_avx512;
+                submit_job_aes256_xts_enc_avx512 =
+                        submit_job_aes256_xts_enc_vaes_avx512;
+                flush_job_aes256_xts_enc_avx512 =
+                        flush_job_aes256_xts_enc_vaes_avx512;
+                submit_job_aes256_xts_dec_avx512 =
+                        submit_job_aes256_xts_dec_vaes_avx512;
+                flush_job_aes256_xts_dec_avx512 =
+                        flush_job_aes256_xts_dec_vaes_avx512;
         }
 
         if ((state->features & IMB_FEATURE_GFNI) &&
@@ -1119,10 +1282,12 @@ init_mb_mgr_avx512_internal(IMB_MGR *state, const int reset_mgrs)
 
         if (reset_mgrs) {
                 reset_ooo_mgrs(state);
+                reset_ooo_stats(state);
 
                 /* Init "in order" components */
                 state->next_job = 0;
                 state->earliest_job = -1;
+                completion_ring_reset(state);
         }
 
         /* set handlers */
@@ -1246,6 +1411,14 @@ init_mb_mgr_avx512_internal(IMB_MGR *state, const int reset_mgrs)
 
         if (state->features & IMB_FEATURE_AVX512_IFMA) {
                 poly1305_mac_avx512 = poly1305_mac_fma_avx512;
+                submit_chacha20_poly1305_mb_avx512_ptr =
+                        submit_job_chacha20_poly1305_mb_fma_avx512;
+                flush_chacha20_poly1305_mb_avx512_ptr =
+                        flush_job_chacha20_poly1305_mb_fma_avx512;
+                submit_poly1305_mb_avx512_ptr =
+                        submit_job_poly1305_mb_fma_avx512;
+                flush_poly1305_mb_avx512_ptr =
+                        flush_job_poly1305_mb_fma_avx512;
                 state->chacha20_poly1305_init =
                                         init_chacha20_poly1305_fma_avx512;
                 state->chacha20_poly1305_enc_update =
@@ -0,0 +1,392 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+;; code to compute 32-lane (double hexadeca) MD5 using AVX512
+
+;; Stack frame is aligned to 64 bytes internally
+;;
+;; Registers:		RAX RBX RCX RDX RBP RSI RDI R8  R9  R10 R11 R12 R13 R14 R15
+;;			-----------------------------------------------------------
+;; Windows clobbers:	RAX         RDX     RSI RDI R8  R9  R10 R11 R12 R13 R14 R15
+;; Windows preserves:	    RBX RCX     RBP
+;;			-----------------------------------------------------------
+;; Linux clobbers:	RAX     RCX RDX     RSI     R8  R9  R10 R11 R12 R13 R14 R15
+;; Linux preserves:	    RBX         RBP     RDI
+;;			-----------------------------------------------------------
+;; Clobbers ZMM0-31
+
+%include "include/os.asm"
+;%define DO_DBGPRINT
+%include "include/dbgprint.asm"
+%include "include/mb_mgr_datastruct.asm"
+%include "include/transpose_avx512.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+mksection .rodata
+default rel
+align 64
+MD5_TABLE:
+	dd	0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee
+	dd	0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501
+	dd	0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be
+	dd	0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821
+	dd	0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa
+	dd	0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8
+	dd	0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed
+	dd	0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a
+	dd	0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c
+	dd	0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70
+	dd	0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05
+	dd	0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665
+	dd	0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039
+	dd	0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1
+	dd	0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1
+	dd	0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+
+mksection .text
+
+%define APPEND(a,b) a %+ b
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%define reg3	rcx
+%define reg4	rdx
+%else
+%define arg1	rcx
+%define arg2	rdx
+%define reg3	rdi
+%define reg4	rsi
+%endif
+
+;; rbx and rbp are not clobbered
+
+%define state		arg1
+%define num_blks	arg2
+
+%define IDX	reg4
+%define TMP	reg3
+
+%define inp0	r8
+%define inp1	r9
+%define inp2	r10
+%define inp3	r11
+%define inp4	r12
+%define inp5	r13
+%define inp6	r14
+%define inp7	r15
+
+;; Transposed digest: lanes 0-15 in A-D, lanes 16-31 in A2-D2
+%define A	zmm0
+%define B	zmm1
+%define C	zmm2
+%define D	zmm3
+%define A2	zmm4
+%define B2	zmm5
+%define C2	zmm6
+%define D2	zmm7
+
+;; Temporary registers used during MD5 round operations
+%define FUN	zmm8
+%define FUN2	zmm9
+
+;; Temporary registers used during data transposition
+%define T0	zmm8
+%define T1	zmm9
+%define M0	zmm10
+%define M1	zmm11
+
+%define W0	zmm16
+%define W1	zmm17
+%define W2	zmm18
+%define W3	zmm19
+%define W4	zmm20
+%define W5	zmm21
+%define W6	zmm22
+%define W7	zmm23
+%define W8	zmm24
+%define W9	zmm25
+%define W10	zmm26
+%define W11	zmm27
+%define W12	zmm28
+%define W13	zmm29
+%define W14	zmm30
+%define W15	zmm31
+
+%define RESZ	resb 64*
+
+struc STACK
+_DATA:		RESZ	2*16	; 2 sets of 16 lanes * 16 message words
+_DIGEST:	RESZ	8	; stores A-D, A2-D2
+_RSP_SAVE:	resq	1
+endstruc
+
+;;
+;; MD5 left rotations (number of bits)
+;;
+rot11 equ  7
+rot12 equ  12
+rot13 equ  17
+rot14 equ  22
+rot21 equ  5
+rot22 equ  9
+rot23 equ  14
+rot24 equ  20
+rot31 equ  4
+rot32 equ  11
+rot33 equ  16
+rot34 equ  23
+rot41 equ  6
+rot42 equ  10
+rot43 equ  15
+rot44 equ  21
+
+;;
+;; Magic functions defined in RFC 1321, as vpternlogd immediates
+;; with X in the destination operand, Y and Z in the sources
+;;
+MAGIC_F equ 0xCA	; F = ((X) & (Y)) | (~(X) & (Z))
+MAGIC_G equ 0xE4	; G = ((X) & (Z)) | ((Y) & ~(Z))
+MAGIC_H equ 0x96	; H = (X) ^ (Y) ^ (Z)
+MAGIC_I equ 0x39	; I = (Y) ^ ((X) | ~(Z))
+
+%macro ROTATE_ARGS 0
+%xdefine TMP_ D
+%xdefine D C
+%xdefine C B
+%xdefine B A
+%xdefine A TMP_
+%xdefine TMP_ D2
+%xdefine D2 C2
+%xdefine C2 B2
+%xdefine B2 A2
+%xdefine A2 TMP_
+%endm
+
+;;
+;; single MD5 step on both sets of 16 lanes
+;;
+;; A = B + ROL32((A + MAGIC(B,C,D) + data + const), nrot)
+;;
+; macro MD5_STEP MAGIC_IMM, data_word, const_idx, nrot
+%macro MD5_STEP 4
+%define %%MAGIC_IMM	%1
+%define %%word		%2
+%define %%const_idx	%3
+%define %%nrot		%4
+
+	vpaddd		A,  A,  [rel MD5_TABLE + 4*%%const_idx]{1to16}
+	vpaddd		A2, A2, [rel MD5_TABLE + 4*%%const_idx]{1to16}
+	vpaddd		A,  A,  [rsp + _DATA + %%word*64]
+	vpaddd		A2, A2, [rsp + _DATA + (16 + %%word)*64]
+	vmovdqa32	FUN,  B
+	vmovdqa32	FUN2, B2
+	vpternlogd	FUN,  C,  D,  %%MAGIC_IMM
+	vpternlogd	FUN2, C2, D2, %%MAGIC_IMM
+	vpaddd		A,  A,  FUN
+	vpaddd		A2, A2, FUN2
+	vprold		A,  A,  %%nrot
+	vprold		A2, A2, %%nrot
+	vpaddd		A,  A,  B
+	vpaddd		A2, A2, B2
+
+	ROTATE_ARGS
+%endmacro
+
+;;
+;; Loads next 64-byte block of 16 lanes (starting at lane %1),
+;; transposes it and stores it in the stack frame
+;;
+%macro LOAD_TRANSPOSE_16 1
+%define %%first_lane	%1
+
+	mov	inp0, [state + _data_ptr_md5 + (%%first_lane + 0)*PTR_SZ]
+	mov	inp1, [state + _data_ptr_md5 + (%%first_lane + 1)*PTR_SZ]
+	mov	inp2, [state + _data_ptr_md5 + (%%first_lane + 2)*PTR_SZ]
+	mov	inp3, [state + _data_ptr_md5 + (%%first_lane + 3)*PTR_SZ]
+	mov	inp4, [state + _data_ptr_md5 + (%%first_lane + 4)*PTR_SZ]
+	mov	inp5, [state + _data_ptr_md5 + (%%first_lane + 5)*PTR_SZ]
+	mov	inp6, [state + _data_ptr_md5 + (%%first_lane + 6)*PTR_SZ]
+	mov	inp7, [state + _data_ptr_md5 + (%%first_lane + 7)*PTR_SZ]
+
+	TRANSPOSE16_U32_LOAD_FIRST8 W0, W1, W2,  W3,  W4,  W5,  W6,  W7, \
+				    W8, W9, W10, W11, W12, W13, W14, W15, \
+				    inp0, inp1, inp2, inp3, inp4, inp5, \
+				    inp6, inp7, IDX
+
+	mov	inp0, [state + _data_ptr_md5 + (%%first_lane + 8)*PTR_SZ]
+	mov	inp1, [state + _data_ptr_md5 + (%%first_lane + 9)*PTR_SZ]
+	mov	inp2, [state + _data_ptr_md5 + (%%first_lane + 10)*PTR_SZ]
+	mov	inp3, [state + _data_ptr_md5 + (%%first_lane + 11)*PTR_SZ]
+	mov	inp4, [state + _data_ptr_md5 + (%%first_lane + 12)*PTR_SZ]
+	mov	inp5, [state + _data_ptr_md5 + (%%first_lane + 13)*PTR_SZ]
+	mov	inp6, [state + _data_ptr_md5 + (%%first_lane + 14)*PTR_SZ]
+	mov	inp7, [state + _data_ptr_md5 + (%%first_lane + 15)*PTR_SZ]
+
+	TRANSPOSE16_U32_LOAD_LAST8 W0, W1, W2,  W3,  W4,  W5,  W6,  W7, \
+				   W8, W9, W10, W11, W12, W13, W14, W15, \
+				   inp0, inp1, inp2, inp3, inp4, inp5, \
+				   inp6, inp7, IDX
+
+	TRANSPOSE16_U32_PRELOADED W0, W1, W2, W3, W4, W5, W6, W7, W8, W9, W10, \
+				  W11, W12, W13, W14, W15, T0, T1, M0, M1
+
+%assign J 0
+%rep 16
+	vmovdqa64	[rsp + _DATA + (%%first_lane + J)*64], APPEND(W,J)
+%assign J (J + 1)
+%endrep
+%endmacro
+
+;;
+;; Advances 8 data pointers (starting at lane %1) by IDX
+;;
+%macro UPDATE_PTRS_8 1
+%define %%first_lane	%1
+
+%assign J 0
+%rep 8
+	add	[state + _data_ptr_md5 + (%%first_lane + J)*PTR_SZ], IDX
+%assign J (J + 1)
+%endrep
+%endmacro
+
+align 64
+; void md5_x16x2_avx512(MD5_ARGS *args, UINT64 num_blks)
+; arg 1 : pointer to MD5_ARGS structure
+; arg 2 : number of blocks (>=1)
+MKGLOBAL(md5_x16x2_avx512,function,internal)
+md5_x16x2_avx512:
+        endbranch64
+	mov	rax, rsp
+	sub	rsp, STACK_size
+	and	rsp, -64
+	mov	[rsp + _RSP_SAVE], rax
+
+	;; digests are already transposed
+	vmovdqu32	A,  [state + 0*MD5_DIGEST_ROW_SIZE]
+	vmovdqu32	B,  [state + 1*MD5_DIGEST_ROW_SIZE]
+	vmovdqu32	C,  [state + 2*MD5_DIGEST_ROW_SIZE]
+	vmovdqu32	D,  [state + 3*MD5_DIGEST_ROW_SIZE]
+	vmovdqu32	A2, [state + 0*MD5_DIGEST_ROW_SIZE + 64]
+	vmovdqu32	B2, [state + 1*MD5_DIGEST_ROW_SIZE + 64]
+	vmovdqu32	C2, [state + 2*MD5_DIGEST_ROW_SIZE + 64]
+	vmovdqu32	D2, [state + 3*MD5_DIGEST_ROW_SIZE + 64]
+
+	xor	IDX, IDX
+
+lloop:
+	;; Transpose next block of lanes 0-15 and lanes 16-31 into the stack
+	LOAD_TRANSPOSE_16 0
+	LOAD_TRANSPOSE_16 16
+
+	;; Save old digests
+	vmovdqa64	[rsp + _DIGEST + 0*64], A
+	vmovdqa64	[rsp + _DIGEST + 1*64], B
+	vmovdqa64	[rsp + _DIGEST + 2*64], C
+	vmovdqa64	[rsp + _DIGEST + 3*64], D
+	vmovdqa64	[rsp + _DIGEST + 4*64], A2
+	vmovdqa64	[rsp + _DIGEST + 5*64], B2
+	vmovdqa64	[rsp + _DIGEST + 6*64], C2
+	vmovdqa64	[rsp + _DIGEST + 7*64], D2
+
+	;; Increment IDX to point to next data block (64 bytes per block)
+	add	IDX, 64
+
+	;; Perform the 64 rounds of processing
+%assign I 0
+%rep 16
+%assign R ((I % 4) + 1)
+	MD5_STEP MAGIC_F, I, I, APPEND(rot1,R)
+%assign I (I + 1)
+%endrep
+%assign I 0
+%rep 16
+%assign R ((I % 4) + 1)
+	MD5_STEP MAGIC_G, ((5*I + 1) % 16), (16 + I), APPEND(rot2,R)
+%assign I (I + 1)
+%endrep
+%assign I 0
+%rep 16
+%assign R ((I % 4) + 1)
+	MD5_STEP MAGIC_H, ((3*I + 5) % 16), (32 + I), APPEND(rot3,R)
+%assign I (I + 1)
+%endrep
+%assign I 0
+%rep 16
+%assign R ((I % 4) + 1)
+	MD5_STEP MAGIC_I, ((7*I) % 16), (48 + I), APPEND(rot4,R)
+%assign I (I + 1)
+%endrep
+
+	;; Add old digests
+	vpaddd	A,  A,  [rsp + _DIGEST + 0*64]
+	vpaddd	B,  B,  [rsp + _DIGEST + 1*64]
+	vpaddd	C,  C,  [rsp + _DIGEST + 2*64]
+	vpaddd	D,  D,  [rsp + _DIGEST + 3*64]
+	vpaddd	A2, A2, [rsp + _DIGEST + 4*64]
+	vpaddd	B2, B2, [rsp + _DIGEST + 5*64]
+	vpaddd	C2, C2, [rsp + _DIGEST + 6*64]
+	vpaddd	D2, D2, [rsp + _DIGEST + 7*64]
+
+	sub	num_blks, 1
+	jne	lloop
+
+	;; Write out digests
+	vmovdqu32	[state + 0*MD5_DIGEST_ROW_SIZE], A
+	vmovdqu32	[state + 1*MD5_DIGEST_ROW_SIZE], B
+	vmovdqu32	[state + 2*MD5_DIGEST_ROW_SIZE], C
+	vmovdqu32	[state + 3*MD5_DIGEST_ROW_SIZE], D
+	vmovdqu32	[state + 0*MD5_DIGEST_ROW_SIZE + 64], A2
+	vmovdqu32	[state + 1*MD5_DIGEST_ROW_SIZE + 64], B2
+	vmovdqu32	[state + 2*MD5_DIGEST_ROW_SIZE + 64], C2
+	vmovdqu32	[state + 3*MD5_DIGEST_ROW_SIZE + 64], D2
+
+	;; update input pointers
+	UPDATE_PTRS_8 0
+	UPDATE_PTRS_8 8
+	UPDATE_PTRS_8 16
+	UPDATE_PTRS_8 24
+
+%ifdef SAFE_DATA
+	;; Clear stack frame (message words and digests)
+	vpxorq	zmm0, zmm0, zmm0
+%assign I 0
+%rep (2*16 + 8)
+	vmovdqa64	[rsp + _DATA + I*64], zmm0
+%assign I (I + 1)
+%endrep
+	clear_all_zmms_asm
+%else
+	vzeroupper
+%endif ;; SAFE_DATA
+
+	mov	rsp, [rsp + _RSP_SAVE]
+	ret
+
+mksection stack-noexec
@@ -0,0 +1,218 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+
+;; AES-XTS (IEEE 1619) encryption and decryption of 16 independent
+;; data units (lanes) using VAES and AVX512
+;;
+;; Each ZMM register holds 4 consecutive blocks of one lane,
+;; so the AES rounds of 64 blocks are done with 16 VAESENC/VAESDEC.
+;; Round keys of each lane are broadcast to all 128-bit lanes.
+;;
+;; Preserves all general purpose registers except RAX, R10, R11 and arg2
+;; Clobbers ZMM0-5, ZMM16-31 and K1
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+
+mksection .text
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%else
+%define arg1	rcx
+%define arg2	rdx
+%endif
+
+%define ARGS		arg1
+%define NUM_BLOCKS	arg2
+
+%define IDX		r10	;; offset of the blocks in the lanes
+%define PTR		r11
+%define KEYS		rax
+
+;; offsets of the fields in AES_XTS_ARGS
+%define _in		0
+%define _out		(16 * 8)
+%define _keys		(16 * 8 * 2)
+%define _tweak		(16 * 8 * 3)
+
+;; =============================================================================
+;; Multiplies 4 tweaks (one per 128-bit lane) by alpha^4
+;; K1 must select the low quad words
+;; =============================================================================
+%macro XTS_NEXT_TWEAKS_X4 4
+%define %%T	%1	;; [in/out] ZMM with 4 tweaks
+%define %%C	%2	;; [clobbered] ZMM temp
+%define %%D	%3	;; [clobbered] ZMM temp
+%define %%E	%4	;; [clobbered] ZMM temp
+
+	vpsrlq		%%C, %%T, 60
+	vpsllq		%%T, %%T, 4
+	;; carry of each quad word goes to the other quad word
+	vpshufd		%%C, %%C, 0x4e
+	;; carry out of the tweak is reduced: C x 0x87 (carry-less)
+	vpsllq		%%D, %%C, 1
+	vpsllq		%%E, %%C, 2
+	vpternlogq	%%D, %%E, %%C, 0x96
+	vpsllq		%%E, %%C, 7
+	vpxorq		%%D, %%D, %%E
+	vpblendmq	%%C{k1}, %%C, %%D
+	vpxorq		%%T, %%T, %%C
+%endmacro
+
+;; =============================================================================
+;; Encrypts/decrypts NUM_BLOCKS blocks (multiple of 4) of 16 lanes
+;; =============================================================================
+%macro AES_XTS_X16 2
+%define %%NROUNDS	%1	;; [in] number of AES rounds (10 or 14)
+%define %%DIR		%2	;; [in] ENC or DEC
+
+	shr		NUM_BLOCKS, 2
+	jz		%%_exit
+
+	mov		eax, 0x55
+	kmovw		k1, eax
+
+	xor		IDX, IDX
+%%_main_loop:
+	;; load 4 blocks of each lane and XOR them with their tweaks
+%assign i 0
+%rep 16
+%assign j (16 + i)
+	mov		PTR, [ARGS + _in + 8*i]
+	vmovdqu64	zmm %+ j, [PTR + IDX]
+	vpxorq		zmm %+ j, zmm %+ j, [ARGS + _tweak + 64*i]
+%assign i (i + 1)
+%endrep
+
+	;; AES rounds of all lanes
+%assign r 0
+%rep (%%NROUNDS + 1)
+%assign i 0
+%rep 16
+%assign j (16 + i)
+%assign k (i % 6)
+	mov		KEYS, [ARGS + _keys + 8*i]
+	vbroadcasti32x4	zmm %+ k, [KEYS + 16*r]
+%if r == 0
+	vpxorq		zmm %+ j, zmm %+ j, zmm %+ k
+%elif r == %%NROUNDS
+%ifidn %%DIR, ENC
+	vaesenclast	zmm %+ j, zmm %+ j, zmm %+ k
+%else
+	vaesdeclast	zmm %+ j, zmm %+ j, zmm %+ k
+%endif
+%else
+%ifidn %%DIR, ENC
+	vaesenc		zmm %+ j, zmm %+ j, zmm %+ k
+%else
+	vaesdec		zmm %+ j, zmm %+ j, zmm %+ k
+%endif
+%endif
+%assign i (i + 1)
+%endrep
+%assign r (r + 1)
+%endrep
+
+	;; XOR the blocks with their tweaks, store them
+	;; and compute the tweaks of the next 4 blocks
+%assign i 0
+%rep 16
+%assign j (16 + i)
+	vmovdqu64	zmm0, [ARGS + _tweak + 64*i]
+	vpxorq		zmm %+ j, zmm %+ j, zmm0
+	mov		PTR, [ARGS + _out + 8*i]
+	vmovdqu64	[PTR + IDX], zmm %+ j
+	XTS_NEXT_TWEAKS_X4 zmm0, zmm1, zmm2, zmm3
+	vmovdqu64	[ARGS + _tweak + 64*i], zmm0
+%assign i (i + 1)
+%endrep
+
+	add		IDX, 64
+	dec		NUM_BLOCKS
+	jnz		%%_main_loop
+
+	;; update input and output pointers
+%assign i 0
+%rep 16
+	add		[ARGS + _in + 8*i], IDX
+	add		[ARGS + _out + 8*i], IDX
+%assign i (i + 1)
+%endrep
+
+%ifdef SAFE_DATA
+	clear_scratch_zmms_asm
+%else
+	vzeroupper
+%endif
+%%_exit:
+%endmacro
+
+align 64
+;; void aes_xts_enc_128_x16_vaes_avx512(AES_XTS_ARGS *args,
+;;                                      const uint64_t num_blocks)
+;; arg 1 : ARGS - input/output pointers, keys and tweaks of 16 lanes,
+;;         pointers and tweaks updated on output
+;; arg 2 : NUM_BLOCKS - number of blocks per lane (multiple of 4)
+MKGLOBAL(aes_xts_enc_128_x16_vaes_avx512,function,internal)
+aes_xts_enc_128_x16_vaes_avx512:
+        endbranch64
+	AES_XTS_X16 10, ENC
+	ret
+
+align 64
+;; void aes_xts_dec_128_x16_vaes_avx512(AES_XTS_ARGS *args,
+;;                                      const uint64_t num_blocks)
+MKGLOBAL(aes_xts_dec_128_x16_vaes_avx512,function,internal)
+aes_xts_dec_128_x16_vaes_avx512:
+        endbranch64
+	AES_XTS_X16 10, DEC
+	ret
+
+align 64
+;; void aes_xts_enc_256_x16_vaes_avx512(AES_XTS_ARGS *args,
+;;                                      const uint64_t num_blocks)
+MKGLOBAL(aes_xts_enc_256_x16_vaes_avx512,function,internal)
+aes_xts_enc_256_x16_vaes_avx512:
+        endbranch64
+	AES_XTS_X16 14, ENC
+	ret
+
+align 64
+;; void aes_xts_dec_256_x16_vaes_avx512(AES_XTS_ARGS *args,
+;;                                      const uint64_t num_blocks)
+MKGLOBAL(aes_xts_dec_256_x16_vaes_avx512,function,internal)
+aes_xts_dec_256_x16_vaes_avx512:
+        endbranch64
+	AES_XTS_X16 14, DEC
+	ret
+
+mksection stack-noexec
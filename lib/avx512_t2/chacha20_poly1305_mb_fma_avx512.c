@@ -0,0 +1,246 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*
+ * ChaCha20-Poly1305 AEAD and Poly1305 multi-buffer implementation
+ * with Poly1305 computed across 8 lanes at once using AVX512 IFMA.
+ *
+ * Lane state is kept in radix 2^26 by the shared manager code and
+ * converted to radix 2^44 (one limb per register, one lane per qword)
+ * for the duration of the update:
+ *   h = h0 + h1 * 2^44 + h2 * 2^88
+ * With 2^130 = 5 (mod 2^130 - 5), limb products above 2^130
+ * (at 2^132 and 2^176) are folded back multiplied by 20.
+ */
+
+#include <string.h>
+
+#include "include/chacha20_poly1305_mb_avx512.h"
+#include "include/clear_regs_mem.h"
+
+#if defined(__AVX512IFMA__) || defined(_MSC_VER)
+
+#define POLY1305_IFMA_MASK26 0x3ffffffULL
+#define POLY1305_IFMA_MASK42 0x3ffffffffffULL
+#define POLY1305_IFMA_MASK44 0xfffffffffffULL
+
+/* Converts 26-bit limbs a[0..4] into 44-bit limbs b[0/8/16 + k] */
+__forceinline
+void poly1305_ifma_to_radix44(const uint32_t *a, uint64_t *b, const unsigned k)
+{
+        uint64_t t;
+
+        t = (uint64_t) a[0] + ((uint64_t) a[1] << 26);
+        b[0 * 8 + k] = t & POLY1305_IFMA_MASK44;
+        t = (t >> 44) + ((uint64_t) a[2] << 8) + ((uint64_t) a[3] << 34);
+        b[1 * 8 + k] = t & POLY1305_IFMA_MASK44;
+        b[2 * 8 + k] = (t >> 44) + ((uint64_t) a[4] << 16);
+}
+
+/* Converts 44-bit limbs b[0/8/16 + k] into 26-bit limbs a[0..4] */
+__forceinline
+void poly1305_ifma_to_radix26(const uint64_t *b, uint32_t *a, const unsigned k)
+{
+        uint64_t l0 = b[0 * 8 + k];
+        uint64_t l1 = b[1 * 8 + k];
+        uint64_t l2 = b[2 * 8 + k];
+
+        l1 += l0 >> 44;
+        l0 &= POLY1305_IFMA_MASK44;
+        l2 += l1 >> 44;
+        l1 &= POLY1305_IFMA_MASK44;
+
+        a[0] = (uint32_t) (l0 & POLY1305_IFMA_MASK26);
+        a[1] = (uint32_t) ((l0 >> 26) | ((l1 & 0xff) << 18));
+        a[2] = (uint32_t) ((l1 >> 8) & POLY1305_IFMA_MASK26);
+        a[3] = (uint32_t) ((l1 >> 34) | ((l2 & 0xffff) << 10));
+        a[4] = (uint32_t) (l2 >> 16);
+}
+
+/*
+ * Absorbs num_blocks full blocks of msg[i] on lanes[i], for i < n <= 8
+ */
+__forceinline
+void poly1305_ifma_update_x8(CHACHA20_POLY1305_ARGS *args,
+                             const unsigned *lanes, const uint8_t **msg,
+                             const unsigned n, uint64_t num_blocks)
+{
+        DECLARE_ALIGNED(uint64_t h[3 * 8], 64);
+        DECLARE_ALIGNED(uint64_t r[3 * 8], 64);
+        DECLARE_ALIGNED(uint64_t ptr[8], 64);
+        const __mmask8 k = (__mmask8) ((1 << n) - 1);
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i mask42 = _mm512_set1_epi64(POLY1305_IFMA_MASK42);
+        const __m512i mask44 = _mm512_set1_epi64(POLY1305_IFMA_MASK44);
+        const __m512i hibit = _mm512_set1_epi64(1ULL << 40);
+        const __m512i blk_size = _mm512_set1_epi64(16);
+        const __m512i qword_size = _mm512_set1_epi64(8);
+        __m512i h0, h1, h2, r0, r1, r2, s1, s2, p;
+        unsigned i;
+
+        memset(h, 0, sizeof(h));
+        memset(r, 0, sizeof(r));
+        memset(ptr, 0, sizeof(ptr));
+        for (i = 0; i < n; i++) {
+                poly1305_ifma_to_radix44(args->poly_h[lanes[i]], h, i);
+                poly1305_ifma_to_radix44(args->poly_r[lanes[i]], r, i);
+                ptr[i] = (uint64_t) (uintptr_t) msg[i];
+        }
+
+        h0 = _mm512_load_si512((const void *) &h[0 * 8]);
+        h1 = _mm512_load_si512((const void *) &h[1 * 8]);
+        h2 = _mm512_load_si512((const void *) &h[2 * 8]);
+        r0 = _mm512_load_si512((const void *) &r[0 * 8]);
+        r1 = _mm512_load_si512((const void *) &r[1 * 8]);
+        r2 = _mm512_load_si512((const void *) &r[2 * 8]);
+        /* s = 20 * r */
+        s1 = _mm512_add_epi64(_mm512_slli_epi64(r1, 4),
+                              _mm512_slli_epi64(r1, 2));
+        s2 = _mm512_add_epi64(_mm512_slli_epi64(r2, 4),
+                              _mm512_slli_epi64(r2, 2));
+        p = _mm512_load_si512((const void *) ptr);
+
+        while (num_blocks--) {
+                const __m512i m_lo = _mm512_mask_i64gather_epi64(zero, k, p,
+                                                                 NULL, 1);
+                const __m512i m_hi =
+                        _mm512_mask_i64gather_epi64(zero, k,
+                                                    _mm512_add_epi64(p,
+                                                                qword_size),
+                                                    NULL, 1);
+                __m512i d0l, d0h, d1l, d1h, d2l, d2h, c;
+
+                /* h += m (with 2^128 bit set) */
+                h0 = _mm512_add_epi64(h0, _mm512_and_si512(m_lo, mask44));
+                h1 = _mm512_add_epi64(h1, _mm512_and_si512(
+                        _mm512_or_si512(_mm512_srli_epi64(m_lo, 44),
+                                        _mm512_slli_epi64(m_hi, 20)),
+                        mask44));
+                h2 = _mm512_add_epi64(h2, _mm512_or_si512(
+                        _mm512_srli_epi64(m_hi, 24), hibit));
+
+                /* d = h * r, as low and high 52-bit halves of products */
+                d0l = _mm512_madd52lo_epu64(zero, h0, r0);
+                d0l = _mm512_madd52lo_epu64(d0l, h1, s2);
+                d0l = _mm512_madd52lo_epu64(d0l, h2, s1);
+                d0h = _mm512_madd52hi_epu64(zero, h0, r0);
+                d0h = _mm512_madd52hi_epu64(d0h, h1, s2);
+                d0h = _mm512_madd52hi_epu64(d0h, h2, s1);
+
+                d1l = _mm512_madd52lo_epu64(zero, h0, r1);
+                d1l = _mm512_madd52lo_epu64(d1l, h1, r0);
+                d1l = _mm512_madd52lo_epu64(d1l, h2, s2);
+                d1h = _mm512_madd52hi_epu64(zero, h0, r1);
+                d1h = _mm512_madd52hi_epu64(d1h, h1, r0);
+                d1h = _mm512_madd52hi_epu64(d1h, h2, s2);
+
+                d2l = _mm512_madd52lo_epu64(zero, h0, r2);
+                d2l = _mm512_madd52lo_epu64(d2l, h1, r1);
+                d2l = _mm512_madd52lo_epu64(d2l, h2, r0);
+                d2h = _mm512_madd52hi_epu64(zero, h0, r2);
+                d2h = _mm512_madd52hi_epu64(d2h, h1, r1);
+                d2h = _mm512_madd52hi_epu64(d2h, h2, r0);
+
+                /* partial reduction */
+                c = _mm512_add_epi64(_mm512_srli_epi64(d0l, 44),
+                                     _mm512_slli_epi64(d0h, 8));
+                h0 = _mm512_and_si512(d0l, mask44);
+                d1l = _mm512_add_epi64(d1l, c);
+                c = _mm512_add_epi64(_mm512_srli_epi64(d1l, 44),
+                                     _mm512_slli_epi64(d1h, 8));
+                h1 = _mm512_and_si512(d1l, mask44);
+                d2l = _mm512_add_epi64(d2l, c);
+                c = _mm512_add_epi64(_mm512_srli_epi64(d2l, 42),
+                                     _mm512_slli_epi64(d2h, 10));
+                h2 = _mm512_and_si512(d2l, mask42);
+                h0 = _mm512_add_epi64(h0, _mm512_add_epi64(c,
+                                      _mm512_slli_epi64(c, 2)));
+                c = _mm512_srli_epi64(h0, 44);
+                h0 = _mm512_and_si512(h0, mask44);
+                h1 = _mm512_add_epi64(h1, c);
+
+                p = _mm512_add_epi64(p, blk_size);
+        }
+
+        _mm512_store_si512((void *) &h[0 * 8], h0);
+        _mm512_store_si512((void *) &h[1 * 8], h1);
+        _mm512_store_si512((void *) &h[2 * 8], h2);
+        for (i = 0; i < n; i++)
+                poly1305_ifma_to_radix26(h, args->poly_h[lanes[i]], i);
+
+#ifdef SAFE_DATA
+        clear_mem(h, sizeof(h));
+        clear_mem(r, sizeof(r));
+#endif
+}
+
+__forceinline
+void poly1305_ifma_update_lanes(CHACHA20_POLY1305_ARGS *args,
+                                const unsigned *lanes,
+                                const unsigned num_lanes,
+                                const uint8_t * const *msg,
+                                const uint64_t num_blocks)
+{
+        unsigned sel_lanes[8];
+        const uint8_t *sel_msg[8];
+        unsigned i, n = 0;
+
+        for (i = 0; i < num_lanes; i++) {
+                if (msg[i] == NULL)
+                        continue;
+                sel_lanes[n] = lanes[i];
+                sel_msg[n] = msg[i];
+                if (++n == 8) {
+                        poly1305_ifma_update_x8(args, sel_lanes, sel_msg, n,
+                                                num_blocks);
+                        n = 0;
+                }
+        }
+
+        if (n != 0)
+                poly1305_ifma_update_x8(args, sel_lanes, sel_msg, n,
+                                        num_blocks);
+}
+
+#define POLY1305_MB_UPDATE_LANES poly1305_ifma_update_lanes
+
+#endif /* __AVX512IFMA__ || _MSC_VER */
+
+#include "include/arch_avx512_type2.h"
+
+#define NUM_CHACHA20_LANES     AVX512_NUM_CHACHA20_LANES
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB \
+        submit_job_chacha20_poly1305_mb_fma_avx512
+#define FLUSH_JOB_CHACHA20_POLY1305_MB \
+        flush_job_chacha20_poly1305_mb_fma_avx512
+#define SUBMIT_JOB_POLY1305_MB submit_job_poly1305_mb_fma_avx512
+#define FLUSH_JOB_POLY1305_MB  flush_job_poly1305_mb_fma_avx512
+
+#include "include/chacha20_poly1305_mb_mgr.h"
@@ -0,0 +1,305 @@
+;;
+;; Copyright (c) 2022, Intel Corporation
+;;
+;; Redistribution and use in source and binary forms, with or without
+;; modification, are permitted provided that the following conditions are met:
+;;
+;;     * Redistributions of source code must retain the above copyright notice,
+;;       this list of conditions and the following disclaimer.
+;;     * Redistributions in binary form must reproduce the above copyright
+;;       notice, this list of conditions and the following disclaimer in the
+;;       documentation and/or other materials provided with the distribution.
+;;     * Neither the name of Intel Corporation nor the names of its contributors
+;;       may be used to endorse or promote products derived from this software
+;;       without specific prior written permission.
+;;
+;; THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+;; AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+;; IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+;; DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+;; FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+;; DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+;; SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+;; CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+;; OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;; OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;
+
+
+;; SNOW-V for 4 independent streams using VAES and AVX512
+;;
+;; Each 128-bit lane of a ZMM register holds the state of one stream,
+;; so the FSM AES rounds of the 4 streams are done with one VAESENC.
+;;
+;; Implementation based on
+;; Patrik Ekdahl1, Thomas Johansson2, Alexander Maximov1 and Jing Yang2
+;; abstract : 'A new SNOW stream cipher called SNOW-V'
+;; https://eprint.iacr.org/2018/1143.pdf
+;;
+;; Preserves all general purpose registers except RAX
+;; Clobbers ZMM0-2, ZMM16-31
+
+%include "include/os.asm"
+%include "include/reg_sizes.asm"
+%include "include/clear_regs.asm"
+%include "include/cet.inc"
+
+mksection .rodata
+default rel
+
+align 16
+;; permutation: [ 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 ]
+sigma:
+dq 0xd0905010c080400
+dq 0xf0b07030e0a0602
+
+align 4
+alpha:
+dd 0x990f990f
+alpha_inv:
+dd 0xcc87cc87
+beta:
+dd 0xc963c963
+beta_inv:
+dd 0xe4b1e4b1
+
+mksection .text
+
+%ifdef LINUX
+%define arg1	rdi
+%define arg2	rsi
+%define arg3	rdx
+%else
+%define arg1	rcx
+%define arg2	rdx
+%define arg3	r8
+%endif
+
+%define STATE		arg1
+%define KS		arg2
+%define NUM_BLOCKS	arg3
+
+;; offsets of the state rows in SNOW_V_X4_STATE (4 streams x 16 bytes each)
+%define _lfsr_a_lo	(0 * 64)
+%define _lfsr_a_hi	(1 * 64)
+%define _lfsr_b_lo	(2 * 64)
+%define _lfsr_b_hi	(3 * 64)
+%define _fsm_r1		(4 * 64)
+%define _fsm_r2		(5 * 64)
+%define _fsm_r3		(6 * 64)
+
+%define LFSR_A_LO	zmm16	;; LFSR A: (a7, ..., a0) of 4 streams
+%define LFSR_A_HI	zmm17	;; LFSR A: (a15, ..., a8) of 4 streams
+%define LFSR_B_LO	zmm18	;; LFSR B: (b7, ..., b0) of 4 streams
+%define LFSR_B_HI	zmm19	;; LFSR B: (b15, ..., b8) of 4 streams
+%define FSM_R1		zmm20
+%define FSM_R2		zmm21
+%define FSM_R3		zmm22
+%define KEYSTREAM	zmm23
+%define TEMP1		zmm24
+%define TEMP2		zmm25
+%define TEMP3		zmm26
+%define ZERO		zmm27
+%define GA		zmm28
+%define GB		zmm29
+%define INV_GA		zmm30
+%define INV_GB		zmm31
+%define SIGMA		zmm0
+%define KEY_LO		zmm1
+%define KEY_HI		zmm2
+
+;; =============================================================================
+;; Load constants used by the LFSR and FSM updates
+;; =============================================================================
+%macro SNOW_V_X4_LOAD_CONSTANTS 0
+	vpxorq		ZERO, ZERO, ZERO
+	vbroadcasti32x4	SIGMA, [rel sigma]
+	vpbroadcastd	GA, [rel alpha]
+	vpbroadcastd	GB, [rel beta]
+	vpbroadcastd	INV_GA, [rel alpha_inv]
+	vpbroadcastd	INV_GB, [rel beta_inv]
+%endmacro
+
+;; =============================================================================
+;; Load/store LFSR and FSM of 4 streams
+;; =============================================================================
+%macro SNOW_V_X4_LOAD_STATE 0
+	vmovdqu64	LFSR_A_LO, [STATE + _lfsr_a_lo]
+	vmovdqu64	LFSR_A_HI, [STATE + _lfsr_a_hi]
+	vmovdqu64	LFSR_B_LO, [STATE + _lfsr_b_lo]
+	vmovdqu64	LFSR_B_HI, [STATE + _lfsr_b_hi]
+	vmovdqu64	FSM_R1, [STATE + _fsm_r1]
+	vmovdqu64	FSM_R2, [STATE + _fsm_r2]
+	vmovdqu64	FSM_R3, [STATE + _fsm_r3]
+%endmacro
+
+%macro SNOW_V_X4_STORE_STATE 0
+	vmovdqu64	[STATE + _lfsr_a_lo], LFSR_A_LO
+	vmovdqu64	[STATE + _lfsr_a_hi], LFSR_A_HI
+	vmovdqu64	[STATE + _lfsr_b_lo], LFSR_B_LO
+	vmovdqu64	[STATE + _lfsr_b_hi], LFSR_B_HI
+	vmovdqu64	[STATE + _fsm_r1], FSM_R1
+	vmovdqu64	[STATE + _fsm_r2], FSM_R2
+	vmovdqu64	[STATE + _fsm_r3], FSM_R3
+%endmacro
+
+;; =============================================================================
+;; Calculate 128-bit keystream of 4 streams: z = (b15...b8 + R1) xor R2
+;; =============================================================================
+%macro SNOW_V_X4_KEYSTREAM 0
+	vpaddd		KEYSTREAM, LFSR_B_HI, FSM_R1
+	vpxorq		KEYSTREAM, KEYSTREAM, FSM_R2
+%endmacro
+
+;; =============================================================================
+;; Update FSM of 4 streams
+;; =============================================================================
+%macro SNOW_V_X4_FSM_UPDATE 0
+	vpxorq		TEMP1, LFSR_A_LO, FSM_R3	;; TEMP1 = R3 XOR LSFR_A [0:7]
+	vpaddd		TEMP1, TEMP1, FSM_R2		;; TEMP1 += R2
+	vaesenc		FSM_R3, FSM_R2, ZERO		;; R3 = AESR(R2) (round key C1 = 0)
+	vaesenc		FSM_R2, FSM_R1, ZERO		;; R2 = AESR(R1) (round key C2 = 0)
+	vpshufb		FSM_R1, TEMP1, SIGMA		;; R1 = sigma(TEMP1)
+%endmacro
+
+;; =============================================================================
+;; Update LFSR of 4 streams
+;;
+;; for i in [0,7]:
+;;    tmpa_i = alpha*a_i + alpha^-1*a_(i+8) + b_i + a_(i+1) mod g^A(alpha)
+;;    tmpb_i =  beta*b_i +  beta^-1*b_(i+8) + a_i + b_(i+3) mod g^B(beta)
+;;
+;; (a15, a14, ..., a0) = (tmpa_7, ..., tmpa_0, a15, ..., a8)
+;; (b15, b14, ..., b0) = (tmpb_7, ..., tmpb_0, b15, ..., b8)
+;;
+;; alpha*x      = (x << 1) xor ((x >>> 15) and gA)
+;; (alpha^-1)*x = (x >> 1) xor (((x << 15) >>> 15) and inv_gA)
+;; (>>> is an arithmetic shift)
+;; =============================================================================
+%macro SNOW_V_X4_LFSR_UPDATE 0
+	;; TEMP1 = mulx_A
+	vpsraw		TEMP1, LFSR_A_LO, 15
+	vpsllw		TEMP2, LFSR_A_LO, 1
+	vpternlogq	TEMP1, TEMP2, GA, 0x6C		;; TEMP2 xor (TEMP1 and GA)
+
+	;; TEMP1 = mulx_A xor invx_A
+	vpsllw		TEMP2, LFSR_A_HI, 15
+	vpsraw		TEMP2, TEMP2, 15
+	vpternlogq	TEMP1, TEMP2, INV_GA, 0x78	;; TEMP1 xor (TEMP2 and INV_GA)
+	vpsrlw		TEMP2, LFSR_A_HI, 1
+	vpalignr	TEMP3, LFSR_A_HI, LFSR_A_LO, 2	;; (a8, ..., a1)
+	vpternlogq	TEMP1, TEMP2, TEMP3, 0x96
+
+	;; TEMP1 = tmpa = mulx_A xor invx_A xor (a8, ..., a1) xor (b7, ..., b0)
+	vpxorq		TEMP1, TEMP1, LFSR_B_LO
+
+	;; TEMP2 = mulx_B
+	vpsraw		TEMP2, LFSR_B_LO, 15
+	vpsllw		TEMP3, LFSR_B_LO, 1
+	vpternlogq	TEMP2, TEMP3, GB, 0x6C		;; TEMP3 xor (TEMP2 and GB)
+
+	;; TEMP2 = mulx_B xor (a7, ..., a0) xor (b10, ..., b3)
+	vpalignr	TEMP3, LFSR_B_HI, LFSR_B_LO, 6	;; (b10, ..., b3)
+	vpternlogq	TEMP2, TEMP3, LFSR_A_LO, 0x96
+
+	;; TEMP2 = tmpb = mulx_B xor invx_B xor (a7, ..., a0) xor (b10, ..., b3)
+	vpsllw		TEMP3, LFSR_B_HI, 15
+	vpsraw		TEMP3, TEMP3, 15
+	vpternlogq	TEMP2, TEMP3, INV_GB, 0x78	;; TEMP2 xor (TEMP3 and INV_GB)
+	vpsrlw		TEMP3, LFSR_B_HI, 1
+	vpxorq		TEMP2, TEMP2, TEMP3
+
+	vmovdqa64	LFSR_A_LO, LFSR_A_HI
+	vmovdqa64	LFSR_A_HI, TEMP1
+	vmovdqa64	LFSR_B_LO, LFSR_B_HI
+	vmovdqa64	LFSR_B_HI, TEMP2
+%endmacro
+
+;; =============================================================================
+;; One initialization round of 4 streams
+;; =============================================================================
+%macro SNOW_V_X4_INIT_ROUND 0
+	SNOW_V_X4_KEYSTREAM
+	SNOW_V_X4_FSM_UPDATE
+	SNOW_V_X4_LFSR_UPDATE
+	vpxorq		LFSR_A_HI, LFSR_A_HI, KEYSTREAM
+%endmacro
+
+align 64
+;; void snow_v_init_x4_vaes_avx512(SNOW_V_X4_STATE *state)
+;; arg 1 : STATE - on input LFSR_A_LO holds the IVs, LFSR_A_HI and LFSR_B_HI
+;;         hold the keys (bytes 0-15 and 16-31), LFSR_B_LO is zero
+;;         (or the AEAD constant); on output initialized LFSR and FSM
+MKGLOBAL(snow_v_init_x4_vaes_avx512,function,internal)
+snow_v_init_x4_vaes_avx512:
+        endbranch64
+	SNOW_V_X4_LOAD_CONSTANTS
+
+	vmovdqu64	LFSR_A_LO, [STATE + _lfsr_a_lo]
+	vmovdqu64	LFSR_A_HI, [STATE + _lfsr_a_hi]
+	vmovdqu64	LFSR_B_LO, [STATE + _lfsr_b_lo]
+	vmovdqu64	LFSR_B_HI, [STATE + _lfsr_b_hi]
+	vmovdqa64	KEY_LO, LFSR_A_HI
+	vmovdqa64	KEY_HI, LFSR_B_HI
+
+	;; Init FSM: R1 = R2 = R3 = 0
+	vpxorq		FSM_R1, FSM_R1, FSM_R1
+	vpxorq		FSM_R2, FSM_R2, FSM_R2
+	vpxorq		FSM_R3, FSM_R3, FSM_R3
+
+	mov		eax, 15
+init_x4_loop:
+	SNOW_V_X4_INIT_ROUND
+	dec		eax
+	jnz		init_x4_loop
+
+	vpxorq		FSM_R1, FSM_R1, KEY_LO
+	SNOW_V_X4_INIT_ROUND
+	vpxorq		FSM_R1, FSM_R1, KEY_HI
+
+	SNOW_V_X4_STORE_STATE
+
+%ifdef SAFE_DATA
+	clear_scratch_zmms_asm
+%else
+	vzeroupper
+%endif
+	ret
+
+align 64
+;; void snow_v_keystream_x4_vaes_avx512(SNOW_V_X4_STATE *state, uint8_t *ks,
+;;                                     const uint64_t num_blocks)
+;; arg 1 : STATE - LFSR and FSM of 4 streams, updated on output
+;; arg 2 : KS - output keystream, num_blocks x 64 bytes
+;;         (16 bytes of each of the 4 streams per block)
+;; arg 3 : NUM_BLOCKS - number of 16-byte keystream blocks per stream
+MKGLOBAL(snow_v_keystream_x4_vaes_avx512,function,internal)
+snow_v_keystream_x4_vaes_avx512:
+        endbranch64
+	or		NUM_BLOCKS, NUM_BLOCKS
+	jz		keystream_x4_exit
+
+	SNOW_V_X4_LOAD_CONSTANTS
+	SNOW_V_X4_LOAD_STATE
+
+	mov		rax, NUM_BLOCKS
+keystream_x4_loop:
+	SNOW_V_X4_KEYSTREAM
+	vmovdqu64	[KS], KEYSTREAM
+	SNOW_V_X4_FSM_UPDATE
+	SNOW_V_X4_LFSR_UPDATE
+	add		KS, 64
+	dec		rax
+	jnz		keystream_x4_loop
+
+	SNOW_V_X4_STORE_STATE
+
+%ifdef SAFE_DATA
+	clear_scratch_zmms_asm
+%else
+	vzeroupper
+%endif
+keystream_x4_exit:
+	ret
+
+mksection stack-noexec
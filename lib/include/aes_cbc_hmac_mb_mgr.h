@@ -0,0 +1,530 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * Stitched AES-CBC/CTR + HMAC-SHA1/SHA256.
+ *
+ * Jobs are ciphered in place and the hashed region ends with the
+ * ciphered region (IPsec ESP layout). Each lane is ciphered just ahead
+ * of the inner hash (cipher-then-hash) or just behind it
+ * (hash-then-cipher, AES-CTR only), a few SHA blocks at a time, so that
+ * the data is still in L1 cache for the second operation and the job
+ * is complete after a single pass through one manager.
+ *
+ * The final inner block(s) and the outer hash of the shortest lane
+ * are computed with the single block SHA functions.
+ */
+
+#ifndef AES_CBC_HMAC_MB_MGR_H
+#define AES_CBC_HMAC_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/sha_generic.h"
+#include "include/clear_regs_mem.h"
+
+/* Number of SHA blocks hashed per kernel call */
+#define AES_CBC_HMAC_STITCH_BLOCKS 4
+
+/* Position of the cipher relative to the hash in the lane */
+#define AES_STITCH_LEAD 0 /* cipher-then-hash */
+#define AES_STITCH_LAG  1 /* hash-then-cipher */
+#define AES_STITCH_LAST 2 /* hash is complete, cipher the rest */
+
+typedef void (*sha1_mb_kernel_t)(SHA1_ARGS *, uint32_t);
+typedef void (*sha256_mb_kernel_t)(SHA256_ARGS *, uint32_t);
+typedef void (*sha_one_block_t)(const void *, void *);
+
+__forceinline
+unsigned aes_stitch_nrounds(const uint64_t key_len_in_bytes)
+{
+        if (key_len_in_bytes == 16)
+                return 10;
+        if (key_len_in_bytes == 24)
+                return 12;
+        return 14;
+}
+
+__forceinline
+__m128i aes_stitch_enc_block(__m128i x, const void *keys,
+                             const unsigned nrounds)
+{
+        const __m128i *k = (const __m128i *) keys;
+        unsigned r;
+
+        x = _mm_xor_si128(x, _mm_loadu_si128(&k[0]));
+        for (r = 1; r < nrounds; r++)
+                x = _mm_aesenc_si128(x, _mm_loadu_si128(&k[r]));
+        return _mm_aesenclast_si128(x, _mm_loadu_si128(&k[r]));
+}
+
+/*
+ * Sets up the AES-CTR counter block from 12 byte (nonce + IV,
+ * block counter starts at 1) or 16 byte IV
+ */
+__forceinline
+void aes_stitch_ctr_init(imb_uint128_t *ctr, const IMB_JOB *job)
+{
+        if (job->iv_len_in_bytes == 16) {
+                memcpy(ctr, job->iv, 16);
+        } else {
+                memcpy(ctr, job->iv, 12);
+                ((uint32_t *) ctr)[3] = bswap4(1);
+        }
+}
+
+/*
+ * Processes one cipher block in place: AES-CBC encrypt or
+ * AES-CTR, with a partial last block for the latter
+ */
+__forceinline
+void aes_stitch_cipher_block(imb_uint128_t *iv, uint8_t *p,
+                             const uint64_t len, const void *keys,
+                             const unsigned nrounds,
+                             const IMB_CIPHER_MODE cipher_mode)
+{
+        __m128i x;
+
+        if (cipher_mode == IMB_CIPHER_CBC) {
+                x = _mm_xor_si128(_mm_loadu_si128((const __m128i *) p),
+                                  _mm_load_si128((const __m128i *) iv));
+                x = aes_stitch_enc_block(x, keys, nrounds);
+                _mm_storeu_si128((__m128i *) p, x);
+                _mm_store_si128((__m128i *) iv, x);
+        } else {
+                uint32_t *cnt = &((uint32_t *) iv)[3];
+
+                x = aes_stitch_enc_block(_mm_load_si128((const __m128i *) iv),
+                                         keys, nrounds);
+                *cnt = bswap4(bswap4(*cnt) + 1);
+                if (len >= 16) {
+                        x = _mm_xor_si128(x, _mm_loadu_si128((__m128i *) p));
+                        _mm_storeu_si128((__m128i *) p, x);
+                } else {
+                        DECLARE_ALIGNED(uint8_t ks[16], 16);
+                        uint64_t i;
+
+                        _mm_store_si128((__m128i *) ks, x);
+                        for (i = 0; i < len; i++)
+                                p[i] ^= ks[i];
+                }
+        }
+}
+
+/*
+ * Number of cipher blocks to process so that the cipher reaches
+ * the hash at 'limit': blocks starting below 'limit' if the cipher
+ * leads, only blocks fully below 'limit' if it lags
+ */
+__forceinline
+uint64_t aes_stitch_num_blocks(const uint8_t *cipher_ptr,
+                               const uint64_t cipher_len,
+                               const uint8_t *limit, const int lag)
+{
+        const uint64_t max_blocks = (cipher_len + 15) / 16;
+        uint64_t n;
+
+        if (limit <= cipher_ptr)
+                return 0;
+
+        n = (uint64_t) (limit - cipher_ptr);
+        n = lag ? (n / 16) : ((n + 15) / 16);
+
+        return (n < max_blocks) ? n : max_blocks;
+}
+
+/*
+ * Ciphers, in lanes in use from the given range, the data up to
+ * hash_bytes bytes past the current hash position. Only lanes with
+ * the given cipher position are processed (any lane for
+ * AES_STITCH_LAST). Blocks of different lanes are interleaved, as
+ * CBC is sequential within a lane.
+ */
+__forceinline
+void aes_cbc_hmac_cipher_lanes(MB_MGR_AES_CBC_HMAC_OOO *state,
+                               const uint8_t * const *data_ptr,
+                               const uint64_t hash_bytes,
+                               const unsigned first_lane,
+                               const unsigned end_lane,
+                               const int position,
+                               const IMB_CIPHER_MODE cipher_mode)
+{
+        uint64_t nblocks[16], max_blocks = 0, n;
+        unsigned lane;
+
+        for (lane = first_lane; lane < end_lane; lane++) {
+                nblocks[lane] = 0;
+                if (state->job_in_lane[lane] == NULL)
+                        continue;
+                if (position != AES_STITCH_LAST &&
+                    state->cipher_lag[lane] != position)
+                        continue;
+
+                nblocks[lane] =
+                        aes_stitch_num_blocks(state->cipher_ptr[lane],
+                                              state->cipher_len[lane],
+                                              data_ptr[lane] + hash_bytes,
+                                              position == AES_STITCH_LAG);
+                if (max_blocks < nblocks[lane])
+                        max_blocks = nblocks[lane];
+        }
+
+        for (n = 0; n < max_blocks; n++)
+                for (lane = first_lane; lane < end_lane; lane++) {
+                        if (n >= nblocks[lane])
+                                continue;
+
+                        aes_stitch_cipher_block(&state->iv[lane],
+                                                state->cipher_ptr[lane] +
+                                                n * 16,
+                                                state->cipher_len[lane] -
+                                                n * 16,
+                                                state->keys[lane],
+                                                state->nrounds[lane],
+                                                cipher_mode);
+                }
+
+        for (lane = first_lane; lane < end_lane; lane++) {
+                uint64_t bytes = nblocks[lane] * 16;
+
+                if (bytes > state->cipher_len[lane])
+                        bytes = state->cipher_len[lane];
+                state->cipher_ptr[lane] += bytes;
+                state->cipher_len[lane] -= bytes;
+        }
+}
+
+/*
+ * Completes HMAC of the lane: final inner block(s) with padding,
+ * outer hash and tag output
+ */
+__forceinline
+void aes_cbc_hmac_complete_lane(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                const unsigned lane, const int sha_type,
+                                const sha_one_block_t one_block)
+{
+        const IMB_JOB *job = state->job_in_lane[lane];
+        const unsigned num_words = (sha_type == 1) ?
+                NUM_SHA_DIGEST_WORDS : NUM_SHA_256_DIGEST_WORDS;
+        const uint64_t r = job->msg_len_to_hash_in_bytes % 64;
+        const uint8_t *data = (sha_type == 1) ?
+                state->args.sha1.data_ptr[lane] :
+                state->args.sha256.data_ptr[lane];
+        DECLARE_ALIGNED(uint8_t block[2 * 64], 16);
+        DECLARE_ALIGNED(uint32_t dgst[NUM_SHA_256_DIGEST_WORDS], 16);
+        const unsigned num_blocks = (r > (64 - 8 - 1)) ? 2 : 1;
+        unsigned i;
+
+        /* SHA1 and SHA256 arguments share storage, use the typed member */
+        if (sha_type == 1)
+                for (i = 0; i < NUM_SHA_DIGEST_WORDS; i++)
+                        dgst[i] = state->args.sha1.digest[lane + i * 16];
+        else
+                for (i = 0; i < NUM_SHA_256_DIGEST_WORDS; i++)
+                        dgst[i] = state->args.sha256.digest[lane + i * 16];
+
+        /* inner hash: message length includes the ipad block */
+        memset(block, 0, sizeof(block));
+        memcpy(block, data, r);
+        block[r] = 0x80;
+        store8_be(&block[num_blocks * 64 - 8],
+                  (64 + job->msg_len_to_hash_in_bytes) * 8);
+        one_block(block, dgst);
+        if (num_blocks == 2)
+                one_block(&block[64], dgst);
+
+        /* outer hash */
+        memset(block, 0, 64);
+        copy_bswap4_array(block, dgst, num_words);
+        block[num_words * 4] = 0x80;
+        store8_be(&block[64 - 8], (64 + num_words * 4) * 8);
+        memcpy(dgst, job->u.HMAC._hashed_auth_key_xor_opad, num_words * 4);
+        one_block(block, dgst);
+
+        copy_bswap4_array(block, dgst, num_words);
+        memcpy(job->auth_tag_output, block,
+               job->auth_tag_output_len_in_bytes);
+
+#ifdef SAFE_DATA
+        clear_mem(block, sizeof(block));
+        clear_mem(dgst, sizeof(dgst));
+#endif
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_aes_cbc_hmac(MB_MGR_AES_CBC_HMAC_OOO *state, IMB_JOB *job,
+                              const unsigned max_jobs, const int is_submit,
+                              const int sha_type,
+                              const IMB_CIPHER_MODE cipher_mode,
+                              const sha1_mb_kernel_t sha1_kernel,
+                              const sha256_mb_kernel_t sha256_kernel,
+                              const sha_one_block_t one_block)
+{
+        const uint8_t **data_ptr = (sha_type == 1) ?
+                state->args.sha1.data_ptr : state->args.sha256.data_ptr;
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX, done;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - inner hash starts from the ipad digest
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+                const uint8_t *ipad = job->u.HMAC._hashed_auth_key_xor_ipad;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                data_ptr[lane] = job->src + job->hash_start_src_offset_in_bytes;
+                if (sha_type == 1)
+                        for (i = 0; i < NUM_SHA_DIGEST_WORDS; i++)
+                                memcpy(&state->args.sha1.digest[lane + i * 16],
+                                       &ipad[i * 4], 4);
+                else
+                        for (i = 0; i < NUM_SHA_256_DIGEST_WORDS; i++)
+                                memcpy(&state->args.sha256.digest[lane +
+                                                                  i * 16],
+                                       &ipad[i * 4], 4);
+
+                state->cipher_ptr[lane] = job->dst;
+                state->keys[lane] = job->enc_keys;
+                state->nrounds[lane] =
+                        aes_stitch_nrounds(job->key_len_in_bytes);
+                state->cipher_lag[lane] =
+                        (job->chain_order == IMB_ORDER_HASH_CIPHER);
+                if (cipher_mode == IMB_CIPHER_CBC) {
+                        state->cipher_len[lane] =
+                                job->msg_len_to_cipher_in_bytes &
+                                (~UINT64_C(15));
+                        memcpy(&state->iv[lane], job->iv, 16);
+                } else {
+                        state->cipher_len[lane] =
+                                job->msg_len_to_cipher_in_bytes;
+                        aes_stitch_ctr_init(&state->iv[lane], job);
+                }
+                state->lens[lane] = job->msg_len_to_hash_in_bytes / 64;
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs without full hash blocks are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        if (min_len != 0) {
+                /*
+                 * Unused lanes (flush only) hash the data of the
+                 * shortest lane; they are skipped by the cipher.
+                 * Hash-then-cipher lanes (AES-CTR only) are ciphered
+                 * after the kernel call.
+                 */
+                if (!is_submit)
+                        for (i = 0; i < max_jobs; i++)
+                                if (state->job_in_lane[i] == NULL)
+                                        data_ptr[i] = data_ptr[min_idx];
+
+                for (done = 0; done < min_len;) {
+                        uint64_t n = min_len - done;
+
+                        if (n > AES_CBC_HMAC_STITCH_BLOCKS)
+                                n = AES_CBC_HMAC_STITCH_BLOCKS;
+
+                        aes_cbc_hmac_cipher_lanes(state, data_ptr, n * 64,
+                                                  0, max_jobs,
+                                                  AES_STITCH_LEAD,
+                                                  cipher_mode);
+                        if (sha_type == 1)
+                                sha1_kernel(&state->args.sha1, (uint32_t) n);
+                        else
+                                sha256_kernel(&state->args.sha256,
+                                              (uint32_t) n);
+                        if (cipher_mode != IMB_CIPHER_CBC)
+                                aes_cbc_hmac_cipher_lanes(state, data_ptr, 0,
+                                                          0, max_jobs,
+                                                          AES_STITCH_LAG,
+                                                          cipher_mode);
+                        done += n;
+                }
+
+                for (i = 0; i < max_jobs; i++)
+                        if (state->job_in_lane[i] != NULL)
+                                state->lens[i] -= min_len;
+        }
+
+        /* complete the shortest lane and cipher the rest of it */
+        aes_cbc_hmac_cipher_lanes(state, data_ptr, 64, min_idx, min_idx + 1,
+                                  AES_STITCH_LEAD, cipher_mode);
+        aes_cbc_hmac_complete_lane(state, min_idx, sha_type, one_block);
+        aes_cbc_hmac_cipher_lanes(state, data_ptr, 64, min_idx, min_idx + 1,
+                                  AES_STITCH_LAST, cipher_mode);
+
+        job = state->job_in_lane[min_idx];
+        job->status |= IMB_STATUS_COMPLETED_CIPHER |
+                IMB_STATUS_COMPLETED_AUTH;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+#ifdef SAFE_DATA
+        if (sha_type == 1)
+                for (i = 0; i < NUM_SHA_DIGEST_WORDS; i++)
+                        state->args.sha1.digest[min_idx + i * 16] = 0;
+        else
+                for (i = 0; i < NUM_SHA_256_DIGEST_WORDS; i++)
+                        state->args.sha256.digest[min_idx + i * 16] = 0;
+        clear_mem(&state->iv[min_idx], sizeof(state->iv[min_idx]));
+#endif
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch stitched AES-CBC/CTR + HMAC-SHA1/SHA256 API.
+ * The arch file defines NUM_SHA1_LANES, NUM_SHA256_LANES, the SHA
+ * kernels and the function names below before including this header.
+ */
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES_CBC_HMAC_SHA_1(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                       IMB_JOB *job)
+{
+        return submit_flush_job_aes_cbc_hmac(state, job,
+                                             NUM_SHA1_LANES, 1, 1,
+                                             IMB_CIPHER_CBC,
+                                             SHA1_MB_KERNEL, NULL,
+                                             SHA1_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES_CBC_HMAC_SHA_1(MB_MGR_AES_CBC_HMAC_OOO *state)
+{
+        return submit_flush_job_aes_cbc_hmac(state, NULL,
+                                             NUM_SHA1_LANES, 0, 1,
+                                             IMB_CIPHER_CBC,
+                                             SHA1_MB_KERNEL, NULL,
+                                             SHA1_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES_CBC_HMAC_SHA_256(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                         IMB_JOB *job)
+{
+        return submit_flush_job_aes_cbc_hmac(state, job,
+                                             NUM_SHA256_LANES, 1, 256,
+                                             IMB_CIPHER_CBC,
+                                             NULL, SHA256_MB_KERNEL,
+                                             SHA256_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES_CBC_HMAC_SHA_256(MB_MGR_AES_CBC_HMAC_OOO *state)
+{
+        return submit_flush_job_aes_cbc_hmac(state, NULL,
+                                             NUM_SHA256_LANES, 0, 256,
+                                             IMB_CIPHER_CBC,
+                                             NULL, SHA256_MB_KERNEL,
+                                             SHA256_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES_CTR_HMAC_SHA_1(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                       IMB_JOB *job)
+{
+        return submit_flush_job_aes_cbc_hmac(state, job,
+                                             NUM_SHA1_LANES, 1, 1,
+                                             IMB_CIPHER_CNTR,
+                                             SHA1_MB_KERNEL, NULL,
+                                             SHA1_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES_CTR_HMAC_SHA_1(MB_MGR_AES_CBC_HMAC_OOO *state)
+{
+        return submit_flush_job_aes_cbc_hmac(state, NULL,
+                                             NUM_SHA1_LANES, 0, 1,
+                                             IMB_CIPHER_CNTR,
+                                             SHA1_MB_KERNEL, NULL,
+                                             SHA1_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES_CTR_HMAC_SHA_256(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                         IMB_JOB *job)
+{
+        return submit_flush_job_aes_cbc_hmac(state, job,
+                                             NUM_SHA256_LANES, 1, 256,
+                                             IMB_CIPHER_CNTR,
+                                             NULL, SHA256_MB_KERNEL,
+                                             SHA256_ONE_BLOCK);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES_CTR_HMAC_SHA_256(MB_MGR_AES_CBC_HMAC_OOO *state)
+{
+        return submit_flush_job_aes_cbc_hmac(state, NULL,
+                                             NUM_SHA256_LANES, 0, 256,
+                                             IMB_CIPHER_CNTR,
+                                             NULL, SHA256_MB_KERNEL,
+                                             SHA256_ONE_BLOCK);
+}
+
+#endif /* SUBMIT_JOB_AES_CBC_HMAC_SHA_1 */
+
+#endif /* AES_CBC_HMAC_MB_MGR_H */
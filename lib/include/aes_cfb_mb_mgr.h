@@ -0,0 +1,402 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*
+ * AES-CFB128 (NIST SP 800-38A) implementation.
+ *
+ * Encryption is sequential within a message, so up to 16 independent
+ * messages are encrypted in parallel by the multi-buffer manager, with
+ * the AES rounds of all lanes interleaved. The feedback block of each
+ * lane is kept in the IV field of the arguments. The final partial block
+ * is encrypted when the job is complete.
+ *
+ * Decryption of each block only depends on cipher-text, so it is done
+ * synchronously, 8 blocks of the message at a time.
+ */
+
+#ifndef AES_CFB_MB_MGR_H
+#define AES_CFB_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/clear_regs_mem.h"
+
+/* Encrypts num_blocks full blocks of all lanes */
+typedef void (*aes_cfb_mb_kernel_t)(AES_ARGS *, const uint64_t);
+
+__forceinline
+__m128i aes_cfb_enc_block(__m128i block, const void *keys,
+                          const unsigned nrounds)
+{
+        const __m128i *k = (const __m128i *) keys;
+        unsigned i;
+
+        block = _mm_xor_si128(block, _mm_loadu_si128(&k[0]));
+        for (i = 1; i < nrounds; i++)
+                block = _mm_aesenc_si128(block, _mm_loadu_si128(&k[i]));
+
+        return _mm_aesenclast_si128(block, _mm_loadu_si128(&k[nrounds]));
+}
+
+/*
+ * Encrypts/decrypts the final partial block (len < 16 bytes)
+ * with feedback block fb
+ */
+__forceinline
+void aes_cfb_partial_block(const uint8_t *in, uint8_t *out, const void *keys,
+                           const __m128i fb, const uint64_t len,
+                           const unsigned nrounds)
+{
+        DECLARE_ALIGNED(uint8_t ks[16], 16);
+        uint64_t i;
+
+        if (len == 0)
+                return;
+
+        _mm_store_si128((__m128i *) ks, aes_cfb_enc_block(fb, keys, nrounds));
+        for (i = 0; i < len; i++)
+                out[i] = in[i] ^ ks[i];
+#ifdef SAFE_DATA
+        clear_mem(ks, sizeof(ks));
+#endif
+}
+
+/*
+ * AESNI encrypt kernel: 8 lanes, 1 block per lane at a time.
+ * All blocks are loaded before any block is stored, as unused lanes
+ * may be a copy of a lane in use.
+ */
+__forceinline
+void aes_cfb_enc_mb_x8_aesni(AES_ARGS *args, const uint64_t num_blocks,
+                             const unsigned nrounds)
+{
+        __m128i x[8], fb[8], p[8];
+        uint64_t i, offset;
+        unsigned lane, r;
+
+        for (lane = 0; lane < 8; lane++)
+                fb[lane] = _mm_load_si128((const __m128i *) &args->IV[lane]);
+
+        for (i = 0, offset = 0; i < num_blocks; i++, offset += 16) {
+                for (lane = 0; lane < 8; lane++) {
+                        const __m128i *k =
+                                (const __m128i *) args->keys[lane];
+
+                        p[lane] = _mm_loadu_si128((const __m128i *)
+                                                  &args->in[lane][offset]);
+                        x[lane] = _mm_xor_si128(fb[lane],
+                                                _mm_loadu_si128(&k[0]));
+                }
+
+                for (r = 1; r < nrounds; r++)
+                        for (lane = 0; lane < 8; lane++) {
+                                const __m128i *k =
+                                        (const __m128i *) args->keys[lane];
+
+                                x[lane] = _mm_aesenc_si128(x[lane],
+                                                   _mm_loadu_si128(&k[r]));
+                        }
+
+                for (lane = 0; lane < 8; lane++) {
+                        const __m128i *k =
+                                (const __m128i *) args->keys[lane];
+                        __m128i *out = (__m128i *) &args->out[lane][offset];
+
+                        x[lane] = _mm_aesenclast_si128(x[lane],
+                                             _mm_loadu_si128(&k[nrounds]));
+                        fb[lane] = _mm_xor_si128(x[lane], p[lane]);
+                        _mm_storeu_si128(out, fb[lane]);
+                }
+        }
+
+        for (lane = 0; lane < 8; lane++) {
+                _mm_store_si128((__m128i *) &args->IV[lane], fb[lane]);
+                args->in[lane] += offset;
+                args->out[lane] += offset;
+        }
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_aes_cfb_enc(MB_MGR_AES_CFB_OOO *state, IMB_JOB *job,
+                             const unsigned max_jobs, const int is_submit,
+                             const unsigned nrounds,
+                             const aes_cfb_mb_kernel_t kernel)
+{
+        AES_ARGS *args = &state->args;
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - number of blocks for the kernel: all full blocks
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                args->in[lane] = job->src +
+                        job->cipher_start_src_offset_in_bytes;
+                args->out[lane] = job->dst;
+                args->keys[lane] = job->enc_keys;
+                memcpy(&args->IV[lane], job->iv, sizeof(args->IV[lane]));
+                state->lens[lane] = job->msg_len_to_cipher_in_bytes / 16;
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs without full blocks are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        if (min_len != 0) {
+                /*
+                 * Unused lanes (flush only) repeat the work
+                 * of the shortest lane
+                 */
+                if (!is_submit)
+                        for (i = 0; i < max_jobs; i++) {
+                                if (state->job_in_lane[i] != NULL)
+                                        continue;
+                                args->in[i] = args->in[min_idx];
+                                args->out[i] = args->out[min_idx];
+                                args->keys[i] = args->keys[min_idx];
+                                args->IV[i] = args->IV[min_idx];
+                        }
+
+                kernel(args, min_len);
+
+                for (i = 0; i < max_jobs; i++)
+                        if (state->job_in_lane[i] != NULL)
+                                state->lens[i] -= min_len;
+        }
+
+        job = state->job_in_lane[min_idx];
+        aes_cfb_partial_block(args->in[min_idx], args->out[min_idx],
+                              args->keys[min_idx],
+                              _mm_load_si128((const __m128i *)
+                                             &args->IV[min_idx]),
+                              job->msg_len_to_cipher_in_bytes & 15, nrounds);
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+        return job;
+}
+
+/*
+ * Decrypts len bytes with the AESNI by8 method: cipher-text of the
+ * 8 blocks is loaded before plain-text is stored (in-place operation)
+ */
+__forceinline
+void aes_cfb_dec_by8_aesni(const uint8_t *in, uint8_t *out, const void *keys,
+                           const void *iv, uint64_t len,
+                           const unsigned nrounds)
+{
+        const __m128i *k = (const __m128i *) keys;
+        __m128i fb = _mm_loadu_si128((const __m128i *) iv);
+        __m128i x[8], c[8];
+        unsigned i, r;
+
+        for (; len >= (8 * 16); len -= (8 * 16)) {
+                for (i = 0; i < 8; i++)
+                        c[i] = _mm_loadu_si128((const __m128i *)
+                                               &in[i * 16]);
+
+                x[0] = _mm_xor_si128(fb, _mm_loadu_si128(&k[0]));
+                for (i = 1; i < 8; i++)
+                        x[i] = _mm_xor_si128(c[i - 1],
+                                             _mm_loadu_si128(&k[0]));
+
+                for (r = 1; r < nrounds; r++) {
+                        const __m128i rk = _mm_loadu_si128(&k[r]);
+
+                        for (i = 0; i < 8; i++)
+                                x[i] = _mm_aesenc_si128(x[i], rk);
+                }
+
+                for (i = 0; i < 8; i++) {
+                        x[i] = _mm_aesenclast_si128(x[i],
+                                             _mm_loadu_si128(&k[nrounds]));
+                        _mm_storeu_si128((__m128i *) &out[i * 16],
+                                         _mm_xor_si128(x[i], c[i]));
+                }
+
+                fb = c[7];
+                in += (8 * 16);
+                out += (8 * 16);
+        }
+
+        for (; len >= 16; len -= 16) {
+                const __m128i ct = _mm_loadu_si128((const __m128i *) in);
+
+                _mm_storeu_si128((__m128i *) out,
+                                 _mm_xor_si128(aes_cfb_enc_block(fb, keys,
+                                                                 nrounds),
+                                               ct));
+                fb = ct;
+                in += 16;
+                out += 16;
+        }
+
+        aes_cfb_partial_block(in, out, keys, fb, len, nrounds);
+}
+
+__forceinline
+IMB_JOB *
+submit_job_aes_cfb_dec(IMB_JOB *job, const unsigned nrounds)
+{
+        aes_cfb_dec_by8_aesni(job->src + job->cipher_start_src_offset_in_bytes,
+                              job->dst, job->enc_keys, job->iv,
+                              job->msg_len_to_cipher_in_bytes, nrounds);
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch AES-CFB API.
+ * The arch file defines NUM_CFB_LANES and the function names below
+ * before including this header.
+ */
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+
+static void
+aes_cfb_enc_128_x8(AES_ARGS *args, const uint64_t num_blocks)
+{
+        aes_cfb_enc_mb_x8_aesni(args, num_blocks, 10);
+}
+
+static void
+aes_cfb_enc_192_x8(AES_ARGS *args, const uint64_t num_blocks)
+{
+        aes_cfb_enc_mb_x8_aesni(args, num_blocks, 12);
+}
+
+static void
+aes_cfb_enc_256_x8(AES_ARGS *args, const uint64_t num_blocks)
+{
+        aes_cfb_enc_mb_x8_aesni(args, num_blocks, 14);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES128_CFB_ENC(MB_MGR_AES_CFB_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_cfb_enc(state, job, NUM_CFB_LANES, 1,
+                                            10, aes_cfb_enc_128_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES128_CFB_ENC(MB_MGR_AES_CFB_OOO *state)
+{
+        return submit_flush_job_aes_cfb_enc(state, NULL, NUM_CFB_LANES, 0,
+                                            10, aes_cfb_enc_128_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES128_CFB_DEC(IMB_JOB *job)
+{
+        return submit_job_aes_cfb_dec(job, 10);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES192_CFB_ENC(MB_MGR_AES_CFB_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_cfb_enc(state, job, NUM_CFB_LANES, 1,
+                                            12, aes_cfb_enc_192_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES192_CFB_ENC(MB_MGR_AES_CFB_OOO *state)
+{
+        return submit_flush_job_aes_cfb_enc(state, NULL, NUM_CFB_LANES, 0,
+                                            12, aes_cfb_enc_192_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES192_CFB_DEC(IMB_JOB *job)
+{
+        return submit_job_aes_cfb_dec(job, 12);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES256_CFB_ENC(MB_MGR_AES_CFB_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_cfb_enc(state, job, NUM_CFB_LANES, 1,
+                                            14, aes_cfb_enc_256_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES256_CFB_ENC(MB_MGR_AES_CFB_OOO *state)
+{
+        return submit_flush_job_aes_cfb_enc(state, NULL, NUM_CFB_LANES, 0,
+                                            14, aes_cfb_enc_256_x8);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES256_CFB_DEC(IMB_JOB *job)
+{
+        return submit_job_aes_cfb_dec(job, 14);
+}
+
+#endif /* SUBMIT_JOB_AES128_CFB_ENC */
+
+#endif /* AES_CFB_MB_MGR_H */
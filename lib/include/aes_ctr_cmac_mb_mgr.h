@@ -0,0 +1,272 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * Stitched AES-CTR + AES-CMAC (e.g. 128-NEA2 + 128-NIA2).
+ *
+ * Jobs are ciphered in place and the hashed region ends with the
+ * ciphered region. Both algorithms are AES based, so each lane
+ * processes one CMAC block and the cipher blocks around it per step,
+ * with the lanes interleaved to hide the latency of the CMAC chain.
+ * Data is read once from memory for both operations.
+ */
+
+#ifndef AES_CTR_CMAC_MB_MGR_H
+#define AES_CTR_CMAC_MB_MGR_H
+
+#include "include/aes_cbc_hmac_mb_mgr.h"
+
+__forceinline
+uint64_t aes_ctr_cmac_hash_bytes(const IMB_JOB *job)
+{
+        if (job->hash_alg == IMB_AUTH_AES_CMAC_BITLEN)
+                return (job->msg_len_to_hash_in_bits + 7) / 8;
+
+        return job->msg_len_to_hash_in_bytes;
+}
+
+/*
+ * Ciphers the lane up to 'limit' given the cipher position
+ * relative to the hash
+ */
+__forceinline
+void aes_ctr_cmac_cipher_lane(MB_MGR_AES_CTR_CMAC_OOO *state,
+                              const unsigned lane, const uint8_t *limit,
+                              const int position)
+{
+        const uint64_t nblocks =
+                aes_stitch_num_blocks(state->cipher_ptr[lane],
+                                      state->cipher_len[lane], limit,
+                                      position == AES_STITCH_LAG);
+        uint64_t n, bytes = nblocks * 16;
+
+        for (n = 0; n < nblocks; n++)
+                aes_stitch_cipher_block(&state->ctr[lane],
+                                        state->cipher_ptr[lane] + n * 16,
+                                        state->cipher_len[lane] - n * 16,
+                                        state->keys[lane],
+                                        state->nrounds[lane],
+                                        IMB_CIPHER_CNTR);
+
+        if (bytes > state->cipher_len[lane])
+                bytes = state->cipher_len[lane];
+        state->cipher_ptr[lane] += bytes;
+        state->cipher_len[lane] -= bytes;
+}
+
+/*
+ * Completes AES-CMAC of the lane: last block with K1 or
+ * padding and K2, then tag output
+ */
+__forceinline
+void aes_ctr_cmac_complete_lane(MB_MGR_AES_CTR_CMAC_OOO *state,
+                                const unsigned lane)
+{
+        const IMB_JOB *job = state->job_in_lane[lane];
+        const uint64_t nbits = (job->hash_alg == IMB_AUTH_AES_CMAC_BITLEN) ?
+                job->msg_len_to_hash_in_bits :
+                job->msg_len_to_hash_in_bytes * 8;
+        /* number of message bits in the last block */
+        const uint64_t last_bits = (nbits == 0) ? 0 :
+                (((nbits - 1) % 128) + 1);
+        DECLARE_ALIGNED(uint8_t block[16], 16);
+        __m128i m;
+
+        memset(block, 0, sizeof(block));
+        memcpy(block, state->hash_ptr[lane], (last_bits + 7) / 8);
+
+        if (last_bits == 128) {
+                m = _mm_loadu_si128((const __m128i *) job->u.CMAC._skey1);
+        } else {
+                const unsigned byte = (unsigned) (last_bits / 8);
+                const unsigned bit = (unsigned) (last_bits % 8);
+
+                block[byte] &= (uint8_t) (0xff00 >> bit);
+                block[byte] |= (uint8_t) (0x80 >> bit);
+                m = _mm_loadu_si128((const __m128i *) job->u.CMAC._skey2);
+        }
+
+        m = _mm_xor_si128(m, _mm_load_si128((const __m128i *) block));
+        m = _mm_xor_si128(m, _mm_load_si128((const __m128i *)
+                                            &state->mac[lane]));
+        m = aes_stitch_enc_block(m, job->u.CMAC._key_expanded, 10);
+        _mm_store_si128((__m128i *) block, m);
+
+        memcpy(job->auth_tag_output, block,
+               job->auth_tag_output_len_in_bytes);
+
+#ifdef SAFE_DATA
+        clear_mem(block, sizeof(block));
+#endif
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_aes_ctr_cmac(MB_MGR_AES_CTR_CMAC_OOO *state, IMB_JOB *job,
+                              const unsigned max_jobs, const int is_submit)
+{
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX, n;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - all CMAC blocks but the last one go through the lanes
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+                const uint64_t hash_bytes = aes_ctr_cmac_hash_bytes(job);
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                state->hash_ptr[lane] = job->src +
+                        job->hash_start_src_offset_in_bytes;
+                memset(&state->mac[lane], 0, sizeof(state->mac[lane]));
+                state->lens[lane] = (hash_bytes == 0) ? 0 :
+                        ((hash_bytes - 1) / 16);
+
+                state->cipher_ptr[lane] = job->dst;
+                state->cipher_len[lane] = job->msg_len_to_cipher_in_bytes;
+                state->keys[lane] = job->enc_keys;
+                state->nrounds[lane] =
+                        aes_stitch_nrounds(job->key_len_in_bytes);
+                state->cipher_lag[lane] =
+                        (job->chain_order == IMB_ORDER_HASH_CIPHER);
+                aes_stitch_ctr_init(&state->ctr[lane], job);
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs with a single CMAC block are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        for (n = 0; n < min_len; n++)
+                for (i = 0; i < max_jobs; i++) {
+                        const IMB_JOB *lane_job = state->job_in_lane[i];
+                        __m128i m;
+
+                        if (lane_job == NULL)
+                                continue;
+
+                        if (!state->cipher_lag[i])
+                                aes_ctr_cmac_cipher_lane(state, i,
+                                                         state->hash_ptr[i] +
+                                                         16,
+                                                         AES_STITCH_LEAD);
+
+                        m = _mm_xor_si128(_mm_load_si128((const __m128i *)
+                                                         &state->mac[i]),
+                                          _mm_loadu_si128((const __m128i *)
+                                                          state->hash_ptr[i]));
+                        m = aes_stitch_enc_block(m,
+                                                 lane_job->u.CMAC._key_expanded,
+                                                 10);
+                        _mm_store_si128((__m128i *) &state->mac[i], m);
+                        state->hash_ptr[i] += 16;
+
+                        if (state->cipher_lag[i])
+                                aes_ctr_cmac_cipher_lane(state, i,
+                                                         state->hash_ptr[i],
+                                                         AES_STITCH_LAG);
+                }
+
+        for (i = 0; i < max_jobs; i++)
+                if (state->job_in_lane[i] != NULL)
+                        state->lens[i] -= min_len;
+
+        /* complete the shortest lane and cipher the rest of it */
+        if (!state->cipher_lag[min_idx])
+                aes_ctr_cmac_cipher_lane(state, min_idx,
+                                         state->hash_ptr[min_idx] + 16,
+                                         AES_STITCH_LEAD);
+        aes_ctr_cmac_complete_lane(state, min_idx);
+        aes_ctr_cmac_cipher_lane(state, min_idx,
+                                 state->hash_ptr[min_idx] + 16,
+                                 AES_STITCH_LAST);
+
+        job = state->job_in_lane[min_idx];
+        job->status |= IMB_STATUS_COMPLETED_CIPHER |
+                IMB_STATUS_COMPLETED_AUTH;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+#ifdef SAFE_DATA
+        clear_mem(&state->mac[min_idx], sizeof(state->mac[min_idx]));
+        clear_mem(&state->ctr[min_idx], sizeof(state->ctr[min_idx]));
+#endif
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch stitched AES-CTR + AES-CMAC API.
+ * The arch file defines NUM_CTR_CMAC_LANES and the function names below
+ * before including this header.
+ */
+#ifdef SUBMIT_JOB_AES_CTR_CMAC
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES_CTR_CMAC(MB_MGR_AES_CTR_CMAC_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_ctr_cmac(state, job, NUM_CTR_CMAC_LANES, 1);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES_CTR_CMAC(MB_MGR_AES_CTR_CMAC_OOO *state)
+{
+        return submit_flush_job_aes_ctr_cmac(state, NULL, NUM_CTR_CMAC_LANES,
+                                             0);
+}
+
+#endif /* SUBMIT_JOB_AES_CTR_CMAC */
+
+#endif /* AES_CTR_CMAC_MB_MGR_H */
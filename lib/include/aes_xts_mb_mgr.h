@@ -0,0 +1,479 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*
+ * AES-XTS (IEEE 1619) multi-buffer implementation.
+ *
+ * Up to 16 independent data units (each with its own keys and tweak)
+ * are processed in parallel. The kernels encrypt/decrypt a fixed number
+ * of full blocks per lane at a time (1 for AESNI, 2 for AVX2 VAES and
+ * 4 for AVX512 VAES), with the AES rounds of all lanes interleaved.
+ * The tweaks of the next 4 blocks of each lane are kept in the manager,
+ * so that a kernel can load all the tweaks of a lane with one register.
+ *
+ * The initial tweak is encrypted on submission. Blocks left over by
+ * the kernels and ciphertext stealing of the final partial block
+ * are processed one block at a time when the job is complete.
+ */
+
+#ifndef AES_XTS_MB_MGR_H
+#define AES_XTS_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/clear_regs_mem.h"
+
+/* Encrypts/decrypts num_blocks full blocks of all lanes */
+typedef void (*aes_xts_mb_kernel_t)(AES_XTS_ARGS *, const uint64_t);
+
+/*
+ * Multiplication of the tweak by alpha (x) in GF(2^128),
+ * with the tweak in little endian byte order
+ */
+__forceinline
+__m128i aes_xts_mb_mul_alpha(const __m128i t)
+{
+        const __m128i poly = _mm_set_epi32(0x87, 1, 1, 1);
+        __m128i carry;
+
+        /* carry of each dword moves to the next one, top one is reduced */
+        carry = _mm_and_si128(_mm_srai_epi32(t, 31), poly);
+        carry = _mm_shuffle_epi32(carry, 0x93);
+
+        return _mm_xor_si128(_mm_slli_epi32(t, 1), carry);
+}
+
+__forceinline
+__m128i aes_xts_mb_enc_block(__m128i block, const void *keys,
+                             const unsigned nrounds)
+{
+        const __m128i *k = (const __m128i *) keys;
+        unsigned i;
+
+        block = _mm_xor_si128(block, _mm_loadu_si128(&k[0]));
+        for (i = 1; i < nrounds; i++)
+                block = _mm_aesenc_si128(block, _mm_loadu_si128(&k[i]));
+
+        return _mm_aesenclast_si128(block, _mm_loadu_si128(&k[nrounds]));
+}
+
+__forceinline
+__m128i aes_xts_mb_dec_block(__m128i block, const void *keys,
+                             const unsigned nrounds)
+{
+        const __m128i *k = (const __m128i *) keys;
+        unsigned i;
+
+        block = _mm_xor_si128(block, _mm_loadu_si128(&k[0]));
+        for (i = 1; i < nrounds; i++)
+                block = _mm_aesdec_si128(block, _mm_loadu_si128(&k[i]));
+
+        return _mm_aesdeclast_si128(block, _mm_loadu_si128(&k[nrounds]));
+}
+
+/* Encrypts/decrypts one block with tweak t */
+__forceinline
+__m128i aes_xts_mb_block(const __m128i block, const __m128i t,
+                         const void *keys, const unsigned nrounds,
+                         const int is_enc)
+{
+        __m128i x = _mm_xor_si128(block, t);
+
+        if (is_enc)
+                x = aes_xts_mb_enc_block(x, keys, nrounds);
+        else
+                x = aes_xts_mb_dec_block(x, keys, nrounds);
+
+        return _mm_xor_si128(x, t);
+}
+
+/*
+ * AESNI kernel: 8 lanes, 1 block per lane at a time.
+ * All blocks are loaded before any block is stored, as unused lanes
+ * may be a copy of a lane in use.
+ */
+__forceinline
+void aes_xts_mb_x8_aesni(AES_XTS_ARGS *args, const uint64_t num_blocks,
+                         const unsigned nrounds, const int is_enc)
+{
+        __m128i x[8], t[8];
+        uint64_t i, offset;
+        unsigned lane, r;
+
+        for (lane = 0; lane < 8; lane++)
+                t[lane] = _mm_load_si128((const __m128i *)
+                                         &args->tweak[lane][0]);
+
+        for (i = 0, offset = 0; i < num_blocks; i++, offset += 16) {
+                for (lane = 0; lane < 8; lane++) {
+                        const __m128i *k =
+                                (const __m128i *) args->keys[lane];
+                        const __m128i *in = (const __m128i *)
+                                &args->in[lane][offset];
+
+                        x[lane] = _mm_xor_si128(_mm_loadu_si128(in), t[lane]);
+                        x[lane] = _mm_xor_si128(x[lane],
+                                                _mm_loadu_si128(&k[0]));
+                }
+
+                for (r = 1; r < nrounds; r++)
+                        for (lane = 0; lane < 8; lane++) {
+                                const __m128i *k =
+                                        (const __m128i *) args->keys[lane];
+                                const __m128i rk = _mm_loadu_si128(&k[r]);
+
+                                if (is_enc)
+                                        x[lane] = _mm_aesenc_si128(x[lane],
+                                                                   rk);
+                                else
+                                        x[lane] = _mm_aesdec_si128(x[lane],
+                                                                   rk);
+                        }
+
+                for (lane = 0; lane < 8; lane++) {
+                        const __m128i *k =
+                                (const __m128i *) args->keys[lane];
+                        const __m128i rk = _mm_loadu_si128(&k[nrounds]);
+                        __m128i *out = (__m128i *) &args->out[lane][offset];
+
+                        if (is_enc)
+                                x[lane] = _mm_aesenclast_si128(x[lane], rk);
+                        else
+                                x[lane] = _mm_aesdeclast_si128(x[lane], rk);
+
+                        _mm_storeu_si128(out, _mm_xor_si128(x[lane],
+                                                            t[lane]));
+                        t[lane] = aes_xts_mb_mul_alpha(t[lane]);
+                }
+        }
+
+        for (lane = 0; lane < 8; lane++) {
+                _mm_store_si128((__m128i *) &args->tweak[lane][0], t[lane]);
+                args->in[lane] += offset;
+                args->out[lane] += offset;
+        }
+}
+
+/* AESNI kernel entry points for each key size and direction */
+__forceinline
+void aes_xts_enc_128_x8_aesni(AES_XTS_ARGS *args, const uint64_t num_blocks)
+{
+        aes_xts_mb_x8_aesni(args, num_blocks, 10, 1);
+}
+
+__forceinline
+void aes_xts_dec_128_x8_aesni(AES_XTS_ARGS *args, const uint64_t num_blocks)
+{
+        aes_xts_mb_x8_aesni(args, num_blocks, 10, 0);
+}
+
+__forceinline
+void aes_xts_enc_256_x8_aesni(AES_XTS_ARGS *args, const uint64_t num_blocks)
+{
+        aes_xts_mb_x8_aesni(args, num_blocks, 14, 1);
+}
+
+__forceinline
+void aes_xts_dec_256_x8_aesni(AES_XTS_ARGS *args, const uint64_t num_blocks)
+{
+        aes_xts_mb_x8_aesni(args, num_blocks, 14, 0);
+}
+
+/* Sets tweaks of the next 4 blocks of the lane, starting from t */
+__forceinline
+void aes_xts_mb_set_tweaks(AES_XTS_ARGS *args, const unsigned lane, __m128i t)
+{
+        unsigned i;
+
+        for (i = 0; i < 4; i++) {
+                _mm_store_si128((__m128i *) &args->tweak[lane][i], t);
+                t = aes_xts_mb_mul_alpha(t);
+        }
+}
+
+/*
+ * Encrypts/decrypts the blocks of the job left over by the kernel,
+ * including ciphertext stealing of the final partial block
+ */
+__forceinline
+void aes_xts_mb_finish(const uint8_t *in, uint8_t *out, const void *keys,
+                       __m128i t, const uint64_t len, const unsigned nrounds,
+                       const int is_enc)
+{
+        const uint64_t partial = len & 15;
+        uint64_t num_blocks = len / 16;
+        uint64_t i;
+
+        /* last full block is needed for ciphertext stealing */
+        if (partial != 0)
+                num_blocks--;
+
+        for (i = 0; i < num_blocks; i++) {
+                const __m128i x = _mm_loadu_si128((const __m128i *) in);
+
+                _mm_storeu_si128((__m128i *) out,
+                                 aes_xts_mb_block(x, t, keys, nrounds,
+                                                  is_enc));
+                t = aes_xts_mb_mul_alpha(t);
+                in += 16;
+                out += 16;
+        }
+
+        if (partial != 0) {
+                DECLARE_ALIGNED(uint8_t buf[16], 16);
+                const __m128i t_next = aes_xts_mb_mul_alpha(t);
+                __m128i x = _mm_loadu_si128((const __m128i *) in);
+
+                /*
+                 * Encrypt: last full block is processed with its own
+                 * tweak and the stolen block with the next one.
+                 * Decrypt: the order of the two tweaks is swapped.
+                 */
+                x = aes_xts_mb_block(x, is_enc ? t : t_next, keys, nrounds,
+                                     is_enc);
+                _mm_store_si128((__m128i *) buf, x);
+
+                /* buf = partial block || tail of the processed block */
+                for (i = 0; i < partial; i++) {
+                        const uint8_t c = buf[i];
+
+                        buf[i] = in[16 + i];
+                        out[16 + i] = c;
+                }
+
+                x = _mm_load_si128((const __m128i *) buf);
+                _mm_storeu_si128((__m128i *) out,
+                                 aes_xts_mb_block(x, is_enc ? t_next : t,
+                                                  keys, nrounds, is_enc));
+#ifdef SAFE_DATA
+                clear_mem(buf, sizeof(buf));
+#endif
+        }
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_aes_xts(MB_MGR_AES_XTS_OOO *state, IMB_JOB *job,
+                         const unsigned max_jobs, const int is_submit,
+                         const unsigned nrounds, const int is_enc,
+                         const unsigned blocks_per_lane,
+                         const aes_xts_mb_kernel_t kernel)
+{
+        AES_XTS_ARGS *args = &state->args;
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - encrypt the tweak of the job
+                 * - number of blocks for the kernel: all full blocks
+                 *   (except the one needed for ciphertext stealing),
+                 *   rounded down to blocks per lane of the kernel
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+                const uint64_t len = job->msg_len_to_cipher_in_bytes;
+                uint64_t num_blocks = len / 16;
+                __m128i t;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                args->in[lane] = job->src +
+                        job->cipher_start_src_offset_in_bytes;
+                args->out[lane] = job->dst;
+                args->keys[lane] = is_enc ? job->enc_keys : job->dec_keys;
+
+                t = _mm_loadu_si128((const __m128i *) job->iv);
+                t = aes_xts_mb_enc_block(t, job->cipher_fields.XTS.tweak_keys,
+                                         nrounds);
+                aes_xts_mb_set_tweaks(args, lane, t);
+
+                if (len & 15)
+                        num_blocks--;
+                state->lens[lane] = num_blocks - (num_blocks % blocks_per_lane);
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs too short for the kernel are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        if (min_len != 0) {
+                /*
+                 * Unused lanes (flush only) repeat the work
+                 * of the shortest lane
+                 */
+                if (!is_submit)
+                        for (i = 0; i < max_jobs; i++) {
+                                if (state->job_in_lane[i] != NULL)
+                                        continue;
+                                args->in[i] = args->in[min_idx];
+                                args->out[i] = args->out[min_idx];
+                                args->keys[i] = args->keys[min_idx];
+                                memcpy(args->tweak[i], args->tweak[min_idx],
+                                       sizeof(args->tweak[i]));
+                        }
+
+                kernel(args, min_len);
+
+                for (i = 0; i < max_jobs; i++)
+                        if (state->job_in_lane[i] != NULL)
+                                state->lens[i] -= min_len;
+        }
+
+        job = state->job_in_lane[min_idx];
+        aes_xts_mb_finish(args->in[min_idx], args->out[min_idx],
+                          args->keys[min_idx],
+                          _mm_load_si128((const __m128i *)
+                                         &args->tweak[min_idx][0]),
+                          job->msg_len_to_cipher_in_bytes -
+                          (uint64_t) (args->out[min_idx] - job->dst),
+                          nrounds, is_enc);
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+#ifdef SAFE_DATA
+        /* clear tweaks of the completed lane and of the unused lanes */
+        for (i = 0; i < max_jobs; i++)
+                if (state->job_in_lane[i] == NULL)
+                        memset(args->tweak[i], 0, sizeof(args->tweak[i]));
+#endif
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch AES-XTS MB API.
+ * The arch file defines NUM_XTS_LANES, XTS_BLOCKS_PER_STEP (blocks per
+ * lane done by one kernel call), the AES_XTS_*_KERNEL functions and the
+ * function names below before including this header.
+ */
+#ifdef SUBMIT_JOB_AES128_XTS_ENC
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES128_XTS_ENC(MB_MGR_AES_XTS_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_xts(state, job, NUM_XTS_LANES, 1, 10, 1,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_ENC_128_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES128_XTS_ENC(MB_MGR_AES_XTS_OOO *state)
+{
+        return submit_flush_job_aes_xts(state, NULL, NUM_XTS_LANES, 0, 10, 1,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_ENC_128_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES128_XTS_DEC(MB_MGR_AES_XTS_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_xts(state, job, NUM_XTS_LANES, 1, 10, 0,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_DEC_128_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES128_XTS_DEC(MB_MGR_AES_XTS_OOO *state)
+{
+        return submit_flush_job_aes_xts(state, NULL, NUM_XTS_LANES, 0, 10, 0,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_DEC_128_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES256_XTS_ENC(MB_MGR_AES_XTS_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_xts(state, job, NUM_XTS_LANES, 1, 14, 1,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_ENC_256_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES256_XTS_ENC(MB_MGR_AES_XTS_OOO *state)
+{
+        return submit_flush_job_aes_xts(state, NULL, NUM_XTS_LANES, 0, 14, 1,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_ENC_256_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES256_XTS_DEC(MB_MGR_AES_XTS_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_xts(state, job, NUM_XTS_LANES, 1, 14, 0,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_DEC_256_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES256_XTS_DEC(MB_MGR_AES_XTS_OOO *state)
+{
+        return submit_flush_job_aes_xts(state, NULL, NUM_XTS_LANES, 0, 14, 0,
+                                        XTS_BLOCKS_PER_STEP,
+                                        AES_XTS_DEC_256_KERNEL);
+}
+
+#endif /* SUBMIT_JOB_AES128_XTS_ENC */
+
+#endif /* AES_XTS_MB_MGR_H */
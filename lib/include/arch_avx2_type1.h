@@ -34,24 +34,48 @@
 #include "ipsec_ooo_mgr.h"
 
 /* moved from MB MGR */
-IMB_JOB *submit_job_zuc_eea3_avx2(MB_MGR_ZUC_OOO *state,
-                                  IMB_JOB *job);
-IMB_JOB *flush_job_zuc_eea3_avx2(MB_MGR_ZUC_OOO *state);
+IMB_JOB *submit_job_zuc_eea3_no_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                          IMB_JOB *job);
+IMB_JOB *flush_job_zuc_eea3_no_gfni_avx2(MB_MGR_ZUC_OOO *state);
 
-IMB_JOB *flush_job_zuc256_eea3_avx2(MB_MGR_ZUC_OOO *state);
+IMB_JOB *flush_job_zuc256_eea3_no_gfni_avx2(MB_MGR_ZUC_OOO *state);
 
-IMB_JOB *submit_job_zuc256_eea3_avx2(MB_MGR_ZUC_OOO *state,
-                                     IMB_JOB *job);
+IMB_JOB *submit_job_zuc256_eea3_no_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                             IMB_JOB *job);
 
-IMB_JOB *submit_job_zuc_eia3_avx2(MB_MGR_ZUC_OOO *state,
-                                  IMB_JOB *job);
-IMB_JOB *flush_job_zuc_eia3_avx2(MB_MGR_ZUC_OOO *state);
+IMB_JOB *submit_job_zuc_eia3_no_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                          IMB_JOB *job);
+IMB_JOB *flush_job_zuc_eia3_no_gfni_avx2(MB_MGR_ZUC_OOO *state);
+
+IMB_JOB *submit_job_zuc256_eia3_no_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                             IMB_JOB *job,
+                                             const uint64_t tag_sz);
+IMB_JOB *flush_job_zuc256_eia3_no_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                            const uint64_t tag_sz);
+
+IMB_JOB *submit_job_aes128_gcm_avx2(MB_MGR_GCM_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_aes128_gcm_avx2(MB_MGR_GCM_OOO *state);
+
+IMB_JOB *submit_job_aes192_gcm_avx2(MB_MGR_GCM_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_aes192_gcm_avx2(MB_MGR_GCM_OOO *state);
 
-IMB_JOB *submit_job_zuc256_eia3_avx2(MB_MGR_ZUC_OOO *state,
-                                     IMB_JOB *job,
-                                     const uint64_t tag_sz);
-IMB_JOB *flush_job_zuc256_eia3_avx2(MB_MGR_ZUC_OOO *state,
-                                    const uint64_t tag_sz);
+IMB_JOB *submit_job_aes256_gcm_avx2(MB_MGR_GCM_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_aes256_gcm_avx2(MB_MGR_GCM_OOO *state);
+
+IMB_JOB *submit_job_chacha20_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                     IMB_JOB *job);
+IMB_JOB *flush_job_chacha20_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *
+submit_job_chacha20_poly1305_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                     IMB_JOB *job);
+IMB_JOB *
+flush_job_chacha20_poly1305_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *submit_job_poly1305_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                     IMB_JOB *job);
+IMB_JOB *flush_job_poly1305_mb_avx2(MB_MGR_CHACHA20_POLY1305_OOO *state);
 
 IMB_JOB *submit_job_sha1_avx2(MB_MGR_SHA_1_OOO *state,
                               IMB_JOB *job);
@@ -107,4 +131,18 @@ IMB_JOB *submit_job_hmac_md5_avx2(MB_MGR_HMAC_MD5_OOO *state,
                                   IMB_JOB *job);
 IMB_JOB *flush_job_hmac_md5_avx2(MB_MGR_HMAC_MD5_OOO *state);
 
+/* AES-CBC/CTR + HMAC-SHA1/SHA256 stitched */
+IMB_JOB *submit_job_aes_cbc_hmac_sha_1_avx2(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                            IMB_JOB *job);
+IMB_JOB *flush_job_aes_cbc_hmac_sha_1_avx2(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_cbc_hmac_sha_256_avx2(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                              IMB_JOB *job);
+IMB_JOB *flush_job_aes_cbc_hmac_sha_256_avx2(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_ctr_hmac_sha_1_avx2(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                            IMB_JOB *job);
+IMB_JOB *flush_job_aes_ctr_hmac_sha_1_avx2(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_ctr_hmac_sha_256_avx2(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                              IMB_JOB *job);
+IMB_JOB *flush_job_aes_ctr_hmac_sha_256_avx2(MB_MGR_AES_CBC_HMAC_OOO *state);
+
 #endif /* IMB_ASM_AVX2_T1_H */
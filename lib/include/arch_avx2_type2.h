@@ -48,4 +48,89 @@ void aes_ecb_dec_192_vaes_avx2(const void *in, const void *keys,
 void aes_ecb_dec_128_vaes_avx2(const void *in, const void *keys,
                                void *out, uint64_t len_bytes);
 
+/* AES-CBC */
+void aes_cbc_dec_128_vaes_avx2(const void *in, const uint8_t *IV,
+                               const void *keys, void *out,
+                               uint64_t len_bytes);
+void aes_cbc_dec_192_vaes_avx2(const void *in, const uint8_t *IV,
+                               const void *keys, void *out,
+                               uint64_t len_bytes);
+void aes_cbc_dec_256_vaes_avx2(const void *in, const uint8_t *IV,
+                               const void *keys, void *out,
+                               uint64_t len_bytes);
+
+/* AES-CTR */
+void aes_cntr_256_vaes_avx2(const void *in, const void *IV, const void *keys,
+                            void *out, uint64_t len_bytes, uint64_t IV_len);
+void aes_cntr_192_vaes_avx2(const void *in, const void *IV, const void *keys,
+                            void *out, uint64_t len_bytes, uint64_t IV_len);
+void aes_cntr_128_vaes_avx2(const void *in, const void *IV, const void *keys,
+                            void *out, uint64_t len_bytes, uint64_t IV_len);
+
+/* AES-CTR-BITLEN */
+void aes_cntr_bit_256_vaes_avx2(const void *in, const void *IV,
+                                const void *keys, void *out,
+                                uint64_t len_bits, uint64_t IV_len);
+void aes_cntr_bit_192_vaes_avx2(const void *in, const void *IV,
+                                const void *keys, void *out,
+                                uint64_t len_bits, uint64_t IV_len);
+void aes_cntr_bit_128_vaes_avx2(const void *in, const void *IV,
+                                const void *keys, void *out,
+                                uint64_t len_bits, uint64_t IV_len);
+
+/* AES-CCM */
+IMB_JOB *aes_cntr_ccm_128_vaes_avx2(IMB_JOB *job);
+IMB_JOB *aes_cntr_ccm_256_vaes_avx2(IMB_JOB *job);
+
+/* SNOW-V */
+void snow_v_init_x4_vaes_avx2(SNOW_V_X4_STATE *state);
+void snow_v_keystream_x4_vaes_avx2(SNOW_V_X4_STATE *state, uint8_t *ks,
+                                   const uint64_t num_blocks);
+IMB_JOB *submit_job_snow_v_mb_avx2(MB_MGR_SNOW_V_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_snow_v_mb_avx2(MB_MGR_SNOW_V_OOO *state);
+IMB_JOB *submit_job_snow_v_aead_mb_avx2(MB_MGR_SNOW_V_OOO *state,
+                                        IMB_JOB *job);
+IMB_JOB *flush_job_snow_v_aead_mb_avx2(MB_MGR_SNOW_V_OOO *state);
+
+/* AES-XTS */
+void aes_xts_enc_128_x8_vaes_avx2(AES_XTS_ARGS *args,
+                                  const uint64_t num_blocks);
+void aes_xts_dec_128_x8_vaes_avx2(AES_XTS_ARGS *args,
+                                  const uint64_t num_blocks);
+void aes_xts_enc_256_x8_vaes_avx2(AES_XTS_ARGS *args,
+                                  const uint64_t num_blocks);
+void aes_xts_dec_256_x8_vaes_avx2(AES_XTS_ARGS *args,
+                                  const uint64_t num_blocks);
+IMB_JOB *submit_job_aes128_xts_enc_vaes_avx2(MB_MGR_AES_XTS_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_enc_vaes_avx2(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes128_xts_dec_vaes_avx2(MB_MGR_AES_XTS_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_dec_vaes_avx2(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_enc_vaes_avx2(MB_MGR_AES_XTS_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_enc_vaes_avx2(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_dec_vaes_avx2(MB_MGR_AES_XTS_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_dec_vaes_avx2(MB_MGR_AES_XTS_OOO *state);
+
+/* ZUC-EEA3/EIA3 (GFNI + VAES) */
+IMB_JOB *submit_job_zuc_eea3_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_zuc_eea3_gfni_avx2(MB_MGR_ZUC_OOO *state);
+
+IMB_JOB *submit_job_zuc256_eea3_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                          IMB_JOB *job);
+IMB_JOB *flush_job_zuc256_eea3_gfni_avx2(MB_MGR_ZUC_OOO *state);
+
+IMB_JOB *submit_job_zuc_eia3_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_zuc_eia3_gfni_avx2(MB_MGR_ZUC_OOO *state);
+
+IMB_JOB *submit_job_zuc256_eia3_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                          IMB_JOB *job,
+                                          const uint64_t tag_sz);
+IMB_JOB *flush_job_zuc256_eia3_gfni_avx2(MB_MGR_ZUC_OOO *state,
+                                         const uint64_t tag_sz);
+
 #endif /* IMB_ASM_AVX2_T2_H */
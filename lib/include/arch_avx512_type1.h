@@ -75,6 +75,26 @@ IMB_JOB *submit_job_zuc256_eia3_no_gfni_avx512(MB_MGR_ZUC_OOO *state,
 IMB_JOB *flush_job_zuc256_eia3_no_gfni_avx512(MB_MGR_ZUC_OOO *state,
                                            const uint64_t tag_sz);
 
+IMB_JOB *submit_job_chacha20_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_chacha20_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *
+submit_job_chacha20_poly1305_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *
+flush_job_chacha20_poly1305_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *submit_job_poly1305_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_poly1305_mb_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state);
+
+void kasumi_x16_avx512(const uint16_t *ks, uint64_t *data);
+IMB_JOB *submit_job_kasumi_uea1_avx512(MB_MGR_KASUMI_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_kasumi_uea1_avx512(MB_MGR_KASUMI_OOO *state);
+IMB_JOB *submit_job_kasumi_uia1_avx512(MB_MGR_KASUMI_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_kasumi_uia1_avx512(MB_MGR_KASUMI_OOO *state);
+
 IMB_JOB *submit_job_sha1_avx512(MB_MGR_SHA_1_OOO *state,
                                 IMB_JOB *job);
 IMB_JOB *flush_job_sha1_avx512(MB_MGR_SHA_1_OOO *state,
@@ -133,6 +153,10 @@ IMB_JOB *submit_job_hmac_sha_512_avx512(MB_MGR_HMAC_SHA_512_OOO *state,
                                              IMB_JOB *job);
 IMB_JOB *flush_job_hmac_sha_512_avx512(MB_MGR_HMAC_SHA_512_OOO *state);
 
+IMB_JOB *submit_job_hmac_md5_avx512(MB_MGR_HMAC_MD5_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_hmac_md5_avx512(MB_MGR_HMAC_MD5_OOO *state);
+
 void poly1305_mac_plain_avx512(IMB_JOB *job);
 
 IMB_JOB *submit_job_chacha20_enc_dec_avx512(IMB_JOB *job);
@@ -151,6 +175,9 @@ submit_job_aes_docsis256_enc_crc32_avx512(MB_MGR_DOCSIS_AES_OOO *state,
 IMB_JOB *
 flush_job_aes_docsis256_enc_crc32_avx512(MB_MGR_DOCSIS_AES_OOO *state);
 
+IMB_JOB *submit_job_crc_avx512(MB_MGR_CRC_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_crc_avx512(MB_MGR_CRC_OOO *state);
+
 
 #endif /* IMB_ASM_AVX512_T1_H */
 
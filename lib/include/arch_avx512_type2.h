@@ -162,6 +162,15 @@ IMB_JOB *flush_job_aes256_ccm_auth_vaes_avx512(MB_MGR_CCM_OOO *state);
 
 void poly1305_mac_fma_avx512(IMB_JOB *job);
 
+IMB_JOB *
+submit_job_chacha20_poly1305_mb_fma_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                           IMB_JOB *job);
+IMB_JOB *
+flush_job_chacha20_poly1305_mb_fma_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *submit_job_poly1305_mb_fma_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                           IMB_JOB *job);
+IMB_JOB *flush_job_poly1305_mb_fma_avx512(MB_MGR_CHACHA20_POLY1305_OOO *state);
+
 uint32_t ethernet_fcs_avx512(const void *msg, const uint64_t len);
 uint32_t crc16_x25_avx512(const void *msg, const uint64_t len);
 uint32_t crc32_sctp_avx512(const void *msg, const uint64_t len);
@@ -198,5 +207,37 @@ IMB_JOB *
 flush_job_aes_docsis256_enc_crc32_vaes_avx512(MB_MGR_DOCSIS_AES_OOO *state);
 
 
+/* SNOW-V */
+void snow_v_init_x4_vaes_avx512(SNOW_V_X4_STATE *state);
+void snow_v_keystream_x4_vaes_avx512(SNOW_V_X4_STATE *state, uint8_t *ks,
+                                     const uint64_t num_blocks);
+IMB_JOB *submit_job_snow_v_mb_avx512(MB_MGR_SNOW_V_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_snow_v_mb_avx512(MB_MGR_SNOW_V_OOO *state);
+IMB_JOB *submit_job_snow_v_aead_mb_avx512(MB_MGR_SNOW_V_OOO *state,
+                                          IMB_JOB *job);
+IMB_JOB *flush_job_snow_v_aead_mb_avx512(MB_MGR_SNOW_V_OOO *state);
+
+/* AES-XTS */
+void aes_xts_enc_128_x16_vaes_avx512(AES_XTS_ARGS *args,
+                                     const uint64_t num_blocks);
+void aes_xts_dec_128_x16_vaes_avx512(AES_XTS_ARGS *args,
+                                     const uint64_t num_blocks);
+void aes_xts_enc_256_x16_vaes_avx512(AES_XTS_ARGS *args,
+                                     const uint64_t num_blocks);
+void aes_xts_dec_256_x16_vaes_avx512(AES_XTS_ARGS *args,
+                                     const uint64_t num_blocks);
+IMB_JOB *submit_job_aes128_xts_enc_vaes_avx512(MB_MGR_AES_XTS_OOO *state,
+                                               IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_enc_vaes_avx512(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes128_xts_dec_vaes_avx512(MB_MGR_AES_XTS_OOO *state,
+                                               IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_dec_vaes_avx512(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_enc_vaes_avx512(MB_MGR_AES_XTS_OOO *state,
+                                               IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_enc_vaes_avx512(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_dec_vaes_avx512(MB_MGR_AES_XTS_OOO *state,
+                                               IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_dec_vaes_avx512(MB_MGR_AES_XTS_OOO *state);
+
 #endif /* IMB_ASM_AVX512_T2_H */
 
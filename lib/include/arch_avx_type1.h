@@ -144,6 +144,95 @@ IMB_JOB *submit_job_zuc256_eia3_avx(MB_MGR_ZUC_OOO *state,
 IMB_JOB *flush_job_zuc256_eia3_avx(MB_MGR_ZUC_OOO *state,
                                    const uint64_t tag_sz);
 
+IMB_JOB *submit_job_aes128_gcm_avx(MB_MGR_GCM_OOO *state,
+                                   IMB_JOB *job);
+IMB_JOB *flush_job_aes128_gcm_avx(MB_MGR_GCM_OOO *state);
+
+IMB_JOB *submit_job_aes192_gcm_avx(MB_MGR_GCM_OOO *state,
+                                   IMB_JOB *job);
+IMB_JOB *flush_job_aes192_gcm_avx(MB_MGR_GCM_OOO *state);
+
+IMB_JOB *submit_job_aes256_gcm_avx(MB_MGR_GCM_OOO *state,
+                                   IMB_JOB *job);
+IMB_JOB *flush_job_aes256_gcm_avx(MB_MGR_GCM_OOO *state);
+
+/* AES-XTS */
+IMB_JOB *submit_job_aes128_xts_enc_avx(MB_MGR_AES_XTS_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_enc_avx(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes128_xts_dec_avx(MB_MGR_AES_XTS_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes128_xts_dec_avx(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_enc_avx(MB_MGR_AES_XTS_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_enc_avx(MB_MGR_AES_XTS_OOO *state);
+IMB_JOB *submit_job_aes256_xts_dec_avx(MB_MGR_AES_XTS_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes256_xts_dec_avx(MB_MGR_AES_XTS_OOO *state);
+
+/* AES-CFB */
+IMB_JOB *submit_job_aes128_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes128_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state);
+IMB_JOB *submit_job_aes128_cfb_dec_avx(IMB_JOB *job);
+IMB_JOB *submit_job_aes192_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes192_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state);
+IMB_JOB *submit_job_aes192_cfb_dec_avx(IMB_JOB *job);
+IMB_JOB *submit_job_aes256_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state,
+                                       IMB_JOB *job);
+IMB_JOB *flush_job_aes256_cfb_enc_avx(MB_MGR_AES_CFB_OOO *state);
+IMB_JOB *submit_job_aes256_cfb_dec_avx(IMB_JOB *job);
+
+/* AES-CBC/CTR + HMAC-SHA1/SHA256 stitched */
+IMB_JOB *submit_job_aes_cbc_hmac_sha_1_avx(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                           IMB_JOB *job);
+IMB_JOB *flush_job_aes_cbc_hmac_sha_1_avx(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_cbc_hmac_sha_256_avx(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes_cbc_hmac_sha_256_avx(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_ctr_hmac_sha_1_avx(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                           IMB_JOB *job);
+IMB_JOB *flush_job_aes_ctr_hmac_sha_1_avx(MB_MGR_AES_CBC_HMAC_OOO *state);
+IMB_JOB *submit_job_aes_ctr_hmac_sha_256_avx(MB_MGR_AES_CBC_HMAC_OOO *state,
+                                             IMB_JOB *job);
+IMB_JOB *flush_job_aes_ctr_hmac_sha_256_avx(MB_MGR_AES_CBC_HMAC_OOO *state);
+
+/* AES-CTR + AES-CMAC stitched */
+IMB_JOB *submit_job_aes_ctr_cmac_avx(MB_MGR_AES_CTR_CMAC_OOO *state,
+                                     IMB_JOB *job);
+IMB_JOB *flush_job_aes_ctr_cmac_avx(MB_MGR_AES_CTR_CMAC_OOO *state);
+
+/* CRC */
+IMB_JOB *submit_job_crc_avx(MB_MGR_CRC_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_crc_avx(MB_MGR_CRC_OOO *state);
+
+/* DES, 3DES and DOCSIS DES */
+IMB_JOB *submit_job_des_cbc_enc_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_des_cbc_enc_avx(MB_MGR_DES_OOO *state);
+IMB_JOB *submit_job_des_cbc_dec_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_des_cbc_dec_avx(MB_MGR_DES_OOO *state);
+IMB_JOB *submit_job_3des_cbc_enc_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_3des_cbc_enc_avx(MB_MGR_DES_OOO *state);
+IMB_JOB *submit_job_3des_cbc_dec_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_3des_cbc_dec_avx(MB_MGR_DES_OOO *state);
+IMB_JOB *submit_job_docsis_des_enc_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_docsis_des_enc_avx(MB_MGR_DES_OOO *state);
+IMB_JOB *submit_job_docsis_des_dec_avx(MB_MGR_DES_OOO *state, IMB_JOB *job);
+IMB_JOB *flush_job_docsis_des_dec_avx(MB_MGR_DES_OOO *state);
+
+IMB_JOB *submit_job_chacha20_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_chacha20_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *
+submit_job_chacha20_poly1305_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *
+flush_job_chacha20_poly1305_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state);
+IMB_JOB *submit_job_poly1305_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                    IMB_JOB *job);
+IMB_JOB *flush_job_poly1305_mb_avx(MB_MGR_CHACHA20_POLY1305_OOO *state);
+
 IMB_JOB *submit_job_sha1_avx(MB_MGR_SHA_1_OOO *state,
                              IMB_JOB *job);
 IMB_JOB *flush_job_sha1_avx(MB_MGR_SHA_1_OOO *state,
@@ -29,6 +29,7 @@
 #define IMB_ARCH_X86_64_H
 
 #include "intel-ipsec-mb.h"
+#include "ipsec_ooo_mgr.h"
 
 IMB_DLL_LOCAL void *poly1305_mac_scalar(IMB_JOB *job);
 IMB_DLL_LOCAL void
@@ -121,4 +122,29 @@ IMB_DLL_LOCAL
 void docsis_des_dec_basic(const void *input, void *output, const int size,
                           const uint64_t *ks, const uint64_t *ivec);
 
+/**
+ * @brief DES/3DES CBC multi-buffer kernels (4 and 8 lanes)
+ *
+ * @param args lane arguments: input, output, key schedule
+ *             (3DES: array of 3 key schedule pointers) and IV;
+ *             pointers and IV are updated on return
+ * @param num_blocks number of 8 byte blocks to process in each lane
+ */
+IMB_DLL_LOCAL
+void des_cbc_enc_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des_cbc_dec_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des3_cbc_enc_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des3_cbc_dec_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des_cbc_enc_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des_cbc_dec_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des3_cbc_enc_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+IMB_DLL_LOCAL
+void des3_cbc_dec_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks);
+
 #endif /* IMB_ARCH_X86_64_H */
@@ -0,0 +1,142 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*
+ * AVX512 ChaCha20 kernel of the ChaCha20 and Poly1305 multi-buffer
+ * implementation.
+ *
+ * ChaCha20 keystream is generated for all 16 lanes at once,
+ * one ZMM register per state word.
+ * Code built without AVX512F code generation keeps the generic kernels.
+ */
+
+#ifndef CHACHA20_POLY1305_MB_AVX512_H
+#define CHACHA20_POLY1305_MB_AVX512_H
+
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+
+#if defined(__AVX512F__) || defined(_MSC_VER)
+
+#define CHACHA20_MB_QR_X16(a, b, c, d)                          \
+        do {                                                    \
+                a = _mm512_add_epi32(a, b);                     \
+                d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 16); \
+                c = _mm512_add_epi32(c, d);                     \
+                b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 12); \
+                a = _mm512_add_epi32(a, b);                     \
+                d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 8); \
+                c = _mm512_add_epi32(c, d);                     \
+                b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 7); \
+        } while (0)
+
+/*
+ * Generates one 64-byte keystream block for each of the 16 lanes.
+ * Block counters are not updated.
+ */
+__forceinline
+void chacha20_mb_keystream_x16(const CHACHA20_POLY1305_ARGS *args,
+                               const unsigned first_lane, uint8_t *ks)
+{
+        __m512i x[16], u[16];
+        unsigned i, j;
+
+        (void) first_lane;
+
+        for (i = 0; i < 16; i++)
+                x[i] = _mm512_load_si512((const void *) &args->state[i][0]);
+
+        for (i = 0; i < 10; i++) {
+                /* column rounds */
+                CHACHA20_MB_QR_X16(x[0], x[4], x[8], x[12]);
+                CHACHA20_MB_QR_X16(x[1], x[5], x[9], x[13]);
+                CHACHA20_MB_QR_X16(x[2], x[6], x[10], x[14]);
+                CHACHA20_MB_QR_X16(x[3], x[7], x[11], x[15]);
+                /* diagonal rounds */
+                CHACHA20_MB_QR_X16(x[0], x[5], x[10], x[15]);
+                CHACHA20_MB_QR_X16(x[1], x[6], x[11], x[12]);
+                CHACHA20_MB_QR_X16(x[2], x[7], x[8], x[13]);
+                CHACHA20_MB_QR_X16(x[3], x[4], x[9], x[14]);
+        }
+
+        /*
+         * Add input state and transpose dwords within 128-bit chunks:
+         * chunk c of u[4 * j + q] holds words 4q..4q+3 of lane 4c+j
+         */
+        for (i = 0; i < 16; i += 4) {
+                const __m512i w0 = _mm512_add_epi32(x[i], _mm512_load_si512
+                        ((const void *) &args->state[i][0]));
+                const __m512i w1 = _mm512_add_epi32(x[i + 1], _mm512_load_si512
+                        ((const void *) &args->state[i + 1][0]));
+                const __m512i w2 = _mm512_add_epi32(x[i + 2], _mm512_load_si512
+                        ((const void *) &args->state[i + 2][0]));
+                const __m512i w3 = _mm512_add_epi32(x[i + 3], _mm512_load_si512
+                        ((const void *) &args->state[i + 3][0]));
+                const __m512i t0 = _mm512_unpacklo_epi32(w0, w1);
+                const __m512i t1 = _mm512_unpacklo_epi32(w2, w3);
+                const __m512i t2 = _mm512_unpackhi_epi32(w0, w1);
+                const __m512i t3 = _mm512_unpackhi_epi32(w2, w3);
+
+                u[0 + i / 4] = _mm512_unpacklo_epi64(t0, t1);
+                u[4 + i / 4] = _mm512_unpackhi_epi64(t0, t1);
+                u[8 + i / 4] = _mm512_unpacklo_epi64(t2, t3);
+                u[12 + i / 4] = _mm512_unpackhi_epi64(t2, t3);
+        }
+
+        /* transpose 128-bit chunks into per lane blocks */
+        for (j = 0; j < 4; j++) {
+                const __m512i *a = &u[4 * j];
+                const __m512i s0 = _mm512_shuffle_i32x4(a[0], a[1], 0x44);
+                const __m512i s1 = _mm512_shuffle_i32x4(a[2], a[3], 0x44);
+                const __m512i s2 = _mm512_shuffle_i32x4(a[0], a[1], 0xee);
+                const __m512i s3 = _mm512_shuffle_i32x4(a[2], a[3], 0xee);
+
+                _mm512_store_si512((void *) &ks[(0 + j) * 64],
+                                   _mm512_shuffle_i32x4(s0, s1, 0x88));
+                _mm512_store_si512((void *) &ks[(4 + j) * 64],
+                                   _mm512_shuffle_i32x4(s0, s1, 0xdd));
+                _mm512_store_si512((void *) &ks[(8 + j) * 64],
+                                   _mm512_shuffle_i32x4(s2, s3, 0x88));
+                _mm512_store_si512((void *) &ks[(12 + j) * 64],
+                                   _mm512_shuffle_i32x4(s2, s3, 0xdd));
+        }
+}
+
+#define CHACHA20_MB_GROUP_LANES 16
+#define CHACHA20_MB_KEYSTREAM   chacha20_mb_keystream_x16
+
+#endif /* __AVX512F__ || _MSC_VER */
+
+#endif /* CHACHA20_POLY1305_MB_AVX512_H */
@@ -0,0 +1,874 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*
+ * ChaCha20, ChaCha20-Poly1305 AEAD and Poly1305 multi-buffer implementation.
+ *
+ * Up to 16 independent jobs (each with its own key and nonce) are
+ * processed in parallel. ChaCha20 state of the lanes is kept word major,
+ * so that groups of lanes are processed in vertical (one lane per
+ * dword) form, as described in "ChaCha, a variant of Salsa20".
+ * Poly1305 is computed on each lane in radix 2^26, following RFC 8439.
+ *
+ * The architecture including this file may replace the kernels
+ * before the inclusion:
+ * - CHACHA20_MB_KEYSTREAM(args, first_lane, ks) generates one keystream
+ *   block for each of the CHACHA20_MB_GROUP_LANES lanes from first_lane
+ * - POLY1305_MB_UPDATE_LANES(args, lanes, num_lanes, msg, num_blocks)
+ *   absorbs num_blocks full blocks of msg[i] on lanes[i]
+ *   (lanes with NULL msg[i] are skipped)
+ */
+
+#ifndef CHACHA20_POLY1305_MB_MGR_H
+#define CHACHA20_POLY1305_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/clear_regs_mem.h"
+
+/* Type of jobs scheduled on the manager */
+#define CHACHA20_MB_CIPHER      0
+#define CHACHA20_POLY1305_MB    1
+#define POLY1305_MB             2
+
+#define POLY1305_MB_MASK26      0x3ffffff
+
+__forceinline
+uint32_t chacha20_poly1305_mb_load32(const uint8_t *p)
+{
+        uint32_t v;
+
+        memcpy(&v, p, sizeof(v));
+        return v;
+}
+
+__forceinline
+void chacha20_poly1305_mb_store32(uint8_t *p, const uint32_t v)
+{
+        memcpy(p, &v, sizeof(v));
+}
+
+/* ========================================================================== */
+/*
+ * ChaCha20
+ */
+
+__forceinline
+__m128i chacha20_mb_rotl16(const __m128i x)
+{
+        const __m128i shuf_mask = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5,
+                                                10, 11, 8, 9, 14, 15, 12, 13);
+
+        return _mm_shuffle_epi8(x, shuf_mask);
+}
+
+__forceinline
+__m128i chacha20_mb_rotl8(const __m128i x)
+{
+        const __m128i shuf_mask = _mm_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6,
+                                                11, 8, 9, 10, 15, 12, 13, 14);
+
+        return _mm_shuffle_epi8(x, shuf_mask);
+}
+
+#define CHACHA20_MB_ROTL(x, n) \
+        _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+
+#define CHACHA20_MB_QR(a, b, c, d)                              \
+        do {                                                    \
+                a = _mm_add_epi32(a, b);                        \
+                d = chacha20_mb_rotl16(_mm_xor_si128(d, a));    \
+                c = _mm_add_epi32(c, d);                        \
+                b = CHACHA20_MB_ROTL(_mm_xor_si128(b, c), 12);  \
+                a = _mm_add_epi32(a, b);                        \
+                d = chacha20_mb_rotl8(_mm_xor_si128(d, a));     \
+                c = _mm_add_epi32(c, d);                        \
+                b = CHACHA20_MB_ROTL(_mm_xor_si128(b, c), 7);   \
+        } while (0)
+
+/*
+ * Generates one 64-byte keystream block for each of the 4 lanes
+ * starting at first_lane. Block counters are not updated.
+ */
+__forceinline
+void chacha20_mb_keystream_x4(const CHACHA20_POLY1305_ARGS *args,
+                              const unsigned first_lane, uint8_t *ks)
+{
+        __m128i x[16], s[16];
+        unsigned i;
+
+        for (i = 0; i < 16; i++) {
+                s[i] = _mm_load_si128((const __m128i *)
+                                      &args->state[i][first_lane]);
+                x[i] = s[i];
+        }
+
+        for (i = 0; i < 10; i++) {
+                /* column rounds */
+                CHACHA20_MB_QR(x[0], x[4], x[8], x[12]);
+                CHACHA20_MB_QR(x[1], x[5], x[9], x[13]);
+                CHACHA20_MB_QR(x[2], x[6], x[10], x[14]);
+                CHACHA20_MB_QR(x[3], x[7], x[11], x[15]);
+                /* diagonal rounds */
+                CHACHA20_MB_QR(x[0], x[5], x[10], x[15]);
+                CHACHA20_MB_QR(x[1], x[6], x[11], x[12]);
+                CHACHA20_MB_QR(x[2], x[7], x[8], x[13]);
+                CHACHA20_MB_QR(x[3], x[4], x[9], x[14]);
+        }
+
+        /* add input state and transpose back into per lane blocks */
+        for (i = 0; i < 16; i += 4) {
+                const __m128i w0 = _mm_add_epi32(x[i], s[i]);
+                const __m128i w1 = _mm_add_epi32(x[i + 1], s[i + 1]);
+                const __m128i w2 = _mm_add_epi32(x[i + 2], s[i + 2]);
+                const __m128i w3 = _mm_add_epi32(x[i + 3], s[i + 3]);
+                const __m128i t0 = _mm_unpacklo_epi32(w0, w1);
+                const __m128i t1 = _mm_unpacklo_epi32(w2, w3);
+                const __m128i t2 = _mm_unpackhi_epi32(w0, w1);
+                const __m128i t3 = _mm_unpackhi_epi32(w2, w3);
+
+                _mm_store_si128((__m128i *) &ks[0 * 64 + i * 4],
+                                _mm_unpacklo_epi64(t0, t1));
+                _mm_store_si128((__m128i *) &ks[1 * 64 + i * 4],
+                                _mm_unpackhi_epi64(t0, t1));
+                _mm_store_si128((__m128i *) &ks[2 * 64 + i * 4],
+                                _mm_unpacklo_epi64(t2, t3));
+                _mm_store_si128((__m128i *) &ks[3 * 64 + i * 4],
+                                _mm_unpackhi_epi64(t2, t3));
+        }
+}
+
+__forceinline
+void chacha20_mb_xor_block(uint8_t *out, const uint8_t *in, const uint8_t *ks)
+{
+        unsigned i;
+
+        for (i = 0; i < 64; i += 16) {
+                const __m128i x =
+                        _mm_loadu_si128((const __m128i *) &in[i]);
+                const __m128i k = _mm_load_si128((const __m128i *) &ks[i]);
+
+                _mm_storeu_si128((__m128i *) &out[i], _mm_xor_si128(x, k));
+        }
+}
+
+__forceinline
+void chacha20_mb_init_lane(CHACHA20_POLY1305_ARGS *args, const unsigned lane,
+                           const uint8_t *key, const uint8_t *iv,
+                           const uint32_t counter)
+{
+        unsigned i;
+
+        args->state[0][lane] = 0x61707865;
+        args->state[1][lane] = 0x3320646e;
+        args->state[2][lane] = 0x79622d32;
+        args->state[3][lane] = 0x6b206574;
+        for (i = 0; i < 8; i++)
+                args->state[4 + i][lane] =
+                        chacha20_poly1305_mb_load32(&key[i * 4]);
+        args->state[12][lane] = counter;
+        for (i = 0; i < 3; i++)
+                args->state[13 + i][lane] =
+                        chacha20_poly1305_mb_load32(&iv[i * 4]);
+}
+
+/* ========================================================================== */
+/*
+ * Poly1305
+ */
+
+__forceinline
+void poly1305_mb_init_lane(CHACHA20_POLY1305_ARGS *args, const unsigned lane,
+                           const uint8_t *key)
+{
+        /* clamp r */
+        args->poly_r[lane][0] =
+                chacha20_poly1305_mb_load32(&key[0]) & 0x3ffffff;
+        args->poly_r[lane][1] =
+                (chacha20_poly1305_mb_load32(&key[3]) >> 2) & 0x3ffff03;
+        args->poly_r[lane][2] =
+                (chacha20_poly1305_mb_load32(&key[6]) >> 4) & 0x3ffc0ff;
+        args->poly_r[lane][3] =
+                (chacha20_poly1305_mb_load32(&key[9]) >> 6) & 0x3f03fff;
+        args->poly_r[lane][4] =
+                (chacha20_poly1305_mb_load32(&key[12]) >> 8) & 0x00fffff;
+
+        args->poly_s[lane][0] = chacha20_poly1305_mb_load32(&key[16]);
+        args->poly_s[lane][1] = chacha20_poly1305_mb_load32(&key[20]);
+        args->poly_s[lane][2] = chacha20_poly1305_mb_load32(&key[24]);
+        args->poly_s[lane][3] = chacha20_poly1305_mb_load32(&key[28]);
+
+        memset(args->poly_h[lane], 0, sizeof(args->poly_h[lane]));
+}
+
+/*
+ * Absorbs num_blocks 16-byte blocks of the message into the lane state.
+ * hibit is 2^128 in radix 2^26 for full blocks and 0 for padded ones.
+ */
+__forceinline
+void poly1305_mb_update(CHACHA20_POLY1305_ARGS *args, const unsigned lane,
+                        const uint8_t *msg, uint64_t num_blocks,
+                        const uint32_t hibit)
+{
+        const uint32_t r0 = args->poly_r[lane][0];
+        const uint32_t r1 = args->poly_r[lane][1];
+        const uint32_t r2 = args->poly_r[lane][2];
+        const uint32_t r3 = args->poly_r[lane][3];
+        const uint32_t r4 = args->poly_r[lane][4];
+        const uint32_t s1 = r1 * 5;
+        const uint32_t s2 = r2 * 5;
+        const uint32_t s3 = r3 * 5;
+        const uint32_t s4 = r4 * 5;
+        uint32_t h0 = args->poly_h[lane][0];
+        uint32_t h1 = args->poly_h[lane][1];
+        uint32_t h2 = args->poly_h[lane][2];
+        uint32_t h3 = args->poly_h[lane][3];
+        uint32_t h4 = args->poly_h[lane][4];
+
+        while (num_blocks--) {
+                uint64_t d0, d1, d2, d3, d4;
+                uint32_t c;
+
+                h0 += chacha20_poly1305_mb_load32(&msg[0]) &
+                        POLY1305_MB_MASK26;
+                h1 += (chacha20_poly1305_mb_load32(&msg[3]) >> 2) &
+                        POLY1305_MB_MASK26;
+                h2 += (chacha20_poly1305_mb_load32(&msg[6]) >> 4) &
+                        POLY1305_MB_MASK26;
+                h3 += (chacha20_poly1305_mb_load32(&msg[9]) >> 6) &
+                        POLY1305_MB_MASK26;
+                h4 += (chacha20_poly1305_mb_load32(&msg[12]) >> 8) | hibit;
+
+                d0 = ((uint64_t) h0 * r0) + ((uint64_t) h1 * s4) +
+                        ((uint64_t) h2 * s3) + ((uint64_t) h3 * s2) +
+                        ((uint64_t) h4 * s1);
+                d1 = ((uint64_t) h0 * r1) + ((uint64_t) h1 * r0) +
+                        ((uint64_t) h2 * s4) + ((uint64_t) h3 * s3) +
+                        ((uint64_t) h4 * s2);
+                d2 = ((uint64_t) h0 * r2) + ((uint64_t) h1 * r1) +
+                        ((uint64_t) h2 * r0) + ((uint64_t) h3 * s4) +
+                        ((uint64_t) h4 * s3);
+                d3 = ((uint64_t) h0 * r3) + ((uint64_t) h1 * r2) +
+                        ((uint64_t) h2 * r1) + ((uint64_t) h3 * r0) +
+                        ((uint64_t) h4 * s4);
+                d4 = ((uint64_t) h0 * r4) + ((uint64_t) h1 * r3) +
+                        ((uint64_t) h2 * r2) + ((uint64_t) h3 * r1) +
+                        ((uint64_t) h4 * r0);
+
+                /* partial reduction */
+                c = (uint32_t) (d0 >> 26);
+                h0 = (uint32_t) d0 & POLY1305_MB_MASK26;
+                d1 += c;
+                c = (uint32_t) (d1 >> 26);
+                h1 = (uint32_t) d1 & POLY1305_MB_MASK26;
+                d2 += c;
+                c = (uint32_t) (d2 >> 26);
+                h2 = (uint32_t) d2 & POLY1305_MB_MASK26;
+                d3 += c;
+                c = (uint32_t) (d3 >> 26);
+                h3 = (uint32_t) d3 & POLY1305_MB_MASK26;
+                d4 += c;
+                c = (uint32_t) (d4 >> 26);
+                h4 = (uint32_t) d4 & POLY1305_MB_MASK26;
+                h0 += c * 5;
+                c = h0 >> 26;
+                h0 &= POLY1305_MB_MASK26;
+                h1 += c;
+
+                msg += 16;
+        }
+
+        args->poly_h[lane][0] = h0;
+        args->poly_h[lane][1] = h1;
+        args->poly_h[lane][2] = h2;
+        args->poly_h[lane][3] = h3;
+        args->poly_h[lane][4] = h4;
+}
+
+/*
+ * Absorbs a message of any length with the last partial block
+ * padded with zeros (RFC 8439 AEAD construction)
+ */
+__forceinline
+void poly1305_mb_update_padded(CHACHA20_POLY1305_ARGS *args,
+                               const unsigned lane,
+                               const uint8_t *msg, const uint64_t len)
+{
+        const uint64_t partial_bytes = len & 15;
+
+        poly1305_mb_update(args, lane, msg, len / 16, 1 << 24);
+
+        if (partial_bytes) {
+                uint8_t block[16];
+
+                memset(block, 0, sizeof(block));
+                memcpy(block, &msg[len - partial_bytes], partial_bytes);
+                poly1305_mb_update(args, lane, block, 1, 1 << 24);
+#ifdef SAFE_DATA
+                clear_mem(block, sizeof(block));
+#endif
+        }
+}
+
+/*
+ * Final reduction of the lane state modulo 2^130 - 5 and addition of s
+ */
+__forceinline
+void poly1305_mb_finalize(const CHACHA20_POLY1305_ARGS *args,
+                          const unsigned lane, uint8_t *tag)
+{
+        uint32_t h0 = args->poly_h[lane][0];
+        uint32_t h1 = args->poly_h[lane][1];
+        uint32_t h2 = args->poly_h[lane][2];
+        uint32_t h3 = args->poly_h[lane][3];
+        uint32_t h4 = args->poly_h[lane][4];
+        uint32_t g0, g1, g2, g3, g4, c, mask;
+        uint64_t f;
+
+        /* full carry */
+        c = h1 >> 26;
+        h1 &= POLY1305_MB_MASK26;
+        h2 += c;
+        c = h2 >> 26;
+        h2 &= POLY1305_MB_MASK26;
+        h3 += c;
+        c = h3 >> 26;
+        h3 &= POLY1305_MB_MASK26;
+        h4 += c;
+        c = h4 >> 26;
+        h4 &= POLY1305_MB_MASK26;
+        h0 += c * 5;
+        c = h0 >> 26;
+        h0 &= POLY1305_MB_MASK26;
+        h1 += c;
+
+        /* g = h + 5 - 2^130 */
+        g0 = h0 + 5;
+        c = g0 >> 26;
+        g0 &= POLY1305_MB_MASK26;
+        g1 = h1 + c;
+        c = g1 >> 26;
+        g1 &= POLY1305_MB_MASK26;
+        g2 = h2 + c;
+        c = g2 >> 26;
+        g2 &= POLY1305_MB_MASK26;
+        g3 = h3 + c;
+        c = g3 >> 26;
+        g3 &= POLY1305_MB_MASK26;
+        g4 = h4 + c - (1UL << 26);
+
+        /* select h if h < p, or g otherwise (constant time) */
+        mask = (g4 >> 31) - 1;
+        h0 = (h0 & ~mask) | (g0 & mask);
+        h1 = (h1 & ~mask) | (g1 & mask);
+        h2 = (h2 & ~mask) | (g2 & mask);
+        h3 = (h3 & ~mask) | (g3 & mask);
+        h4 = (h4 & ~mask) | (g4 & mask);
+
+        /* h = (h + s) % 2^128 */
+        h0 = h0 | (h1 << 26);
+        h1 = (h1 >> 6) | (h2 << 20);
+        h2 = (h2 >> 12) | (h3 << 14);
+        h3 = (h3 >> 18) | (h4 << 8);
+
+        f = (uint64_t) h0 + args->poly_s[lane][0];
+        chacha20_poly1305_mb_store32(&tag[0], (uint32_t) f);
+        f = (uint64_t) h1 + args->poly_s[lane][1] + (f >> 32);
+        chacha20_poly1305_mb_store32(&tag[4], (uint32_t) f);
+        f = (uint64_t) h2 + args->poly_s[lane][2] + (f >> 32);
+        chacha20_poly1305_mb_store32(&tag[8], (uint32_t) f);
+        f = (uint64_t) h3 + args->poly_s[lane][3] + (f >> 32);
+        chacha20_poly1305_mb_store32(&tag[12], (uint32_t) f);
+}
+
+/*
+ * Absorbs num_blocks full blocks of msg[i] on each of the lanes[i]
+ * with msg[i] set
+ */
+__forceinline
+void poly1305_mb_update_lanes(CHACHA20_POLY1305_ARGS *args,
+                              const unsigned *lanes, const unsigned num_lanes,
+                              const uint8_t * const *msg,
+                              const uint64_t num_blocks)
+{
+        unsigned i;
+
+        for (i = 0; i < num_lanes; i++)
+                if (msg[i] != NULL)
+                        poly1305_mb_update(args, lanes[i], msg[i],
+                                           num_blocks, 1 << 24);
+}
+
+#ifndef CHACHA20_MB_KEYSTREAM
+#define CHACHA20_MB_GROUP_LANES 4
+#define CHACHA20_MB_KEYSTREAM   chacha20_mb_keystream_x4
+#endif
+
+#ifndef POLY1305_MB_UPDATE_LANES
+#define POLY1305_MB_UPDATE_LANES poly1305_mb_update_lanes
+#endif
+
+/* ========================================================================== */
+/*
+ * Lane scheduling
+ */
+
+/*
+ * Sets up lanes of new jobs.
+ * AEAD lanes derive the Poly1305 key from block 0 of the keystream
+ * and authenticate the AAD before any message processing.
+ */
+__forceinline
+void chacha20_poly1305_mb_init_lanes(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                     const unsigned *lanes,
+                                     const unsigned num_lanes,
+                                     const unsigned type)
+{
+        CHACHA20_POLY1305_ARGS *args = &state->args;
+        DECLARE_ALIGNED(uint8_t ks[CHACHA20_MB_GROUP_LANES * 64], 64);
+        unsigned group_mask = 0;
+        unsigned i;
+
+        for (i = 0; i < num_lanes; i++) {
+                const unsigned lane = lanes[i];
+                const IMB_JOB *job = state->job_in_lane[lane];
+
+                if (state->init_done[lane])
+                        continue;
+
+                if (type == POLY1305_MB) {
+                        poly1305_mb_init_lane(args, lane,
+                                              job->u.POLY1305._key);
+                        state->init_done[lane] = 1;
+                        continue;
+                }
+
+                chacha20_mb_init_lane(args, lane, job->enc_keys, job->iv,
+                                      (type == CHACHA20_POLY1305_MB) ? 0 : 1);
+                if (type == CHACHA20_MB_CIPHER)
+                        state->init_done[lane] = 1;
+                else
+                        group_mask |= 1 << (lane / CHACHA20_MB_GROUP_LANES);
+        }
+
+        if (group_mask == 0)
+                return;
+
+        for (i = 0; i < num_lanes; i++) {
+                const unsigned lane = lanes[i];
+                const unsigned group = lane / CHACHA20_MB_GROUP_LANES;
+                const IMB_JOB *job = state->job_in_lane[lane];
+
+                if (state->init_done[lane])
+                        continue;
+
+                /* one keystream block serves all lanes of the group */
+                if (group_mask & (1 << group)) {
+                        CHACHA20_MB_KEYSTREAM(args,
+                                              group * CHACHA20_MB_GROUP_LANES,
+                                              ks);
+                        group_mask &= ~(1 << group);
+                }
+
+                poly1305_mb_init_lane(args, lane,
+                                      &ks[(lane % CHACHA20_MB_GROUP_LANES) *
+                                          64]);
+                args->state[12][lane] = 1;
+                poly1305_mb_update_padded(args, lane,
+                                          job->u.CHACHA20_POLY1305.aad,
+                                          job->u.CHACHA20_POLY1305.
+                                          aad_len_in_bytes);
+                state->init_done[lane] = 1;
+        }
+
+#ifdef SAFE_DATA
+        clear_mem(ks, sizeof(ks));
+#endif
+}
+
+/*
+ * Selects the ciphertext of the lanes[i] with jobs in the given direction:
+ * input for decryption and output for encryption.
+ * Returns number of lanes selected.
+ */
+__forceinline
+unsigned
+chacha20_poly1305_mb_auth_msg(const MB_MGR_CHACHA20_POLY1305_OOO *state,
+                              const unsigned *lanes, const unsigned num_lanes,
+                              const IMB_CIPHER_DIRECTION dir,
+                              const uint8_t **msg)
+{
+        unsigned i, n = 0;
+
+        for (i = 0; i < num_lanes; i++) {
+                const unsigned lane = lanes[i];
+
+                msg[i] = NULL;
+                if (state->job_in_lane[lane]->cipher_direction != dir)
+                        continue;
+                if (dir == IMB_DIR_DECRYPT)
+                        msg[i] = state->args.in[lane];
+                else
+                        msg[i] = state->args.out[lane];
+                n++;
+        }
+
+        return n;
+}
+
+/*
+ * Encrypts/decrypts (and authenticates) num_blocks 64-byte blocks
+ * on all lanes in use
+ */
+__forceinline
+void chacha20_poly1305_mb_process(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                  const unsigned *lanes,
+                                  const unsigned num_lanes,
+                                  uint64_t num_blocks, const unsigned type)
+{
+        CHACHA20_POLY1305_ARGS *args = &state->args;
+        DECLARE_ALIGNED(uint8_t ks[CHACHA20_MB_GROUP_LANES * 64], 64);
+        unsigned i;
+
+        while (num_blocks--) {
+                const uint8_t *msg[16];
+                unsigned group = 16;
+
+                /* ciphertext is authenticated before it is decrypted */
+                if (type == CHACHA20_POLY1305_MB &&
+                    chacha20_poly1305_mb_auth_msg(state, lanes, num_lanes,
+                                                  IMB_DIR_DECRYPT, msg))
+                        POLY1305_MB_UPDATE_LANES(args, lanes, num_lanes,
+                                                 msg, 4);
+
+                /* lanes are sorted, so lanes of a group are adjacent */
+                for (i = 0; i < num_lanes; i++) {
+                        const unsigned lane = lanes[i];
+
+                        if (group != (lane / CHACHA20_MB_GROUP_LANES)) {
+                                group = lane / CHACHA20_MB_GROUP_LANES;
+                                CHACHA20_MB_KEYSTREAM(args,
+                                                      group *
+                                                      CHACHA20_MB_GROUP_LANES,
+                                                      ks);
+                        }
+
+                        chacha20_mb_xor_block(args->out[lane], args->in[lane],
+                                              &ks[(lane %
+                                                   CHACHA20_MB_GROUP_LANES) *
+                                                  64]);
+                }
+
+                if (type == CHACHA20_POLY1305_MB &&
+                    chacha20_poly1305_mb_auth_msg(state, lanes, num_lanes,
+                                                  IMB_DIR_ENCRYPT, msg))
+                        POLY1305_MB_UPDATE_LANES(args, lanes, num_lanes,
+                                                 msg, 4);
+
+                for (i = 0; i < num_lanes; i++) {
+                        const unsigned lane = lanes[i];
+
+                        args->state[12][lane]++;
+                        args->in[lane] += 64;
+                        args->out[lane] += 64;
+                }
+        }
+
+#ifdef SAFE_DATA
+        clear_mem(ks, sizeof(ks));
+#endif
+}
+
+/*
+ * Processes the final partial block of the lane (if any)
+ * and completes the job
+ */
+__forceinline
+IMB_JOB *chacha20_poly1305_mb_finalize_lane(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                            const unsigned lane,
+                                            const unsigned type)
+{
+        CHACHA20_POLY1305_ARGS *args = &state->args;
+        IMB_JOB *job = state->job_in_lane[lane];
+        const uint64_t partial_bytes = state->lens[lane];
+
+        if (type == POLY1305_MB) {
+                if (partial_bytes) {
+                        uint8_t block[16];
+
+                        memset(block, 0, sizeof(block));
+                        memcpy(block, args->in[lane], partial_bytes);
+                        block[partial_bytes] = 1;
+                        poly1305_mb_update(args, lane, block, 1, 0);
+#ifdef SAFE_DATA
+                        clear_mem(block, sizeof(block));
+#endif
+                }
+                poly1305_mb_finalize(args, lane, job->auth_tag_output);
+#ifdef SAFE_DATA
+                clear_mem(args->poly_r[lane], sizeof(args->poly_r[lane]));
+                clear_mem(args->poly_s[lane], sizeof(args->poly_s[lane]));
+                clear_mem(args->poly_h[lane], sizeof(args->poly_h[lane]));
+#endif
+                job->status |= IMB_STATUS_COMPLETED_AUTH;
+                return job;
+        }
+
+        if (type == CHACHA20_POLY1305_MB &&
+            job->cipher_direction == IMB_DIR_DECRYPT)
+                poly1305_mb_update_padded(args, lane, args->in[lane],
+                                          partial_bytes);
+
+        if (partial_bytes) {
+                DECLARE_ALIGNED(uint8_t ks[CHACHA20_MB_GROUP_LANES * 64], 64);
+                const unsigned ks_idx = lane % CHACHA20_MB_GROUP_LANES;
+                const uint8_t *ks_lane = &ks[ks_idx * 64];
+                uint64_t i;
+
+                CHACHA20_MB_KEYSTREAM(args, lane - ks_idx, ks);
+                for (i = 0; i < partial_bytes; i++)
+                        args->out[lane][i] = args->in[lane][i] ^ ks_lane[i];
+#ifdef SAFE_DATA
+                clear_mem(ks, sizeof(ks));
+#endif
+        }
+
+        if (type == CHACHA20_POLY1305_MB) {
+                uint64_t last[2];
+
+                if (job->cipher_direction == IMB_DIR_ENCRYPT)
+                        poly1305_mb_update_padded(args, lane, args->out[lane],
+                                                  partial_bytes);
+
+                /* AAD and message lengths block */
+                last[0] = job->u.CHACHA20_POLY1305.aad_len_in_bytes;
+                last[1] = job->msg_len_to_hash_in_bytes;
+                poly1305_mb_update(args, lane, (const uint8_t *) last, 1,
+                                   1 << 24);
+                poly1305_mb_finalize(args, lane, job->auth_tag_output);
+#ifdef SAFE_DATA
+                clear_mem(args->poly_r[lane], sizeof(args->poly_r[lane]));
+                clear_mem(args->poly_s[lane], sizeof(args->poly_s[lane]));
+                clear_mem(args->poly_h[lane], sizeof(args->poly_h[lane]));
+#endif
+                job->status |= IMB_STATUS_COMPLETED;
+        } else
+                job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+#ifdef SAFE_DATA
+        {
+                unsigned i;
+
+                /* clear the key from the lane state */
+                for (i = 4; i < 12; i++)
+                        args->state[i][lane] = 0;
+        }
+#endif
+        return job;
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_chacha20_poly1305(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                   IMB_JOB *job, const unsigned max_jobs,
+                                   const int is_submit, const unsigned type)
+{
+        unsigned lanes[16];
+        unsigned i, num_lanes = 0, min_idx;
+        const uint64_t block_size = (type == POLY1305_MB) ? 16 : 64;
+        uint64_t min_len;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                if (type == POLY1305_MB) {
+                        state->args.in[lane] =
+                                job->src + job->hash_start_src_offset_in_bytes;
+                        state->lens[lane] = job->msg_len_to_hash_in_bytes;
+                } else {
+                        state->args.in[lane] = job->src +
+                                job->cipher_start_src_offset_in_bytes;
+                        state->args.out[lane] = job->dst;
+                        state->lens[lane] = job->msg_len_to_cipher_in_bytes;
+                }
+                state->init_done[lane] = 0;
+
+                /* enough jobs to start processing? */
+                if (state->num_lanes_inuse != max_jobs)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* collect lanes in use */
+        for (i = 0; i < max_jobs; i++)
+                if (state->job_in_lane[i] != NULL)
+                        lanes[num_lanes++] = i;
+
+        chacha20_poly1305_mb_init_lanes(state, lanes, num_lanes, type);
+
+        /* find min common length to process */
+        min_idx = lanes[0];
+        min_len = state->lens[min_idx];
+        for (i = 1; i < num_lanes; i++) {
+                if (min_len > state->lens[lanes[i]]) {
+                        min_idx = lanes[i];
+                        min_len = state->lens[min_idx];
+                }
+        }
+
+        /* process full blocks of all lanes in parallel */
+        if (min_len >= block_size) {
+                const uint64_t num_blocks = min_len / block_size;
+
+                if (type == POLY1305_MB) {
+                        const uint8_t *msg[16];
+
+                        for (i = 0; i < num_lanes; i++)
+                                msg[i] = state->args.in[lanes[i]];
+                        POLY1305_MB_UPDATE_LANES(&state->args, lanes,
+                                                 num_lanes, msg, num_blocks);
+                        for (i = 0; i < num_lanes; i++)
+                                state->args.in[lanes[i]] += num_blocks * 16;
+                } else
+                        chacha20_poly1305_mb_process(state, lanes, num_lanes,
+                                                     num_blocks, type);
+
+                for (i = 0; i < num_lanes; i++)
+                        state->lens[lanes[i]] -= num_blocks * block_size;
+        }
+
+        job = chacha20_poly1305_mb_finalize_lane(state, min_idx, type);
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch ChaCha20, ChaCha20-Poly1305 and Poly1305 MB API.
+ * The arch file defines NUM_CHACHA20_LANES and the function names below
+ * before including this header. Each API is only built when its names
+ * are defined.
+ */
+
+#ifdef SUBMIT_JOB_CHACHA20_MB
+
+IMB_DLL_LOCAL
+IMB_JOB *
+SUBMIT_JOB_CHACHA20_MB(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                       IMB_JOB *job)
+{
+        return submit_flush_job_chacha20_poly1305(state, job,
+                                                  NUM_CHACHA20_LANES, 1,
+                                                  CHACHA20_MB_CIPHER);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *
+FLUSH_JOB_CHACHA20_MB(MB_MGR_CHACHA20_POLY1305_OOO *state)
+{
+        return submit_flush_job_chacha20_poly1305(state, NULL,
+                                                  NUM_CHACHA20_LANES, 0,
+                                                  CHACHA20_MB_CIPHER);
+}
+
+#endif /* SUBMIT_JOB_CHACHA20_MB */
+
+#ifdef SUBMIT_JOB_CHACHA20_POLY1305_MB
+
+IMB_DLL_LOCAL
+IMB_JOB *
+SUBMIT_JOB_CHACHA20_POLY1305_MB(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                                IMB_JOB *job)
+{
+        return submit_flush_job_chacha20_poly1305(state, job,
+                                                  NUM_CHACHA20_LANES, 1,
+                                                  CHACHA20_POLY1305_MB);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *
+FLUSH_JOB_CHACHA20_POLY1305_MB(MB_MGR_CHACHA20_POLY1305_OOO *state)
+{
+        return submit_flush_job_chacha20_poly1305(state, NULL,
+                                                  NUM_CHACHA20_LANES, 0,
+                                                  CHACHA20_POLY1305_MB);
+}
+
+#endif /* SUBMIT_JOB_CHACHA20_POLY1305_MB */
+
+#ifdef SUBMIT_JOB_POLY1305_MB
+
+IMB_DLL_LOCAL
+IMB_JOB *
+SUBMIT_JOB_POLY1305_MB(MB_MGR_CHACHA20_POLY1305_OOO *state,
+                       IMB_JOB *job)
+{
+        return submit_flush_job_chacha20_poly1305(state, job,
+                                                  NUM_CHACHA20_LANES, 1,
+                                                  POLY1305_MB);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *
+FLUSH_JOB_POLY1305_MB(MB_MGR_CHACHA20_POLY1305_OOO *state)
+{
+        return submit_flush_job_chacha20_poly1305(state, NULL,
+                                                  NUM_CHACHA20_LANES, 0,
+                                                  POLY1305_MB);
+}
+
+#endif /* SUBMIT_JOB_POLY1305_MB */
+
+#endif /* CHACHA20_POLY1305_MB_MGR_H */
@@ -0,0 +1,397 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * Multi-buffer CRC for the IMB_AUTH_CRC* hash algorithms.
+ *
+ * Each lane folds one 16-byte block per step with carry-less multiply,
+ * so a single CRC fold chain no longer limits the throughput of many
+ * short buffers. Lanes may carry different CRC types.
+ *
+ * All CRC types are computed as non-reflected CRC32 with the polynomial
+ * in the upper bits of the register (as the LUT references do):
+ * - bits of each input byte are reversed for the reflected CRC types
+ * - init value is XOR'ed into the first 4 message bytes
+ * - the first (n mod 16) bytes are folded in at submit, so the lanes
+ *   only process full blocks
+ * - final 128 to 32 bit reduction is followed by Barrett reduction
+ */
+
+#ifndef CRC_MB_MGR_H
+#define CRC_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+
+#define CRC_MB_NUM_TYPES \
+        (IMB_AUTH_CRC6_IUUP_HEADER - IMB_AUTH_CRC32_ETHERNET_FCS + 1)
+
+struct crc_mb_params {
+        uint32_t k1;      /* x^192 mod P */
+        uint32_t k2;      /* x^128 mod P */
+        uint32_t k3;      /* x^96 mod P */
+        uint32_t k4;      /* x^64 mod P */
+        uint64_t mu;      /* x^64 / P */
+        uint64_t poly;    /* P, including x^32 */
+        uint32_t init;    /* non-reflected initial register value */
+        uint32_t xor_out; /* applied to the final CRC value */
+        uint8_t width;    /* CRC width in bits */
+        uint8_t reflected;
+};
+
+/* indexed by hash_alg - IMB_AUTH_CRC32_ETHERNET_FCS */
+static const struct crc_mb_params crc_mb_params[CRC_MB_NUM_TYPES] = {
+        /* IMB_AUTH_CRC32_ETHERNET_FCS */
+        { 0xc5b9cd4c, 0xe8a45605, 0xf200aa66, 0x490d678d,
+          UINT64_C(0x104d101df), UINT64_C(0x104c11db7),
+          0xffffffff, 0xffffffff, 32, 1 },
+        /* IMB_AUTH_CRC32_SCTP */
+        { 0x6503ea99, 0x18571d18, 0xd7a01665, 0x3aab4576,
+          UINT64_C(0x11f91caf6), UINT64_C(0x11edc6f41),
+          0x00000000, 0x00000000, 32, 0 },
+        /* IMB_AUTH_CRC32_WIMAX_OFDMA_DATA */
+        { 0xc5b9cd4c, 0xe8a45605, 0xf200aa66, 0x490d678d,
+          UINT64_C(0x104d101df), UINT64_C(0x104c11db7),
+          0xffffffff, 0xffffffff, 32, 0 },
+        /* IMB_AUTH_CRC24_LTE_A */
+        { 0x2c8c9d00, 0x64e4d700, 0xfd7e0c00, 0xd9fe8c00,
+          UINT64_C(0x1f845fe24), UINT64_C(0x1864cfb00),
+          0x00000000, 0x00000000, 24, 0 },
+        /* IMB_AUTH_CRC24_LTE_B */
+        { 0x42000100, 0x80140500, 0x09000200, 0x90042100,
+          UINT64_C(0x1ffff83ff), UINT64_C(0x180006300),
+          0x00000000, 0x00000000, 24, 0 },
+        /* IMB_AUTH_CRC16_X25 */
+        { 0xd5f60000, 0x45630000, 0xeb230000, 0xaa510000,
+          UINT64_C(0x111303471), UINT64_C(0x110210000),
+          0xffff0000, 0x0000ffff, 16, 1 },
+        /* IMB_AUTH_CRC16_FP_DATA */
+        { 0xf9130000, 0xff830000, 0x86630000, 0x807b0000,
+          UINT64_C(0x1fffbffe7), UINT64_C(0x180050000),
+          0x00000000, 0x00000000, 16, 0 },
+        /* IMB_AUTH_CRC11_FP_HEADER */
+        { 0xa0800000, 0x04c00000, 0xe1400000, 0x61000000,
+          UINT64_C(0x17208e3d8), UINT64_C(0x160e00000),
+          0x00000000, 0x00000000, 11, 0 },
+        /* IMB_AUTH_CRC10_IUUP_DATA */
+        { 0x92c00000, 0xfb000000, 0xa8000000, 0xb2400000,
+          UINT64_C(0x1f083a337), UINT64_C(0x18cc00000),
+          0x00000000, 0x00000000, 10, 0 },
+        /* IMB_AUTH_CRC8_WIMAX_OFDMA_HCS */
+        { 0xc4000000, 0x94000000, 0x79000000, 0x62000000,
+          UINT64_C(0x107156a16), UINT64_C(0x107000000),
+          0x00000000, 0x00000000, 8, 0 },
+        /* IMB_AUTH_CRC7_FP_HEADER */
+        { 0xbc000000, 0x5e000000, 0x9e000000, 0xea000000,
+          UINT64_C(0x1f79d6171), UINT64_C(0x18a000000),
+          0x00000000, 0x00000000, 7, 0 },
+        /* IMB_AUTH_CRC6_IUUP_HEADER */
+        { 0x1c000000, 0x68000000, 0x34000000, 0xc4000000,
+          UINT64_C(0x1c8af6983), UINT64_C(0x1bc000000),
+          0x00000000, 0x00000000, 6, 0 },
+};
+
+__forceinline
+uint32_t crc_mb_reflect32(uint32_t x)
+{
+        x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+        x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+        x = ((x >> 4) & 0x0f0f0f0f) | ((x & 0x0f0f0f0f) << 4);
+        x = ((x >> 8) & 0x00ff00ff) | ((x & 0x00ff00ff) << 8);
+        return (x >> 16) | (x << 16);
+}
+
+/*
+ * Loads 16 bytes as a 128-bit polynomial, first byte being the most
+ * significant one. Bits of each byte are reversed if 'reflected' is set.
+ */
+__forceinline
+__m128i crc_mb_load_block(const void *p, const int reflected)
+{
+        const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                            7, 6, 5, 4, 3, 2, 1, 0);
+        __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) p),
+                                     bswap);
+
+        if (reflected) {
+                const __m128i rev_lo = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0c,
+                                                     0x02, 0x0a, 0x06, 0x0e,
+                                                     0x01, 0x09, 0x05, 0x0d,
+                                                     0x03, 0x0b, 0x07, 0x0f);
+                const __m128i rev_hi = _mm_slli_epi16(rev_lo, 4);
+                const __m128i nibble = _mm_set1_epi8(0x0f);
+                const __m128i lo = _mm_and_si128(x, nibble);
+                const __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4),
+                                                 nibble);
+
+                x = _mm_or_si128(_mm_shuffle_epi8(rev_hi, lo),
+                                 _mm_shuffle_epi8(rev_lo, hi));
+        }
+        return x;
+}
+
+/* S * x^128 + D, congruent modulo P and kept on 128 bits */
+__forceinline
+__m128i crc_mb_fold(const __m128i s, const __m128i d,
+                    const struct crc_mb_params *p)
+{
+        const __m128i k = _mm_set_epi64x(p->k2, p->k1);
+
+        return _mm_xor_si128(d,
+                             _mm_xor_si128(_mm_clmulepi64_si128(s, k, 0x01),
+                                           _mm_clmulepi64_si128(s, k, 0x10)));
+}
+
+/* Barrett reduction of a 64-bit polynomial */
+__forceinline
+uint32_t crc_mb_barrett(const __m128i u, const struct crc_mb_params *p)
+{
+        const __m128i k = _mm_set_epi64x(p->poly, p->mu);
+        __m128i q;
+
+        q = _mm_clmulepi64_si128(_mm_srli_epi64(u, 32), k, 0x00);
+        q = _mm_clmulepi64_si128(_mm_srli_epi64(q, 32), k, 0x10);
+
+        return (uint32_t) _mm_cvtsi128_si32(_mm_xor_si128(u, q));
+}
+
+/* S * x^32 mod P */
+__forceinline
+uint32_t crc_mb_reduce(const __m128i s, const struct crc_mb_params *p)
+{
+        const __m128i k = _mm_set_epi64x(p->k4, p->k3);
+        __m128i t, u;
+
+        /* 128 -> 96 bits: S_hi * x^96 + S_lo * x^32 */
+        t = _mm_xor_si128(_mm_clmulepi64_si128(s, k, 0x01),
+                          _mm_slli_si128(_mm_move_epi64(s), 4));
+        /* 96 -> 64 bits: T_hi * x^64 + T_lo */
+        u = _mm_xor_si128(_mm_move_epi64(t),
+                          _mm_clmulepi64_si128(t, k, 0x11));
+
+        return crc_mb_barrett(u, p);
+}
+
+__forceinline
+void crc_mb_output(IMB_JOB *job, uint32_t crc,
+                   const struct crc_mb_params *p)
+{
+        const uint32_t mask = 0xffffffff >> (32 - p->width);
+
+        if (p->reflected)
+                crc = crc_mb_reflect32(crc);
+        else
+                crc >>= (32 - p->width);
+
+        *((uint32_t *) job->auth_tag_output) = (crc ^ p->xor_out) & mask;
+        job->status |= IMB_STATUS_COMPLETED_AUTH;
+}
+
+/*
+ * Folds the message head into the lane, leaving a multiple of 16 bytes
+ * to process. Returns 0 if the job has been completed already.
+ */
+__forceinline
+int crc_mb_init_lane(MB_MGR_CRC_OOO *state, const unsigned lane,
+                     IMB_JOB *job)
+{
+        const unsigned type = job->hash_alg - IMB_AUTH_CRC32_ETHERNET_FCS;
+        const struct crc_mb_params *p = &crc_mb_params[type];
+        const uint8_t *msg = job->src + job->hash_start_src_offset_in_bytes;
+        const uint64_t n = job->msg_len_to_hash_in_bytes;
+        DECLARE_ALIGNED(uint8_t data[32], 16);
+        DECLARE_ALIGNED(uint8_t init[32], 16);
+        unsigned head, nblocks, offset;
+        __m128i s;
+
+        memset(data, 0, sizeof(data));
+        memset(init, 0, sizeof(init));
+
+        if (n < 4) {
+                /* M * x^32 + init * x^(8n) fits in 64 bits */
+                uint64_t u;
+
+                memcpy(&data[16 - n], msg, n);
+                u = (uint64_t) _mm_cvtsi128_si64(
+                        crc_mb_load_block(data, p->reflected));
+                u = (u << 32) ^ (((uint64_t) p->init) << (8 * n));
+                crc_mb_output(job,
+                              crc_mb_barrett(_mm_cvtsi64_si128((long long) u),
+                                             p), p);
+                return 0;
+        }
+
+        /* head needs to hold the 4 bytes of init value */
+        head = (unsigned) (((n - 1) % 16) + 1);
+        if (head < 4)
+                head += 16;
+        nblocks = (head + 15) / 16;
+        offset = (nblocks * 16) - head;
+
+        memcpy(&data[offset], msg, head);
+        init[offset + 0] = (uint8_t) (p->init >> 24);
+        init[offset + 1] = (uint8_t) (p->init >> 16);
+        init[offset + 2] = (uint8_t) (p->init >> 8);
+        init[offset + 3] = (uint8_t) p->init;
+
+        s = _mm_xor_si128(crc_mb_load_block(data, p->reflected),
+                          crc_mb_load_block(init, 0));
+        if (nblocks == 2)
+                s = crc_mb_fold(s,
+                                _mm_xor_si128(crc_mb_load_block(&data[16],
+                                                                p->reflected),
+                                              crc_mb_load_block(&init[16],
+                                                                0)),
+                                p);
+
+        _mm_store_si128((__m128i *) &state->fold[lane], s);
+        state->data_ptr[lane] = msg + head;
+        state->lens[lane] = (n - head) / 16;
+        state->type[lane] = (uint8_t) type;
+
+        return 1;
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_crc(MB_MGR_CRC_OOO *state, IMB_JOB *job,
+                     const unsigned max_jobs, const int is_submit)
+{
+        const struct crc_mb_params *p;
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX, n;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - buffers shorter than 4 bytes are completed right away
+                 * - get a free lane id and fold the message head
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+
+                if (!crc_mb_init_lane(state, lane, job))
+                        return job;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+                state->job_in_lane[lane] = job;
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs without full blocks left are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        /* lanes are independent fold chains, interleave them */
+        for (n = 0; n < min_len; n++)
+                for (i = 0; i < max_jobs; i++) {
+                        __m128i s;
+
+                        if (state->job_in_lane[i] == NULL)
+                                continue;
+
+                        p = &crc_mb_params[state->type[i]];
+                        s = _mm_load_si128((const __m128i *)
+                                           &state->fold[i]);
+                        s = crc_mb_fold(s,
+                                        crc_mb_load_block(state->data_ptr[i],
+                                                          p->reflected),
+                                        p);
+                        _mm_store_si128((__m128i *) &state->fold[i], s);
+                        state->data_ptr[i] += 16;
+                }
+
+        for (i = 0; i < max_jobs; i++)
+                if (state->job_in_lane[i] != NULL)
+                        state->lens[i] -= min_len;
+
+        /* complete the shortest lane */
+        job = state->job_in_lane[min_idx];
+        p = &crc_mb_params[state->type[min_idx]];
+        crc_mb_output(job,
+                      crc_mb_reduce(_mm_load_si128((const __m128i *)
+                                                   &state->fold[min_idx]),
+                                    p), p);
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch CRC (IMB_AUTH_CRC*) API.
+ * The arch file defines NUM_CRC_LANES and the function names below
+ * before including this header.
+ */
+#ifdef SUBMIT_JOB_CRC
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_CRC(MB_MGR_CRC_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_crc(state, job, NUM_CRC_LANES, 1);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_CRC(MB_MGR_CRC_OOO *state)
+{
+        return submit_flush_job_crc(state, NULL, NUM_CRC_LANES, 0);
+}
+
+#endif /* SUBMIT_JOB_CRC */
+
+#endif /* CRC_MB_MGR_H */
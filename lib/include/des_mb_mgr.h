@@ -0,0 +1,267 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * DES, 3DES and DOCSIS DES multi-buffer manager.
+ *
+ * CBC encryption is sequential within a message, so up to 8 independent
+ * messages are processed in parallel, with the DES rounds of all lanes
+ * interleaved (see des_cbc_mb_basic() in des_basic.c). The chaining
+ * block of each lane is kept in the IV field of the arguments.
+ *
+ * DOCSIS DES final partial block (DES CFB) is encrypted when the job
+ * is complete, as it needs the last cipher-text block. On decryption
+ * it is done on submit, before in-place CBC overwrites the cipher-text.
+ */
+
+#ifndef DES_MB_MGR_H
+#define DES_MB_MGR_H
+
+#include <string.h>
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/arch_x86_64.h"
+#include "include/clear_regs_mem.h"
+
+/* Processes num_blocks full blocks of all lanes */
+typedef void (*des_mb_kernel_t)(DES_ARGS_x16 *, const uint64_t);
+
+__forceinline
+IMB_JOB *
+submit_flush_job_des(MB_MGR_DES_OOO *state, IMB_JOB *job,
+                     const unsigned max_jobs, const int is_submit,
+                     const int is_enc, const int is_docsis,
+                     const des_mb_kernel_t kernel)
+{
+        DES_ARGS_x16 *args = &state->args;
+        unsigned i, min_idx = max_jobs;
+        uint64_t min_len = UINT64_MAX;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - number of blocks for the kernel: all full blocks
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+                const uint8_t *src = job->src +
+                        job->cipher_start_src_offset_in_bytes;
+                const uint64_t num_blocks =
+                        job->msg_len_to_cipher_in_bytes / IMB_DES_BLOCK_SIZE;
+                const uint64_t offset = num_blocks * IMB_DES_BLOCK_SIZE;
+                const int partial = (int) (job->msg_len_to_cipher_in_bytes &
+                                           (IMB_DES_BLOCK_SIZE - 1));
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                args->in[lane] = src;
+                args->out[lane] = job->dst;
+                args->keys[lane] = is_enc ? job->enc_keys : job->dec_keys;
+                memcpy(&args->IV[lane * 2], job->iv, IMB_DES_BLOCK_SIZE);
+                state->lens[lane] = (uint16_t) num_blocks;
+
+                /* DOCSIS DES decrypt: partial block uses cipher-text */
+                if (is_docsis && !is_enc && partial != 0)
+                        docsis_des_dec_basic(&src[offset], &job->dst[offset],
+                                             partial, job->dec_keys,
+                                             (num_blocks == 0) ?
+                                             (const uint64_t *) job->iv :
+                                             (const uint64_t *)
+                                             &src[offset - 8]);
+
+                /*
+                 * Enough jobs to start processing?
+                 * Jobs without full blocks are completed right away.
+                 */
+                if (state->num_lanes_inuse != max_jobs &&
+                    state->lens[lane] != 0)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* find min common length to process */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (min_len > state->lens[i]) {
+                        min_idx = i;
+                        min_len = state->lens[i];
+                }
+        }
+
+        if (min_len != 0) {
+                /*
+                 * Unused lanes (flush only) repeat the work
+                 * of the shortest lane
+                 */
+                if (!is_submit)
+                        for (i = 0; i < max_jobs; i++) {
+                                if (state->job_in_lane[i] != NULL)
+                                        continue;
+                                args->in[i] = args->in[min_idx];
+                                args->out[i] = args->out[min_idx];
+                                args->keys[i] = args->keys[min_idx];
+                                args->IV[i * 2] = args->IV[min_idx * 2];
+                                args->IV[i * 2 + 1] =
+                                        args->IV[min_idx * 2 + 1];
+                        }
+
+                kernel(args, min_len);
+
+                for (i = 0; i < max_jobs; i++)
+                        if (state->job_in_lane[i] != NULL)
+                                state->lens[i] -= (uint16_t) min_len;
+        }
+
+        job = state->job_in_lane[min_idx];
+
+        /* DOCSIS DES encrypt: partial block uses the last cipher-text */
+        if (is_docsis && is_enc &&
+            (job->msg_len_to_cipher_in_bytes & (IMB_DES_BLOCK_SIZE - 1)))
+                docsis_des_enc_basic(args->in[min_idx], args->out[min_idx],
+                                     (int) (job->msg_len_to_cipher_in_bytes &
+                                            (IMB_DES_BLOCK_SIZE - 1)),
+                                     (const uint64_t *) args->keys[min_idx],
+                                     (const uint64_t *)
+                                     &args->IV[min_idx * 2]);
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+#ifdef SAFE_DATA
+        clear_mem(&args->IV[min_idx * 2], IMB_DES_BLOCK_SIZE);
+#endif
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch DES, 3DES and DOCSIS DES API.
+ * The arch file defines NUM_DES_LANES, the DES*_CBC_*_KERNEL block
+ * functions and the function names below before including this header.
+ */
+#ifdef SUBMIT_JOB_DES_CBC_ENC
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_DES_CBC_ENC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 1, 0,
+                                    DES_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_DES_CBC_ENC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 1, 0,
+                                    DES_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_DES_CBC_DEC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 0, 0,
+                                    DES_CBC_DEC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_DES_CBC_DEC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 0, 0,
+                                    DES_CBC_DEC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_3DES_CBC_ENC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 1, 0,
+                                    DES3_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_3DES_CBC_ENC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 1, 0,
+                                    DES3_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_3DES_CBC_DEC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 0, 0,
+                                    DES3_CBC_DEC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_3DES_CBC_DEC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 0, 0,
+                                    DES3_CBC_DEC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_DOCSIS_DES_ENC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 1, 1,
+                                    DES_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_DOCSIS_DES_ENC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 1, 1,
+                                    DES_CBC_ENC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_DOCSIS_DES_DEC(MB_MGR_DES_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_des(state, job, NUM_DES_LANES, 1, 0, 1,
+                                    DES_CBC_DEC_KERNEL);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_DOCSIS_DES_DEC(MB_MGR_DES_OOO *state)
+{
+        return submit_flush_job_des(state, NULL, NUM_DES_LANES, 0, 0, 1,
+                                    DES_CBC_DEC_KERNEL);
+}
+
+#endif /* SUBMIT_JOB_DES_CBC_ENC */
+
+#endif /* DES_MB_MGR_H */
@@ -35,8 +35,12 @@
  *           SUBMIT_JOB_AES128_ENC, SUBMIT_JOB_AES256_DEC and
  *           SUBMIT_JOB_AES256_DEC.
  *
+ * @note Optionally, AES_CBC_ENC_128_MB and AES_CBC_ENC_256_MB (multi-lane
+ *       AES-CBC encrypt functions) can be defined, to process residual
+ *       blocks of all completed lanes in a single pass on encryption.
+ *
  * @note The file defines the following:
- *           DOCSIS_LAST_BLOCK, DOCSIS_FIRST_BLOCK,
+ *           DOCSIS_LAST_BLOCK, DOCSIS_LAST_BLOCK_MB, DOCSIS_FIRST_BLOCK,
  *           SUBMIT_JOB_DOCSIS_SEC_ENC, FLUSH_JOB_DOCSIS_SEC_ENC,
  *           SUBMIT_JOB_DOCSIS_SEC_DEC,
  *           SUBMIT_JOB_DOCSIS_SEC_CRC_ENC, FLUSH_JOB_DOCSIS_SEC_CRC_ENC,
@@ -49,6 +53,7 @@
 
 #include <stdint.h>
 #include "include/des.h"
+#include "include/clear_regs_mem.h"
 
 /* ========================================================================= */
 /* DOCSIS SEC BPI / AES  (AES128-CBC + AES128-CFB) */
@@ -133,6 +138,109 @@ DOCSIS_LAST_BLOCK(IMB_JOB *job, const uint64_t key_size)
         return job;
 }
 
+#if defined(AES_CBC_ENC_128_MB) && defined(AES_CBC_ENC_256_MB)
+/**
+ * @brief Encrypts the last partial blocks for DOCSIS SEC v3.1 BPI
+ *        of all completed jobs in the OOO manager
+ *
+ * CFB128 keystream of a single block is AES-CBC of the last complete
+ * cipher-text block with zero IV. Keystream for the returned job and for
+ * all other jobs that completed CBC and are waiting in their lanes
+ * is computed in one multi-lane AES-CBC pass. Jobs processed ahead
+ * of time are recorded in \a residual_done and skipped on return.
+ *
+ * @note It is assumed that length is bigger than one AES 128 block.
+ *
+ * @param state OOO manager structure
+ * @param job description of performed crypto operation
+ * @param key_size key size in bytes (16 or 32)
+ * @return It always returns value passed in \a job
+ */
+__forceinline
+IMB_JOB *
+DOCSIS_LAST_BLOCK_MB(MB_MGR_DOCSIS_AES_OOO *state, IMB_JOB *job,
+                     const uint64_t key_size)
+{
+        DECLARE_ALIGNED(AES_ARGS args, 64);
+        DECLARE_ALIGNED(uint8_t ks[16][IMB_AES_BLOCK_SIZE], 16);
+        IMB_JOB *lane_job[16];
+        unsigned num_jobs = 0;
+        unsigned i, j;
+
+        if (job == NULL)
+                return job;
+
+        IMB_ASSERT(job->status & IMB_STATUS_COMPLETED_CIPHER);
+
+        for (i = 0; i < 16; i++)
+                if (state->residual_done[i] == job) {
+                        /* residual block processed with earlier job */
+                        state->residual_done[i] = NULL;
+                        return job;
+                }
+
+        if (!(job->msg_len_to_cipher_in_bytes & (IMB_AES_BLOCK_SIZE - 1)))
+                return job;
+
+        lane_job[num_jobs++] = job;
+
+        /* collect other lanes with CBC completed and a partial block */
+        for (i = 0; i < 16; i++) {
+                IMB_JOB *lj = state->job_in_lane[i];
+
+                if (lj == NULL || lj == job || state->lens[i] != 0)
+                        continue;
+                if (!(lj->msg_len_to_cipher_in_bytes &
+                      (IMB_AES_BLOCK_SIZE - 1)))
+                        continue;
+                if (state->residual_done[i] == lj)
+                        continue;
+                state->residual_done[i] = lj;
+                lane_job[num_jobs++] = lj;
+        }
+
+        memset(args.IV, 0, sizeof(args.IV));
+        for (i = 0; i < 16; i++) {
+                /* unused lanes repeat the first job, output discarded */
+                const IMB_JOB *lj = lane_job[(i < num_jobs) ? i : 0];
+                const uint64_t offset = lj->msg_len_to_cipher_in_bytes &
+                        (~(IMB_AES_BLOCK_SIZE - 1));
+
+                /* IV is the last cipher-text block */
+                args.in[i] = lj->dst + offset - IMB_AES_BLOCK_SIZE;
+                args.out[i] = ks[i];
+                args.keys[i] = lj->enc_keys;
+        }
+
+        if (key_size == 16)
+                AES_CBC_ENC_128_MB(&args, IMB_AES_BLOCK_SIZE);
+        else /* 32 */
+                AES_CBC_ENC_256_MB(&args, IMB_AES_BLOCK_SIZE);
+
+        for (i = 0; i < num_jobs; i++) {
+                IMB_JOB *lj = lane_job[i];
+                const uint64_t partial_bytes = lj->msg_len_to_cipher_in_bytes &
+                        (IMB_AES_BLOCK_SIZE - 1);
+                const uint64_t offset = lj->msg_len_to_cipher_in_bytes &
+                        (~(IMB_AES_BLOCK_SIZE - 1));
+                const uint8_t *src = lj->src +
+                        lj->cipher_start_src_offset_in_bytes + offset;
+                uint8_t *dst = lj->dst + offset;
+
+                for (j = 0; j < partial_bytes; j++)
+                        dst[j] = src[j] ^ ks[i][j];
+        }
+
+#ifdef SAFE_DATA
+        clear_mem(ks, sizeof(ks));
+#endif
+        return job;
+}
+#else
+#define DOCSIS_LAST_BLOCK_MB(state, job, key_size) \
+        DOCSIS_LAST_BLOCK(job, key_size)
+#endif /* AES_CBC_ENC_128_MB && AES_CBC_ENC_256_MB */
+
 /**
  * @brief Encrypts/decrypts the first and only partial block for
  *        DOCSIS SEC v3.1 BPI
@@ -183,7 +291,7 @@ SUBMIT_JOB_DOCSIS_SEC_ENC(MB_MGR_DOCSIS_AES_OOO *state, IMB_JOB *job,
                         tmp = SUBMIT_JOB_AES128_ENC((MB_MGR_AES_OOO *)state,
                                                     job);
 
-                        return DOCSIS_LAST_BLOCK(tmp, 16);
+                        return DOCSIS_LAST_BLOCK_MB(state, tmp, 16);
                 } else
                         return DOCSIS_FIRST_BLOCK(job, 16);
         } else { /* Key length = 32 */
@@ -191,7 +299,7 @@ SUBMIT_JOB_DOCSIS_SEC_ENC(MB_MGR_DOCSIS_AES_OOO *state, IMB_JOB *job,
                         tmp = SUBMIT_JOB_AES256_ENC((MB_MGR_AES_OOO *)state,
                                                     job);
 
-                        return DOCSIS_LAST_BLOCK(tmp, 32);
+                        return DOCSIS_LAST_BLOCK_MB(state, tmp, 32);
                 } else
                         return DOCSIS_FIRST_BLOCK(job, 32);
         }
@@ -227,11 +335,11 @@ FLUSH_JOB_DOCSIS_SEC_ENC(MB_MGR_DOCSIS_AES_OOO *state, const uint64_t key_size)
         if (key_size == 16) {
                 tmp = FLUSH_JOB_AES128_ENC((MB_MGR_AES_OOO *)state);
 
-                return DOCSIS_LAST_BLOCK(tmp, 16);
+                return DOCSIS_LAST_BLOCK_MB(state, tmp, 16);
         } else { /* 32 */
                 tmp = FLUSH_JOB_AES256_ENC((MB_MGR_AES_OOO *)state);
 
-                return DOCSIS_LAST_BLOCK(tmp, 32);
+                return DOCSIS_LAST_BLOCK_MB(state, tmp, 32);
         }
 }
 
@@ -178,6 +178,220 @@ aes_gcm_pre_192_vaes_avx512(const void *key, struct gcm_key_data *key_data);
 IMB_DLL_EXPORT void
 aes_gcm_pre_256_vaes_avx512(const void *key, struct gcm_key_data *key_data);
 
+/*
+ * AVX2+VAES+VPCLMULQDQ GCM API
+ * - same key layout as the AVX2 (avx_gen4) API
+ * - available through IMB_GCM_xxx() macros from intel-ipsec-mb.h
+ */
+IMB_DLL_LOCAL void
+aes_gcm_enc_128_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_192_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_256_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_128_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_192_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_256_vaes_avx2(const struct gcm_key_data *key_data,
+                          struct gcm_context_data *context_data,
+                          uint8_t *out, uint8_t const *in, uint64_t msg_len,
+                          const uint8_t *iv,
+                          uint8_t const *aad, uint64_t aad_len,
+                          uint8_t *auth_tag, uint64_t auth_tag_len);
+
+IMB_DLL_LOCAL void
+aes_gcm_init_128_vaes_avx2(const struct gcm_key_data *key_data,
+                           struct gcm_context_data *context_data,
+                           const uint8_t *iv, uint8_t const *aad,
+                           uint64_t aad_len);
+IMB_DLL_LOCAL void
+aes_gcm_init_192_vaes_avx2(const struct gcm_key_data *key_data,
+                           struct gcm_context_data *context_data,
+                           const uint8_t *iv, uint8_t const *aad,
+                           uint64_t aad_len);
+IMB_DLL_LOCAL void
+aes_gcm_init_256_vaes_avx2(const struct gcm_key_data *key_data,
+                           struct gcm_context_data *context_data,
+                           const uint8_t *iv, uint8_t const *aad,
+                           uint64_t aad_len);
+
+IMB_DLL_LOCAL void
+aes_gcm_init_var_iv_128_vaes_avx2(const struct gcm_key_data *key_data,
+                              struct gcm_context_data *context_data,
+                              const uint8_t *iv, const uint64_t iv_len,
+                              const uint8_t *aad, const uint64_t aad_len);
+IMB_DLL_LOCAL void
+aes_gcm_init_var_iv_192_vaes_avx2(const struct gcm_key_data *key_data,
+                              struct gcm_context_data *context_data,
+                              const uint8_t *iv, const uint64_t iv_len,
+                              const uint8_t *aad, const uint64_t aad_len);
+IMB_DLL_LOCAL void
+aes_gcm_init_var_iv_256_vaes_avx2(const struct gcm_key_data *key_data,
+                              struct gcm_context_data *context_data,
+                              const uint8_t *iv, const uint64_t iv_len,
+                              const uint8_t *aad, const uint64_t aad_len);
+
+IMB_DLL_LOCAL void
+aes_gcm_enc_128_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_192_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_256_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_128_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_192_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_256_update_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 uint64_t msg_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_128_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_192_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_256_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_128_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_192_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_256_finalize_vaes_avx2(const struct gcm_key_data *key_data,
+                                   struct gcm_context_data *context_data,
+                                   uint8_t *auth_tag, uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_precomp_128_vaes_avx2(struct gcm_key_data *key_data);
+IMB_DLL_LOCAL void
+aes_gcm_precomp_192_vaes_avx2(struct gcm_key_data *key_data);
+IMB_DLL_LOCAL void
+aes_gcm_precomp_256_vaes_avx2(struct gcm_key_data *key_data);
+
+IMB_DLL_LOCAL void
+aes_gcm_enc_var_iv_128_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_var_iv_192_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_enc_var_iv_256_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_var_iv_128_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_var_iv_192_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+IMB_DLL_LOCAL void
+aes_gcm_dec_var_iv_256_vaes_avx2(const struct gcm_key_data *key_data,
+                                 struct gcm_context_data *context_data,
+                                 uint8_t *out, const uint8_t *in,
+                                 const uint64_t msg_len,
+                                 const uint8_t *iv, const uint64_t iv_len,
+                                 const uint8_t *aad, const uint64_t aad_len,
+                                 uint8_t *auth_tag,
+                                 const uint64_t auth_tag_len);
+
+IMB_DLL_LOCAL void
+ghash_vaes_avx2(const struct gcm_key_data *key_data, const void *in,
+                const uint64_t in_len, void *io_tag,
+                const uint64_t tag_len);
+
+IMB_DLL_LOCAL void
+imb_aes_gmac_update_128_vaes_avx2(const struct gcm_key_data *key_data,
+                                  struct gcm_context_data *context_data,
+                                  const uint8_t *in, const uint64_t in_len);
+IMB_DLL_LOCAL void
+imb_aes_gmac_update_192_vaes_avx2(const struct gcm_key_data *key_data,
+                                  struct gcm_context_data *context_data,
+                                  const uint8_t *in, const uint64_t in_len);
+IMB_DLL_LOCAL void
+imb_aes_gmac_update_256_vaes_avx2(const struct gcm_key_data *key_data,
+                                  struct gcm_context_data *context_data,
+                                  const uint8_t *in, const uint64_t in_len);
+
 /*
  * AVX512 GCM API
  * - intentionally this is not exposed in intel-ipsec-mb.h
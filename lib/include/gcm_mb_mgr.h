@@ -0,0 +1,535 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*
+ * AES-GCM multi-buffer implementation.
+ *
+ * Up to 8 independent AES-GCM jobs (each with its own key, IV and AAD)
+ * are processed in parallel. AES rounds of all lanes are interleaved
+ * so that AESENC latency is hidden and GHASH multiplies of all lanes
+ * are independent of each other.
+ *
+ * GHASH is computed on byte reflected data, as described in
+ * "Intel Carry-Less Multiplication Instruction and its Usage for
+ * Computing the GCM Mode". Hash key powers (HashKey^n<<1 mod poly)
+ * precomputed in gcm_key_data are used, so up to GCM_MB_AGG_BLOCKS
+ * blocks of a lane are digested with one reduction.
+ */
+
+#ifndef GCM_MB_MGR_H
+#define GCM_MB_MGR_H
+
+#include <string.h>
+#ifdef LINUX
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/clear_regs_mem.h"
+
+/* number of hash key powers stored in SSE/AVX and AVX2 gcm_key_data */
+#define GCM_MB_AGG_BLOCKS 8
+
+__forceinline
+__m128i gcm_mb_bswap128(const __m128i x)
+{
+        const __m128i shuf_mask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                                7, 6, 5, 4, 3, 2, 1, 0);
+
+        return _mm_shuffle_epi8(x, shuf_mask);
+}
+
+/*
+ * Returns HashKey^n<<1 mod poly (n = 1 to 8).
+ * HashKey_8 to HashKey_1 follow the expanded keys, both in
+ * the SSE/AVX and AVX2 layouts of gcm_key_data.
+ */
+__forceinline
+__m128i gcm_mb_hkey(const struct gcm_key_data *key, const unsigned n)
+{
+        const __m128i *hkeys =
+                (const __m128i *) key->ghash_keys.sse_avx.shifted_hkey;
+
+        return _mm_loadu_si128(&hkeys[GCM_MB_AGG_BLOCKS - n]);
+}
+
+/*
+ * Carry-less multiplication of two 128-bit operands,
+ * accumulated into <hi:mid:lo> without reduction
+ */
+__forceinline
+void gcm_mb_clmul_acc(const __m128i a, const __m128i b,
+                      __m128i *hi, __m128i *mid, __m128i *lo)
+{
+        *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(a, b, 0x00));
+        *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(a, b, 0x11));
+        *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(a, b, 0x01));
+        *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(a, b, 0x10));
+}
+
+/*
+ * Reduces accumulated products with shifted hash keys,
+ * same as GHASH_MUL in gcm_sse.inc
+ */
+__forceinline
+__m128i gcm_mb_reduce(__m128i hi, const __m128i mid, __m128i lo)
+{
+        __m128i t2, t3, t4, t5;
+
+        lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+        hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+        /* first phase */
+        t2 = _mm_slli_epi32(lo, 31);
+        t3 = _mm_slli_epi32(lo, 30);
+        t4 = _mm_slli_epi32(lo, 25);
+        t2 = _mm_xor_si128(t2, t3);
+        t2 = _mm_xor_si128(t2, t4);
+        t5 = _mm_srli_si128(t2, 4);
+        t2 = _mm_slli_si128(t2, 12);
+        lo = _mm_xor_si128(lo, t2);
+
+        /* second phase */
+        t2 = _mm_srli_epi32(lo, 1);
+        t3 = _mm_srli_epi32(lo, 2);
+        t4 = _mm_srli_epi32(lo, 7);
+        t2 = _mm_xor_si128(t2, t3);
+        t2 = _mm_xor_si128(t2, t4);
+        t2 = _mm_xor_si128(t2, t5);
+        lo = _mm_xor_si128(lo, t2);
+
+        return _mm_xor_si128(hi, lo);
+}
+
+/*
+ * GHASH of 1 to GCM_MB_AGG_BLOCKS byte reflected blocks, one reduction:
+ * tag = (tag + X1) * H^n + X2 * H^(n-1) + ... + Xn * H
+ */
+__forceinline
+__m128i gcm_mb_ghash_blocks(const struct gcm_key_data *key, const __m128i tag,
+                            const __m128i *blocks, const unsigned num_blocks)
+{
+        __m128i hi = _mm_setzero_si128();
+        __m128i mid = _mm_setzero_si128();
+        __m128i lo = _mm_setzero_si128();
+        unsigned i;
+
+        gcm_mb_clmul_acc(_mm_xor_si128(tag, blocks[0]),
+                         gcm_mb_hkey(key, num_blocks), &hi, &mid, &lo);
+        for (i = 1; i < num_blocks; i++)
+                gcm_mb_clmul_acc(blocks[i], gcm_mb_hkey(key, num_blocks - i),
+                                 &hi, &mid, &lo);
+
+        return gcm_mb_reduce(hi, mid, lo);
+}
+
+/*
+ * Loads up to 16 bytes, remaining bytes of the block are zeroed
+ */
+__forceinline
+__m128i gcm_mb_load_partial(const void *ptr, const uint64_t num_bytes)
+{
+        DECLARE_ALIGNED(uint8_t block[16], 16);
+
+        memset(block, 0, sizeof(block));
+        memcpy(block, ptr, num_bytes);
+
+        return _mm_load_si128((const __m128i *) block);
+}
+
+/*
+ * Stores up to 16 bytes of the block
+ */
+__forceinline
+void gcm_mb_store_partial(void *ptr, const __m128i x, const uint64_t num_bytes)
+{
+        DECLARE_ALIGNED(uint8_t block[16], 16);
+
+        _mm_store_si128((__m128i *) block, x);
+        memcpy(ptr, block, num_bytes);
+#ifdef SAFE_DATA
+        clear_mem(block, sizeof(block));
+#endif
+}
+
+/*
+ * GHASH update of byte reflected tag with message of any length
+ */
+__forceinline
+__m128i gcm_mb_ghash(const struct gcm_key_data *key, __m128i tag,
+                     const uint8_t *msg, uint64_t len)
+{
+        __m128i blocks[GCM_MB_AGG_BLOCKS];
+
+        while (len != 0) {
+                unsigned n = 0;
+
+                while (n < GCM_MB_AGG_BLOCKS && len >= 16) {
+                        blocks[n++] = gcm_mb_bswap128(
+                                _mm_loadu_si128((const __m128i *) msg));
+                        msg += 16;
+                        len -= 16;
+                }
+
+                if (n < GCM_MB_AGG_BLOCKS && len != 0) {
+                        blocks[n++] = gcm_mb_bswap128(
+                                gcm_mb_load_partial(msg, len));
+                        len = 0;
+                }
+
+                tag = gcm_mb_ghash_blocks(key, tag, blocks, n);
+        }
+
+        return tag;
+}
+
+/*
+ * Encrypts one block
+ */
+__forceinline
+__m128i gcm_mb_aes_enc_x1(const struct gcm_key_data *key,
+                          const unsigned nrounds, const __m128i b)
+{
+        const __m128i *rkeys = (const __m128i *) key->expanded_keys;
+        __m128i s = _mm_xor_si128(b, _mm_loadu_si128(&rkeys[0]));
+        unsigned r;
+
+        for (r = 1; r < nrounds; r++)
+                s = _mm_aesenc_si128(s, _mm_loadu_si128(&rkeys[r]));
+
+        return _mm_aesenclast_si128(s, _mm_loadu_si128(&rkeys[nrounds]));
+}
+
+/*
+ * Sets up a new lane:
+ * - computes E(K, J0)
+ * - initializes the counter block (kept byte reflected)
+ * - digests AAD
+ */
+__forceinline
+void gcm_mb_init_lane(MB_MGR_GCM_OOO *state, const unsigned lane,
+                      const unsigned nrounds)
+{
+        GCM_ARGS *args = &state->args;
+        const IMB_JOB *job = state->job_in_lane[lane];
+        DECLARE_ALIGNED(uint8_t j0_block[16], 16);
+        __m128i j0, ctr, tag;
+
+        /* J0 = IV || 0^31 || 1 */
+        memset(j0_block, 0, sizeof(j0_block));
+        memcpy(j0_block, job->iv, 12);
+        j0_block[15] = 1;
+        j0 = _mm_load_si128((const __m128i *) j0_block);
+        ctr = _mm_add_epi32(gcm_mb_bswap128(j0), _mm_setr_epi32(1, 0, 0, 0));
+
+        j0 = gcm_mb_aes_enc_x1(args->keys[lane], nrounds, j0);
+
+        tag = gcm_mb_ghash(args->keys[lane], _mm_setzero_si128(),
+                           (const uint8_t *) job->u.GCM.aad,
+                           job->u.GCM.aad_len_in_bytes);
+
+        _mm_store_si128((__m128i *) &args->enc_j0[lane], j0);
+        _mm_store_si128((__m128i *) &args->ctr[lane], ctr);
+        _mm_store_si128((__m128i *) &args->tag[lane], tag);
+
+        state->init_done[lane] = 1;
+}
+
+/*
+ * Encrypts/decrypts and digests given number of full blocks
+ * on the selected lanes, up to GCM_MB_AGG_BLOCKS blocks per lane
+ * at a time
+ */
+__forceinline
+void gcm_mb_ctr_ghash(MB_MGR_GCM_OOO *state, const unsigned *lanes,
+                      const unsigned num_lanes, uint64_t num_blocks,
+                      const unsigned nrounds)
+{
+        GCM_ARGS *args = &state->args;
+        __m128i ks[16 * GCM_MB_AGG_BLOCKS];
+        __m128i blocks[GCM_MB_AGG_BLOCKS];
+        unsigned i, b, r;
+
+        while (num_blocks != 0) {
+                const unsigned n = (num_blocks > GCM_MB_AGG_BLOCKS) ?
+                        GCM_MB_AGG_BLOCKS : (unsigned) num_blocks;
+
+                for (i = 0; i < num_lanes; i++) {
+                        const unsigned l = lanes[i];
+                        const __m128i *rkeys =
+                                (const __m128i *) args->keys[l]->expanded_keys;
+                        const __m128i rk = _mm_loadu_si128(&rkeys[0]);
+                        __m128i ctr = _mm_load_si128((__m128i *) &args->ctr[l]);
+
+                        for (b = 0; b < n; b++) {
+                                ks[i * GCM_MB_AGG_BLOCKS + b] =
+                                        _mm_xor_si128(gcm_mb_bswap128(ctr), rk);
+                                ctr = _mm_add_epi32(ctr,
+                                                    _mm_setr_epi32(1, 0, 0, 0));
+                        }
+                        _mm_store_si128((__m128i *) &args->ctr[l], ctr);
+                }
+
+                for (r = 1; r < nrounds; r++)
+                        for (i = 0; i < num_lanes; i++) {
+                                const __m128i *rkeys = (const __m128i *)
+                                        args->keys[lanes[i]]->expanded_keys;
+                                const __m128i rk = _mm_loadu_si128(&rkeys[r]);
+                                __m128i *k = &ks[i * GCM_MB_AGG_BLOCKS];
+
+                                for (b = 0; b < n; b++)
+                                        k[b] = _mm_aesenc_si128(k[b], rk);
+                        }
+
+                for (i = 0; i < num_lanes; i++) {
+                        const unsigned l = lanes[i];
+                        const struct gcm_key_data *key = args->keys[l];
+                        const __m128i *rkeys =
+                                (const __m128i *) key->expanded_keys;
+                        const __m128i rk = _mm_loadu_si128(&rkeys[nrounds]);
+                        const int is_enc = (state->job_in_lane[l]->
+                                            cipher_direction ==
+                                            IMB_DIR_ENCRYPT);
+                        __m128i *k = &ks[i * GCM_MB_AGG_BLOCKS];
+                        __m128i tag = _mm_load_si128((__m128i *) &args->tag[l]);
+
+                        for (b = 0; b < n; b++) {
+                                const __m128i in = _mm_loadu_si128(
+                                        (const __m128i *) &args->in[l][b * 16]);
+                                const __m128i out = _mm_xor_si128(in,
+                                        _mm_aesenclast_si128(k[b], rk));
+
+                                _mm_storeu_si128((__m128i *)
+                                                 &args->out[l][b * 16], out);
+                                /* GHASH is always computed on cipher text */
+                                blocks[b] = gcm_mb_bswap128(is_enc ? out : in);
+                        }
+
+                        tag = gcm_mb_ghash_blocks(key, tag, blocks, n);
+                        _mm_store_si128((__m128i *) &args->tag[l], tag);
+
+                        args->in[l] += n * 16;
+                        args->out[l] += n * 16;
+                }
+
+                num_blocks -= n;
+        }
+
+#ifdef SAFE_DATA
+        clear_mem(ks, sizeof(ks));
+        clear_mem(blocks, sizeof(blocks));
+#endif
+}
+
+/*
+ * Processes the final partial block of the lane (if any)
+ * and writes out the authentication tag
+ */
+__forceinline
+IMB_JOB *
+gcm_mb_finalize_lane(MB_MGR_GCM_OOO *state, const unsigned lane,
+                     const unsigned nrounds)
+{
+        GCM_ARGS *args = &state->args;
+        IMB_JOB *job = state->job_in_lane[lane];
+        const uint64_t partial_bytes = state->lens[lane];
+        __m128i tag = _mm_load_si128((__m128i *) &args->tag[lane]);
+        const __m128i ej0 = _mm_load_si128((__m128i *) &args->enc_j0[lane]);
+        __m128i blocks[2];
+        unsigned n = 0;
+
+        if (partial_bytes != 0) {
+                const __m128i ctr =
+                        _mm_load_si128((__m128i *) &args->ctr[lane]);
+                const __m128i ks = gcm_mb_aes_enc_x1(args->keys[lane], nrounds,
+                                                     gcm_mb_bswap128(ctr));
+                __m128i in, out;
+
+                in = gcm_mb_load_partial(args->in[lane], partial_bytes);
+                out = _mm_xor_si128(in, ks);
+                gcm_mb_store_partial(args->out[lane], out, partial_bytes);
+
+                if (job->cipher_direction == IMB_DIR_ENCRYPT)
+                        in = gcm_mb_load_partial(args->out[lane],
+                                                 partial_bytes);
+                blocks[n++] = gcm_mb_bswap128(in);
+        }
+
+        /* len(A) || len(C) block in byte reflected form */
+        blocks[n++] = _mm_set_epi64x((long long)
+                                     (job->u.GCM.aad_len_in_bytes * 8),
+                                     (long long)
+                                     (job->msg_len_to_cipher_in_bytes * 8));
+        tag = gcm_mb_ghash_blocks(args->keys[lane], tag, blocks, n);
+        tag = _mm_xor_si128(gcm_mb_bswap128(tag), ej0);
+
+        gcm_mb_store_partial(job->auth_tag_output, tag,
+                             job->auth_tag_output_len_in_bytes);
+
+#ifdef SAFE_DATA
+        clear_mem(blocks, sizeof(blocks));
+        clear_mem(&args->enc_j0[lane], sizeof(args->enc_j0[lane]));
+        clear_mem(&args->tag[lane], sizeof(args->tag[lane]));
+        clear_mem(&args->ctr[lane], sizeof(args->ctr[lane]));
+#endif
+        job->status |= IMB_STATUS_COMPLETED;
+
+        return job;
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_aes_gcm(MB_MGR_GCM_OOO *state, IMB_JOB *job,
+                         const unsigned max_jobs, const int is_submit,
+                         const unsigned nrounds)
+{
+        unsigned lanes[16];
+        unsigned i, num_lanes = 0, min_idx;
+        uint64_t min_len;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                state->args.in[lane] =
+                        job->src + job->cipher_start_src_offset_in_bytes;
+                state->args.out[lane] = job->dst;
+                if (job->cipher_direction == IMB_DIR_ENCRYPT)
+                        state->args.keys[lane] = job->enc_keys;
+                else
+                        state->args.keys[lane] = job->dec_keys;
+                state->lens[lane] = job->msg_len_to_cipher_in_bytes;
+                state->init_done[lane] = 0;
+
+                /* enough jobs to start processing? */
+                if (state->num_lanes_inuse != max_jobs)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* collect lanes in use and set up the new ones */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                if (!state->init_done[i])
+                        gcm_mb_init_lane(state, i, nrounds);
+                lanes[num_lanes++] = i;
+        }
+
+        /* find min common length to process */
+        min_idx = lanes[0];
+        min_len = state->lens[min_idx];
+        for (i = 1; i < num_lanes; i++) {
+                if (min_len > state->lens[lanes[i]]) {
+                        min_idx = lanes[i];
+                        min_len = state->lens[min_idx];
+                }
+        }
+
+        /* process full blocks of all lanes in parallel */
+        if (min_len >= 16) {
+                const uint64_t num_blocks = min_len / 16;
+
+                gcm_mb_ctr_ghash(state, lanes, num_lanes, num_blocks, nrounds);
+                for (i = 0; i < num_lanes; i++)
+                        state->lens[lanes[i]] -= num_blocks * 16;
+        }
+
+        job = gcm_mb_finalize_lane(state, min_idx, nrounds);
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch AES-GCM MB API.
+ * The arch file defines NUM_GCM_LANES and the function names below
+ * before including this header.
+ */
+#ifdef SUBMIT_JOB_AES128_GCM
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES128_GCM(MB_MGR_GCM_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_gcm(state, job, NUM_GCM_LANES, 1, 10);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES128_GCM(MB_MGR_GCM_OOO *state)
+{
+        return submit_flush_job_aes_gcm(state, NULL, NUM_GCM_LANES, 0, 10);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES192_GCM(MB_MGR_GCM_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_gcm(state, job, NUM_GCM_LANES, 1, 12);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES192_GCM(MB_MGR_GCM_OOO *state)
+{
+        return submit_flush_job_aes_gcm(state, NULL, NUM_GCM_LANES, 0, 12);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_AES256_GCM(MB_MGR_GCM_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_aes_gcm(state, job, NUM_GCM_LANES, 1, 14);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_AES256_GCM(MB_MGR_GCM_OOO *state)
+{
+        return submit_flush_job_aes_gcm(state, NULL, NUM_GCM_LANES, 0, 14);
+}
+
+#endif /* SUBMIT_JOB_AES128_GCM */
+
+#endif /* GCM_MB_MGR_H */
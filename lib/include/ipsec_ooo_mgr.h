@@ -65,6 +65,59 @@
 #define SSE_NUM_SHA512_LANES AVX_NUM_SHA512_LANES
 #define SSE_NUM_MD5_LANES    AVX_NUM_MD5_LANES
 
+#define AVX2_NUM_GCM_LANES   8
+#define AVX_NUM_GCM_LANES    8
+#define SSE_NUM_GCM_LANES    4
+
+/*
+ * Longest AES-GCM message (in bytes) scheduled on the multi-buffer
+ * manager. Longer messages are processed by the single buffer code.
+ */
+#define GCM_MB_MAX_MSG_LEN   256
+
+#define AVX512_NUM_CHACHA20_LANES 16
+#define AVX2_NUM_CHACHA20_LANES   8
+#define AVX_NUM_CHACHA20_LANES    4
+#define SSE_NUM_CHACHA20_LANES    4
+
+/*
+ * Longest ChaCha20, ChaCha20-Poly1305 and Poly1305 message (in bytes)
+ * scheduled on the multi-buffer manager.
+ * Longer messages are processed by the single buffer code.
+ */
+#define CHACHA20_POLY1305_MB_MAX_MSG_LEN 256
+
+#define AVX512_NUM_KASUMI_LANES 16
+
+#define AVX512_NUM_SNOW_V_LANES 16
+#define AVX2_NUM_SNOW_V_LANES   8
+
+#define AVX512_NUM_XTS_LANES 16
+#define AVX2_NUM_XTS_LANES   8
+#define AVX_NUM_XTS_LANES    8
+#define SSE_NUM_XTS_LANES    8
+
+#define AVX_NUM_CFB_LANES    8
+#define SSE_NUM_CFB_LANES    8
+
+#define AVX_NUM_DES_LANES    8
+#define SSE_NUM_DES_LANES    4
+
+#define AVX_NUM_CTR_CMAC_LANES 8
+#define SSE_NUM_CTR_CMAC_LANES 4
+
+#define AVX512_NUM_CRC_LANES 16
+#define AVX_NUM_CRC_LANES    8
+#define SSE_NUM_CRC_LANES    4
+
+/*
+ * AVX512 CRC manager message length range in bytes; jobs outside of it
+ * go to the single buffer VPCLMULQDQ kernels. This is the short message
+ * range the manager was written for, not a measured crossover point.
+ */
+#define AVX512_CRC_MB_MIN_LEN 10
+#define AVX512_CRC_MB_MAX_LEN 200
+
 /*
  * Each row is sized to hold enough lanes for AVX2, AVX1 and SSE use a subset
  * of each row. Thus one row is not adjacent in memory to its neighboring rows
@@ -220,6 +273,10 @@ typedef struct {
         DECLARE_ALIGNED(imb_uint128_t crc_init[16], 64);
         DECLARE_ALIGNED(uint16_t crc_len[16], 16);
         DECLARE_ALIGNED(uint8_t crc_done[16], 16);
+        /* jobs with the residual CFB block already processed,
+         * waiting in their lane to be returned
+         */
+        IMB_JOB *residual_done[16];
         uint64_t road_block;
 } MB_MGR_DOCSIS_AES_OOO;
 
@@ -257,6 +314,217 @@ typedef struct {
         uint64_t road_block;
 } MB_MGR_CCM_OOO;
 
+/* AES-GCM multi-buffer arguments */
+typedef struct {
+        const uint8_t *in[16];
+        uint8_t *out[16];
+        const struct gcm_key_data *keys[16];
+        DECLARE_ALIGNED(imb_uint128_t ctr[16], 16);
+        DECLARE_ALIGNED(imb_uint128_t tag[16], 16);
+        DECLARE_ALIGNED(imb_uint128_t enc_j0[16], 16);
+} GCM_ARGS;
+
+/* AES-GCM out-of-order scheduler structure */
+typedef struct {
+        GCM_ARGS args;
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        DECLARE_ALIGNED(uint16_t init_done[16], 32);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_GCM_OOO;
+
+/* ChaCha20 and Poly1305 multi-buffer arguments */
+typedef struct {
+        const uint8_t *in[16];
+        uint8_t *out[16];
+        /* ChaCha20 state, word major: state[word][lane] */
+        DECLARE_ALIGNED(uint32_t state[16][16], 64);
+        /* Poly1305 state in 26-bit limbs */
+        uint32_t poly_r[16][5];
+        uint32_t poly_s[16][4];
+        uint32_t poly_h[16][5];
+} CHACHA20_POLY1305_ARGS;
+
+/* ChaCha20, ChaCha20-Poly1305 and Poly1305 out-of-order scheduler structure */
+typedef struct {
+        CHACHA20_POLY1305_ARGS args;
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        DECLARE_ALIGNED(uint16_t init_done[16], 32);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_CHACHA20_POLY1305_OOO;
+
+/* KASUMI F8/F9 multi-buffer arguments */
+typedef struct {
+        const uint8_t *in[16];
+        uint8_t *out[16];
+        const kasumi_key_sched_t *keys[16];
+        /* key schedules of the lanes, transposed: ks[word][lane] */
+        DECLARE_ALIGNED(uint16_t ks[KASUMI_KEY_SCHEDULE_SIZE][16], 64);
+        /* KASUMI input/output block of each lane */
+        DECLARE_ALIGNED(uint64_t blk[16], 64);
+        /* F8: modified IV (A), F9: running MAC value (B) */
+        uint64_t acc[16];
+        uint64_t bytes_left[16];
+        uint32_t blk_cnt[16];
+} KASUMI_ARGS;
+
+/* KASUMI F8/F9 out-of-order scheduler structure */
+typedef struct {
+        KASUMI_ARGS args;
+        /* number of KASUMI blocks left to process in each lane */
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        DECLARE_ALIGNED(uint16_t init_done[16], 32);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_KASUMI_OOO;
+
+/*
+ * SNOW-V state of 4 streams (one stream per 128-bit lane of each row),
+ * as used by the 4-stream VAES SNOW-V engines
+ */
+typedef struct {
+        DECLARE_ALIGNED(imb_uint128_t lfsr_a_lo[4], 64);
+        imb_uint128_t lfsr_a_hi[4];
+        imb_uint128_t lfsr_b_lo[4];
+        imb_uint128_t lfsr_b_hi[4];
+        imb_uint128_t fsm_r1[4];
+        imb_uint128_t fsm_r2[4];
+        imb_uint128_t fsm_r3[4];
+} SNOW_V_X4_STATE;
+
+/* SNOW-V and SNOW-V-AEAD multi-buffer arguments */
+typedef struct {
+        const uint8_t *in[16];
+        uint8_t *out[16];
+        /* lane N state is stream (N % 4) of state[N / 4] */
+        SNOW_V_X4_STATE state[4];
+        /* SNOW-V-AEAD: GHASH key and tag mask of each lane */
+        imb_uint128_t hkey_endpad[16][2];
+} SNOW_V_ARGS;
+
+/* SNOW-V and SNOW-V-AEAD out-of-order scheduler structure */
+typedef struct {
+        SNOW_V_ARGS args;
+        /* number of bytes left to process in each lane */
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        DECLARE_ALIGNED(uint16_t init_done[16], 32);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_SNOW_V_OOO;
+
+/* AES-XTS multi-buffer arguments */
+typedef struct {
+        const uint8_t *in[16];
+        uint8_t *out[16];
+        const void *keys[16];
+        /* tweaks of the next 4 blocks of each lane (T x alpha^0...3) */
+        DECLARE_ALIGNED(imb_uint128_t tweak[16][4], 64);
+} AES_XTS_ARGS;
+
+/* AES-XTS out-of-order scheduler structure */
+typedef struct {
+        AES_XTS_ARGS args;
+        /* number of full blocks left for the kernel in each lane */
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_AES_XTS_OOO;
+
+/* AES-CFB encrypt out-of-order scheduler structure */
+typedef struct {
+        /* IV field holds the feedback (last cipher-text) block of each lane */
+        AES_ARGS args;
+        /* number of full blocks left for the kernel in each lane */
+        DECLARE_ALIGNED(uint64_t lens[16], 16);
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_AES_CFB_OOO;
+
+/* Stitched AES-CBC/CTR + HMAC-SHA1/SHA256 out-of-order structure */
+typedef struct {
+        /* multi-buffer SHA kernel arguments (inner hash) */
+        union {
+                SHA1_ARGS sha1;
+                SHA256_ARGS sha256;
+        } args;
+        /*
+         * AES state: in-place cipher pointer, keys and
+         * CBC chaining block or CTR counter block
+         */
+        DECLARE_ALIGNED(imb_uint128_t iv[16], 16);
+        uint8_t *cipher_ptr[16];
+        const void *keys[16];
+        uint32_t nrounds[16];
+        /* number of cipher bytes left to process in each lane */
+        uint64_t cipher_len[16];
+        /* set if the lane ciphers behind the hash (hash-then-cipher) */
+        uint8_t cipher_lag[16];
+        /* number of full hash blocks left in each lane */
+        uint64_t lens[16];
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_AES_CBC_HMAC_OOO;
+
+/* Stitched AES-CTR + AES-CMAC out-of-order structure */
+typedef struct {
+        /* AES-CTR counter blocks and AES-CMAC chaining blocks */
+        DECLARE_ALIGNED(imb_uint128_t ctr[16], 16);
+        DECLARE_ALIGNED(imb_uint128_t mac[16], 16);
+        const uint8_t *hash_ptr[16];
+        uint8_t *cipher_ptr[16];
+        const void *keys[16];
+        uint32_t nrounds[16];
+        /* number of cipher bytes left to process in each lane */
+        uint64_t cipher_len[16];
+        /* number of CMAC blocks left in each lane, without the last one */
+        uint64_t lens[16];
+        /* set if the lane ciphers behind the hash (hash-then-cipher) */
+        uint8_t cipher_lag[16];
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_AES_CTR_CMAC_OOO;
+
+/* CRC (IMB_AUTH_CRC*) out-of-order structure */
+typedef struct {
+        /* 128-bit CRC remainders, one per lane */
+        DECLARE_ALIGNED(imb_uint128_t fold[16], 16);
+        const uint8_t *data_ptr[16];
+        /* number of 16-byte blocks left to fold in each lane */
+        uint64_t lens[16];
+        /* CRC type of each lane, hash_alg - IMB_AUTH_CRC32_ETHERNET_FCS */
+        uint8_t type[16];
+        /* each nibble is index (0...15) of unused lanes */
+        uint64_t unused_lanes;
+        IMB_JOB *job_in_lane[16];
+        uint64_t num_lanes_inuse;
+        uint64_t road_block;
+} MB_MGR_CRC_OOO;
+
 
 /* AES-CMAC out-of-order scheduler structure */
 typedef struct {
@@ -388,7 +656,8 @@ typedef struct {
         DECLARE_ALIGNED(uint16_t lens[AVX512_NUM_MD5_LANES], 16);
         /*
          * In the avx2 case, all 16 nibbles of unused lanes are used.
-         * In that case num_lanes_inuse is used to detect the end of the list
+         * In that case num_lanes_inuse is used to detect the end of the list.
+         * In the avx512 case, unused_lanes is a bitmask of free lanes.
          */
         uint64_t unused_lanes;
         HMAC_SHA1_LANE_DATA ldata[AVX512_NUM_MD5_LANES];
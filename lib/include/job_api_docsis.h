@@ -27,6 +27,7 @@
 
 #include "intel-ipsec-mb.h"
 #include "include/docsis_common.h"
+#include "include/mb_mgr_stats.h"
 
 #ifndef JOB_API_DOCSIS_H
 #define JOB_API_DOCSIS_H
@@ -40,24 +41,30 @@ submit_docsis_enc_job(IMB_MGR *state, IMB_JOB *job)
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_crc32_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS128_SEC_CRC_ENC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state,
+                                docsis128_crc32_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS128_SEC_CRC_ENC(p_ooo, job));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS128_SEC_ENC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state, docsis128_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS128_SEC_ENC(p_ooo, job));
                 }
         } else { /* 32 */
                 if (job->hash_alg == IMB_AUTH_DOCSIS_CRC32) {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_crc32_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS256_SEC_CRC_ENC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state,
+                                docsis256_crc32_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS256_SEC_CRC_ENC(p_ooo, job));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS256_SEC_ENC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state, docsis256_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS256_SEC_ENC(p_ooo, job));
                 }
         }
 }
@@ -71,24 +78,28 @@ flush_docsis_enc_job(IMB_MGR *state, IMB_JOB *job)
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_crc32_sec_ooo;
 
-                        return FLUSH_JOB_DOCSIS128_SEC_CRC_ENC(p_ooo);
+                        return OOO_STATS_FLUSH(state, docsis128_crc32_sec_ooo,
+                                FLUSH_JOB_DOCSIS128_SEC_CRC_ENC(p_ooo));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_sec_ooo;
 
-                        return FLUSH_JOB_DOCSIS128_SEC_ENC(p_ooo);
+                        return OOO_STATS_FLUSH(state, docsis128_sec_ooo,
+                                FLUSH_JOB_DOCSIS128_SEC_ENC(p_ooo));
                 }
         } else { /* 32 */
                 if (job->hash_alg == IMB_AUTH_DOCSIS_CRC32) {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_crc32_sec_ooo;
 
-                        return FLUSH_JOB_DOCSIS256_SEC_CRC_ENC(p_ooo);
+                        return OOO_STATS_FLUSH(state, docsis256_crc32_sec_ooo,
+                                FLUSH_JOB_DOCSIS256_SEC_CRC_ENC(p_ooo));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_sec_ooo;
 
-                        return FLUSH_JOB_DOCSIS256_SEC_ENC(p_ooo);
+                        return OOO_STATS_FLUSH(state, docsis256_sec_ooo,
+                                FLUSH_JOB_DOCSIS256_SEC_ENC(p_ooo));
                 }
         }
 }
@@ -102,24 +113,30 @@ submit_docsis_dec_job(IMB_MGR *state, IMB_JOB *job)
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_crc32_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS128_SEC_CRC_DEC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state,
+                                docsis128_crc32_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS128_SEC_CRC_DEC(p_ooo, job));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis128_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS128_SEC_DEC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state, docsis128_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS128_SEC_DEC(p_ooo, job));
                 }
         } else { /* 32 */
                 if (job->hash_alg == IMB_AUTH_DOCSIS_CRC32) {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_crc32_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS256_SEC_CRC_DEC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state,
+                                docsis256_crc32_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS256_SEC_CRC_DEC(p_ooo, job));
                 } else {
                         MB_MGR_DOCSIS_AES_OOO *p_ooo =
                                 state->docsis256_sec_ooo;
 
-                        return SUBMIT_JOB_DOCSIS256_SEC_DEC(p_ooo, job);
+                        return OOO_STATS_SUBMIT(state, docsis256_sec_ooo, job,
+                                SUBMIT_JOB_DOCSIS256_SEC_DEC(p_ooo, job));
                 }
         }
 }
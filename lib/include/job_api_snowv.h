@@ -30,37 +30,26 @@
 #ifndef JOB_API_SNOWV_H
 #define JOB_API_SNOWV_H
 
+/*
+ * Computes SNOW-V-AEAD authentication tag of the job
+ * from the GHASH key and the tag mask (hkey_endpad)
+ */
 __forceinline
-IMB_JOB *
-submit_snow_v_aead_job(IMB_MGR *state, IMB_JOB *job)
+void
+snow_v_aead_auth_tag(IMB_MGR *state, IMB_JOB *job,
+                     const imb_uint128_t *hkey_endpad)
 {
         struct gcm_key_data gdata_key;
         imb_uint128_t *auth = (imb_uint128_t *) job->auth_tag_output;
         imb_uint128_t temp;
-        imb_uint128_t hkey_endpad[2];
 
         temp.low = BSWAP64((job->u.SNOW_V_AEAD.aad_len_in_bytes << 3));
         temp.high = BSWAP64((job->msg_len_to_cipher_in_bytes << 3));
 
-        /* if hkey_endpad[1].high == 0:
-         *      SUBMIT_JOB_SNOW_V_AEAD does enc/decrypt operation
-         *      and fills hkey_endpad with first 2 keystreams
-         * else
-         *      SUBMIT_JOB_SNOW_V_AEAD fills hkey_endpad with first
-         *      2 keystreams (no operations on src vector are done)
-         */
-        if(job->cipher_direction == IMB_DIR_ENCRYPT)
-                hkey_endpad[1].high = 0;
-        else
-                hkey_endpad[1].high = 1;
-
-        job->u.SNOW_V_AEAD.reserved = hkey_endpad;
-        job = SUBMIT_JOB_SNOW_V_AEAD(job);
-
         memset(auth, 0, sizeof(imb_uint128_t));
 
         /* GHASH key H */
-        IMB_GHASH_PRE(state, (void *)hkey_endpad,  &gdata_key);
+        IMB_GHASH_PRE(state, (const void *)hkey_endpad,  &gdata_key);
 
         /* push AAD into GHASH */
         IMB_GHASH(state, &gdata_key, job->u.SNOW_V_AEAD.aad,
@@ -82,6 +71,30 @@ submit_snow_v_aead_job(IMB_MGR *state, IMB_JOB *job)
         /* The resulting AuthTag */
         auth->low = auth->low ^ hkey_endpad[1].low;
         auth->high = auth->high ^ hkey_endpad[1].high;
+}
+
+__forceinline
+IMB_JOB *
+submit_snow_v_aead_job(IMB_MGR *state, IMB_JOB *job)
+{
+        imb_uint128_t hkey_endpad[2];
+
+        /* if hkey_endpad[1].high == 0:
+         *      SUBMIT_JOB_SNOW_V_AEAD does enc/decrypt operation
+         *      and fills hkey_endpad with first 2 keystreams
+         * else
+         *      SUBMIT_JOB_SNOW_V_AEAD fills hkey_endpad with first
+         *      2 keystreams (no operations on src vector are done)
+         */
+        if(job->cipher_direction == IMB_DIR_ENCRYPT)
+                hkey_endpad[1].high = 0;
+        else
+                hkey_endpad[1].high = 1;
+
+        job->u.SNOW_V_AEAD.reserved = hkey_endpad;
+        job = SUBMIT_JOB_SNOW_V_AEAD(job);
+
+        snow_v_aead_auth_tag(state, job, hkey_endpad);
 
         if (job->cipher_direction == IMB_DIR_DECRYPT) {
                 hkey_endpad[1].high = 0;
@@ -0,0 +1,179 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * Completion ring of the job API (see imb_set_completion_mode()).
+ *
+ * In IMB_COMPLETION_MODE_OUT_OF_ORDER, pointers to completed jobs of the
+ * job ring are queued in completed_ring, in completion order. A job ring
+ * slot is released (earliest_job advanced over it) only once its job has
+ * been handed back, tracked with job_delivered. Burst jobs are not part
+ * of the job ring and are ignored.
+ *
+ * When the job ring is full, the earliest job is handed back by
+ * submit_job() directly. Its completion ring entry (found through
+ * completed_pos) is cleared instead of shifting the ring, and cleared
+ * entries are skipped by the read index. The read index always points
+ * to a queued job, which holds a job ring slot, so the ring never holds
+ * more than twice job_ring_size entries: jobs of the job ring plus jobs
+ * released since the entry at the read index was queued.
+ */
+
+#ifndef JOB_COMPLETION_H
+#define JOB_COMPLETION_H
+
+#include <string.h> /* memset() */
+#include "intel-ipsec-mb.h"
+
+__forceinline
+uint32_t completion_ring_mask(const IMB_MGR *state)
+{
+        return 2 * state->job_ring_size - 1;
+}
+
+__forceinline
+void completion_ring_reset(IMB_MGR *state)
+{
+        state->completed_head = 0;
+        state->completed_tail = 0;
+        if (state->job_delivered != NULL)
+                memset(state->job_delivered, 0, state->job_ring_size);
+}
+
+/* 1 if the job belongs to the job ring, 0 for a burst job */
+__forceinline
+int completion_is_ring_job(const IMB_MGR *state, const IMB_JOB *job)
+{
+        return job >= state->job_ring &&
+                job < &state->job_ring[state->job_ring_size];
+}
+
+/* Delivered flag of the job at given byte offset of the job ring */
+__forceinline
+uint8_t *completion_job_delivered(IMB_MGR *state, const int offset)
+{
+        return &state->job_delivered[offset / sizeof(IMB_JOB)];
+}
+
+/* Queues a completed job or hands it to the registered callback */
+__forceinline
+void completion_ring_push(IMB_MGR *state, IMB_JOB *job)
+{
+        const uint32_t mask = completion_ring_mask(state);
+
+        if (state->completion_mode != IMB_COMPLETION_MODE_OUT_OF_ORDER ||
+            job == NULL)
+                return;
+
+        /* burst jobs are returned by the burst API */
+        if (!completion_is_ring_job(state, job))
+                return;
+
+        if (state->completion_cb != NULL) {
+                state->job_delivered[job - state->job_ring] = 1;
+                state->completion_cb(job, state->completion_cb_arg);
+                return;
+        }
+
+        state->completed_pos[job - state->job_ring] = state->completed_tail;
+        state->completed_ring[state->completed_tail & mask] = job;
+        state->completed_tail++;
+}
+
+/* Skips cleared entries at the read index of the completion ring */
+__forceinline
+void completion_ring_skip_cleared(IMB_MGR *state)
+{
+        const uint32_t mask = completion_ring_mask(state);
+
+        while (state->completed_head != state->completed_tail &&
+               state->completed_ring[state->completed_head & mask] == NULL)
+                state->completed_head++;
+}
+
+/*
+ * Removes a job from the completion ring,
+ * used when the job ring is full and the earliest job is returned
+ */
+__forceinline
+void completion_ring_remove(IMB_MGR *state, const IMB_JOB *job)
+{
+        const uint32_t mask = completion_ring_mask(state);
+        const uint32_t pos = state->completed_pos[job - state->job_ring];
+
+        /* entry is queued if it is in [head, tail) and points to the job */
+        if ((pos - state->completed_head) >=
+            (state->completed_tail - state->completed_head) ||
+            state->completed_ring[pos & mask] != job)
+                return;
+
+        state->completed_ring[pos & mask] = NULL;
+        completion_ring_skip_cleared(state);
+}
+
+/* Releases job ring slots of handed back jobs, from the earliest one */
+__forceinline
+void completion_ring_release(IMB_MGR *state)
+{
+        while (state->earliest_job >= 0) {
+                uint8_t *delivered =
+                        completion_job_delivered(state, state->earliest_job);
+
+                if (*delivered == 0)
+                        break;
+
+                *delivered = 0;
+                state->earliest_job += sizeof(IMB_JOB);
+                if (state->earliest_job >=
+                    (int) (state->job_ring_size * sizeof(IMB_JOB)))
+                        state->earliest_job = 0;
+
+                if (state->earliest_job == state->next_job)
+                        state->earliest_job = -1; /* becomes empty */
+        }
+}
+
+/* Hands back the next job of the completion ring, NULL if empty */
+__forceinline
+IMB_JOB *completion_ring_pop(IMB_MGR *state)
+{
+        const uint32_t mask = completion_ring_mask(state);
+        IMB_JOB *job;
+
+        if (state->completed_head == state->completed_tail)
+                return NULL;
+
+        job = state->completed_ring[state->completed_head & mask];
+        state->completed_head++;
+        completion_ring_skip_cleared(state);
+        state->job_delivered[job - state->job_ring] = 1;
+        completion_ring_release(state);
+
+        return job;
+}
+
+#endif /* JOB_COMPLETION_H */
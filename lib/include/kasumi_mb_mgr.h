@@ -0,0 +1,302 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*
+ * KASUMI F8 (UEA1) and F9 (UIA1) multi-buffer implementation.
+ *
+ * Up to 16 independent jobs (each with its own key) are processed
+ * in parallel, one 64-bit KASUMI block per lane at a time.
+ * Key schedules of the lanes are kept word major, so that the
+ * multi-lane KASUMI engine can load one subkey of all lanes at once.
+ *
+ * Each lane goes through (1 + number of message blocks) KASUMI operations:
+ * - F8 starts with the IV encryption under the modified key (msk16)
+ * - F9 ends with the MAC encryption under the modified key (msk16)
+ * All other operations use the key schedule (sk16).
+ */
+
+#ifndef KASUMI_MB_MGR_H
+#define KASUMI_MB_MGR_H
+
+#include <string.h>
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/wireless_common.h"
+#include "include/clear_regs_mem.h"
+
+/* Type of jobs scheduled on the manager */
+#define KASUMI_MB_F8    0
+#define KASUMI_MB_F9    1
+
+/* Multi-lane KASUMI block encryption: ks[64][16] and blk[16] */
+typedef void (*kasumi_mb_kernel_t)(const uint16_t *, uint64_t *);
+
+__forceinline
+void kasumi_mb_set_lane_key(KASUMI_ARGS *args, const unsigned lane,
+                            const uint16_t *ks)
+{
+        unsigned i;
+
+        for (i = 0; i < KASUMI_KEY_SCHEDULE_SIZE; i++)
+                args->ks[i][lane] = ks[i];
+}
+
+/*
+ * Reads up to 8 bytes of the message as a big endian 64-bit value
+ * (missing bytes are zero)
+ */
+__forceinline
+uint64_t kasumi_mb_load_be64(const uint8_t *in, const uint64_t len)
+{
+        uint64_t v = 0;
+
+        memcpy(&v, in, (len < IMB_KASUMI_BLOCK_SIZE) ?
+               len : IMB_KASUMI_BLOCK_SIZE);
+        return BSWAP64(v);
+}
+
+/*
+ * Prepares the KASUMI input block of the lane (F9 only,
+ * F8 input blocks are produced by the previous operation)
+ */
+__forceinline
+void kasumi_mb_pre_lane(MB_MGR_KASUMI_OOO *state, const unsigned lane,
+                        const unsigned type)
+{
+        KASUMI_ARGS *args = &state->args;
+
+        if (type != KASUMI_MB_F9)
+                return;
+
+        if (state->lens[lane] == 1) {
+                /* last operation: encrypt B with the modified key */
+                kasumi_mb_set_lane_key(args, lane, args->keys[lane]->msk16);
+                args->blk[lane] = args->acc[lane];
+        } else
+                /* A ^= message block (zero padded) */
+                args->blk[lane] ^= kasumi_mb_load_be64(args->in[lane],
+                                                       args->bytes_left[lane]);
+}
+
+/*
+ * Consumes the KASUMI output block of the lane
+ */
+__forceinline
+void kasumi_mb_post_lane(MB_MGR_KASUMI_OOO *state, const unsigned lane,
+                         const unsigned type)
+{
+        KASUMI_ARGS *args = &state->args;
+        const uint64_t len = (args->bytes_left[lane] < IMB_KASUMI_BLOCK_SIZE) ?
+                args->bytes_left[lane] : IMB_KASUMI_BLOCK_SIZE;
+
+        if (type == KASUMI_MB_F9) {
+                if (state->lens[lane] != 1) {
+                        /* B ^= A */
+                        args->acc[lane] ^= args->blk[lane];
+                        args->in[lane] += len;
+                        args->bytes_left[lane] -= len;
+                }
+                return;
+        }
+
+        if (state->init_done[lane] == 0) {
+                /* A = KASUMI[CK ^ KM](IV), first keystream input is A */
+                args->acc[lane] = args->blk[lane];
+                args->blk_cnt[lane] = 0;
+                kasumi_mb_set_lane_key(args, lane, args->keys[lane]->sk16);
+                state->init_done[lane] = 1;
+                return;
+        }
+
+        /* out = in ^ keystream block (big endian) */
+        {
+                const uint64_t ks = BSWAP64(args->blk[lane]);
+                const uint8_t *ks8 = (const uint8_t *) &ks;
+                uint64_t i;
+
+                for (i = 0; i < len; i++)
+                        args->out[lane][i] = args->in[lane][i] ^ ks8[i];
+        }
+        args->in[lane] += len;
+        args->out[lane] += len;
+        args->bytes_left[lane] -= len;
+
+        /* next keystream input: KS(n) ^ A ^ n */
+        args->blk[lane] ^= args->acc[lane];
+        args->blk[lane] ^= (uint16_t) ++args->blk_cnt[lane];
+}
+
+__forceinline
+IMB_JOB *kasumi_mb_complete_lane(MB_MGR_KASUMI_OOO *state, const unsigned lane,
+                                 const unsigned type)
+{
+        KASUMI_ARGS *args = &state->args;
+        IMB_JOB *job = state->job_in_lane[lane];
+
+        if (type == KASUMI_MB_F9) {
+                const uint32_t digest =
+                        BSWAP32((uint32_t) (args->blk[lane] >> 32));
+
+                memcpy(job->auth_tag_output, &digest, sizeof(digest));
+                job->status |= IMB_STATUS_COMPLETED_AUTH;
+        } else
+                job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+#ifdef SAFE_DATA
+        {
+                unsigned i;
+
+                /* clear the key schedule and the state from the lane */
+                for (i = 0; i < KASUMI_KEY_SCHEDULE_SIZE; i++)
+                        args->ks[i][lane] = 0;
+                args->blk[lane] = 0;
+                args->acc[lane] = 0;
+        }
+#endif
+        return job;
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_kasumi(MB_MGR_KASUMI_OOO *state, IMB_JOB *job,
+                        const unsigned max_jobs, const int is_submit,
+                        const unsigned type, const kasumi_mb_kernel_t kernel)
+{
+        KASUMI_ARGS *args = &state->args;
+        unsigned lanes[16];
+        unsigned i, num_lanes = 0, min_idx;
+        uint64_t min_len;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                if (type == KASUMI_MB_F9) {
+                        const kasumi_key_sched_t *key =
+                                (const kasumi_key_sched_t *)
+                                job->u.KASUMI_UIA1._key;
+                        const uint64_t len = job->msg_len_to_hash_in_bytes;
+
+                        args->keys[lane] = key;
+                        args->in[lane] =
+                                job->src + job->hash_start_src_offset_in_bytes;
+                        args->bytes_left[lane] = len;
+                        kasumi_mb_set_lane_key(args, lane, key->sk16);
+                        /* A = B = 0 */
+                        args->blk[lane] = 0;
+                        args->acc[lane] = 0;
+                        state->lens[lane] =
+                                ((len + IMB_KASUMI_BLOCK_SIZE - 1) /
+                                 IMB_KASUMI_BLOCK_SIZE) + 1;
+                } else {
+                        const kasumi_key_sched_t *key =
+                                (const kasumi_key_sched_t *) job->enc_keys;
+                        const uint64_t offset =
+                                job->cipher_start_src_offset_in_bits / 8;
+                        const uint64_t len =
+                                job->msg_len_to_cipher_in_bits / 8;
+                        uint64_t iv;
+
+                        memcpy(&iv, job->iv, sizeof(iv));
+                        args->keys[lane] = key;
+                        args->in[lane] = job->src + offset;
+                        args->out[lane] = job->dst + offset;
+                        args->bytes_left[lane] = len;
+                        kasumi_mb_set_lane_key(args, lane, key->msk16);
+                        args->blk[lane] = BSWAP64(iv);
+                        state->lens[lane] =
+                                ((len + IMB_KASUMI_BLOCK_SIZE - 1) /
+                                 IMB_KASUMI_BLOCK_SIZE) + 1;
+                }
+                state->init_done[lane] = 0;
+
+                /* enough jobs to start processing? */
+                if (state->num_lanes_inuse != max_jobs)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* collect lanes in use */
+        for (i = 0; i < max_jobs; i++)
+                if (state->job_in_lane[i] != NULL)
+                        lanes[num_lanes++] = i;
+
+        /* find min common length to process */
+        min_idx = lanes[0];
+        min_len = state->lens[min_idx];
+        for (i = 1; i < num_lanes; i++) {
+                if (min_len > state->lens[lanes[i]]) {
+                        min_idx = lanes[i];
+                        min_len = state->lens[min_idx];
+                }
+        }
+
+        /*
+         * Run KASUMI on all lanes in parallel, until the shortest job
+         * is complete. Unused lanes are processed too, their results
+         * are ignored.
+         */
+        while (min_len--) {
+                for (i = 0; i < num_lanes; i++)
+                        kasumi_mb_pre_lane(state, lanes[i], type);
+
+                kernel(&args->ks[0][0], args->blk);
+
+                for (i = 0; i < num_lanes; i++) {
+                        const unsigned lane = lanes[i];
+
+                        kasumi_mb_post_lane(state, lane, type);
+                        state->lens[lane]--;
+                }
+        }
+
+        job = kasumi_mb_complete_lane(state, min_idx, type);
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+        return job;
+}
+
+#endif /* KASUMI_MB_MGR_H */
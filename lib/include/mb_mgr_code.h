@@ -40,11 +40,18 @@
  */
 
 #include <string.h> /* memcpy(), memset() */
+#ifdef LINUX
+#include <x86intrin.h> /* __rdtsc() */
+#else
+#include <intrin.h> /* __rdtsc() */
+#endif
 
 #include "include/clear_regs_mem.h"
 #include "include/des.h"
 #include "intel-ipsec-mb.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 #include "include/snow3g_submit.h"
 #include "include/job_api_gcm.h"
 #include "include/job_api_snowv.h"
@@ -67,19 +74,26 @@
 __forceinline
 IMB_JOB *JOBS(IMB_MGR *state, const int offset)
 {
-        char *cp = (char *)state->jobs;
+        char *cp = (char *)state->job_ring;
 
         return (IMB_JOB *)(cp + offset);
 }
 
 __forceinline
-void ADV_JOBS(int *ptr)
+void ADV_JOBS(IMB_MGR *state, int *ptr)
 {
         *ptr += sizeof(IMB_JOB);
-        if (*ptr >= (int) (IMB_MAX_JOBS * sizeof(IMB_JOB)))
+        if (*ptr >= (int) (state->job_ring_size * sizeof(IMB_JOB)))
                 *ptr = 0;
 }
 
+/* Submit time stamp of the job at given byte offset of the ring */
+__forceinline
+uint64_t *JOB_TSC(IMB_MGR *state, const int offset)
+{
+        return &state->job_tsc[offset / sizeof(IMB_JOB)];
+}
+
 /* ========================================================================= */
 /* Lower level "out of order" schedulers */
 /* ========================================================================= */
@@ -273,6 +287,543 @@ FLUSH_JOB_CUSTOM_HASH(IMB_JOB *job)
         return JOB_CUSTOM_HASH(job);
 }
 
+/* ========================================================================= */
+/* AES-GCM multi-buffer */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_AES128_GCM
+__forceinline
+IMB_JOB *
+submit_job_aes_gcm_sb(IMB_MGR *state, IMB_JOB *job)
+{
+        if (job->cipher_direction == IMB_DIR_ENCRYPT)
+                return SUBMIT_JOB_AES_GCM_ENC(state, job);
+        else
+                return SUBMIT_JOB_AES_GCM_DEC(state, job);
+}
+
+__forceinline
+IMB_JOB *
+submit_job_aes_gcm_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        /*
+         * Only jobs with 12-byte IV and short messages are scheduled
+         * on the multi-buffer manager (if allocated), the others are
+         * processed by the single buffer code straight away.
+         */
+        if (job->iv_len_in_bytes != 12 ||
+            job->msg_len_to_cipher_in_bytes > GCM_MB_MAX_MSG_LEN)
+                return submit_job_aes_gcm_sb(state, job);
+
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_GCM_OOO *aes128_gcm_ooo = state->aes128_gcm_ooo;
+
+                if (aes128_gcm_ooo == NULL)
+                        return submit_job_aes_gcm_sb(state, job);
+
+                return OOO_STATS_SUBMIT(state, aes128_gcm_ooo, job,
+                        SUBMIT_JOB_AES128_GCM(aes128_gcm_ooo, job));
+        } else if (24 == job->key_len_in_bytes) {
+                MB_MGR_GCM_OOO *aes192_gcm_ooo = state->aes192_gcm_ooo;
+
+                if (aes192_gcm_ooo == NULL)
+                        return submit_job_aes_gcm_sb(state, job);
+
+                return OOO_STATS_SUBMIT(state, aes192_gcm_ooo, job,
+                        SUBMIT_JOB_AES192_GCM(aes192_gcm_ooo, job));
+        } else { /* assume 32 */
+                MB_MGR_GCM_OOO *aes256_gcm_ooo = state->aes256_gcm_ooo;
+
+                if (aes256_gcm_ooo == NULL)
+                        return submit_job_aes_gcm_sb(state, job);
+
+                return OOO_STATS_SUBMIT(state, aes256_gcm_ooo, job,
+                        SUBMIT_JOB_AES256_GCM(aes256_gcm_ooo, job));
+        }
+}
+
+__forceinline
+IMB_JOB *
+flush_job_aes_gcm_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_GCM_OOO *aes128_gcm_ooo = state->aes128_gcm_ooo;
+
+                /* manager not allocated, jobs completed on submission */
+                if (aes128_gcm_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, aes128_gcm_ooo,
+                        FLUSH_JOB_AES128_GCM(aes128_gcm_ooo));
+        } else if (24 == job->key_len_in_bytes) {
+                MB_MGR_GCM_OOO *aes192_gcm_ooo = state->aes192_gcm_ooo;
+
+                if (aes192_gcm_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, aes192_gcm_ooo,
+                        FLUSH_JOB_AES192_GCM(aes192_gcm_ooo));
+        } else { /* assume 32 */
+                MB_MGR_GCM_OOO *aes256_gcm_ooo = state->aes256_gcm_ooo;
+
+                if (aes256_gcm_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, aes256_gcm_ooo,
+                        FLUSH_JOB_AES256_GCM(aes256_gcm_ooo));
+        }
+}
+#endif /* SUBMIT_JOB_AES128_GCM */
+
+/* ========================================================================= */
+/* ChaCha20, ChaCha20-Poly1305 and Poly1305 multi-buffer */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_CHACHA20_MB
+__forceinline
+IMB_JOB *
+submit_job_chacha20_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_CHACHA20_POLY1305_OOO *chacha20_ooo = state->chacha20_ooo;
+
+        /*
+         * Long messages are processed by the single buffer code,
+         * as are all messages if the manager is not allocated
+         */
+        if (chacha20_ooo == NULL ||
+            job->msg_len_to_cipher_in_bytes > CHACHA20_POLY1305_MB_MAX_MSG_LEN)
+                return SUBMIT_JOB_CHACHA20_ENC_DEC(job);
+
+        return OOO_STATS_SUBMIT(state, chacha20_ooo, job,
+                SUBMIT_JOB_CHACHA20_MB(chacha20_ooo, job));
+}
+
+__forceinline
+IMB_JOB *
+submit_job_chacha20_poly1305_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_CHACHA20_POLY1305_OOO *chacha20_poly1305_ooo =
+                state->chacha20_poly1305_ooo;
+
+        /*
+         * Only short messages, authenticated over the same buffer
+         * as the one being ciphered, are scheduled on the multi-buffer
+         * manager (if allocated), the others are processed by the single
+         * buffer code.
+         */
+        if (chacha20_poly1305_ooo == NULL ||
+            job->msg_len_to_cipher_in_bytes >
+            CHACHA20_POLY1305_MB_MAX_MSG_LEN ||
+            job->msg_len_to_hash_in_bytes != job->msg_len_to_cipher_in_bytes ||
+            job->hash_start_src_offset_in_bytes !=
+            job->cipher_start_src_offset_in_bytes)
+                return SUBMIT_JOB_CHACHA20_POLY1305(state, job);
+
+        return OOO_STATS_SUBMIT(state, chacha20_poly1305_ooo, job,
+                SUBMIT_JOB_CHACHA20_POLY1305_MB(chacha20_poly1305_ooo, job));
+}
+
+__forceinline
+IMB_JOB *
+submit_job_poly1305_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_CHACHA20_POLY1305_OOO *poly1305_ooo = state->poly1305_ooo;
+
+        if (poly1305_ooo == NULL ||
+            job->msg_len_to_hash_in_bytes > CHACHA20_POLY1305_MB_MAX_MSG_LEN) {
+                POLY1305_MAC(job);
+                job->status |= IMB_STATUS_COMPLETED_AUTH;
+                return job;
+        }
+
+        return OOO_STATS_SUBMIT_HASH(state, poly1305_ooo, job,
+                SUBMIT_JOB_POLY1305_MB(poly1305_ooo, job));
+}
+#endif /* SUBMIT_JOB_CHACHA20_MB */
+
+/* ========================================================================= */
+/* KASUMI-UEA1 multi-buffer */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_KASUMI_UEA1_MB
+__forceinline
+IMB_JOB *
+submit_job_kasumi_uea1_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_KASUMI_OOO *kasumi_uea1_ooo = state->kasumi_uea1_ooo;
+
+        /*
+         * Messages with length or offset not multiple of bytes
+         * are processed by the single buffer code
+         */
+        if ((job->msg_len_to_cipher_in_bits & 7) ||
+            (job->cipher_start_src_offset_in_bits & 7))
+                return submit_kasumi_uea1_job(state, job);
+
+        return OOO_STATS_SUBMIT(state, kasumi_uea1_ooo, job,
+                SUBMIT_JOB_KASUMI_UEA1_MB(kasumi_uea1_ooo, job));
+}
+#endif /* SUBMIT_JOB_KASUMI_UEA1_MB */
+
+/* ========================================================================= */
+/* SNOW-V and SNOW-V-AEAD multi-buffer */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_SNOW_V_MB
+__forceinline
+IMB_JOB *
+submit_job_snow_v_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_SNOW_V_OOO *snow_v_ooo = state->snow_v_ooo;
+
+        /* the multi-buffer engines use VAES */
+        if ((state->features & IMB_FEATURE_VAES) != IMB_FEATURE_VAES)
+                return SUBMIT_JOB_SNOW_V(job);
+
+        return OOO_STATS_SUBMIT(state, snow_v_ooo, job,
+                SUBMIT_JOB_SNOW_V_MB(snow_v_ooo, job));
+}
+
+/*
+ * Computes the authentication tag of a SNOW-V-AEAD job
+ * returned by the multi-buffer manager
+ */
+__forceinline
+IMB_JOB *
+complete_job_snow_v_aead_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        if (job == NULL)
+                return NULL;
+
+        snow_v_aead_auth_tag(state, job, job->u.SNOW_V_AEAD.reserved);
+#ifdef SAFE_DATA
+        clear_mem(job->u.SNOW_V_AEAD.reserved, 2 * sizeof(imb_uint128_t));
+#endif
+        return job;
+}
+
+__forceinline
+IMB_JOB *
+submit_job_snow_v_aead_mb(IMB_MGR *state, IMB_JOB *job)
+{
+        MB_MGR_SNOW_V_OOO *snow_v_aead_ooo = state->snow_v_aead_ooo;
+
+        /* the multi-buffer engines use VAES */
+        if ((state->features & IMB_FEATURE_VAES) != IMB_FEATURE_VAES)
+                return submit_snow_v_aead_job(state, job);
+
+        /*
+         * Decrypt tag is computed from the source buffer once the job
+         * is complete. Decryption with overlapping source and destination
+         * buffers is processed by the single buffer code.
+         */
+        if (job->cipher_direction == IMB_DIR_DECRYPT &&
+            job->dst < (job->src + job->msg_len_to_cipher_in_bytes) &&
+            job->src < (job->dst + job->msg_len_to_cipher_in_bytes))
+                return submit_snow_v_aead_job(state, job);
+
+        job = OOO_STATS_SUBMIT(state, snow_v_aead_ooo, job,
+                SUBMIT_JOB_SNOW_V_AEAD_MB(snow_v_aead_ooo, job));
+
+        return complete_job_snow_v_aead_mb(state, job);
+}
+#endif /* SUBMIT_JOB_SNOW_V_MB */
+
+/* ========================================================================= */
+/* AES-XTS multi-buffer */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_AES128_XTS_ENC
+__forceinline
+IMB_JOB *
+submit_job_aes_xts_enc(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_XTS_OOO *aes128_xts_enc_ooo =
+                        state->aes128_xts_enc_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes128_xts_enc_ooo, job,
+                        SUBMIT_JOB_AES128_XTS_ENC(aes128_xts_enc_ooo, job));
+        } else { /* assume 32 */
+                MB_MGR_AES_XTS_OOO *aes256_xts_enc_ooo =
+                        state->aes256_xts_enc_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes256_xts_enc_ooo, job,
+                        SUBMIT_JOB_AES256_XTS_ENC(aes256_xts_enc_ooo, job));
+        }
+}
+
+__forceinline
+IMB_JOB *
+flush_job_aes_xts_enc(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_XTS_OOO *aes128_xts_enc_ooo =
+                        state->aes128_xts_enc_ooo;
+
+                return OOO_STATS_FLUSH(state, aes128_xts_enc_ooo,
+                        FLUSH_JOB_AES128_XTS_ENC(aes128_xts_enc_ooo));
+        } else { /* assume 32 */
+                MB_MGR_AES_XTS_OOO *aes256_xts_enc_ooo =
+                        state->aes256_xts_enc_ooo;
+
+                return OOO_STATS_FLUSH(state, aes256_xts_enc_ooo,
+                        FLUSH_JOB_AES256_XTS_ENC(aes256_xts_enc_ooo));
+        }
+}
+
+__forceinline
+IMB_JOB *
+submit_job_aes_xts_dec(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_XTS_OOO *aes128_xts_dec_ooo =
+                        state->aes128_xts_dec_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes128_xts_dec_ooo, job,
+                        SUBMIT_JOB_AES128_XTS_DEC(aes128_xts_dec_ooo, job));
+        } else { /* assume 32 */
+                MB_MGR_AES_XTS_OOO *aes256_xts_dec_ooo =
+                        state->aes256_xts_dec_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes256_xts_dec_ooo, job,
+                        SUBMIT_JOB_AES256_XTS_DEC(aes256_xts_dec_ooo, job));
+        }
+}
+
+__forceinline
+IMB_JOB *
+flush_job_aes_xts_dec(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_XTS_OOO *aes128_xts_dec_ooo =
+                        state->aes128_xts_dec_ooo;
+
+                return OOO_STATS_FLUSH(state, aes128_xts_dec_ooo,
+                        FLUSH_JOB_AES128_XTS_DEC(aes128_xts_dec_ooo));
+        } else { /* assume 32 */
+                MB_MGR_AES_XTS_OOO *aes256_xts_dec_ooo =
+                        state->aes256_xts_dec_ooo;
+
+                return OOO_STATS_FLUSH(state, aes256_xts_dec_ooo,
+                        FLUSH_JOB_AES256_XTS_DEC(aes256_xts_dec_ooo));
+        }
+}
+#endif /* SUBMIT_JOB_AES128_XTS_ENC */
+
+/* ========================================================================= */
+/* AES-CFB multi-buffer encrypt and synchronous decrypt */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+__forceinline
+IMB_JOB *
+submit_job_aes_cfb_enc(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_CFB_OOO *aes128_cfb_ooo = state->aes128_cfb_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes128_cfb_ooo, job,
+                        SUBMIT_JOB_AES128_CFB_ENC(aes128_cfb_ooo, job));
+        } else if (24 == job->key_len_in_bytes) {
+                MB_MGR_AES_CFB_OOO *aes192_cfb_ooo = state->aes192_cfb_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes192_cfb_ooo, job,
+                        SUBMIT_JOB_AES192_CFB_ENC(aes192_cfb_ooo, job));
+        } else { /* assume 32 */
+                MB_MGR_AES_CFB_OOO *aes256_cfb_ooo = state->aes256_cfb_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes256_cfb_ooo, job,
+                        SUBMIT_JOB_AES256_CFB_ENC(aes256_cfb_ooo, job));
+        }
+}
+
+__forceinline
+IMB_JOB *
+flush_job_aes_cfb_enc(IMB_MGR *state, IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes) {
+                MB_MGR_AES_CFB_OOO *aes128_cfb_ooo = state->aes128_cfb_ooo;
+
+                return OOO_STATS_FLUSH(state, aes128_cfb_ooo,
+                        FLUSH_JOB_AES128_CFB_ENC(aes128_cfb_ooo));
+        } else if (24 == job->key_len_in_bytes) {
+                MB_MGR_AES_CFB_OOO *aes192_cfb_ooo = state->aes192_cfb_ooo;
+
+                return OOO_STATS_FLUSH(state, aes192_cfb_ooo,
+                        FLUSH_JOB_AES192_CFB_ENC(aes192_cfb_ooo));
+        } else { /* assume 32 */
+                MB_MGR_AES_CFB_OOO *aes256_cfb_ooo = state->aes256_cfb_ooo;
+
+                return OOO_STATS_FLUSH(state, aes256_cfb_ooo,
+                        FLUSH_JOB_AES256_CFB_ENC(aes256_cfb_ooo));
+        }
+}
+
+__forceinline
+IMB_JOB *
+submit_job_aes_cfb_dec(IMB_JOB *job)
+{
+        if (16 == job->key_len_in_bytes)
+                return SUBMIT_JOB_AES128_CFB_DEC(job);
+        else if (24 == job->key_len_in_bytes)
+                return SUBMIT_JOB_AES192_CFB_DEC(job);
+        else /* assume 32 */
+                return SUBMIT_JOB_AES256_CFB_DEC(job);
+}
+#endif /* SUBMIT_JOB_AES128_CFB_ENC */
+
+/* ========================================================================= */
+/* Stitched AES-CBC/CTR + HMAC-SHA1/SHA256 and AES-CTR + AES-CMAC */
+/* ========================================================================= */
+
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+/*
+ * Stitched path takes in-place jobs where the hashed region
+ * ends with the ciphered region:
+ * - AES-CBC encrypt (cipher-then-hash) + HMAC-SHA1/SHA256
+ * - AES-CTR (either order) + HMAC-SHA1/SHA256 or AES-CMAC
+ */
+__forceinline
+int
+is_job_stitched(IMB_MGR *state, const IMB_JOB *job)
+{
+        uint64_t hash_len = job->msg_len_to_hash_in_bytes;
+        void *ooo = NULL;
+
+        if (job->cipher_mode == IMB_CIPHER_CBC) {
+                if (job->cipher_direction != IMB_DIR_ENCRYPT ||
+                    job->chain_order != IMB_ORDER_CIPHER_HASH)
+                        return 0;
+                if (job->hash_alg == IMB_AUTH_HMAC_SHA_1)
+                        ooo = state->aes_cbc_hmac_sha_1_ooo;
+                else if (job->hash_alg == IMB_AUTH_HMAC_SHA_256)
+                        ooo = state->aes_cbc_hmac_sha_256_ooo;
+        } else if (job->cipher_mode == IMB_CIPHER_CNTR) {
+                if (job->hash_alg == IMB_AUTH_HMAC_SHA_1)
+                        ooo = state->aes_ctr_hmac_sha_1_ooo;
+                else if (job->hash_alg == IMB_AUTH_HMAC_SHA_256)
+                        ooo = state->aes_ctr_hmac_sha_256_ooo;
+                else if (job->hash_alg == IMB_AUTH_AES_CMAC)
+                        ooo = state->aes_ctr_cmac_ooo;
+                else if (job->hash_alg == IMB_AUTH_AES_CMAC_BITLEN) {
+                        ooo = state->aes_ctr_cmac_ooo;
+                        hash_len = (job->msg_len_to_hash_in_bits + 7) / 8;
+                }
+        }
+
+        if (ooo == NULL)
+                return 0;
+
+#ifdef HASH_USE_SHAEXT
+        /* SHA-NI single buffer hashing is faster than multi-buffer */
+        if ((state->features & IMB_FEATURE_SHANI) &&
+            (job->hash_alg == IMB_AUTH_HMAC_SHA_1 ||
+             job->hash_alg == IMB_AUTH_HMAC_SHA_256))
+                return 0;
+#endif
+        return (job->dst == job->src + job->cipher_start_src_offset_in_bytes &&
+                job->hash_start_src_offset_in_bytes <=
+                job->cipher_start_src_offset_in_bytes &&
+                job->hash_start_src_offset_in_bytes + hash_len ==
+                job->cipher_start_src_offset_in_bytes +
+                job->msg_len_to_cipher_in_bytes);
+}
+
+__forceinline
+IMB_JOB *
+submit_job_stitched(IMB_MGR *state, IMB_JOB *job)
+{
+        if (job->cipher_mode == IMB_CIPHER_CBC) {
+                if (job->hash_alg == IMB_AUTH_HMAC_SHA_1) {
+                        MB_MGR_AES_CBC_HMAC_OOO *aes_cbc_hmac_sha_1_ooo =
+                                state->aes_cbc_hmac_sha_1_ooo;
+
+                        return OOO_STATS_SUBMIT(state, aes_cbc_hmac_sha_1_ooo,
+                                job, SUBMIT_JOB_AES_CBC_HMAC_SHA_1(
+                                        aes_cbc_hmac_sha_1_ooo, job));
+                } else { /* assume IMB_AUTH_HMAC_SHA_256 */
+                        MB_MGR_AES_CBC_HMAC_OOO *aes_cbc_hmac_sha_256_ooo =
+                                state->aes_cbc_hmac_sha_256_ooo;
+
+                        return OOO_STATS_SUBMIT(state,
+                                aes_cbc_hmac_sha_256_ooo, job,
+                                SUBMIT_JOB_AES_CBC_HMAC_SHA_256(
+                                        aes_cbc_hmac_sha_256_ooo, job));
+                }
+        }
+
+        /* assume IMB_CIPHER_CNTR */
+        if (job->hash_alg == IMB_AUTH_HMAC_SHA_1) {
+                MB_MGR_AES_CBC_HMAC_OOO *aes_ctr_hmac_sha_1_ooo =
+                        state->aes_ctr_hmac_sha_1_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes_ctr_hmac_sha_1_ooo, job,
+                        SUBMIT_JOB_AES_CTR_HMAC_SHA_1(aes_ctr_hmac_sha_1_ooo,
+                                                      job));
+        } else if (job->hash_alg == IMB_AUTH_HMAC_SHA_256) {
+                MB_MGR_AES_CBC_HMAC_OOO *aes_ctr_hmac_sha_256_ooo =
+                        state->aes_ctr_hmac_sha_256_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes_ctr_hmac_sha_256_ooo, job,
+                        SUBMIT_JOB_AES_CTR_HMAC_SHA_256(
+                                aes_ctr_hmac_sha_256_ooo, job));
+        } else { /* assume IMB_AUTH_AES_CMAC/CMAC_BITLEN */
+                MB_MGR_AES_CTR_CMAC_OOO *aes_ctr_cmac_ooo =
+                        state->aes_ctr_cmac_ooo;
+
+                return OOO_STATS_SUBMIT(state, aes_ctr_cmac_ooo, job,
+                        SUBMIT_JOB_AES_CTR_CMAC(aes_ctr_cmac_ooo, job));
+        }
+}
+
+__forceinline
+IMB_JOB *
+flush_job_stitched(IMB_MGR *state, IMB_JOB *job)
+{
+        if (job->cipher_mode == IMB_CIPHER_CBC) {
+                if (job->hash_alg == IMB_AUTH_HMAC_SHA_1) {
+                        MB_MGR_AES_CBC_HMAC_OOO *aes_cbc_hmac_sha_1_ooo =
+                                state->aes_cbc_hmac_sha_1_ooo;
+
+                        return OOO_STATS_FLUSH(state, aes_cbc_hmac_sha_1_ooo,
+                                FLUSH_JOB_AES_CBC_HMAC_SHA_1(
+                                        aes_cbc_hmac_sha_1_ooo));
+                } else { /* assume IMB_AUTH_HMAC_SHA_256 */
+                        MB_MGR_AES_CBC_HMAC_OOO *aes_cbc_hmac_sha_256_ooo =
+                                state->aes_cbc_hmac_sha_256_ooo;
+
+                        return OOO_STATS_FLUSH(state,
+                                aes_cbc_hmac_sha_256_ooo,
+                                FLUSH_JOB_AES_CBC_HMAC_SHA_256(
+                                        aes_cbc_hmac_sha_256_ooo));
+                }
+        }
+
+        /* assume IMB_CIPHER_CNTR */
+        if (job->hash_alg == IMB_AUTH_HMAC_SHA_1) {
+                MB_MGR_AES_CBC_HMAC_OOO *aes_ctr_hmac_sha_1_ooo =
+                        state->aes_ctr_hmac_sha_1_ooo;
+
+                return OOO_STATS_FLUSH(state, aes_ctr_hmac_sha_1_ooo,
+                        FLUSH_JOB_AES_CTR_HMAC_SHA_1(aes_ctr_hmac_sha_1_ooo));
+        } else if (job->hash_alg == IMB_AUTH_HMAC_SHA_256) {
+                MB_MGR_AES_CBC_HMAC_OOO *aes_ctr_hmac_sha_256_ooo =
+                        state->aes_ctr_hmac_sha_256_ooo;
+
+                return OOO_STATS_FLUSH(state, aes_ctr_hmac_sha_256_ooo,
+                        FLUSH_JOB_AES_CTR_HMAC_SHA_256(
+                                aes_ctr_hmac_sha_256_ooo));
+        } else { /* assume IMB_AUTH_AES_CMAC/CMAC_BITLEN */
+                MB_MGR_AES_CTR_CMAC_OOO *aes_ctr_cmac_ooo =
+                        state->aes_ctr_cmac_ooo;
+
+                return OOO_STATS_FLUSH(state, aes_ctr_cmac_ooo,
+                        FLUSH_JOB_AES_CTR_CMAC(aes_ctr_cmac_ooo));
+        }
+}
+#endif /* SUBMIT_JOB_AES_CBC_HMAC_SHA_1 */
+
 /* ========================================================================= */
 /* Cipher submit & flush functions */
 /* ========================================================================= */
@@ -284,15 +835,18 @@ SUBMIT_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_AES_OOO *aes128_ooo = state->aes128_ooo;
 
-                        return SUBMIT_JOB_AES128_ENC(aes128_ooo, job);
+                        return OOO_STATS_SUBMIT(state, aes128_ooo, job,
+                                SUBMIT_JOB_AES128_ENC(aes128_ooo, job));
                 } else if (24 == job->key_len_in_bytes) {
                         MB_MGR_AES_OOO *aes192_ooo = state->aes192_ooo;
 
-                        return SUBMIT_JOB_AES192_ENC(aes192_ooo, job);
+                        return OOO_STATS_SUBMIT(state, aes192_ooo, job,
+                                SUBMIT_JOB_AES192_ENC(aes192_ooo, job));
                 } else { /* assume 32 */
                         MB_MGR_AES_OOO *aes256_ooo = state->aes256_ooo;
 
-                        return SUBMIT_JOB_AES256_ENC(aes256_ooo, job);
+                        return OOO_STATS_SUBMIT(state, aes256_ooo, job,
+                                SUBMIT_JOB_AES256_ENC(aes256_ooo, job));
                 }
         } else if (IMB_CIPHER_CNTR == job->cipher_mode) {
                 return SUBMIT_JOB_AES_CNTR(job);
@@ -314,7 +868,11 @@ SUBMIT_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
                 else
                         return SUBMIT_JOB_PON_ENC(job);
         } else if (IMB_CIPHER_GCM == job->cipher_mode) {
+#ifdef SUBMIT_JOB_AES128_GCM
+                return submit_job_aes_gcm_mb(state, job);
+#else
                 return SUBMIT_JOB_AES_GCM_ENC(state, job);
+#endif /* SUBMIT_JOB_AES128_GCM */
         } else if (IMB_CIPHER_GCM_SGL == job->cipher_mode) {
                 return submit_gcm_sgl_enc(state, job);
         } else if (IMB_CIPHER_CUSTOM == job->cipher_mode) {
@@ -323,22 +881,31 @@ SUBMIT_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
 #ifdef SUBMIT_JOB_DES_CBC_ENC
                 MB_MGR_DES_OOO *des_enc_ooo = state->des_enc_ooo;
 
-                return SUBMIT_JOB_DES_CBC_ENC(des_enc_ooo, job);
+                return OOO_STATS_SUBMIT(state, des_enc_ooo, job,
+                        SUBMIT_JOB_DES_CBC_ENC(des_enc_ooo, job));
 #else
                 return DES_CBC_ENC(job);
 #endif /* SUBMIT_JOB_DES_CBC_ENC */
         } else if (IMB_CIPHER_CHACHA20 == job->cipher_mode) {
+#ifdef SUBMIT_JOB_CHACHA20_MB
+                return submit_job_chacha20_mb(state, job);
+#else
                 return SUBMIT_JOB_CHACHA20_ENC_DEC(job);
+#endif
         } else if (IMB_CIPHER_CHACHA20_POLY1305 == job->cipher_mode) {
+#ifdef SUBMIT_JOB_CHACHA20_MB
+                return submit_job_chacha20_poly1305_mb(state, job);
+#else
                 return SUBMIT_JOB_CHACHA20_POLY1305(state, job);
+#endif
         } else if (IMB_CIPHER_CHACHA20_POLY1305_SGL == job->cipher_mode) {
                 return SUBMIT_JOB_CHACHA20_POLY1305_SGL(state, job);
         } else if (IMB_CIPHER_DOCSIS_DES == job->cipher_mode) {
 #ifdef SUBMIT_JOB_DOCSIS_DES_ENC
                 MB_MGR_DES_OOO *docsis_des_enc_ooo = state->docsis_des_enc_ooo;
 
-                return SUBMIT_JOB_DOCSIS_DES_ENC(docsis_des_enc_ooo,
-                                                 job);
+                return OOO_STATS_SUBMIT(state, docsis_des_enc_ooo, job,
+                        SUBMIT_JOB_DOCSIS_DES_ENC(docsis_des_enc_ooo, job));
 #else
                 return DOCSIS_DES_ENC(job);
 #endif /* SUBMIT_JOB_DOCSIS_DES_ENC */
@@ -346,7 +913,8 @@ SUBMIT_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
 #ifdef SUBMIT_JOB_3DES_CBC_ENC
                 MB_MGR_DES_OOO *des3_enc_ooo = state->des3_enc_ooo;
 
-                return SUBMIT_JOB_3DES_CBC_ENC(des3_enc_ooo, job);
+                return OOO_STATS_SUBMIT(state, des3_enc_ooo, job,
+                        SUBMIT_JOB_3DES_CBC_ENC(des3_enc_ooo, job));
 #else
                 return DES3_CBC_ENC(job);
 #endif
@@ -360,29 +928,53 @@ SUBMIT_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_ZUC_OOO *zuc_eea3_ooo = state->zuc_eea3_ooo;
 
-                        return SUBMIT_JOB_ZUC_EEA3(zuc_eea3_ooo, job);
+                        return OOO_STATS_SUBMIT(state, zuc_eea3_ooo, job,
+                                SUBMIT_JOB_ZUC_EEA3(zuc_eea3_ooo, job));
                 } else { /* assume 32 */
                         MB_MGR_ZUC_OOO *zuc256_eea3_ooo =
                                 state->zuc256_eea3_ooo;
 
-                        return SUBMIT_JOB_ZUC256_EEA3(zuc256_eea3_ooo, job);
+                        return OOO_STATS_SUBMIT(state, zuc256_eea3_ooo, job,
+                                SUBMIT_JOB_ZUC256_EEA3(zuc256_eea3_ooo, job));
                 }
         } else if (IMB_CIPHER_SNOW3G_UEA2_BITLEN == job->cipher_mode) {
 #ifdef SUBMIT_JOB_SNOW3G_UEA2
-                return SUBMIT_JOB_SNOW3G_UEA2(state, job);
+                return OOO_STATS_SUBMIT(state, snow3g_uea2_ooo, job,
+                        SUBMIT_JOB_SNOW3G_UEA2(state, job));
 #else
                 return def_submit_snow3g_uea2_job(state, job);
 #endif
         } else if (IMB_CIPHER_KASUMI_UEA1_BITLEN == job->cipher_mode) {
+#ifdef SUBMIT_JOB_KASUMI_UEA1_MB
+                return submit_job_kasumi_uea1_mb(state, job);
+#else
                 return submit_kasumi_uea1_job(state, job);
+#endif
         } else if (IMB_CIPHER_CBCS_1_9 == job->cipher_mode) {
                 MB_MGR_AES_OOO *aes128_cbcs_ooo = state->aes128_cbcs_ooo;
 
-                return SUBMIT_JOB_AES128_CBCS_1_9_ENC(aes128_cbcs_ooo, job);
+                return OOO_STATS_SUBMIT(state, aes128_cbcs_ooo, job,
+                        SUBMIT_JOB_AES128_CBCS_1_9_ENC(aes128_cbcs_ooo, job));
         } else if (IMB_CIPHER_SNOW_V == job->cipher_mode) {
+#ifdef SUBMIT_JOB_SNOW_V_MB
+                return submit_job_snow_v_mb(state, job);
+#else
                 return SUBMIT_JOB_SNOW_V(job);
+#endif
         } else if (IMB_CIPHER_SNOW_V_AEAD == job->cipher_mode) {
+#ifdef SUBMIT_JOB_SNOW_V_MB
+                return submit_job_snow_v_aead_mb(state, job);
+#else
                 return submit_snow_v_aead_job(state, job);
+#endif
+#ifdef SUBMIT_JOB_AES128_XTS_ENC
+        } else if (IMB_CIPHER_XTS == job->cipher_mode) {
+                return submit_job_aes_xts_enc(state, job);
+#endif
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+        } else if (IMB_CIPHER_CFB == job->cipher_mode) {
+                return submit_job_aes_cfb_enc(state, job);
+#endif
         } else { /* assume IMB_CIPHER_NULL */
                 job->status |= IMB_STATUS_COMPLETED_CIPHER;
                 return job;
@@ -397,15 +989,18 @@ FLUSH_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_AES_OOO *aes128_ooo = state->aes128_ooo;
 
-                        return FLUSH_JOB_AES128_ENC(aes128_ooo);
+                        return OOO_STATS_FLUSH(state, aes128_ooo,
+                                FLUSH_JOB_AES128_ENC(aes128_ooo));
                 } else if (24 == job->key_len_in_bytes) {
                         MB_MGR_AES_OOO *aes192_ooo = state->aes192_ooo;
 
-                        return FLUSH_JOB_AES192_ENC(aes192_ooo);
+                        return OOO_STATS_FLUSH(state, aes192_ooo,
+                                FLUSH_JOB_AES192_ENC(aes192_ooo));
                 } else  { /* assume 32 */
                         MB_MGR_AES_OOO *aes256_ooo = state->aes256_ooo;
 
-                        return FLUSH_JOB_AES256_ENC(aes256_ooo);
+                        return OOO_STATS_FLUSH(state, aes256_ooo,
+                                FLUSH_JOB_AES256_ENC(aes256_ooo));
                 }
         } else if (IMB_CIPHER_DOCSIS_SEC_BPI == job->cipher_mode) {
                 return flush_docsis_enc_job(state, job);
@@ -413,19 +1008,22 @@ FLUSH_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
         } else if (IMB_CIPHER_DES == job->cipher_mode) {
                 MB_MGR_DES_OOO *des_enc_ooo = state->des_enc_ooo;
 
-                return FLUSH_JOB_DES_CBC_ENC(des_enc_ooo);
+                return OOO_STATS_FLUSH(state, des_enc_ooo,
+                        FLUSH_JOB_DES_CBC_ENC(des_enc_ooo));
 #endif /* FLUSH_JOB_DES_CBC_ENC */
 #ifdef FLUSH_JOB_3DES_CBC_ENC
         } else if (IMB_CIPHER_DES3 == job->cipher_mode) {
                 MB_MGR_DES_OOO *des3_enc_ooo = state->des3_enc_ooo;
 
-                return FLUSH_JOB_3DES_CBC_ENC(des3_enc_ooo);
+                return OOO_STATS_FLUSH(state, des3_enc_ooo,
+                        FLUSH_JOB_3DES_CBC_ENC(des3_enc_ooo));
 #endif /* FLUSH_JOB_3DES_CBC_ENC */
 #ifdef FLUSH_JOB_DOCSIS_DES_ENC
         } else if (IMB_CIPHER_DOCSIS_DES == job->cipher_mode) {
                 MB_MGR_DES_OOO *docsis_des_enc_ooo = state->docsis_des_enc_ooo;
 
-                return FLUSH_JOB_DOCSIS_DES_ENC(docsis_des_enc_ooo);
+                return OOO_STATS_FLUSH(state, docsis_des_enc_ooo,
+                        FLUSH_JOB_DOCSIS_DES_ENC(docsis_des_enc_ooo));
 #endif /* FLUSH_JOB_DOCSIS_DES_ENC */
         } else if (IMB_CIPHER_CUSTOM == job->cipher_mode) {
                 return FLUSH_JOB_CUSTOM_CIPHER(job);
@@ -433,21 +1031,79 @@ FLUSH_JOB_AES_ENC(IMB_MGR *state, IMB_JOB *job)
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_ZUC_OOO *zuc_eea3_ooo = state->zuc_eea3_ooo;
 
-                        return FLUSH_JOB_ZUC_EEA3(zuc_eea3_ooo);
+                        return OOO_STATS_FLUSH(state, zuc_eea3_ooo,
+                                FLUSH_JOB_ZUC_EEA3(zuc_eea3_ooo));
                 } else { /* assume 32 */
                         MB_MGR_ZUC_OOO *zuc256_eea3_ooo =
                                 state->zuc256_eea3_ooo;
 
-                        return FLUSH_JOB_ZUC256_EEA3(zuc256_eea3_ooo);
+                        return OOO_STATS_FLUSH(state, zuc256_eea3_ooo,
+                                FLUSH_JOB_ZUC256_EEA3(zuc256_eea3_ooo));
                 }
         } else if (IMB_CIPHER_CBCS_1_9 == job->cipher_mode) {
                 MB_MGR_AES_OOO *aes128_cbcs_ooo = state->aes128_cbcs_ooo;
 
-                return FLUSH_JOB_AES128_CBCS_1_9_ENC(aes128_cbcs_ooo);
+                return OOO_STATS_FLUSH(state, aes128_cbcs_ooo,
+                        FLUSH_JOB_AES128_CBCS_1_9_ENC(aes128_cbcs_ooo));
 #ifdef FLUSH_JOB_SNOW3G_UEA2
         } else if (IMB_CIPHER_SNOW3G_UEA2_BITLEN == job->cipher_mode) {
-                return FLUSH_JOB_SNOW3G_UEA2(state);
+                return OOO_STATS_FLUSH(state, snow3g_uea2_ooo,
+                        FLUSH_JOB_SNOW3G_UEA2(state));
 #endif
+#ifdef FLUSH_JOB_AES128_GCM
+        } else if (IMB_CIPHER_GCM == job->cipher_mode) {
+                return flush_job_aes_gcm_mb(state, job);
+#endif /* FLUSH_JOB_AES128_GCM */
+#ifdef FLUSH_JOB_CHACHA20_MB
+        } else if (IMB_CIPHER_CHACHA20 == job->cipher_mode) {
+                MB_MGR_CHACHA20_POLY1305_OOO *chacha20_ooo =
+                        state->chacha20_ooo;
+
+                /* manager not allocated, jobs completed on submission */
+                if (chacha20_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, chacha20_ooo,
+                        FLUSH_JOB_CHACHA20_MB(chacha20_ooo));
+        } else if (IMB_CIPHER_CHACHA20_POLY1305 == job->cipher_mode) {
+                MB_MGR_CHACHA20_POLY1305_OOO *chacha20_poly1305_ooo =
+                        state->chacha20_poly1305_ooo;
+
+                /* manager not allocated, jobs completed on submission */
+                if (chacha20_poly1305_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, chacha20_poly1305_ooo,
+                        FLUSH_JOB_CHACHA20_POLY1305_MB(chacha20_poly1305_ooo));
+#endif /* FLUSH_JOB_CHACHA20_MB */
+#ifdef FLUSH_JOB_KASUMI_UEA1_MB
+        } else if (IMB_CIPHER_KASUMI_UEA1_BITLEN == job->cipher_mode) {
+                MB_MGR_KASUMI_OOO *kasumi_uea1_ooo = state->kasumi_uea1_ooo;
+
+                return OOO_STATS_FLUSH(state, kasumi_uea1_ooo,
+                        FLUSH_JOB_KASUMI_UEA1_MB(kasumi_uea1_ooo));
+#endif /* FLUSH_JOB_KASUMI_UEA1_MB */
+#ifdef FLUSH_JOB_SNOW_V_MB
+        } else if (IMB_CIPHER_SNOW_V == job->cipher_mode) {
+                MB_MGR_SNOW_V_OOO *snow_v_ooo = state->snow_v_ooo;
+
+                return OOO_STATS_FLUSH(state, snow_v_ooo,
+                        FLUSH_JOB_SNOW_V_MB(snow_v_ooo));
+        } else if (IMB_CIPHER_SNOW_V_AEAD == job->cipher_mode) {
+                MB_MGR_SNOW_V_OOO *snow_v_aead_ooo = state->snow_v_aead_ooo;
+
+                return complete_job_snow_v_aead_mb(state,
+                        OOO_STATS_FLUSH(state, snow_v_aead_ooo,
+                                FLUSH_JOB_SNOW_V_AEAD_MB(snow_v_aead_ooo)));
+#endif /* FLUSH_JOB_SNOW_V_MB */
+#ifdef FLUSH_JOB_AES128_XTS_ENC
+        } else if (IMB_CIPHER_XTS == job->cipher_mode) {
+                return flush_job_aes_xts_enc(state, job);
+#endif /* FLUSH_JOB_AES128_XTS_ENC */
+#ifdef FLUSH_JOB_AES128_CFB_ENC
+        } else if (IMB_CIPHER_CFB == job->cipher_mode) {
+                return flush_job_aes_cfb_enc(state, job);
+#endif /* FLUSH_JOB_AES128_CFB_ENC */
         /**
          * assume IMB_CIPHER_CNTR/CNTR_BITLEN, IMB_CIPHER_ECB,
          * IMB_CIPHER_CCM, IMB_CIPHER_NULL or IMB_CIPHER_GCM
@@ -489,30 +1145,43 @@ SUBMIT_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
                 else
                         return SUBMIT_JOB_PON_DEC(job);
         } else if (IMB_CIPHER_GCM == job->cipher_mode) {
+#ifdef SUBMIT_JOB_AES128_GCM
+                return submit_job_aes_gcm_mb(state, job);
+#else
                 return SUBMIT_JOB_AES_GCM_DEC(state, job);
+#endif /* SUBMIT_JOB_AES128_GCM */
         } else if (IMB_CIPHER_GCM_SGL == job->cipher_mode) {
                 return submit_gcm_sgl_dec(state, job);
         } else if (IMB_CIPHER_DES == job->cipher_mode) {
 #ifdef SUBMIT_JOB_DES_CBC_DEC
                 MB_MGR_DES_OOO *des_dec_ooo = state->des_dec_ooo;
 
-                return SUBMIT_JOB_DES_CBC_DEC(des_dec_ooo, job);
+                return OOO_STATS_SUBMIT(state, des_dec_ooo, job,
+                        SUBMIT_JOB_DES_CBC_DEC(des_dec_ooo, job));
 #else
                 (void) state;
                 return DES_CBC_DEC(job);
 #endif /* SUBMIT_JOB_DES_CBC_DEC */
         } else if (IMB_CIPHER_CHACHA20 == job->cipher_mode) {
+#ifdef SUBMIT_JOB_CHACHA20_MB
+                return submit_job_chacha20_mb(state, job);
+#else
                 return SUBMIT_JOB_CHACHA20_ENC_DEC(job);
+#endif
         } else if (IMB_CIPHER_CHACHA20_POLY1305 == job->cipher_mode) {
+#ifdef SUBMIT_JOB_CHACHA20_MB
+                return submit_job_chacha20_poly1305_mb(state, job);
+#else
                 return SUBMIT_JOB_CHACHA20_POLY1305(state, job);
+#endif
         } else if (IMB_CIPHER_CHACHA20_POLY1305_SGL == job->cipher_mode) {
                 return SUBMIT_JOB_CHACHA20_POLY1305_SGL(state, job);
         } else if (IMB_CIPHER_DOCSIS_DES == job->cipher_mode) {
 #ifdef SUBMIT_JOB_DOCSIS_DES_DEC
                 MB_MGR_DES_OOO *docsis_des_dec_ooo = state->docsis_des_dec_ooo;
 
-                return SUBMIT_JOB_DOCSIS_DES_DEC(docsis_des_dec_ooo,
-                                                 job);
+                return OOO_STATS_SUBMIT(state, docsis_des_dec_ooo, job,
+                        SUBMIT_JOB_DOCSIS_DES_DEC(docsis_des_dec_ooo, job));
 #else
                 return DOCSIS_DES_DEC(job);
 #endif /* SUBMIT_JOB_DOCSIS_DES_DEC */
@@ -520,7 +1189,8 @@ SUBMIT_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
 #ifdef SUBMIT_JOB_3DES_CBC_DEC
                 MB_MGR_DES_OOO *des3_dec_ooo = state->des3_dec_ooo;
 
-                return SUBMIT_JOB_3DES_CBC_DEC(des3_dec_ooo, job);
+                return OOO_STATS_SUBMIT(state, des3_dec_ooo, job,
+                        SUBMIT_JOB_3DES_CBC_DEC(des3_dec_ooo, job));
 #else
                 return DES3_CBC_DEC(job);
 #endif
@@ -536,27 +1206,50 @@ SUBMIT_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_ZUC_OOO *zuc_eea3_ooo = state->zuc_eea3_ooo;
 
-                        return SUBMIT_JOB_ZUC_EEA3(zuc_eea3_ooo, job);
+                        return OOO_STATS_SUBMIT(state, zuc_eea3_ooo, job,
+                                SUBMIT_JOB_ZUC_EEA3(zuc_eea3_ooo, job));
                 } else { /* assume 32 */
                         MB_MGR_ZUC_OOO *zuc256_eea3_ooo =
                                 state->zuc256_eea3_ooo;
 
-                        return SUBMIT_JOB_ZUC256_EEA3(zuc256_eea3_ooo, job);
+                        return OOO_STATS_SUBMIT(state, zuc256_eea3_ooo, job,
+                                SUBMIT_JOB_ZUC256_EEA3(zuc256_eea3_ooo, job));
                 }
         } else if (IMB_CIPHER_SNOW3G_UEA2_BITLEN == job->cipher_mode) {
 #ifdef SUBMIT_JOB_SNOW3G_UEA2
-                return SUBMIT_JOB_SNOW3G_UEA2(state, job);
+                return OOO_STATS_SUBMIT(state, snow3g_uea2_ooo, job,
+                        SUBMIT_JOB_SNOW3G_UEA2(state, job));
 #else
                 return def_submit_snow3g_uea2_job(state, job);
 #endif
         } else if (IMB_CIPHER_KASUMI_UEA1_BITLEN == job->cipher_mode) {
+#ifdef SUBMIT_JOB_KASUMI_UEA1_MB
+                return submit_job_kasumi_uea1_mb(state, job);
+#else
                 return submit_kasumi_uea1_job(state, job);
+#endif
         } else if (IMB_CIPHER_CBCS_1_9 == job->cipher_mode) {
                 return SUBMIT_JOB_AES128_CBCS_1_9_DEC(job);
         } else if (IMB_CIPHER_SNOW_V == job->cipher_mode) {
+#ifdef SUBMIT_JOB_SNOW_V_MB
+                return submit_job_snow_v_mb(state, job);
+#else
                 return SUBMIT_JOB_SNOW_V(job);
+#endif
         } else if (IMB_CIPHER_SNOW_V_AEAD == job->cipher_mode) {
+#ifdef SUBMIT_JOB_SNOW_V_MB
+                return submit_job_snow_v_aead_mb(state, job);
+#else
                 return submit_snow_v_aead_job(state, job);
+#endif
+#ifdef SUBMIT_JOB_AES128_XTS_ENC
+        } else if (IMB_CIPHER_XTS == job->cipher_mode) {
+                return submit_job_aes_xts_dec(state, job);
+#endif
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+        } else if (IMB_CIPHER_CFB == job->cipher_mode) {
+                return submit_job_aes_cfb_dec(job);
+#endif
         } else {
                 /* assume IMB_CIPHER_NULL */
                 job->status |= IMB_STATUS_COMPLETED_CIPHER;
@@ -570,14 +1263,16 @@ FLUSH_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
 {
 #ifdef FLUSH_JOB_SNOW3G_UEA2
         if (IMB_CIPHER_SNOW3G_UEA2_BITLEN == job->cipher_mode)
-                return FLUSH_JOB_SNOW3G_UEA2(state);
+                return OOO_STATS_FLUSH(state, snow3g_uea2_ooo,
+                        FLUSH_JOB_SNOW3G_UEA2(state));
 #endif
 
 #ifdef FLUSH_JOB_DES_CBC_DEC
         if (IMB_CIPHER_DES == job->cipher_mode) {
                 MB_MGR_DES_OOO *des_dec_ooo = state->des_dec_ooo;
 
-                return FLUSH_JOB_DES_CBC_DEC(des_dec_ooo);
+                return OOO_STATS_FLUSH(state, des_dec_ooo,
+                        FLUSH_JOB_DES_CBC_DEC(des_dec_ooo));
         }
 #endif /* FLUSH_JOB_DES_CBC_DEC */
 
@@ -585,7 +1280,8 @@ FLUSH_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
         if (IMB_CIPHER_DES3 == job->cipher_mode) {
                 MB_MGR_DES_OOO *des3_dec_ooo = state->des3_dec_ooo;
 
-                return FLUSH_JOB_3DES_CBC_DEC(des3_dec_ooo);
+                return OOO_STATS_FLUSH(state, des3_dec_ooo,
+                        FLUSH_JOB_3DES_CBC_DEC(des3_dec_ooo));
         }
 #endif /* FLUSH_JOB_3DES_CBC_DEC */
 
@@ -594,26 +1290,140 @@ FLUSH_JOB_AES_DEC(IMB_MGR *state, IMB_JOB *job)
         if (IMB_CIPHER_DOCSIS_DES == job->cipher_mode) {
                 MB_MGR_DES_OOO *docsis_des_dec_ooo = state->docsis_des_dec_ooo;
 
-                return FLUSH_JOB_DOCSIS_DES_DEC(docsis_des_dec_ooo);
+                return OOO_STATS_FLUSH(state, docsis_des_dec_ooo,
+                        FLUSH_JOB_DOCSIS_DES_DEC(docsis_des_dec_ooo));
         }
 #endif /* FLUSH_JOB_DOCSIS_DES_DEC */
 
+#ifdef FLUSH_JOB_AES128_GCM
+        if (IMB_CIPHER_GCM == job->cipher_mode)
+                return flush_job_aes_gcm_mb(state, job);
+#endif /* FLUSH_JOB_AES128_GCM */
+
+#ifdef FLUSH_JOB_CHACHA20_MB
+        if (IMB_CIPHER_CHACHA20 == job->cipher_mode) {
+                MB_MGR_CHACHA20_POLY1305_OOO *chacha20_ooo =
+                        state->chacha20_ooo;
+
+                /* manager not allocated, jobs completed on submission */
+                if (chacha20_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, chacha20_ooo,
+                        FLUSH_JOB_CHACHA20_MB(chacha20_ooo));
+        }
+
+        if (IMB_CIPHER_CHACHA20_POLY1305 == job->cipher_mode) {
+                MB_MGR_CHACHA20_POLY1305_OOO *chacha20_poly1305_ooo =
+                        state->chacha20_poly1305_ooo;
+
+                /* manager not allocated, jobs completed on submission */
+                if (chacha20_poly1305_ooo == NULL)
+                        return NULL;
+
+                return OOO_STATS_FLUSH(state, chacha20_poly1305_ooo,
+                        FLUSH_JOB_CHACHA20_POLY1305_MB(chacha20_poly1305_ooo));
+        }
+#endif /* FLUSH_JOB_CHACHA20_MB */
+
+#ifdef FLUSH_JOB_KASUMI_UEA1_MB
+        if (IMB_CIPHER_KASUMI_UEA1_BITLEN == job->cipher_mode) {
+                MB_MGR_KASUMI_OOO *kasumi_uea1_ooo = state->kasumi_uea1_ooo;
+
+                return OOO_STATS_FLUSH(state, kasumi_uea1_ooo,
+                        FLUSH_JOB_KASUMI_UEA1_MB(kasumi_uea1_ooo));
+        }
+#endif /* FLUSH_JOB_KASUMI_UEA1_MB */
+
+#ifdef FLUSH_JOB_SNOW_V_MB
+        if (IMB_CIPHER_SNOW_V == job->cipher_mode) {
+                MB_MGR_SNOW_V_OOO *snow_v_ooo = state->snow_v_ooo;
+
+                return OOO_STATS_FLUSH(state, snow_v_ooo,
+                        FLUSH_JOB_SNOW_V_MB(snow_v_ooo));
+        }
+
+        if (IMB_CIPHER_SNOW_V_AEAD == job->cipher_mode) {
+                MB_MGR_SNOW_V_OOO *snow_v_aead_ooo = state->snow_v_aead_ooo;
+
+                return complete_job_snow_v_aead_mb(state,
+                        OOO_STATS_FLUSH(state, snow_v_aead_ooo,
+                                FLUSH_JOB_SNOW_V_AEAD_MB(snow_v_aead_ooo)));
+        }
+#endif /* FLUSH_JOB_SNOW_V_MB */
+
+#ifdef FLUSH_JOB_AES128_XTS_DEC
+        if (IMB_CIPHER_XTS == job->cipher_mode)
+                return flush_job_aes_xts_dec(state, job);
+#endif /* FLUSH_JOB_AES128_XTS_DEC */
+
         if (IMB_CIPHER_ZUC_EEA3 == job->cipher_mode) {
                 if (16 == job->key_len_in_bytes) {
                         MB_MGR_ZUC_OOO *zuc_eea3_ooo = state->zuc_eea3_ooo;
 
-                        return FLUSH_JOB_ZUC_EEA3(zuc_eea3_ooo);
+                        return OOO_STATS_FLUSH(state, zuc_eea3_ooo,
+                                FLUSH_JOB_ZUC_EEA3(zuc_eea3_ooo));
                 } else { /* assume 32 */
                         MB_MGR_ZUC_OOO *zuc256_eea3_ooo =
                                 state->zuc256_eea3_ooo;
 
-                        return FLUSH_JOB_ZUC256_EEA3(zuc256_eea3_ooo);
+                        return OOO_STATS_FLUSH(state, zuc256_eea3_ooo,
+                                FLUSH_JOB_ZUC256_EEA3(zuc256_eea3_ooo));
                 }
         }
 
         return NULL;
 }
 
+/* Single buffer CRC (IMB_AUTH_CRC*), completes the job at submit */
+__forceinline
+IMB_JOB *
+process_crc(IMB_MGR *state, IMB_JOB *job)
+{
+        switch (job->hash_alg) {
+        case IMB_AUTH_CRC32_ETHERNET_FCS:
+                CRC(IMB_CRC32_ETHERNET_FCS, state, job);
+                break;
+        case IMB_AUTH_CRC32_SCTP:
+                CRC(IMB_CRC32_SCTP, state, job);
+                break;
+        case IMB_AUTH_CRC32_WIMAX_OFDMA_DATA:
+                CRC(IMB_CRC32_WIMAX_OFDMA_DATA, state, job);
+                break;
+        case IMB_AUTH_CRC24_LTE_A:
+                CRC(IMB_CRC24_LTE_A, state, job);
+                break;
+        case IMB_AUTH_CRC24_LTE_B:
+                CRC(IMB_CRC24_LTE_B, state, job);
+                break;
+        case IMB_AUTH_CRC16_X25:
+                CRC(IMB_CRC16_X25, state, job);
+                break;
+        case IMB_AUTH_CRC16_FP_DATA:
+                CRC(IMB_CRC16_FP_DATA, state, job);
+                break;
+        case IMB_AUTH_CRC11_FP_HEADER:
+                CRC(IMB_CRC11_FP_HEADER, state, job);
+                break;
+        case IMB_AUTH_CRC10_IUUP_DATA:
+                CRC(IMB_CRC10_IUUP_DATA, state, job);
+                break;
+        case IMB_AUTH_CRC8_WIMAX_OFDMA_HCS:
+                CRC(IMB_CRC8_WIMAX_OFDMA_HCS, state, job);
+                break;
+        case IMB_AUTH_CRC7_FP_HEADER:
+                CRC(IMB_CRC7_FP_HEADER, state, job);
+                break;
+        case IMB_AUTH_CRC6_IUUP_HEADER:
+                CRC(IMB_CRC6_IUUP_HEADER, state, job);
+                break;
+        default:
+                break;
+        }
+        job->status |= IMB_STATUS_COMPLETED_AUTH;
+        return job;
+}
+
 /* ========================================================================= */
 /* Hash submit & flush functions */
 /* ========================================================================= */
@@ -649,38 +1459,53 @@ SUBMIT_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
         case IMB_AUTH_HMAC_SHA_1:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_HMAC_NI(hmac_sha_1_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, hmac_sha_1_ooo, job,
+                                SUBMIT_JOB_HMAC_NI(hmac_sha_1_ooo, job));
 #endif
-                return SUBMIT_JOB_HMAC(hmac_sha_1_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_sha_1_ooo, job,
+                        SUBMIT_JOB_HMAC(hmac_sha_1_ooo, job));
         case IMB_AUTH_HMAC_SHA_224:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_HMAC_SHA_224_NI
-                                (hmac_sha_224_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state,
+                                hmac_sha_224_ooo, job,
+                                SUBMIT_JOB_HMAC_SHA_224_NI(hmac_sha_224_ooo,
+                                                           job));
 #endif
-                return SUBMIT_JOB_HMAC_SHA_224(hmac_sha_224_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_sha_224_ooo, job,
+                        SUBMIT_JOB_HMAC_SHA_224(hmac_sha_224_ooo, job));
         case IMB_AUTH_HMAC_SHA_256:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_HMAC_SHA_256_NI
-                                (hmac_sha_256_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state,
+                                hmac_sha_256_ooo, job,
+                                SUBMIT_JOB_HMAC_SHA_256_NI(hmac_sha_256_ooo,
+                                                           job));
 #endif
-                return SUBMIT_JOB_HMAC_SHA_256(hmac_sha_256_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_sha_256_ooo, job,
+                        SUBMIT_JOB_HMAC_SHA_256(hmac_sha_256_ooo, job));
         case IMB_AUTH_HMAC_SHA_384:
-                return SUBMIT_JOB_HMAC_SHA_384(hmac_sha_384_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_sha_384_ooo, job,
+                        SUBMIT_JOB_HMAC_SHA_384(hmac_sha_384_ooo, job));
         case IMB_AUTH_HMAC_SHA_512:
-                return SUBMIT_JOB_HMAC_SHA_512(hmac_sha_512_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_sha_512_ooo, job,
+                        SUBMIT_JOB_HMAC_SHA_512(hmac_sha_512_ooo, job));
         case IMB_AUTH_AES_XCBC:
-                return SUBMIT_JOB_AES_XCBC(aes_xcbc_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, aes_xcbc_ooo, job,
+                        SUBMIT_JOB_AES_XCBC(aes_xcbc_ooo, job));
         case IMB_AUTH_MD5:
-                return SUBMIT_JOB_HMAC_MD5(hmac_md5_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, hmac_md5_ooo, job,
+                        SUBMIT_JOB_HMAC_MD5(hmac_md5_ooo, job));
         case IMB_AUTH_CUSTOM:
                 return SUBMIT_JOB_CUSTOM_HASH(job);
         case IMB_AUTH_AES_CCM:
                 if (16 == job->key_len_in_bytes) {
-                        return SUBMIT_JOB_AES128_CCM_AUTH(aes_ccm_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, aes_ccm_ooo, job,
+                                SUBMIT_JOB_AES128_CCM_AUTH(aes_ccm_ooo, job));
                 } else { /* assume 32 */
-                        return SUBMIT_JOB_AES256_CCM_AUTH(aes256_ccm_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, aes256_ccm_ooo, job,
+                                SUBMIT_JOB_AES256_CCM_AUTH(aes256_ccm_ooo,
+                                                           job));
                 }
         case IMB_AUTH_AES_CMAC:
                 /*
@@ -689,43 +1514,57 @@ SUBMIT_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
                  */
                 job->msg_len_to_hash_in_bits =
                         job->msg_len_to_hash_in_bytes * 8;
-                return SUBMIT_JOB_AES128_CMAC_AUTH(aes_cmac_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, aes_cmac_ooo, job,
+                        SUBMIT_JOB_AES128_CMAC_AUTH(aes_cmac_ooo, job));
         case IMB_AUTH_AES_CMAC_BITLEN:
-                return SUBMIT_JOB_AES128_CMAC_AUTH(aes_cmac_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, aes_cmac_ooo, job,
+                        SUBMIT_JOB_AES128_CMAC_AUTH(aes_cmac_ooo, job));
         case IMB_AUTH_AES_CMAC_256:
                 job->msg_len_to_hash_in_bits =
                         job->msg_len_to_hash_in_bytes * 8;
-                return SUBMIT_JOB_AES256_CMAC_AUTH(aes256_cmac_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, aes256_cmac_ooo, job,
+                        SUBMIT_JOB_AES256_CMAC_AUTH(aes256_cmac_ooo, job));
         case IMB_AUTH_SHA_1:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_SHA1_NI(sha_1_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, sha_1_ooo, job,
+                                SUBMIT_JOB_SHA1_NI(sha_1_ooo, job));
 #endif
-                return SUBMIT_JOB_SHA1(sha_1_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, sha_1_ooo, job,
+                        SUBMIT_JOB_SHA1(sha_1_ooo, job));
         case IMB_AUTH_SHA_224:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_SHA224_NI(sha_224_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, sha_224_ooo, job,
+                                SUBMIT_JOB_SHA224_NI(sha_224_ooo, job));
 #endif
-                return SUBMIT_JOB_SHA224(sha_224_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, sha_224_ooo, job,
+                        SUBMIT_JOB_SHA224(sha_224_ooo, job));
         case IMB_AUTH_SHA_256:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return SUBMIT_JOB_SHA256_NI(sha_256_ooo, job);
+                        return OOO_STATS_SUBMIT_HASH(state, sha_256_ooo, job,
+                                SUBMIT_JOB_SHA256_NI(sha_256_ooo, job));
 #endif
-                return SUBMIT_JOB_SHA256(sha_256_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, sha_256_ooo, job,
+                        SUBMIT_JOB_SHA256(sha_256_ooo, job));
         case IMB_AUTH_SHA_384:
-                return SUBMIT_JOB_SHA384(sha_384_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, sha_384_ooo, job,
+                        SUBMIT_JOB_SHA384(sha_384_ooo, job));
         case IMB_AUTH_SHA_512:
-                return SUBMIT_JOB_SHA512(sha_512_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, sha_512_ooo, job,
+                        SUBMIT_JOB_SHA512(sha_512_ooo, job));
         case IMB_AUTH_ZUC_EIA3_BITLEN:
-                return SUBMIT_JOB_ZUC_EIA3(zuc_eia3_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, zuc_eia3_ooo, job,
+                        SUBMIT_JOB_ZUC_EIA3(zuc_eia3_ooo, job));
         case IMB_AUTH_ZUC256_EIA3_BITLEN:
-                return SUBMIT_JOB_ZUC256_EIA3(zuc256_eia3_ooo, job,
-                                        job->auth_tag_output_len_in_bytes);
+                return OOO_STATS_SUBMIT_HASH(state, zuc256_eia3_ooo, job,
+                        SUBMIT_JOB_ZUC256_EIA3(zuc256_eia3_ooo, job,
+                                        job->auth_tag_output_len_in_bytes));
         case IMB_AUTH_SNOW3G_UIA2_BITLEN:
 #if defined (SSE) || defined (AVX512)
-                return SUBMIT_JOB_SNOW3G_UIA2(snow3g_uia2_ooo, job);
+                return OOO_STATS_SUBMIT_HASH(state, snow3g_uia2_ooo, job,
+                        SUBMIT_JOB_SNOW3G_UIA2(snow3g_uia2_ooo, job));
 #else
                 IMB_SNOW3G_F9_1_BUFFER(state, (const snow3g_key_schedule_t *)
                                job->u.SNOW3G_UIA2._key,
@@ -737,6 +1576,10 @@ SUBMIT_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
                 return job;
 #endif
         case IMB_AUTH_KASUMI_UIA1:
+#ifdef SUBMIT_JOB_KASUMI_UIA1_MB
+                return OOO_STATS_SUBMIT_HASH(state, kasumi_uia1_ooo, job,
+                        SUBMIT_JOB_KASUMI_UIA1_MB(state->kasumi_uia1_ooo, job));
+#else
                 IMB_KASUMI_F9_1_BUFFER(state, (const kasumi_key_sched_t *)
                                job->u.KASUMI_UIA1._key,
                                job->src + job->hash_start_src_offset_in_bytes,
@@ -744,6 +1587,7 @@ SUBMIT_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
                                job->auth_tag_output);
                 job->status |= IMB_STATUS_COMPLETED_AUTH;
                 return job;
+#endif
         case IMB_AUTH_AES_GMAC_128:
                 process_gmac(state, job, IMB_KEY_128_BYTES);
                 job->status |= IMB_STATUS_COMPLETED_AUTH;
@@ -757,57 +1601,48 @@ SUBMIT_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
                 job->status |= IMB_STATUS_COMPLETED_AUTH;
                 return job;
         case IMB_AUTH_POLY1305:
+#ifdef SUBMIT_JOB_POLY1305_MB
+                return submit_job_poly1305_mb(state, job);
+#else
                 POLY1305_MAC(job);
                 job->status |= IMB_STATUS_COMPLETED_AUTH;
                 return job;
+#endif
+#ifdef SUBMIT_JOB_CRC
         case IMB_AUTH_CRC32_ETHERNET_FCS:
-                CRC(IMB_CRC32_ETHERNET_FCS, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC32_SCTP:
-                CRC(IMB_CRC32_SCTP, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC32_WIMAX_OFDMA_DATA:
-                CRC(IMB_CRC32_WIMAX_OFDMA_DATA, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC24_LTE_A:
-                CRC(IMB_CRC24_LTE_A, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC24_LTE_B:
-                CRC(IMB_CRC24_LTE_B, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC16_X25:
-                CRC(IMB_CRC16_X25, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC16_FP_DATA:
-                CRC(IMB_CRC16_FP_DATA, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC11_FP_HEADER:
-                CRC(IMB_CRC11_FP_HEADER, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC10_IUUP_DATA:
-                CRC(IMB_CRC10_IUUP_DATA, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC8_WIMAX_OFDMA_HCS:
-                CRC(IMB_CRC8_WIMAX_OFDMA_HCS, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC7_FP_HEADER:
-                CRC(IMB_CRC7_FP_HEADER, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
         case IMB_AUTH_CRC6_IUUP_HEADER:
-                CRC(IMB_CRC6_IUUP_HEADER, state, job);
-                job->status |= IMB_STATUS_COMPLETED_AUTH;
-                return job;
+#ifdef SUBMIT_JOB_CRC_MAX_LEN
+                if (job->msg_len_to_hash_in_bytes < SUBMIT_JOB_CRC_MIN_LEN ||
+                    job->msg_len_to_hash_in_bytes > SUBMIT_JOB_CRC_MAX_LEN)
+                        return process_crc(state, job);
+#endif
+                return OOO_STATS_SUBMIT_HASH(state, crc_ooo, job,
+                        SUBMIT_JOB_CRC(state->crc_ooo, job));
+#else
+        case IMB_AUTH_CRC32_ETHERNET_FCS:
+        case IMB_AUTH_CRC32_SCTP:
+        case IMB_AUTH_CRC32_WIMAX_OFDMA_DATA:
+        case IMB_AUTH_CRC24_LTE_A:
+        case IMB_AUTH_CRC24_LTE_B:
+        case IMB_AUTH_CRC16_X25:
+        case IMB_AUTH_CRC16_FP_DATA:
+        case IMB_AUTH_CRC11_FP_HEADER:
+        case IMB_AUTH_CRC10_IUUP_DATA:
+        case IMB_AUTH_CRC8_WIMAX_OFDMA_HCS:
+        case IMB_AUTH_CRC7_FP_HEADER:
+        case IMB_AUTH_CRC6_IUUP_HEADER:
+                return process_crc(state, job);
+#endif
         case IMB_AUTH_GHASH:
                 return process_ghash(state, job);
         default:
@@ -850,74 +1685,126 @@ FLUSH_JOB_HASH(IMB_MGR *state, IMB_JOB *job)
         case IMB_AUTH_HMAC_SHA_1:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_HMAC_NI(hmac_sha_1_ooo);
+                        return OOO_STATS_FLUSH(state, hmac_sha_1_ooo,
+                                FLUSH_JOB_HMAC_NI(hmac_sha_1_ooo));
 #endif
-                return FLUSH_JOB_HMAC(hmac_sha_1_ooo);
+                return OOO_STATS_FLUSH(state, hmac_sha_1_ooo,
+                        FLUSH_JOB_HMAC(hmac_sha_1_ooo));
         case IMB_AUTH_HMAC_SHA_224:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_HMAC_SHA_224_NI
-                                (hmac_sha_224_ooo);
+                        return OOO_STATS_FLUSH(state, hmac_sha_224_ooo,
+                                FLUSH_JOB_HMAC_SHA_224_NI(hmac_sha_224_ooo));
 #endif
-                return FLUSH_JOB_HMAC_SHA_224(hmac_sha_224_ooo);
+                return OOO_STATS_FLUSH(state, hmac_sha_224_ooo,
+                        FLUSH_JOB_HMAC_SHA_224(hmac_sha_224_ooo));
         case IMB_AUTH_HMAC_SHA_256:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_HMAC_SHA_256_NI
-                                (hmac_sha_256_ooo);
+                        return OOO_STATS_FLUSH(state, hmac_sha_256_ooo,
+                                FLUSH_JOB_HMAC_SHA_256_NI(hmac_sha_256_ooo));
 #endif
-                return FLUSH_JOB_HMAC_SHA_256(hmac_sha_256_ooo);
+                return OOO_STATS_FLUSH(state, hmac_sha_256_ooo,
+                        FLUSH_JOB_HMAC_SHA_256(hmac_sha_256_ooo));
         case IMB_AUTH_HMAC_SHA_384:
-                return FLUSH_JOB_HMAC_SHA_384(hmac_sha_384_ooo);
+                return OOO_STATS_FLUSH(state, hmac_sha_384_ooo,
+                        FLUSH_JOB_HMAC_SHA_384(hmac_sha_384_ooo));
         case IMB_AUTH_HMAC_SHA_512:
-                return FLUSH_JOB_HMAC_SHA_512(hmac_sha_512_ooo);
+                return OOO_STATS_FLUSH(state, hmac_sha_512_ooo,
+                        FLUSH_JOB_HMAC_SHA_512(hmac_sha_512_ooo));
         case IMB_AUTH_SHA_1:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_SHA1_NI(sha_1_ooo, job);
+                        return OOO_STATS_FLUSH(state, sha_1_ooo,
+                                FLUSH_JOB_SHA1_NI(sha_1_ooo, job));
 #endif
-                return FLUSH_JOB_SHA1(sha_1_ooo, job);
+                return OOO_STATS_FLUSH(state, sha_1_ooo,
+                        FLUSH_JOB_SHA1(sha_1_ooo, job));
         case IMB_AUTH_SHA_224:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_SHA224_NI(sha_224_ooo, job);
+                        return OOO_STATS_FLUSH(state, sha_224_ooo,
+                                FLUSH_JOB_SHA224_NI(sha_224_ooo, job));
 #endif
-                return FLUSH_JOB_SHA224(sha_224_ooo, job);
+                return OOO_STATS_FLUSH(state, sha_224_ooo,
+                        FLUSH_JOB_SHA224(sha_224_ooo, job));
         case IMB_AUTH_SHA_256:
 #ifdef HASH_USE_SHAEXT
                 if (state->features & IMB_FEATURE_SHANI)
-                        return FLUSH_JOB_SHA256_NI(sha_256_ooo, job);
+                        return OOO_STATS_FLUSH(state, sha_256_ooo,
+                                FLUSH_JOB_SHA256_NI(sha_256_ooo, job));
 #endif
-                return FLUSH_JOB_SHA256(sha_256_ooo, job);
+                return OOO_STATS_FLUSH(state, sha_256_ooo,
+                        FLUSH_JOB_SHA256(sha_256_ooo, job));
         case IMB_AUTH_SHA_384:
-                return FLUSH_JOB_SHA384(sha_384_ooo, job);
+                return OOO_STATS_FLUSH(state, sha_384_ooo,
+                        FLUSH_JOB_SHA384(sha_384_ooo, job));
         case IMB_AUTH_SHA_512:
-                return FLUSH_JOB_SHA512(sha_512_ooo, job);
+                return OOO_STATS_FLUSH(state, sha_512_ooo,
+                        FLUSH_JOB_SHA512(sha_512_ooo, job));
         case IMB_AUTH_AES_XCBC:
-                return FLUSH_JOB_AES_XCBC(aes_xcbc_ooo);
+                return OOO_STATS_FLUSH(state, aes_xcbc_ooo,
+                        FLUSH_JOB_AES_XCBC(aes_xcbc_ooo));
         case IMB_AUTH_MD5:
-                return FLUSH_JOB_HMAC_MD5(hmac_md5_ooo);
+                return OOO_STATS_FLUSH(state, hmac_md5_ooo,
+                        FLUSH_JOB_HMAC_MD5(hmac_md5_ooo));
         case IMB_AUTH_CUSTOM:
                 return FLUSH_JOB_CUSTOM_HASH(job);
         case IMB_AUTH_AES_CCM:
                 if (16 == job->key_len_in_bytes) {
-                        return FLUSH_JOB_AES128_CCM_AUTH(aes_ccm_ooo);
+                        return OOO_STATS_FLUSH(state, aes_ccm_ooo,
+                                FLUSH_JOB_AES128_CCM_AUTH(aes_ccm_ooo));
                 } else { /* assume 32 */
-                        return FLUSH_JOB_AES256_CCM_AUTH(aes256_ccm_ooo);
+                        return OOO_STATS_FLUSH(state, aes256_ccm_ooo,
+                                FLUSH_JOB_AES256_CCM_AUTH(aes256_ccm_ooo));
                 }
         case IMB_AUTH_AES_CMAC:
         case IMB_AUTH_AES_CMAC_BITLEN:
-                return FLUSH_JOB_AES128_CMAC_AUTH(aes_cmac_ooo);
+                return OOO_STATS_FLUSH(state, aes_cmac_ooo,
+                        FLUSH_JOB_AES128_CMAC_AUTH(aes_cmac_ooo));
         case IMB_AUTH_AES_CMAC_256:
-                return FLUSH_JOB_AES256_CMAC_AUTH(aes256_cmac_ooo);
+                return OOO_STATS_FLUSH(state, aes256_cmac_ooo,
+                        FLUSH_JOB_AES256_CMAC_AUTH(aes256_cmac_ooo));
         case IMB_AUTH_ZUC_EIA3_BITLEN:
-                return FLUSH_JOB_ZUC_EIA3(zuc_eia3_ooo);
+                return OOO_STATS_FLUSH(state, zuc_eia3_ooo,
+                        FLUSH_JOB_ZUC_EIA3(zuc_eia3_ooo));
         case IMB_AUTH_ZUC256_EIA3_BITLEN:
-                return FLUSH_JOB_ZUC256_EIA3(zuc256_eia3_ooo,
-                                             job->auth_tag_output_len_in_bytes);
+                return OOO_STATS_FLUSH(state, zuc256_eia3_ooo,
+                        FLUSH_JOB_ZUC256_EIA3(zuc256_eia3_ooo,
+                                        job->auth_tag_output_len_in_bytes));
 #if defined(SSE) || defined (AVX512)
         case IMB_AUTH_SNOW3G_UIA2_BITLEN:
-                return FLUSH_JOB_SNOW3G_UIA2(snow3g_uia2_ooo);
+                return OOO_STATS_FLUSH(state, snow3g_uia2_ooo,
+                        FLUSH_JOB_SNOW3G_UIA2(snow3g_uia2_ooo));
+#endif
+#ifdef FLUSH_JOB_CRC
+        case IMB_AUTH_CRC32_ETHERNET_FCS:
+        case IMB_AUTH_CRC32_SCTP:
+        case IMB_AUTH_CRC32_WIMAX_OFDMA_DATA:
+        case IMB_AUTH_CRC24_LTE_A:
+        case IMB_AUTH_CRC24_LTE_B:
+        case IMB_AUTH_CRC16_X25:
+        case IMB_AUTH_CRC16_FP_DATA:
+        case IMB_AUTH_CRC11_FP_HEADER:
+        case IMB_AUTH_CRC10_IUUP_DATA:
+        case IMB_AUTH_CRC8_WIMAX_OFDMA_HCS:
+        case IMB_AUTH_CRC7_FP_HEADER:
+        case IMB_AUTH_CRC6_IUUP_HEADER:
+                return OOO_STATS_FLUSH(state, crc_ooo,
+                        FLUSH_JOB_CRC(state->crc_ooo));
+#endif
+#ifdef FLUSH_JOB_POLY1305_MB
+        case IMB_AUTH_POLY1305:
+                if (!(job->status & IMB_STATUS_COMPLETED_AUTH) &&
+                    state->poly1305_ooo != NULL)
+                        return OOO_STATS_FLUSH(state, poly1305_ooo,
+                                FLUSH_JOB_POLY1305_MB(state->poly1305_ooo));
+                return NULL;
+#endif
+#ifdef FLUSH_JOB_KASUMI_UIA1_MB
+        case IMB_AUTH_KASUMI_UIA1:
+                return OOO_STATS_FLUSH(state, kasumi_uia1_ooo,
+                        FLUSH_JOB_KASUMI_UIA1_MB(state->kasumi_uia1_ooo));
 #endif
         default: /* assume GCM or IMB_AUTH_NULL */
                 if (!(job->status & IMB_STATUS_COMPLETED_AUTH)) {
@@ -1054,6 +1941,13 @@ is_job_invalid(IMB_MGR *state, const IMB_JOB *job,
                 imb_set_errno(state, IMB_ERR_JOB_CIPH_DIR);
                 return 1;
         }
+        /* OOO managers are allocated for enabled algorithms only */
+        if (cipher_mode < IMB_CIPHER_NUM && hash_alg < IMB_AUTH_NUM &&
+            ((state->cipher_mask & IMB_CIPHER_MASK(cipher_mode)) == 0 ||
+             (state->hash_mask & IMB_HASH_MASK(hash_alg)) == 0)) {
+                imb_set_errno(state, IMB_ERR_ALGO_NOT_ENABLED);
+                return 1;
+        }
         switch (cipher_mode) {
         case IMB_CIPHER_CBC:
         case IMB_CIPHER_CBCS_1_9:
@@ -1766,6 +2660,93 @@ is_job_invalid(IMB_MGR *state, const IMB_JOB *job,
                         return 1;
                 }
                 break;
+        case IMB_CIPHER_XTS:
+#ifndef SUBMIT_JOB_AES128_XTS_ENC
+                /* not supported by this architecture */
+                imb_set_errno(state, IMB_ERR_CIPH_MODE);
+                return 1;
+#endif
+                if (job->src == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_SRC);
+                        return 1;
+                }
+                if (job->dst == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_DST);
+                        return 1;
+                }
+                if (job->iv == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_IV);
+                        return 1;
+                }
+                if (cipher_direction == IMB_DIR_ENCRYPT &&
+                    job->enc_keys == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_KEY);
+                        return 1;
+                }
+                if (cipher_direction == IMB_DIR_DECRYPT &&
+                    job->dec_keys == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_KEY);
+                        return 1;
+                }
+                if (job->cipher_fields.XTS.tweak_keys == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_KEY);
+                        return 1;
+                }
+                if (key_len_in_bytes != UINT64_C(16) &&
+                    key_len_in_bytes != UINT64_C(32)) {
+                        imb_set_errno(state, IMB_ERR_JOB_KEY_LEN);
+                        return 1;
+                }
+                if (job->iv_len_in_bytes != UINT64_C(16)) {
+                        imb_set_errno(state, IMB_ERR_JOB_IV_LEN);
+                        return 1;
+                }
+                /* at least one full block, at most 2^20 blocks (IEEE 1619) */
+                if (job->msg_len_to_cipher_in_bytes < UINT64_C(16) ||
+                    job->msg_len_to_cipher_in_bytes > (UINT64_C(1) << 24)) {
+                        imb_set_errno(state, IMB_ERR_JOB_CIPH_LEN);
+                        return 1;
+                }
+                break;
+        case IMB_CIPHER_CFB:
+#ifndef SUBMIT_JOB_AES128_CFB_ENC
+                /* not supported by this architecture */
+                imb_set_errno(state, IMB_ERR_CIPH_MODE);
+                return 1;
+#endif
+                if (job->src == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_SRC);
+                        return 1;
+                }
+                if (job->dst == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_DST);
+                        return 1;
+                }
+                if (job->iv == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_IV);
+                        return 1;
+                }
+                /* encryption key schedule is used in both directions */
+                if (job->enc_keys == NULL) {
+                        imb_set_errno(state, IMB_ERR_JOB_NULL_KEY);
+                        return 1;
+                }
+                if (key_len_in_bytes != UINT64_C(16) &&
+                    key_len_in_bytes != UINT64_C(24) &&
+                    key_len_in_bytes != UINT64_C(32)) {
+                        imb_set_errno(state, IMB_ERR_JOB_KEY_LEN);
+                        return 1;
+                }
+                if (job->iv_len_in_bytes != UINT64_C(16)) {
+                        imb_set_errno(state, IMB_ERR_JOB_IV_LEN);
+                        return 1;
+                }
+                if (job->msg_len_to_cipher_in_bytes == 0 ||
+                    job->msg_len_to_cipher_in_bytes > MB_MAX_LEN16) {
+                        imb_set_errno(state, IMB_ERR_JOB_CIPH_LEN);
+                        return 1;
+                }
+                break;
         default:
                 imb_set_errno(state, IMB_ERR_CIPH_MODE);
                 return 1;
@@ -2454,12 +3435,21 @@ IMB_JOB *RESUBMIT_JOB(IMB_MGR *state, IMB_JOB *job)
 __forceinline
 IMB_JOB *submit_new_job(IMB_MGR *state, IMB_JOB *job)
 {
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+        /* cipher and hash done in one pass */
+        if (is_job_stitched(state, job)) {
+                job = submit_job_stitched(state, job);
+                completion_ring_push(state, job);
+                return job;
+        }
+#endif
 	if (job->chain_order == IMB_ORDER_CIPHER_HASH)
 		job = SUBMIT_JOB_AES(state, job);
 	else
 		job = SUBMIT_JOB_HASH(state, job);
 
         job = RESUBMIT_JOB(state, job);
+        completion_ring_push(state, job);
 	return job;
 }
 
@@ -2475,23 +3465,39 @@ uint32_t complete_job(IMB_MGR *state, IMB_JOB *job)
         if (job->chain_order == IMB_ORDER_CIPHER_HASH) {
                 /* while() loop optimized for cipher_hash order */
                 while (job->status < IMB_STATUS_COMPLETED) {
-                        IMB_JOB *tmp = FLUSH_JOB_AES(state, job);
+                        IMB_JOB *tmp;
+
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+                        if (is_job_stitched(state, job))
+                                tmp = flush_job_stitched(state, job);
+                        else
+#endif
+                                tmp = FLUSH_JOB_AES(state, job);
 
                         if (tmp == NULL)
                                 tmp = FLUSH_JOB_HASH(state, job);
 
-                        (void) RESUBMIT_JOB(state, tmp);
+                        tmp = RESUBMIT_JOB(state, tmp);
+                        completion_ring_push(state, tmp);
                         completed_jobs++;
                 }
         } else {
                 /* while() loop optimized for hash_cipher order */
                 while (job->status < IMB_STATUS_COMPLETED) {
-                        IMB_JOB *tmp = FLUSH_JOB_HASH(state, job);
+                        IMB_JOB *tmp;
+
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+                        if (is_job_stitched(state, job))
+                                tmp = flush_job_stitched(state, job);
+                        else
+#endif
+                                tmp = FLUSH_JOB_HASH(state, job);
 
                         if (tmp == NULL)
                                 tmp = FLUSH_JOB_AES(state, job);
 
-                        (void) RESUBMIT_JOB(state, tmp);
+                        tmp = RESUBMIT_JOB(state, tmp);
+                        completion_ring_push(state, tmp);
                         completed_jobs++;
                 }
         }
@@ -2499,13 +3505,95 @@ uint32_t complete_job(IMB_MGR *state, IMB_JOB *job)
         return completed_jobs;
 }
 
+/*
+ * Job returned by an OOO manager in a burst path. Jobs of the job ring,
+ * submitted with the job API and returned by the burst submit/flush,
+ * continue their cipher/hash chain and go to the completion ring.
+ *
+ * @return 1 for a burst job, 0 for a job of the job ring
+ */
+__forceinline
+int burst_job_returned(IMB_MGR *state, IMB_JOB *job)
+{
+        if (!completion_is_ring_job(state, job))
+                return 1;
+
+        completion_ring_push(state, RESUBMIT_JOB(state, job));
+        return 0;
+}
+
+/*
+ * Job ring bookkeeping of submit_job() in IMB_COMPLETION_MODE_OUT_OF_ORDER.
+ * Completed jobs are already queued, so the earliest job is only completed
+ * and returned when the job ring is full (or past the flush deadline).
+ */
 __forceinline
 IMB_JOB *
-submit_job_and_check(IMB_MGR *state, const int run_check)
+submit_job_ooo_completion(IMB_MGR *state, const uint64_t tsc)
 {
         IMB_JOB *job = NULL;
 
-        /* reset error status */
+        if (state->earliest_job < 0)
+                state->earliest_job = state->next_job;
+
+        ADV_JOBS(state, &state->next_job);
+
+        if (state->earliest_job == state->next_job) {
+                /* Full */
+                IMB_JOB *earliest = JOBS(state, state->earliest_job);
+                uint8_t *delivered =
+                        completion_job_delivered(state, state->earliest_job);
+
+                (void) complete_job(state, earliest);
+                if (*delivered == 0) {
+                        /* not handed back yet - return it */
+                        completion_ring_remove(state, earliest);
+                        *delivered = 1;
+                        job = earliest;
+                }
+        } else if (state->flush_deadline != 0) {
+                IMB_JOB *earliest = JOBS(state, state->earliest_job);
+
+                if (earliest->status < IMB_STATUS_COMPLETED &&
+                    (tsc - *JOB_TSC(state, state->earliest_job)) >=
+                    state->flush_deadline)
+                        (void) complete_job(state, earliest);
+        }
+
+        completion_ring_release(state);
+        return job;
+}
+
+/*
+ * flush_job() in IMB_COMPLETION_MODE_OUT_OF_ORDER:
+ * completes all jobs in flight and hands back the next completed job
+ */
+__forceinline
+IMB_JOB *
+flush_job_ooo_completion(IMB_MGR *state)
+{
+        int offset = state->earliest_job;
+
+        do {
+                IMB_JOB *job = JOBS(state, offset);
+
+                if (job->status < IMB_STATUS_COMPLETED)
+                        (void) complete_job(state, job);
+                ADV_JOBS(state, &offset);
+        } while (offset != state->next_job);
+
+        completion_ring_release(state);
+        return completion_ring_pop(state);
+}
+
+__forceinline
+IMB_JOB *
+submit_job_and_check(IMB_MGR *state, const int run_check)
+{
+        IMB_JOB *job = NULL;
+        uint64_t tsc = 0;
+
+        /* reset error status */
         imb_set_errno(state, 0);
 
         if (run_check) {
@@ -2523,12 +3611,18 @@ submit_job_and_check(IMB_MGR *state, const int run_check)
 
         job = JOBS(state, state->next_job);
 
+        if (state->flush_deadline != 0) {
+                tsc = __rdtsc();
+                *JOB_TSC(state, state->next_job) = tsc;
+        }
+
         if (run_check) {
                 if (is_job_invalid(state, job,
                                    job->cipher_mode, job->hash_alg,
                                    job->cipher_direction,
                                    job->key_len_in_bytes)) {
                         job->status = IMB_STATUS_INVALID_ARGS;
+                        completion_ring_push(state, job);
                 } else {
                         job->status = IMB_STATUS_BEING_PROCESSED;
                         job = submit_new_job(state, job);
@@ -2538,32 +3632,46 @@ submit_job_and_check(IMB_MGR *state, const int run_check)
                 job = submit_new_job(state, job);
         }
 
+        if (state->completion_mode == IMB_COMPLETION_MODE_OUT_OF_ORDER) {
+                job = submit_job_ooo_completion(state, tsc);
+                goto exit;
+        }
+
         if (state->earliest_job < 0) {
                 /* state was previously empty */
                 if (job == NULL)
                         state->earliest_job = state->next_job;
-                ADV_JOBS(&state->next_job);
+                ADV_JOBS(state, &state->next_job);
                 goto exit;
         }
 
-        ADV_JOBS(&state->next_job);
+        ADV_JOBS(state, &state->next_job);
 
         if (state->earliest_job == state->next_job) {
                 /* Full */
                 job = JOBS(state, state->earliest_job);
                 (void) complete_job(state, job);
-                ADV_JOBS(&state->earliest_job);
+                ADV_JOBS(state, &state->earliest_job);
                 goto exit;
         }
 
         /* not full */
         job = JOBS(state, state->earliest_job);
         if (job->status < IMB_STATUS_COMPLETED) {
-                job = NULL;
-                goto exit;
+                /*
+                 * Flush the earliest job once it is older than
+                 * the deadline, even if its lanes are not all filled
+                 */
+                if (state->flush_deadline == 0 ||
+                    (tsc - *JOB_TSC(state, state->earliest_job)) <
+                    state->flush_deadline) {
+                        job = NULL;
+                        goto exit;
+                }
+                (void) complete_job(state, job);
         }
 
-        ADV_JOBS(&state->earliest_job);
+        ADV_JOBS(state, &state->earliest_job);
 exit:
 
 #ifndef LINUX
@@ -2606,13 +3714,17 @@ FLUSH_JOB(IMB_MGR *state)
 #ifndef LINUX
         SAVE_XMMS(xmm_save);
 #endif
-        job = JOBS(state, state->earliest_job);
-        (void) complete_job(state, job);
+        if (state->completion_mode == IMB_COMPLETION_MODE_OUT_OF_ORDER) {
+                job = flush_job_ooo_completion(state);
+        } else {
+                job = JOBS(state, state->earliest_job);
+                (void) complete_job(state, job);
 
-        ADV_JOBS(&state->earliest_job);
+                ADV_JOBS(state, &state->earliest_job);
 
-        if (state->earliest_job == state->next_job)
-                state->earliest_job = -1; /* becomes empty */
+                if (state->earliest_job == state->next_job)
+                        state->earliest_job = -1; /* becomes empty */
+        }
 
 #ifndef LINUX
         RESTORE_XMMS(xmm_save);
@@ -2641,7 +3753,7 @@ QUEUE_SIZE(IMB_MGR *state)
                 return 0;
         a = state->next_job / sizeof(IMB_JOB);
         b = state->earliest_job / sizeof(IMB_JOB);
-        return ((a-b) & (IMB_MAX_JOBS-1));
+        return ((a-b) & (state->job_ring_size - 1));
 }
 
 IMB_JOB *
@@ -2658,6 +3770,9 @@ GET_COMPLETED_JOB(IMB_MGR *state)
 #endif
         IMB_JOB *job;
 
+        if (state->completion_mode == IMB_COMPLETION_MODE_OUT_OF_ORDER)
+                return completion_ring_pop(state);
+
         if (state->earliest_job < 0)
                 return NULL;
 
@@ -2665,7 +3780,7 @@ GET_COMPLETED_JOB(IMB_MGR *state)
         if (job->status < IMB_STATUS_COMPLETED)
                 return NULL;
 
-        ADV_JOBS(&state->earliest_job);
+        ADV_JOBS(state, &state->earliest_job);
 
         if (state->earliest_job == state->next_job)
                 state->earliest_job = -1;
@@ -2689,6 +3804,107 @@ GET_NEXT_JOB(IMB_MGR *state)
         return JOBS(state, state->next_job);
 }
 
+/* Max number of job buckets drained by IMB_BURST_MODE_SORTED */
+#define BURST_MAX_BUCKETS 16
+
+/*
+ * Jobs with the same bucket key are processed by the same OOO manager(s).
+ * All fields fit in their bit ranges (key size is at most 32 bytes).
+ */
+__forceinline
+uint32_t burst_job_bucket(IMB_MGR *state, const IMB_JOB *job)
+{
+        uint32_t key = (uint32_t) job->cipher_mode |
+                ((uint32_t) job->hash_alg << 8) |
+                ((uint32_t) job->key_len_in_bytes << 16) |
+                ((uint32_t) job->cipher_direction << 22) |
+                ((uint32_t) job->chain_order << 24);
+
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+        if (is_job_stitched(state, job))
+                key |= 1 << 26;
+#else
+        (void) state;
+#endif
+        return key;
+}
+
+/*
+ * Flushes the OOO manager running the first (stage 0)
+ * or the second (stage 1) operation of the job
+ */
+__forceinline
+IMB_JOB *flush_job_stage(IMB_MGR *state, IMB_JOB *job, const int stage)
+{
+#ifdef SUBMIT_JOB_AES_CBC_HMAC_SHA_1
+        if (is_job_stitched(state, job))
+                return (stage == 0) ? flush_job_stitched(state, job) : NULL;
+#endif
+        if ((job->chain_order == IMB_ORDER_CIPHER_HASH) == (stage == 0))
+                return FLUSH_JOB_AES(state, job);
+        else
+                return FLUSH_JOB_HASH(state, job);
+}
+
+/*
+ * Completes the jobs of a burst in IMB_BURST_MODE_SORTED
+ *
+ * Jobs left in the lanes are bucketed, and the managers running
+ * the first operation of all buckets are drained before the ones running
+ * the second operation. Jobs passed on by the first managers
+ * (e.g. AES-CBC to HMAC) are then all in the lanes of the second ones
+ * when these get drained. Jobs of buckets beyond BURST_MAX_BUCKETS
+ * (or passed on to an already drained manager) are completed one by one.
+ */
+__forceinline
+void complete_burst_sorted(IMB_MGR *state, IMB_JOB *jobs,
+                           const uint32_t n_jobs)
+{
+        uint32_t keys[BURST_MAX_BUCKETS];
+        IMB_JOB *bucket_job[BURST_MAX_BUCKETS];
+        uint32_t i, b, num_buckets = 0;
+        int stage;
+
+        /* one job per bucket identifies its managers */
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+                uint32_t key;
+
+                if (job->status >= IMB_STATUS_COMPLETED)
+                        continue;
+
+                key = burst_job_bucket(state, job);
+                for (b = 0; b < num_buckets; b++)
+                        if (keys[b] == key)
+                                break;
+
+                if (b == num_buckets && num_buckets < BURST_MAX_BUCKETS) {
+                        keys[num_buckets] = key;
+                        bucket_job[num_buckets++] = job;
+                }
+        }
+
+        /* drain each manager once, first stage managers first */
+        for (stage = 0; stage < 2; stage++) {
+                for (b = 0; b < num_buckets; b++) {
+                        IMB_JOB *job;
+
+                        while ((job = flush_job_stage(state, bucket_job[b],
+                                                      stage)) != NULL) {
+                                job = RESUBMIT_JOB(state, job);
+                                completion_ring_push(state, job);
+                        }
+                }
+        }
+
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                if (job->status < IMB_STATUS_COMPLETED)
+                        (void) complete_job(state, job);
+        }
+}
+
 /**
  * Submit multiple jobs to be processed synchronously
  *
@@ -2734,21 +3950,32 @@ uint32_t submit_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
 
                 job->status = IMB_STATUS_BEING_PROCESSED;
 
+                /*
+                 * With multi-buffer AES-GCM and ChaCha20-Poly1305 managers,
+                 * these jobs go through submit_new_job() as any other
+                 * cipher. Jobs left in the lanes are completed below
+                 * by one flush sequence per manager.
+                 */
+#ifndef SUBMIT_JOB_AES128_GCM
                 if (job->cipher_mode == IMB_CIPHER_GCM) {
                         if (job->cipher_direction == IMB_DIR_ENCRYPT)
                                 SUBMIT_JOB_AES_GCM_ENC(state, job);
                         else
                                 SUBMIT_JOB_AES_GCM_DEC(state, job);
                         completed_jobs++;
-                } else if (job->cipher_mode == IMB_CIPHER_GCM_SGL) {
+                } else
+#endif
+                if (job->cipher_mode == IMB_CIPHER_GCM_SGL) {
                         if (job->cipher_direction == IMB_DIR_ENCRYPT)
                                 submit_gcm_sgl_enc(state, job);
                         else
                                 submit_gcm_sgl_dec(state, job);
                         completed_jobs++;
+#ifndef SUBMIT_JOB_CHACHA20_MB
                 } else if (IMB_CIPHER_CHACHA20_POLY1305 == job->cipher_mode) {
                         SUBMIT_JOB_CHACHA20_POLY1305(state, job);
                         completed_jobs++;
+#endif
                 } else if (IMB_CIPHER_CHACHA20_POLY1305_SGL ==
                            job->cipher_mode) {
                         SUBMIT_JOB_CHACHA20_POLY1305_SGL(state, job);
@@ -2763,6 +3990,11 @@ uint32_t submit_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
         if (completed_jobs == n_jobs)
                 return completed_jobs;
 
+        if (state->burst_mode == IMB_BURST_MODE_SORTED) {
+                complete_burst_sorted(state, jobs, n_jobs);
+                return n_jobs;
+        }
+
         /* otherwise complete remaining jobs */
         for (i = 0; i < n_jobs; i++) {
                 IMB_JOB *job = &jobs[i];
@@ -2797,6 +4029,7 @@ uint32_t submit_aes_cbc_burst_enc(IMB_MGR *state,
 {
         uint32_t i, completed_jobs = 0;
         MB_MGR_AES_OOO *aes_ooo = NULL;
+        size_t stats_idx;
 
         IMB_JOB * (*submit_fn)(MB_MGR_AES_OOO *state, IMB_JOB *job) = NULL;
         IMB_JOB * (*flush_fn)(MB_MGR_AES_OOO *state) = NULL;
@@ -2818,14 +4051,17 @@ uint32_t submit_aes_cbc_burst_enc(IMB_MGR *state,
 
         if (key_size == 16) {
                 aes_ooo = state->aes128_ooo;
+                stats_idx = OOO_STATS_IDX(aes128_ooo);
                 submit_fn = SUBMIT_JOB_AES128_ENC;
                 flush_fn = FLUSH_JOB_AES128_ENC;
         } else if (key_size == 24) {
                 aes_ooo = state->aes192_ooo;
+                stats_idx = OOO_STATS_IDX(aes192_ooo);
                 submit_fn = SUBMIT_JOB_AES192_ENC;
                 flush_fn = FLUSH_JOB_AES192_ENC;
         } else { /* assume 32 */
                 aes_ooo = state->aes256_ooo;
+                stats_idx = OOO_STATS_IDX(aes256_ooo);
                 submit_fn = SUBMIT_JOB_AES256_ENC;
                 flush_fn = FLUSH_JOB_AES256_ENC;
         }
@@ -2833,8 +4069,9 @@ uint32_t submit_aes_cbc_burst_enc(IMB_MGR *state,
         for (i = 0; i < n_jobs; i++) {
                 IMB_JOB *job = &jobs[i];
 
-                job = submit_fn(aes_ooo, job);
-                if (job != NULL) {
+                job = OOO_STATS_SUBMIT_IDX(state, stats_idx, job,
+                                           submit_fn(aes_ooo, job), 0);
+                if (job != NULL && burst_job_returned(state, job)) {
                         job->status = IMB_STATUS_COMPLETED;
                         completed_jobs++;
                 }
@@ -2843,7 +4080,10 @@ uint32_t submit_aes_cbc_burst_enc(IMB_MGR *state,
         if (completed_jobs != n_jobs) {
                 IMB_JOB *job = NULL;
 
-                while((job = flush_fn(aes_ooo)) != NULL) {
+                while((job = OOO_STATS_FLUSH_IDX(state, stats_idx,
+                                                 flush_fn(aes_ooo))) != NULL) {
+                        if (!burst_job_returned(state, job))
+                                continue;
                         job->status = IMB_STATUS_COMPLETED;
                         completed_jobs++;
                 }
@@ -2902,6 +4142,123 @@ uint32_t submit_aes_cbc_burst_dec(IMB_MGR *state,
         return completed_jobs;
 }
 
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+__forceinline
+uint32_t submit_aes_cfb_burst_enc(IMB_MGR *state,
+                                  IMB_JOB *jobs,
+                                  const uint32_t n_jobs,
+                                  const IMB_KEY_SIZE_BYTES key_size,
+                                  const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+        MB_MGR_AES_CFB_OOO *cfb_ooo = NULL;
+        size_t stats_idx;
+
+        IMB_JOB * (*submit_fn)(MB_MGR_AES_CFB_OOO *state, IMB_JOB *job) = NULL;
+        IMB_JOB * (*flush_fn)(MB_MGR_AES_CFB_OOO *state) = NULL;
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_CFB, IMB_AUTH_NULL,
+                                           IMB_DIR_ENCRYPT, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        if (key_size == 16) {
+                cfb_ooo = state->aes128_cfb_ooo;
+                stats_idx = OOO_STATS_IDX(aes128_cfb_ooo);
+                submit_fn = SUBMIT_JOB_AES128_CFB_ENC;
+                flush_fn = FLUSH_JOB_AES128_CFB_ENC;
+        } else if (key_size == 24) {
+                cfb_ooo = state->aes192_cfb_ooo;
+                stats_idx = OOO_STATS_IDX(aes192_cfb_ooo);
+                submit_fn = SUBMIT_JOB_AES192_CFB_ENC;
+                flush_fn = FLUSH_JOB_AES192_CFB_ENC;
+        } else { /* assume 32 */
+                cfb_ooo = state->aes256_cfb_ooo;
+                stats_idx = OOO_STATS_IDX(aes256_cfb_ooo);
+                submit_fn = SUBMIT_JOB_AES256_CFB_ENC;
+                flush_fn = FLUSH_JOB_AES256_CFB_ENC;
+        }
+
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job = OOO_STATS_SUBMIT_IDX(state, stats_idx, job,
+                                           submit_fn(cfb_ooo, job), 0);
+                if (job != NULL && burst_job_returned(state, job)) {
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+
+        if (completed_jobs != n_jobs) {
+                IMB_JOB *job = NULL;
+
+                while((job = OOO_STATS_FLUSH_IDX(state, stats_idx,
+                                                 flush_fn(cfb_ooo))) != NULL) {
+                        if (!burst_job_returned(state, job))
+                                continue;
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+
+        return completed_jobs;
+}
+
+__forceinline
+uint32_t submit_aes_cfb_burst_dec(IMB_MGR *state,
+                                  IMB_JOB *jobs,
+                                  const uint32_t n_jobs,
+                                  const IMB_KEY_SIZE_BYTES key_size,
+                                  const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+        IMB_JOB * (*submit_fn)(IMB_JOB *job) = NULL;
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_CFB, IMB_AUTH_NULL,
+                                           IMB_DIR_DECRYPT, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        if (key_size == 16)
+                submit_fn = SUBMIT_JOB_AES128_CFB_DEC;
+        else if (key_size == 24)
+                submit_fn = SUBMIT_JOB_AES192_CFB_DEC;
+        else  /* assume 32 */
+                submit_fn = SUBMIT_JOB_AES256_CFB_DEC;
+
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                submit_fn(job);
+                job->status = IMB_STATUS_COMPLETED;
+                completed_jobs++;
+        }
+
+        return completed_jobs;
+}
+#endif /* SUBMIT_JOB_AES128_CFB_ENC */
+
 __forceinline
 uint32_t submit_aes_ctr_burst(IMB_MGR *state,
                               IMB_JOB *jobs,
@@ -2977,6 +4334,351 @@ uint32_t submit_aes_ctr_burst(IMB_MGR *state,
         return completed_jobs;
 }
 
+/*
+ * AEAD burst functions below take cipher direction and key size from
+ * the burst arguments. These are written into each job, as the underlying
+ * AEAD implementations read them from the job structure.
+ */
+__forceinline
+uint32_t submit_aes_gcm_burst(IMB_MGR *state,
+                              IMB_JOB *jobs,
+                              const uint32_t n_jobs,
+                              const IMB_CIPHER_DIRECTION dir,
+                              const IMB_KEY_SIZE_BYTES key_size,
+                              const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+        IMB_JOB * (*submit_fn)(IMB_MGR *state, IMB_JOB *job) = NULL;
+#ifdef SUBMIT_JOB_AES128_GCM
+        MB_MGR_GCM_OOO *gcm_ooo = NULL;
+        size_t stats_idx;
+        uint32_t n_mb_jobs = 0;
+
+        IMB_JOB * (*submit_mb_fn)(MB_MGR_GCM_OOO *state, IMB_JOB *job) = NULL;
+        IMB_JOB * (*flush_mb_fn)(MB_MGR_GCM_OOO *state) = NULL;
+#endif
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_GCM, IMB_AUTH_AES_GMAC,
+                                           dir, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        if (dir == IMB_DIR_ENCRYPT)
+                submit_fn = SUBMIT_JOB_AES_GCM_ENC;
+        else
+                submit_fn = SUBMIT_JOB_AES_GCM_DEC;
+
+#ifdef SUBMIT_JOB_AES128_GCM
+        if (key_size == 16) {
+                gcm_ooo = state->aes128_gcm_ooo;
+                stats_idx = OOO_STATS_IDX(aes128_gcm_ooo);
+                submit_mb_fn = SUBMIT_JOB_AES128_GCM;
+                flush_mb_fn = FLUSH_JOB_AES128_GCM;
+        } else if (key_size == 24) {
+                gcm_ooo = state->aes192_gcm_ooo;
+                stats_idx = OOO_STATS_IDX(aes192_gcm_ooo);
+                submit_mb_fn = SUBMIT_JOB_AES192_GCM;
+                flush_mb_fn = FLUSH_JOB_AES192_GCM;
+        } else { /* assume 32 */
+                gcm_ooo = state->aes256_gcm_ooo;
+                stats_idx = OOO_STATS_IDX(aes256_gcm_ooo);
+                submit_mb_fn = SUBMIT_JOB_AES256_GCM;
+                flush_mb_fn = FLUSH_JOB_AES256_GCM;
+        }
+#endif
+
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->cipher_direction = dir;
+                job->key_len_in_bytes = key_size;
+                job->status = IMB_STATUS_BEING_PROCESSED;
+#ifdef SUBMIT_JOB_AES128_GCM
+                /*
+                 * Jobs with 12-byte IV and short messages share
+                 * the lanes of the multi-buffer manager (if allocated)
+                 */
+                if (gcm_ooo != NULL && job->iv_len_in_bytes == 12 &&
+                    job->msg_len_to_cipher_in_bytes <= GCM_MB_MAX_MSG_LEN) {
+                        job = OOO_STATS_SUBMIT_IDX(state, stats_idx, job,
+                                                   submit_mb_fn(gcm_ooo,
+                                                                job), 0);
+                        if (job != NULL)
+                                (void) burst_job_returned(state, job);
+                        n_mb_jobs++;
+                        continue;
+                }
+#endif
+                submit_fn(state, job);
+        }
+
+#ifdef SUBMIT_JOB_AES128_GCM
+        /* complete outstanding multi-buffer jobs in one flush sequence */
+        if (n_mb_jobs != 0) {
+                IMB_JOB *job;
+
+                while ((job = OOO_STATS_FLUSH_IDX(state, stats_idx,
+                                                  flush_mb_fn(gcm_ooo))) !=
+                       NULL)
+                        (void) burst_job_returned(state, job);
+        }
+#endif
+
+        for (i = 0; i < n_jobs; i++) {
+                jobs[i].status = IMB_STATUS_COMPLETED;
+                completed_jobs++;
+        }
+
+        return completed_jobs;
+}
+
+__forceinline
+uint32_t submit_aes_ccm_burst(IMB_MGR *state,
+                              IMB_JOB *jobs,
+                              const uint32_t n_jobs,
+                              const IMB_CIPHER_DIRECTION dir,
+                              const IMB_KEY_SIZE_BYTES key_size,
+                              const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+        MB_MGR_CCM_OOO *ccm_ooo = NULL;
+        size_t stats_idx;
+        IMB_JOB *job = NULL;
+
+        IMB_JOB * (*submit_fn)(MB_MGR_CCM_OOO *state, IMB_JOB *job) = NULL;
+        IMB_JOB * (*flush_fn)(MB_MGR_CCM_OOO *state) = NULL;
+        IMB_JOB * (*cipher_fn)(IMB_JOB *job) = NULL;
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_CCM, IMB_AUTH_AES_CCM,
+                                           dir, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        if (key_size == 16) {
+                ccm_ooo = state->aes_ccm_ooo;
+                stats_idx = OOO_STATS_IDX(aes_ccm_ooo);
+                submit_fn = SUBMIT_JOB_AES128_CCM_AUTH;
+                flush_fn = FLUSH_JOB_AES128_CCM_AUTH;
+                cipher_fn = AES_CNTR_CCM_128;
+        } else { /* assume 32 */
+                ccm_ooo = state->aes256_ccm_ooo;
+                stats_idx = OOO_STATS_IDX(aes256_ccm_ooo);
+                submit_fn = SUBMIT_JOB_AES256_CCM_AUTH;
+                flush_fn = FLUSH_JOB_AES256_CCM_AUTH;
+                cipher_fn = AES_CNTR_CCM_256;
+        }
+
+        for (i = 0; i < n_jobs; i++) {
+                jobs[i].cipher_direction = dir;
+                jobs[i].key_len_in_bytes = key_size;
+                jobs[i].status = IMB_STATUS_BEING_PROCESSED;
+        }
+
+        /*
+         * Encryption: CBC-MAC is computed on plaintext first.
+         * Decryption: plaintext is recovered first.
+         */
+        if (dir == IMB_DIR_DECRYPT)
+                for (i = 0; i < n_jobs; i++)
+                        cipher_fn(&jobs[i]);
+
+        /* CBC-MAC of all jobs is computed in parallel by the OOO manager */
+        for (i = 0; i < n_jobs; i++) {
+                job = OOO_STATS_SUBMIT_IDX(state, stats_idx, &jobs[i],
+                                           submit_fn(ccm_ooo, &jobs[i]), 1);
+                if (job != NULL)
+                        (void) burst_job_returned(state, job);
+        }
+
+        while ((job = OOO_STATS_FLUSH_IDX(state, stats_idx,
+                                          flush_fn(ccm_ooo))) != NULL)
+                (void) burst_job_returned(state, job);
+
+        if (dir == IMB_DIR_ENCRYPT)
+                for (i = 0; i < n_jobs; i++)
+                        cipher_fn(&jobs[i]);
+
+        for (i = 0; i < n_jobs; i++) {
+                jobs[i].status = IMB_STATUS_COMPLETED;
+                completed_jobs++;
+        }
+
+        return completed_jobs;
+}
+
+__forceinline
+uint32_t submit_chacha20_poly1305_burst(IMB_MGR *state,
+                                        IMB_JOB *jobs,
+                                        const uint32_t n_jobs,
+                                        const IMB_CIPHER_DIRECTION dir,
+                                        const IMB_KEY_SIZE_BYTES key_size,
+                                        const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+#ifdef SUBMIT_JOB_CHACHA20_POLY1305_MB
+        MB_MGR_CHACHA20_POLY1305_OOO *chacha20_poly1305_ooo =
+                state->chacha20_poly1305_ooo;
+        uint32_t n_mb_jobs = 0;
+#endif
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_CHACHA20_POLY1305,
+                                           IMB_AUTH_CHACHA20_POLY1305,
+                                           dir, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->cipher_direction = dir;
+                job->key_len_in_bytes = key_size;
+                job->status = IMB_STATUS_BEING_PROCESSED;
+#ifdef SUBMIT_JOB_CHACHA20_POLY1305_MB
+                /*
+                 * Short messages, authenticated over the same buffer
+                 * as the one being ciphered, share the lanes of
+                 * the multi-buffer manager (if allocated)
+                 */
+                if (chacha20_poly1305_ooo != NULL &&
+                    job->msg_len_to_cipher_in_bytes <=
+                    CHACHA20_POLY1305_MB_MAX_MSG_LEN &&
+                    job->msg_len_to_hash_in_bytes ==
+                    job->msg_len_to_cipher_in_bytes &&
+                    job->hash_start_src_offset_in_bytes ==
+                    job->cipher_start_src_offset_in_bytes) {
+                        job = OOO_STATS_SUBMIT(state, chacha20_poly1305_ooo,
+                                job, SUBMIT_JOB_CHACHA20_POLY1305_MB(
+                                        chacha20_poly1305_ooo, job));
+                        if (job != NULL)
+                                (void) burst_job_returned(state, job);
+                        n_mb_jobs++;
+                        continue;
+                }
+#endif
+                SUBMIT_JOB_CHACHA20_POLY1305(state, job);
+        }
+
+#ifdef SUBMIT_JOB_CHACHA20_POLY1305_MB
+        /* complete outstanding multi-buffer jobs in one flush sequence */
+        if (n_mb_jobs != 0) {
+                IMB_JOB *job;
+
+                while ((job = OOO_STATS_FLUSH(state, chacha20_poly1305_ooo,
+                        FLUSH_JOB_CHACHA20_POLY1305_MB(
+                                chacha20_poly1305_ooo))) != NULL)
+                        (void) burst_job_returned(state, job);
+        }
+#endif
+
+        for (i = 0; i < n_jobs; i++) {
+                jobs[i].status = IMB_STATUS_COMPLETED;
+                completed_jobs++;
+        }
+
+        return completed_jobs;
+}
+
+/*
+ * Same cipher burst through SUBMIT_JOB_AES_ENC/DEC() and
+ * FLUSH_JOB_AES_ENC/DEC(), without the job ring. Lanes of the cipher's
+ * OOO manager (e.g. 16 ZUC lanes on AVX512) are filled directly from the
+ * job array. Cipher mode, direction and key size are written into each
+ * job, as the cipher implementations read them from the job structure.
+ */
+__forceinline
+uint32_t submit_cipher_burst_x(IMB_MGR *state,
+                               IMB_JOB *jobs,
+                               const uint32_t n_jobs,
+                               const IMB_CIPHER_MODE cipher,
+                               const IMB_CIPHER_DIRECTION dir,
+                               const IMB_KEY_SIZE_BYTES key_size,
+                               const int run_check)
+{
+        uint32_t i, completed_jobs = 0;
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           cipher, IMB_AUTH_NULL,
+                                           dir, key_size)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+
+        /* submit all jobs */
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->cipher_mode = cipher;
+                job->cipher_direction = dir;
+                job->key_len_in_bytes = key_size;
+                job->hash_alg = IMB_AUTH_NULL;
+                job->status = IMB_STATUS_BEING_PROCESSED;
+
+                if (dir == IMB_DIR_ENCRYPT)
+                        job = SUBMIT_JOB_AES_ENC(state, job);
+                else
+                        job = SUBMIT_JOB_AES_DEC(state, job);
+
+                if (job != NULL && burst_job_returned(state, job)) {
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+
+        /* flush any outstanding jobs */
+        if (completed_jobs != n_jobs) {
+                IMB_JOB *job = NULL;
+
+                while ((job = (dir == IMB_DIR_ENCRYPT) ?
+                        FLUSH_JOB_AES_ENC(state, &jobs[0]) :
+                        FLUSH_JOB_AES_DEC(state, &jobs[0])) != NULL) {
+                        if (!burst_job_returned(state, job))
+                                continue;
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+
+        return completed_jobs;
+}
+
 __forceinline
 uint32_t submit_cipher_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
                                        const uint32_t n_jobs,
@@ -3003,9 +4705,36 @@ uint32_t submit_cipher_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
                 else
                         return submit_aes_cbc_burst_dec(state, jobs, n_jobs,
                                                         key_size, run_check);
+#ifdef SUBMIT_JOB_AES128_CFB_ENC
+        case IMB_CIPHER_CFB:
+                if (dir == IMB_DIR_ENCRYPT)
+                        return submit_aes_cfb_burst_enc(state, jobs, n_jobs,
+                                                        key_size, run_check);
+                else
+                        return submit_aes_cfb_burst_dec(state, jobs, n_jobs,
+                                                        key_size, run_check);
+#endif
         case IMB_CIPHER_CNTR:
                 return submit_aes_ctr_burst(state, jobs, n_jobs,
                                             key_size, run_check);
+        case IMB_CIPHER_GCM:
+                return submit_aes_gcm_burst(state, jobs, n_jobs,
+                                            dir, key_size, run_check);
+        case IMB_CIPHER_CCM:
+                return submit_aes_ccm_burst(state, jobs, n_jobs,
+                                            dir, key_size, run_check);
+        case IMB_CIPHER_CHACHA20_POLY1305:
+                return submit_chacha20_poly1305_burst(state, jobs, n_jobs,
+                                                      dir, key_size,
+                                                      run_check);
+        case IMB_CIPHER_ECB:
+        case IMB_CIPHER_DOCSIS_SEC_BPI:
+        case IMB_CIPHER_DOCSIS_DES:
+        case IMB_CIPHER_ZUC_EEA3:
+        case IMB_CIPHER_SNOW3G_UEA2_BITLEN:
+        case IMB_CIPHER_KASUMI_UEA1_BITLEN:
+                return submit_cipher_burst_x(state, jobs, n_jobs, cipher,
+                                             dir, key_size, run_check);
         default:
                 break;
         }
@@ -3045,6 +4774,7 @@ uint32_t submit_burst_hmac_sha_x(IMB_MGR *state,
                                  const int run_check,
                                  const IMB_HASH_ALG hash_alg,
                                  void *ooo_mgr,
+                                 const size_t stats_idx,
                                  IMB_JOB *(*submit_fn)(void *, IMB_JOB *),
                                  IMB_JOB *(*flush_fn)(void *))
 {
@@ -3070,8 +4800,9 @@ uint32_t submit_burst_hmac_sha_x(IMB_MGR *state,
         for (i = 0; i < n_jobs; i++) {
                 IMB_JOB *job = &jobs[i];
 
-                job = submit_fn(ooo_mgr, job);
-                if (job != NULL) {
+                job = OOO_STATS_SUBMIT_IDX(state, stats_idx, job,
+                                           submit_fn(ooo_mgr, job), 1);
+                if (job != NULL && burst_job_returned(state, job)) {
                         job->status = IMB_STATUS_COMPLETED;
                         completed_jobs++;
                 }
@@ -3080,7 +4811,10 @@ uint32_t submit_burst_hmac_sha_x(IMB_MGR *state,
         if (completed_jobs != n_jobs) {
                 IMB_JOB *job = NULL;
 
-                while ((job = flush_fn(ooo_mgr)) != NULL) {
+                while ((job = OOO_STATS_FLUSH_IDX(state, stats_idx,
+                                                  flush_fn(ooo_mgr))) != NULL) {
+                        if (!burst_job_returned(state, job))
+                                continue;
                         job->status = IMB_STATUS_COMPLETED;
                         completed_jobs++;
                 }
@@ -3100,6 +4834,7 @@ uint32_t submit_burst_hmac_sha_1(IMB_MGR *state,
                 return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                                IMB_AUTH_HMAC_SHA_1,
                                                (void *)state->hmac_sha_1_ooo,
+                                               OOO_STATS_IDX(hmac_sha_1_ooo),
                                                (void *)SUBMIT_JOB_HMAC_NI,
                                                (void *)FLUSH_JOB_HMAC_NI);
         }
@@ -3107,6 +4842,7 @@ uint32_t submit_burst_hmac_sha_1(IMB_MGR *state,
         return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                        IMB_AUTH_HMAC_SHA_1,
                                        (void *)state->hmac_sha_1_ooo,
+                                       OOO_STATS_IDX(hmac_sha_1_ooo),
                                        (void *)SUBMIT_JOB_HMAC,
                                        (void *)FLUSH_JOB_HMAC);
 }
@@ -3122,6 +4858,7 @@ uint32_t submit_burst_hmac_sha_224(IMB_MGR *state,
                 return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                              IMB_AUTH_HMAC_SHA_224,
                                              (void *)state->hmac_sha_224_ooo,
+                                             OOO_STATS_IDX(hmac_sha_224_ooo),
                                              (void *)SUBMIT_JOB_HMAC_SHA_224_NI,
                                              (void *)FLUSH_JOB_HMAC_SHA_224_NI);
         }
@@ -3129,6 +4866,7 @@ uint32_t submit_burst_hmac_sha_224(IMB_MGR *state,
         return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                        IMB_AUTH_HMAC_SHA_224,
                                        (void *)state->hmac_sha_224_ooo,
+                                       OOO_STATS_IDX(hmac_sha_224_ooo),
                                        (void *)SUBMIT_JOB_HMAC_SHA_224,
                                        (void *)FLUSH_JOB_HMAC_SHA_224);
 
@@ -3145,6 +4883,7 @@ uint32_t submit_burst_hmac_sha_256(IMB_MGR *state,
                 return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                              IMB_AUTH_HMAC_SHA_256,
                                              (void *)state->hmac_sha_256_ooo,
+                                             OOO_STATS_IDX(hmac_sha_256_ooo),
                                              (void *)SUBMIT_JOB_HMAC_SHA_256_NI,
                                              (void *)FLUSH_JOB_HMAC_SHA_256_NI);
         }
@@ -3152,6 +4891,7 @@ uint32_t submit_burst_hmac_sha_256(IMB_MGR *state,
         return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                        IMB_AUTH_HMAC_SHA_256,
                                        (void *)state->hmac_sha_256_ooo,
+                                       OOO_STATS_IDX(hmac_sha_256_ooo),
                                        (void *)SUBMIT_JOB_HMAC_SHA_256,
                                        (void *)FLUSH_JOB_HMAC_SHA_256);
 }
@@ -3165,6 +4905,7 @@ uint32_t submit_burst_hmac_sha_384(IMB_MGR *state,
         return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                        IMB_AUTH_HMAC_SHA_384,
                                        (void *)state->hmac_sha_384_ooo,
+                                       OOO_STATS_IDX(hmac_sha_384_ooo),
                                        (void *)SUBMIT_JOB_HMAC_SHA_384,
                                        (void *)FLUSH_JOB_HMAC_SHA_384);
 }
@@ -3178,10 +4919,70 @@ uint32_t submit_burst_hmac_sha_512(IMB_MGR *state,
         return submit_burst_hmac_sha_x(state, jobs, n_jobs, run_check,
                                        IMB_AUTH_HMAC_SHA_512,
                                        (void *)state->hmac_sha_512_ooo,
+                                       OOO_STATS_IDX(hmac_sha_512_ooo),
                                        (void *)SUBMIT_JOB_HMAC_SHA_512,
                                        (void *)FLUSH_JOB_HMAC_SHA_512);
 }
 
+/*
+ * Same algorithm hash burst through SUBMIT_JOB_HASH() and
+ * FLUSH_JOB_HASH(), without the job ring. Lanes of the algorithm's
+ * OOO manager are filled directly, the same way as in the job API
+ * (SHA-NI and architecture selection included). Synchronous algorithms
+ * (e.g. GMAC) complete at submit.
+ */
+__forceinline
+uint32_t submit_burst_hash_x(IMB_MGR *state,
+                             IMB_JOB *jobs,
+                             const uint32_t n_jobs,
+                             const int run_check,
+                             const IMB_HASH_ALG hash_alg)
+{
+        uint32_t i, completed_jobs = 0;
+
+        if (run_check) {
+                /* validate jobs */
+                for (i = 0; i < n_jobs; i++) {
+                        IMB_JOB *job = &jobs[i];
+
+                        /* validate job */
+                        if (is_job_invalid(state, job,
+                                           IMB_CIPHER_NULL,
+                                           hash_alg,
+                                           IMB_DIR_ENCRYPT,
+                                           job->key_len_in_bytes)) {
+                                job->status = IMB_STATUS_INVALID_ARGS;
+                                return 0;
+                        }
+                }
+        }
+        /* submit all jobs */
+        for (i = 0; i < n_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->hash_alg = hash_alg;
+                job->status = IMB_STATUS_BEING_PROCESSED;
+                job = SUBMIT_JOB_HASH(state, job);
+                if (job != NULL && burst_job_returned(state, job)) {
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+        /* flush any outstanding jobs */
+        if (completed_jobs != n_jobs) {
+                IMB_JOB *job = NULL;
+
+                while ((job = FLUSH_JOB_HASH(state, &jobs[0])) != NULL) {
+                        if (!burst_job_returned(state, job))
+                                continue;
+                        job->status = IMB_STATUS_COMPLETED;
+                        completed_jobs++;
+                }
+        }
+
+        return completed_jobs;
+}
+
 __forceinline
 uint32_t submit_hash_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
                                      const uint32_t n_jobs,
@@ -3214,6 +5015,39 @@ uint32_t submit_hash_burst_and_check(IMB_MGR *state, IMB_JOB *jobs,
         case IMB_AUTH_HMAC_SHA_512:
                 return submit_burst_hmac_sha_512(state, jobs,
                                                  n_jobs, run_check);
+        case IMB_AUTH_SHA_1:
+        case IMB_AUTH_SHA_224:
+        case IMB_AUTH_SHA_256:
+        case IMB_AUTH_SHA_384:
+        case IMB_AUTH_SHA_512:
+        case IMB_AUTH_AES_XCBC:
+        case IMB_AUTH_AES_CMAC:
+        case IMB_AUTH_AES_CMAC_BITLEN:
+        case IMB_AUTH_AES_CMAC_256:
+        case IMB_AUTH_AES_GMAC_128:
+        case IMB_AUTH_AES_GMAC_192:
+        case IMB_AUTH_AES_GMAC_256:
+        case IMB_AUTH_ZUC_EIA3_BITLEN:
+        case IMB_AUTH_ZUC256_EIA3_BITLEN:
+        case IMB_AUTH_SNOW3G_UIA2_BITLEN:
+                return submit_burst_hash_x(state, jobs, n_jobs, run_check,
+                                           hash);
+#ifdef SUBMIT_JOB_CRC
+        case IMB_AUTH_CRC32_ETHERNET_FCS:
+        case IMB_AUTH_CRC32_SCTP:
+        case IMB_AUTH_CRC32_WIMAX_OFDMA_DATA:
+        case IMB_AUTH_CRC24_LTE_A:
+        case IMB_AUTH_CRC24_LTE_B:
+        case IMB_AUTH_CRC16_X25:
+        case IMB_AUTH_CRC16_FP_DATA:
+        case IMB_AUTH_CRC11_FP_HEADER:
+        case IMB_AUTH_CRC10_IUUP_DATA:
+        case IMB_AUTH_CRC8_WIMAX_OFDMA_HCS:
+        case IMB_AUTH_CRC7_FP_HEADER:
+        case IMB_AUTH_CRC6_IUUP_HEADER:
+                return submit_burst_hash_x(state, jobs, n_jobs, run_check,
+                                           hash);
+#endif
         default:
                 break;
         }
@@ -86,6 +86,7 @@ FIELD	_docsis_aes_lanes_in_use, 8,              8
 FIELD	_docsis_crc_init,         16*16,	  64
 FIELD	_docsis_crc_len,          16*2,           16
 FIELD	_docsis_crc_done,         16*1,           16
+FIELD	_docsis_residual_done,    16*8,           8
 FIELD   _docsis_crc_road_block,   8, 		  8
 END_FIELDS
 %assign _MB_MGR_DOCSIS_AES_OOO_size	_FIELD_OFFSET
@@ -0,0 +1,148 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*
+ * Out-of-order manager counters (see imb_get_stats()).
+ *
+ * Counters are indexed by the position of the OOO manager pointer
+ * in IMB_MGR, so that the index is a compile time constant.
+ * They are updated with plain increments (IMB_MGR is not shared
+ * between threads) and compiled out unless IMB_STATS is defined.
+ */
+
+#ifndef MB_MGR_STATS_H
+#define MB_MGR_STATS_H
+
+#include <stddef.h> /* offsetof() */
+#include <string.h> /* memset() */
+#include "intel-ipsec-mb.h"
+
+#define OOO_STATS_IDX(ooo_name) \
+        ((offsetof(IMB_MGR, ooo_name) - offsetof(IMB_MGR, aes128_ooo)) / \
+         sizeof(void *))
+
+#define OOO_STATS_NUM OOO_STATS_IDX(end_ooo)
+
+__forceinline
+void reset_ooo_stats(IMB_MGR *state)
+{
+        if (state->ooo_stats != NULL)
+                memset(state->ooo_stats, 0,
+                       OOO_STATS_NUM * sizeof(IMB_OOO_STATS));
+}
+
+#ifdef IMB_STATS
+
+__forceinline
+uint64_t ooo_stats_job_bytes(const IMB_JOB *job, const int is_hash)
+{
+        if (is_hash) {
+                switch (job->hash_alg) {
+                case IMB_AUTH_ZUC_EIA3_BITLEN:
+                case IMB_AUTH_ZUC256_EIA3_BITLEN:
+                case IMB_AUTH_SNOW3G_UIA2_BITLEN:
+                /* CMAC OOO managers take the length in bits */
+                case IMB_AUTH_AES_CMAC:
+                case IMB_AUTH_AES_CMAC_BITLEN:
+                case IMB_AUTH_AES_CMAC_256:
+                        return job->msg_len_to_hash_in_bits / 8;
+                default:
+                        return job->msg_len_to_hash_in_bytes;
+                }
+        }
+
+        if (job->cipher_mode == IMB_CIPHER_SNOW3G_UEA2_BITLEN)
+                return job->msg_len_to_cipher_in_bits / 8;
+
+        return job->msg_len_to_cipher_in_bytes;
+}
+
+__forceinline
+void ooo_stats_complete(IMB_OOO_STATS *stats)
+{
+        stats->lanes_in_use += stats->in_flight;
+        stats->in_flight--;
+}
+
+__forceinline
+IMB_JOB *ooo_stats_submit(IMB_MGR *state, const size_t idx,
+                          const IMB_JOB *job_in, IMB_JOB *job_out,
+                          const int is_hash)
+{
+        IMB_OOO_STATS *stats = &state->ooo_stats[idx];
+
+        stats->submits++;
+        stats->bytes += ooo_stats_job_bytes(job_in, is_hash);
+        stats->in_flight++;
+
+        if (job_out != NULL) {
+                stats->dispatches++;
+                ooo_stats_complete(stats);
+        }
+
+        return job_out;
+}
+
+__forceinline
+IMB_JOB *ooo_stats_flush(IMB_MGR *state, const size_t idx, IMB_JOB *job_out)
+{
+        IMB_OOO_STATS *stats = &state->ooo_stats[idx];
+
+        if (job_out != NULL) {
+                stats->flushes++;
+                ooo_stats_complete(stats);
+        }
+
+        return job_out;
+}
+
+/*
+ * 'call' is the submit/flush call of the OOO manager
+ * given by its counter index
+ */
+#define OOO_STATS_SUBMIT_IDX(state, idx, job, call, is_hash) \
+        ooo_stats_submit(state, idx, job, call, is_hash)
+#define OOO_STATS_FLUSH_IDX(state, idx, call) \
+        ooo_stats_flush(state, idx, call)
+
+#else /* IMB_STATS */
+
+#define OOO_STATS_SUBMIT_IDX(state, idx, job, call, is_hash) \
+        ((void) (idx), (call))
+#define OOO_STATS_FLUSH_IDX(state, idx, call) ((void) (idx), (call))
+
+#endif /* IMB_STATS */
+
+/* OOO manager given by its IMB_MGR pointer name */
+#define OOO_STATS_SUBMIT(state, ooo_name, job, call) \
+        OOO_STATS_SUBMIT_IDX(state, OOO_STATS_IDX(ooo_name), job, call, 0)
+#define OOO_STATS_SUBMIT_HASH(state, ooo_name, job, call) \
+        OOO_STATS_SUBMIT_IDX(state, OOO_STATS_IDX(ooo_name), job, call, 1)
+#define OOO_STATS_FLUSH(state, ooo_name, call) \
+        OOO_STATS_FLUSH_IDX(state, OOO_STATS_IDX(ooo_name), call)
+
+#endif /* MB_MGR_STATS_H */
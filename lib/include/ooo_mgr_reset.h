@@ -40,6 +40,33 @@ ooo_mgr_cmac_reset(void *p_ooo_mgr, const unsigned num_lanes);
 IMB_DLL_LOCAL void
 ooo_mgr_ccm_reset(void *p_ooo_mgr, const unsigned num_lanes);
 
+IMB_DLL_LOCAL void
+ooo_mgr_gcm_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_chacha20_poly1305_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_kasumi_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_snow_v_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_aes_xts_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_aes_cfb_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_aes_cbc_hmac_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_aes_ctr_cmac_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
+IMB_DLL_LOCAL void
+ooo_mgr_crc_reset(void *p_ooo_mgr, const unsigned num_lanes);
+
 IMB_DLL_LOCAL
 void ooo_mgr_aes_xcbc_reset(void *p_ooo_mgr, const unsigned num_lanes);
 
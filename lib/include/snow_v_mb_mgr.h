@@ -0,0 +1,351 @@
+/*******************************************************************************
+  Copyright (c) 2022, Intel Corporation
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+      * Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above copyright
+        notice, this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+      * Neither the name of Intel Corporation nor the names of its contributors
+        may be used to endorse or promote products derived from this software
+        without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*
+ * SNOW-V and SNOW-V-AEAD multi-buffer implementation.
+ *
+ * Lanes are grouped by 4: the VAES engines clock the 4 independent
+ * SNOW-V states of a group at once (one state per 128-bit lane).
+ *
+ * New jobs are initialized in batches of up to 4 on a scratch group,
+ * so that the other streams of their groups are not disturbed.
+ * Full keystream blocks are then generated for all groups in use,
+ * until the shortest job is complete. Its final partial block is
+ * produced from a copy of its state.
+ */
+
+#ifndef SNOW_V_MB_MGR_H
+#define SNOW_V_MB_MGR_H
+
+#include <string.h>
+
+#include "intel-ipsec-mb.h"
+#include "include/ipsec_ooo_mgr.h"
+#include "include/clear_regs_mem.h"
+
+/* Type of jobs scheduled on the manager */
+#define SNOW_V_MB       0
+#define SNOW_V_AEAD_MB  1
+
+/* Number of keystream blocks per stream generated by one engine call */
+#define SNOW_V_MB_KS_BLOCKS 16
+
+/* Initializes LFSR/FSM of 4 streams (IV and key loaded in the LFSR) */
+typedef void (*snow_v_mb_init_t)(SNOW_V_X4_STATE *);
+/* Generates num_blocks x 16 bytes of keystream of 4 streams */
+typedef void (*snow_v_mb_keystream_t)(SNOW_V_X4_STATE *, uint8_t *,
+                                      const uint64_t);
+
+__forceinline
+void snow_v_mb_copy_stream(SNOW_V_X4_STATE *dst, const unsigned dst_idx,
+                           const SNOW_V_X4_STATE *src, const unsigned src_idx)
+{
+        dst->lfsr_a_lo[dst_idx] = src->lfsr_a_lo[src_idx];
+        dst->lfsr_a_hi[dst_idx] = src->lfsr_a_hi[src_idx];
+        dst->lfsr_b_lo[dst_idx] = src->lfsr_b_lo[src_idx];
+        dst->lfsr_b_hi[dst_idx] = src->lfsr_b_hi[src_idx];
+        dst->fsm_r1[dst_idx] = src->fsm_r1[src_idx];
+        dst->fsm_r2[dst_idx] = src->fsm_r2[src_idx];
+        dst->fsm_r3[dst_idx] = src->fsm_r3[src_idx];
+}
+
+/* out = in ^ ks, for up to 16 bytes */
+__forceinline
+void snow_v_mb_xor_block(uint8_t *out, const uint8_t *in, const uint8_t *ks,
+                         const uint64_t len)
+{
+        uint64_t i;
+
+        if (len == 16) {
+                uint64_t a[2], b[2];
+
+                memcpy(a, in, sizeof(a));
+                memcpy(b, ks, sizeof(b));
+                a[0] ^= b[0];
+                a[1] ^= b[1];
+                memcpy(out, a, sizeof(a));
+                return;
+        }
+
+        for (i = 0; i < len; i++)
+                out[i] = in[i] ^ ks[i];
+}
+
+/*
+ * Initializes the lanes in the list.
+ * Lanes are moved to a scratch group 4 at a time, initialized there
+ * and moved back to their groups.
+ */
+__forceinline
+void snow_v_mb_init_lanes(MB_MGR_SNOW_V_OOO *state, const unsigned *lanes,
+                          const unsigned num_lanes, const unsigned type,
+                          SNOW_V_X4_STATE *tmp, uint8_t *ks,
+                          const snow_v_mb_init_t init_kernel,
+                          const snow_v_mb_keystream_t ks_kernel)
+{
+        SNOW_V_ARGS *args = &state->args;
+        unsigned i, j;
+
+        for (i = 0; i < num_lanes; i += 4) {
+                const unsigned n = ((num_lanes - i) < 4) ? (num_lanes - i) : 4;
+
+                for (j = 0; j < n; j++) {
+                        const unsigned lane = lanes[i + j];
+
+                        snow_v_mb_copy_stream(tmp, j, &args->state[lane / 4],
+                                              lane % 4);
+                }
+
+                init_kernel(tmp);
+
+                /* AEAD: hkey = keystream_0 and endpad = keystream_1 */
+                if (type == SNOW_V_AEAD_MB)
+                        ks_kernel(tmp, ks, 2);
+
+                for (j = 0; j < n; j++) {
+                        const unsigned lane = lanes[i + j];
+
+                        snow_v_mb_copy_stream(&args->state[lane / 4],
+                                              lane % 4, tmp, j);
+                        if (type == SNOW_V_AEAD_MB) {
+                                memcpy(&args->hkey_endpad[lane][0],
+                                       &ks[j * 16], 16);
+                                memcpy(&args->hkey_endpad[lane][1],
+                                       &ks[64 + j * 16], 16);
+                        }
+                        state->init_done[lane] = 1;
+                }
+        }
+}
+
+__forceinline
+IMB_JOB *
+submit_flush_job_snow_v(MB_MGR_SNOW_V_OOO *state, IMB_JOB *job,
+                        const unsigned max_jobs, const int is_submit,
+                        const unsigned type,
+                        const snow_v_mb_init_t init_kernel,
+                        const snow_v_mb_keystream_t ks_kernel)
+{
+        SNOW_V_ARGS *args = &state->args;
+        DECLARE_ALIGNED(SNOW_V_X4_STATE tmp, 64);
+        DECLARE_ALIGNED(uint8_t ks[SNOW_V_MB_KS_BLOCKS * 64], 64);
+        unsigned lanes[16], init_lanes[16];
+        unsigned groups_inuse = 0;
+        unsigned i, num_lanes = 0, num_init_lanes = 0, min_idx;
+        uint64_t min_len, num_blocks, partial;
+
+        if (is_submit) {
+                /*
+                 * SUBMIT
+                 * - get a free lane id
+                 * - load key and IV into the LFSR of the lane
+                 */
+                const unsigned lane = state->unused_lanes & 15;
+                SNOW_V_X4_STATE *s = &args->state[lane / 4];
+                const unsigned idx = lane % 4;
+                const uint8_t *key = (const uint8_t *) job->enc_keys;
+
+                state->unused_lanes >>= 4;
+                state->num_lanes_inuse++;
+
+                state->job_in_lane[lane] = job;
+                args->in[lane] = job->src +
+                        job->cipher_start_src_offset_in_bytes;
+                args->out[lane] = job->dst;
+                state->lens[lane] = job->msg_len_to_cipher_in_bytes;
+
+                memcpy(&s->lfsr_a_lo[idx], job->iv, 16);
+                memcpy(&s->lfsr_a_hi[idx], &key[0], 16);
+                memcpy(&s->lfsr_b_hi[idx], &key[16], 16);
+                if (type == SNOW_V_AEAD_MB) {
+                        s->lfsr_b_lo[idx].low = 0x20646b4578656c41ULL;
+                        s->lfsr_b_lo[idx].high = 0x6d6f6854676e694aULL;
+                        job->u.SNOW_V_AEAD.reserved = args->hkey_endpad[lane];
+                } else {
+                        s->lfsr_b_lo[idx].low = 0;
+                        s->lfsr_b_lo[idx].high = 0;
+                }
+                state->init_done[lane] = 0;
+
+                /* enough jobs to start processing? */
+                if (state->num_lanes_inuse != max_jobs)
+                        return NULL;
+        } else {
+                /*
+                 * FLUSH
+                 * - return if there are no jobs in the lanes
+                 */
+                if (state->num_lanes_inuse == 0)
+                        return NULL;
+        }
+
+        /* collect lanes in use and lanes to be initialized */
+        for (i = 0; i < max_jobs; i++) {
+                if (state->job_in_lane[i] == NULL)
+                        continue;
+                lanes[num_lanes++] = i;
+                groups_inuse |= 1 << (i / 4);
+                if (state->init_done[i] == 0)
+                        init_lanes[num_init_lanes++] = i;
+        }
+
+        if (num_init_lanes != 0)
+                snow_v_mb_init_lanes(state, init_lanes, num_init_lanes, type,
+                                     &tmp, ks, init_kernel, ks_kernel);
+
+        /* find min common length to process */
+        min_idx = lanes[0];
+        min_len = state->lens[min_idx];
+        for (i = 1; i < num_lanes; i++) {
+                if (min_len > state->lens[lanes[i]]) {
+                        min_idx = lanes[i];
+                        min_len = state->lens[min_idx];
+                }
+        }
+
+        /*
+         * Encrypt/decrypt full blocks of all lanes in parallel,
+         * until the shortest job is down to its final partial block.
+         * Groups with no jobs are not processed, unused streams
+         * of the other groups are processed and their output ignored.
+         */
+        num_blocks = min_len / 16;
+        while (num_blocks != 0) {
+                const uint64_t n = (num_blocks < SNOW_V_MB_KS_BLOCKS) ?
+                        num_blocks : SNOW_V_MB_KS_BLOCKS;
+                unsigned g;
+
+                for (g = 0; g < (max_jobs / 4); g++) {
+                        uint64_t b;
+
+                        if ((groups_inuse & (1 << g)) == 0)
+                                continue;
+
+                        ks_kernel(&args->state[g], ks, n);
+
+                        for (i = g * 4; i < (g * 4 + 4); i++) {
+                                if (state->job_in_lane[i] == NULL)
+                                        continue;
+                                for (b = 0; b < n; b++)
+                                        snow_v_mb_xor_block(
+                                                &args->out[i][b * 16],
+                                                &args->in[i][b * 16],
+                                                &ks[b * 64 + (i % 4) * 16],
+                                                16);
+                                args->in[i] += n * 16;
+                                args->out[i] += n * 16;
+                                state->lens[i] -= n * 16;
+                        }
+                }
+                num_blocks -= n;
+        }
+
+        /* final partial block of the shortest job */
+        partial = state->lens[min_idx];
+        if (partial != 0) {
+                snow_v_mb_copy_stream(&tmp, 0, &args->state[min_idx / 4],
+                                      min_idx % 4);
+                ks_kernel(&tmp, ks, 1);
+                snow_v_mb_xor_block(args->out[min_idx], args->in[min_idx],
+                                    ks, partial);
+                state->lens[min_idx] = 0;
+        }
+
+        job = state->job_in_lane[min_idx];
+        job->status |= IMB_STATUS_COMPLETED_CIPHER;
+
+        /* put back processed lane into unused lanes pool */
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+        state->job_in_lane[min_idx] = NULL;
+
+#ifdef SAFE_DATA
+        {
+                SNOW_V_X4_STATE *s = &args->state[min_idx / 4];
+                const unsigned idx = min_idx % 4;
+
+                /* clear the state of the lane and the scratch buffers */
+                memset(&s->lfsr_a_lo[idx], 0, 16);
+                memset(&s->lfsr_a_hi[idx], 0, 16);
+                memset(&s->lfsr_b_lo[idx], 0, 16);
+                memset(&s->lfsr_b_hi[idx], 0, 16);
+                memset(&s->fsm_r1[idx], 0, 16);
+                memset(&s->fsm_r2[idx], 0, 16);
+                memset(&s->fsm_r3[idx], 0, 16);
+                clear_mem(&tmp, sizeof(tmp));
+                clear_mem(ks, sizeof(ks));
+        }
+#endif
+        return job;
+}
+
+/* ========================================================================== */
+/*
+ * Per-arch SNOW-V and SNOW-V-AEAD MB API.
+ * The arch file defines NUM_SNOW_V_LANES, the SNOW_V_INIT_X4 and
+ * SNOW_V_KEYSTREAM_X4 kernels and the function names below before
+ * including this header.
+ */
+#ifdef SUBMIT_JOB_SNOW_V_MB
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_SNOW_V_MB(MB_MGR_SNOW_V_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_snow_v(state, job, NUM_SNOW_V_LANES, 1,
+                                       SNOW_V_MB, SNOW_V_INIT_X4,
+                                       SNOW_V_KEYSTREAM_X4);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_SNOW_V_MB(MB_MGR_SNOW_V_OOO *state)
+{
+        return submit_flush_job_snow_v(state, NULL, NUM_SNOW_V_LANES, 0,
+                                       SNOW_V_MB, SNOW_V_INIT_X4,
+                                       SNOW_V_KEYSTREAM_X4);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *SUBMIT_JOB_SNOW_V_AEAD_MB(MB_MGR_SNOW_V_OOO *state, IMB_JOB *job)
+{
+        return submit_flush_job_snow_v(state, job, NUM_SNOW_V_LANES, 1,
+                                       SNOW_V_AEAD_MB, SNOW_V_INIT_X4,
+                                       SNOW_V_KEYSTREAM_X4);
+}
+
+IMB_DLL_LOCAL
+IMB_JOB *FLUSH_JOB_SNOW_V_AEAD_MB(MB_MGR_SNOW_V_OOO *state)
+{
+        return submit_flush_job_snow_v(state, NULL, NUM_SNOW_V_LANES, 0,
+                                       SNOW_V_AEAD_MB, SNOW_V_INIT_X4,
+                                       SNOW_V_KEYSTREAM_X4);
+}
+
+#endif /* SUBMIT_JOB_SNOW_V_MB */
+
+#endif /* SNOW_V_MB_MGR_H */
@@ -343,6 +343,10 @@ IMB_DLL_LOCAL void asm_ZucInitialization_8_avx2(ZucKey8_t *pKeys,
                                                 const uint8_t *ivs,
                                                 ZucState8_t *pState);
 
+IMB_DLL_LOCAL void asm_ZucInitialization_8_gfni_avx2(ZucKey8_t *pKeys,
+                                                     const uint8_t *ivs,
+                                                     ZucState8_t *pState);
+
 /**
  ******************************************************************************
  * @description
@@ -378,6 +382,12 @@ IMB_DLL_LOCAL void asm_Zuc256Initialization_8_avx2(ZucKey8_t *pKeys,
                                                    void *tags,
                                                    const uint64_t tag_sz);
 
+IMB_DLL_LOCAL void asm_Zuc256Initialization_8_gfni_avx2(ZucKey8_t *pKeys,
+                                                        const uint8_t *ivs,
+                                                        ZucState8_t *pState,
+                                                        void *tags,
+                                                        const uint64_t tag_sz);
+
 /**
  ******************************************************************************
  * @description
@@ -634,6 +644,9 @@ IMB_DLL_LOCAL void asm_ZucGenKeystream16B_4_avx(ZucState4_t *pState,
 IMB_DLL_LOCAL void asm_ZucGenKeystream32B_8_avx2(ZucState8_t *pState,
                                                  uint32_t *pKeyStr[8]);
 
+IMB_DLL_LOCAL void asm_ZucGenKeystream32B_8_gfni_avx2(ZucState8_t *pState,
+                                                      uint32_t *pKeyStr[8]);
+
 /**
  ******************************************************************************
  *
@@ -864,6 +877,9 @@ IMB_DLL_LOCAL void asm_ZucGenKeystream4B_4_avx(ZucState4_t *pState,
 IMB_DLL_LOCAL void asm_ZucGenKeystream16B_8_avx2(ZucState8_t *pState,
                                                 uint32_t *pKeyStr[8]);
 
+IMB_DLL_LOCAL void asm_ZucGenKeystream16B_8_gfni_avx2(ZucState8_t *pState,
+                                                      uint32_t *pKeyStr[8]);
+
 /**
  ******************************************************************************
  *
@@ -887,6 +903,9 @@ IMB_DLL_LOCAL void asm_ZucGenKeystream16B_8_avx2(ZucState8_t *pState,
 IMB_DLL_LOCAL void asm_ZucGenKeystream8B_8_avx2(ZucState8_t *pState,
                                                 uint32_t *pKeyStr[8]);
 
+IMB_DLL_LOCAL void asm_ZucGenKeystream8B_8_gfni_avx2(ZucState8_t *pState,
+                                                     uint32_t *pKeyStr[8]);
+
 /**
  ******************************************************************************
  *
@@ -910,6 +929,9 @@ IMB_DLL_LOCAL void asm_ZucGenKeystream8B_8_avx2(ZucState8_t *pState,
 IMB_DLL_LOCAL void asm_ZucGenKeystream4B_8_avx2(ZucState8_t *pState,
                                                 uint32_t *pKeyStr[8]);
 
+IMB_DLL_LOCAL void asm_ZucGenKeystream4B_8_gfni_avx2(ZucState8_t *pState,
+                                                     uint32_t *pKeyStr[8]);
+
 /**
  ******************************************************************************
  *
@@ -1180,6 +1202,12 @@ IMB_DLL_LOCAL void asm_ZucCipher_8_avx2(ZucState8_t *pState,
                                         const uint16_t lengths[8],
                                         const uint64_t minLength);
 
+IMB_DLL_LOCAL void asm_ZucCipher_8_gfni_avx2(ZucState8_t *pState,
+                                             const uint64_t *pIn[8],
+                                             uint64_t *pOut[8],
+                                             const uint16_t lengths[8],
+                                             const uint64_t minLength);
+
 /**
  ******************************************************************************
  *
@@ -1493,6 +1521,23 @@ void zuc256_eia3_8_buffer_job_avx2(const void * const pKey[8],
                                    const void * const job_in_lane[8],
                                    const uint64_t tag_size);
 
+IMB_DLL_LOCAL
+void zuc_eia3_8_buffer_job_gfni_avx2(const void * const pKey[8],
+                                     const uint8_t *ivs,
+                                     const void * const pBufferIn[8],
+                                     uint32_t *pMacI[8],
+                                     const uint16_t lengthInBits[8],
+                                     const void * const job_in_lane[8]);
+
+IMB_DLL_LOCAL
+void zuc256_eia3_8_buffer_job_gfni_avx2(const void * const pKey[8],
+                                        const uint8_t *ivs,
+                                        const void * const pBufferIn[8],
+                                        void *pMacI[8],
+                                        const uint16_t lengthInBits[8],
+                                        const void * const job_in_lane[8],
+                                        const uint64_t tag_size);
+
 /* the s-boxes */
 extern const uint8_t S0[256];
 extern const uint8_t S1[256];
@@ -1608,6 +1653,13 @@ void zuc_eea3_n_buffer_avx2(const void * const pKey[], const void * const pIv[],
                             const uint32_t lengthInBytes[],
                             const uint32_t numBuffers);
 
+void zuc_eea3_n_buffer_gfni_avx2(const void * const pKey[],
+                                 const void * const pIv[],
+                                 const void * const pBufferIn[],
+                                 void *pBufferOut[],
+                                 const uint32_t lengthInBytes[],
+                                 const uint32_t numBuffers);
+
 void zuc_eia3_1_buffer_avx2(const void *pKey, const void *pIv,
                             const void *pBufferIn, const uint32_t lengthInBits,
                             uint32_t *pMacI);
@@ -1619,6 +1671,13 @@ void zuc_eia3_n_buffer_avx2(const void * const pKey[],
                             uint32_t *pMacI[],
                             const uint32_t numBuffers);
 
+void zuc_eia3_n_buffer_gfni_avx2(const void * const pKey[],
+                                 const void * const pIv[],
+                                 const void * const pBufferIn[],
+                                 const uint32_t lengthInBits[],
+                                 uint32_t *pMacI[],
+                                 const uint32_t numBuffers);
+
 void zuc_eea3_1_buffer_avx512(const void *pKey, const void *pIv,
                               const void *pBufferIn, void *pBufferOut,
                               const uint32_t lengthInBytes);
@@ -91,8 +91,8 @@ typedef struct {
 /**
  * Library version
  */
-#define IMB_VERSION_STR "1.2.0"
-#define IMB_VERSION_NUM 0x10200
+#define IMB_VERSION_STR "2.0.0"
+#define IMB_VERSION_NUM 0x20000
 
 /**
  * Macro to translate version number
@@ -224,6 +224,11 @@ typedef enum {
         IMB_ERR_JOB_NULL_GHASH_INIT_TAG,
         IMB_ERR_MISSING_CPUFLAGS_INIT_MGR,
         IMB_ERR_NULL_JOB,
+        IMB_ERR_JOB_RING_SIZE,
+        IMB_ERR_NO_STATS,
+        IMB_ERR_ALGO_NOT_ENABLED,
+        IMB_ERR_COMPLETION_MODE,
+        IMB_ERR_BURST_MODE,
         /* add new error types above this comment */
         IMB_ERR_MAX       /* don't move this one */
 } IMB_ERR;
@@ -376,6 +381,8 @@ typedef enum {
         IMB_CIPHER_SNOW_V,
         IMB_CIPHER_SNOW_V_AEAD,
         IMB_CIPHER_GCM_SGL,
+        IMB_CIPHER_XTS,               /**< AES-XTS (IEEE 1619) */
+        IMB_CIPHER_CFB,               /**< AES-CFB128 (NIST SP 800-38A) */
         IMB_CIPHER_NUM
 } IMB_CIPHER_MODE;
 
@@ -638,6 +645,11 @@ typedef struct IMB_JOB {
                         void *next_iv;
                         /**< Pointer to next IV (last ciphertext block) */
                 } CBCS; /**< CBCS specific fields */
+                struct _XTS_specific_fields {
+                        const void *tweak_keys;
+                        /**< Pointer to expanded tweak key (Key2),
+                           encryption key schedule */
+                } XTS; /**< XTS specific fields */
         } cipher_fields; /**< Cipher algorithm-specific fields */
 } IMB_JOB;
 
@@ -782,6 +794,7 @@ typedef IMB_JOB *(*submit_job_t)(struct IMB_MGR *);
 typedef IMB_JOB *(*get_completed_job_t)(struct IMB_MGR *);
 typedef IMB_JOB *(*flush_job_t)(struct IMB_MGR *);
 typedef uint32_t (*queue_size_t)(struct IMB_MGR *);
+typedef void (*imb_completion_cb_t)(IMB_JOB *, void *);
 typedef uint32_t (*submit_burst_t)(struct IMB_MGR *,
                                    struct IMB_JOB *, const uint32_t);
 typedef uint32_t (*submit_cipher_burst_t)(struct IMB_MGR *,
@@ -989,10 +1002,27 @@ typedef uint32_t (*hec_32_t)(const uint8_t *);
 typedef uint64_t (*hec_64_t)(const uint8_t *);
 
 typedef uint32_t (*crc32_fn_t)(const void *, const uint64_t);
+/* Job API completion modes, see imb_set_completion_mode() */
+typedef enum {
+        IMB_COMPLETION_MODE_IN_ORDER = 0, /**< jobs returned in submission
+                                             order */
+        IMB_COMPLETION_MODE_OUT_OF_ORDER, /**< jobs queued as they complete */
+} IMB_COMPLETION_MODE;
+
+/* Burst API job completion modes, see imb_set_burst_mode() */
+typedef enum {
+        IMB_BURST_MODE_ORDERED = 0, /**< jobs forced to completion in
+                                       array order */
+        IMB_BURST_MODE_SORTED,      /**< OOO managers drained one by one */
+} IMB_BURST_MODE;
+
 /* Multi-buffer manager flags passed to alloc_mb_mgr() */
 
 #define IMB_FLAG_SHANI_OFF (1ULL << 0) /**< disable use of SHANI extension */
 #define IMB_FLAG_AESNI_OFF (1ULL << 1) /**< disable use of AESNI extension */
+#define IMB_FLAG_HUGEPAGES (1ULL << 2) /**< use 2 MiB pages for memory
+                                          allocated by alloc_mb_mgr_numa()
+                                          and imb_alloc_mem() */
 
 /**
  * Multi-buffer manager detected features
@@ -1040,6 +1070,50 @@ typedef uint32_t (*crc32_fn_t)(const void *, const uint64_t);
 
 #define IMB_MAX_JOBS 128
 
+/* Job ring size limits (in jobs) for alloc_mb_mgr_ex() */
+#define IMB_MIN_JOB_RING_SIZE 16
+#define IMB_MAX_JOB_RING_SIZE 4096
+
+/*
+ * Algorithm masks for alloc_mb_mgr_algos(),
+ * IMB_CIPHER_NULL and IMB_AUTH_NULL are always enabled
+ */
+#define IMB_CIPHER_MASK(mode)  (1ULL << (mode))
+#define IMB_HASH_MASK(alg)     (1ULL << (alg))
+#define IMB_CIPHER_MASK_ALL    UINT64_MAX
+#define IMB_HASH_MASK_ALL      UINT64_MAX
+
+/**
+ * Counters of an out-of-order (OOO) manager, collected only
+ * when the library is built with IMB_STATS (STATS=y).
+ *
+ * Average number of lanes occupied at job completion
+ * is lanes_in_use / (dispatches + flushes).
+ */
+typedef struct IMB_OOO_STATS {
+        const char *name;      /**< OOO manager name (set by imb_get_stats) */
+        uint64_t submits;      /**< jobs submitted to the manager */
+        uint64_t dispatches;   /**< jobs completed by submit (lanes full) */
+        uint64_t flushes;      /**< jobs completed by forced flush */
+        uint64_t lanes_in_use; /**< sum of jobs held at each completion */
+        uint64_t bytes;        /**< bytes of submitted jobs */
+        uint64_t in_flight;    /**< jobs currently held by the manager */
+} IMB_OOO_STATS;
+
+/* Memory not bound to a NUMA node (see alloc_mb_mgr_numa()) */
+#define IMB_NUMA_NODE_ANY (-1)
+
+/**
+ * Memory allocation hooks for IMB_MGR (see alloc_mb_mgr_hooks())
+ */
+typedef struct {
+        /** returns \a size bytes aligned to \a alignment, NULL on error */
+        void *(*alloc)(const size_t size, const size_t alignment, void *ctx);
+        /** releases memory returned by alloc() */
+        void (*free)(void *ptr, const size_t size, void *ctx);
+        void *ctx; /**< user context passed to the hooks */
+} IMB_MEM_HOOKS;
+
 typedef struct IMB_MGR {
 
         uint64_t flags;	  /**< passed to alloc_mb_mgr() */
@@ -1185,7 +1259,6 @@ typedef struct IMB_MGR {
         /* in-order scheduler fields */
         int              earliest_job; /**< byte offset, -1 if none */
         int              next_job;     /**< byte offset */
-        IMB_JOB     jobs[IMB_MAX_JOBS];
 
         /* out of order managers */
         void *aes128_ooo;
@@ -1225,7 +1298,51 @@ typedef struct IMB_MGR {
         void *sha_256_ooo;
         void *sha_384_ooo;
         void *sha_512_ooo;
+        void *aes128_gcm_ooo;
+        void *aes192_gcm_ooo;
+        void *aes256_gcm_ooo;
+        void *chacha20_ooo;
+        void *chacha20_poly1305_ooo;
+        void *poly1305_ooo;
+        void *kasumi_uea1_ooo;
+        void *kasumi_uia1_ooo;
+        void *snow_v_ooo;
+        void *snow_v_aead_ooo;
+        void *aes128_xts_enc_ooo;
+        void *aes128_xts_dec_ooo;
+        void *aes256_xts_enc_ooo;
+        void *aes256_xts_dec_ooo;
+        void *aes128_cfb_ooo;
+        void *aes192_cfb_ooo;
+        void *aes256_cfb_ooo;
+        void *aes_cbc_hmac_sha_1_ooo;
+        void *aes_cbc_hmac_sha_256_ooo;
+        void *aes_ctr_hmac_sha_1_ooo;
+        void *aes_ctr_hmac_sha_256_ooo;
+        void *aes_ctr_cmac_ooo;
+        void *crc_ooo;
         void *end_ooo; /* add new out-of-order managers above this line */
+
+        /* job ring and manager mode fields */
+        IMB_JOB     *job_ring;     /**< job_ring_size jobs after OOO managers */
+        uint32_t    job_ring_size; /**< number of jobs in the ring */
+        uint64_t    *job_tsc;      /**< submit time stamps of ring jobs */
+        uint64_t    flush_deadline; /**< TSC cycles, 0 if disabled */
+        uint32_t    completion_mode; /**< IMB_COMPLETION_MODE_xxx */
+        uint32_t    completed_head; /**< completion ring read index */
+        uint32_t    completed_tail; /**< completion ring write index */
+        IMB_JOB     **completed_ring; /**< completed ring jobs,
+                                         2 x job_ring_size entries */
+        uint32_t    *completed_pos; /**< completed_ring index of each job */
+        uint8_t     *job_delivered; /**< 1 if ring job was handed back */
+        imb_completion_cb_t completion_cb; /**< NULL if not registered */
+        void        *completion_cb_arg;
+        IMB_OOO_STATS *ooo_stats;   /**< NULL if built without IMB_STATS */
+        uint64_t    cipher_mask;    /**< enabled IMB_CIPHER_MASK() modes */
+        uint64_t    hash_mask;      /**< enabled IMB_HASH_MASK() algorithms */
+        IMB_MEM_HOOKS mem_hooks;    /**< free is NULL for default allocator */
+        size_t      mem_size;       /**< size of memory from mem_hooks */
+        uint32_t    burst_mode;     /**< IMB_BURST_MODE_xxx */
 } IMB_MGR;
 
 /**
@@ -1294,14 +1411,245 @@ IMB_DLL_EXPORT const char *imb_get_strerror(int errnum);
  */
 IMB_DLL_EXPORT IMB_MGR *alloc_mb_mgr(uint64_t flags);
 
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with a job ring of given size
+ *
+ * Shallow rings limit the number of jobs held by the in-order scheduler
+ * (lower latency), deep rings let high-latency multi-buffer managers
+ * fill their lanes without forcing jobs to complete when the ring fills.
+ *
+ * @param [in] flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param [in] ring_size number of jobs in the ring, power of 2
+ *                       from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ *                       (IMB_MAX_JOBS is the size used by alloc_mb_mgr())
+ *
+ * @return Pointer to allocated memory for IMB_MGR structure
+ * @retval NULL on allocation error or invalid ring size
+ */
+IMB_DLL_EXPORT IMB_MGR *alloc_mb_mgr_ex(uint64_t flags,
+                                        const unsigned ring_size);
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with out-of-order managers for a subset of algorithms only
+ *
+ * Only the out-of-order managers used by the selected algorithms
+ * are allocated and reset, which reduces the memory footprint
+ * and initialization time of IMB_MGR. Jobs using an algorithm
+ * that is not selected are rejected with IMB_ERR_ALGO_NOT_ENABLED.
+ *
+ * Both the cipher mode and the hash algorithm of a job have to be
+ * selected, e.g. AES-GCM requires IMB_CIPHER_MASK(IMB_CIPHER_GCM)
+ * and IMB_HASH_MASK(IMB_AUTH_AES_GMAC).
+ *
+ * @param [in] flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ * @param [in] cipher_mask IMB_CIPHER_MASK() of the enabled cipher modes
+ * @param [in] hash_mask IMB_HASH_MASK() of the enabled hash algorithms
+ *
+ * @return Pointer to allocated memory for IMB_MGR structure
+ * @retval NULL on allocation error or invalid ring size
+ */
+IMB_DLL_EXPORT IMB_MGR *alloc_mb_mgr_algos(uint64_t flags,
+                                           const unsigned ring_size,
+                                           const uint64_t cipher_mask,
+                                           const uint64_t hash_mask);
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        on a given NUMA node
+ *
+ * Memory is mapped and bound to \a numa_node before first use.
+ * With IMB_FLAG_HUGEPAGES, 2 MiB pages are used to reduce TLB misses
+ * on OOO managers and the job ring: explicit hugepages (MAP_HUGETLB)
+ * are tried first, then transparent hugepages (madvise()).
+ *
+ * @param [in] flags multi-buffer manager flags (see alloc_mb_mgr())
+ *     IMB_FLAG_HUGEPAGES - use 2 MiB pages
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ * @param [in] numa_node NUMA node id or IMB_NUMA_NODE_ANY
+ *
+ * @return Pointer to allocated memory for IMB_MGR structure
+ * @retval NULL on allocation error, invalid ring size or NUMA node
+ */
+IMB_DLL_EXPORT IMB_MGR *alloc_mb_mgr_numa(uint64_t flags,
+                                          const unsigned ring_size,
+                                          const int numa_node);
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with user supplied memory allocation hooks
+ *
+ * \a hooks are copied into IMB_MGR and free_mb_mgr() releases
+ * the memory with hooks->free().
+ *
+ * @param [in] flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ * @param [in] hooks memory allocation hooks
+ *
+ * @return Pointer to allocated memory for IMB_MGR structure
+ * @retval NULL on allocation error, invalid ring size or hooks
+ */
+IMB_DLL_EXPORT IMB_MGR *alloc_mb_mgr_hooks(uint64_t flags,
+                                           const unsigned ring_size,
+                                           const IMB_MEM_HOOKS *hooks);
+
+/**
+ * @brief Allocates 64 byte aligned memory on a given NUMA node,
+ *        e.g. for expanded keys used by jobs of a NUMA local IMB_MGR
+ *
+ * @param [in] size number of bytes
+ * @param [in] numa_node NUMA node id or IMB_NUMA_NODE_ANY
+ * @param [in] flags IMB_FLAG_HUGEPAGES or 0
+ *
+ * @return Pointer to allocated memory
+ * @retval NULL on allocation error or invalid NUMA node
+ */
+IMB_DLL_EXPORT void *imb_alloc_mem(const size_t size, const int numa_node,
+                                   const uint64_t flags);
+
+/**
+ * @brief Frees memory allocated previously by imb_alloc_mem()
+ *
+ * @param [in] ptr Pointer to allocated memory
+ */
+IMB_DLL_EXPORT void imb_free_mem(void *ptr);
+
 /**
  * @brief Frees memory allocated previously by alloc_mb_mgr()
+ *        or alloc_mb_mgr_XXX()
  *
  * @param [in] ptr Pointer to allocated MB_MGR structure
  *
  */
 IMB_DLL_EXPORT void free_mb_mgr(IMB_MGR *ptr);
 
+/**
+ * @brief Sets the flush deadline of the multi-buffer manager.
+ *
+ * When the earliest job in the job ring has not completed and
+ * it was submitted more than tsc_cycles ago, submit_job() flushes
+ * the out-of-order manager holding it (even with partially filled lanes)
+ * and returns it. This bounds job latency at low submission rates,
+ * without the application calling flush_job() on a timer.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ * @param [in] tsc_cycles maximum age of the earliest job (in TSC cycles),
+ *                        0 disables the deadline (default)
+ */
+IMB_DLL_EXPORT void imb_set_flush_deadline(IMB_MGR *state,
+                                           const uint64_t tsc_cycles);
+
+/**
+ * @brief Sets the completion mode of the job API.
+ *
+ * With IMB_COMPLETION_MODE_OUT_OF_ORDER, jobs of the job ring are
+ * queued in a per-manager completion ring as soon as they complete,
+ * so a job waiting for its lanes to fill (e.g. ZUC) no longer holds
+ * back jobs submitted after it (e.g. GCM). Completed jobs are then
+ * retrieved with imb_dequeue_completed() or get_completed_job(),
+ * or handed to the callback set with imb_set_completion_callback().
+ * submit_job() returns NULL, unless the job ring is full: the earliest
+ * job is then completed and returned, as in IMB_COMPLETION_MODE_IN_ORDER.
+ * flush_job() completes all jobs in flight and returns the next job
+ * of the completion ring.
+ * A job ring slot is reused only after its job has been handed back.
+ * The burst API is not affected.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ * @param [in] mode IMB_COMPLETION_MODE_IN_ORDER (default) or
+ *                  IMB_COMPLETION_MODE_OUT_OF_ORDER
+ *
+ * The mode can only be changed with no jobs in the job ring,
+ * IMB_ERR_COMPLETION_MODE is set otherwise.
+ */
+IMB_DLL_EXPORT void imb_set_completion_mode(IMB_MGR *state,
+                                            const IMB_COMPLETION_MODE mode);
+
+/**
+ * @brief Registers a callback for jobs completed out of order.
+ *
+ * In IMB_COMPLETION_MODE_OUT_OF_ORDER, the callback is invoked
+ * for every job of the job ring as soon as it completes, from within
+ * submit_job() or flush_job(), instead of queuing the job in the
+ * completion ring. The job is handed back once the callback returns.
+ * The callback must not call the job API of the same manager.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ * @param [in] cb callback function, NULL to queue completed jobs
+ * @param [in] cb_arg argument passed to the callback
+ */
+IMB_DLL_EXPORT void imb_set_completion_callback(IMB_MGR *state,
+                                                imb_completion_cb_t cb,
+                                                void *cb_arg);
+
+/**
+ * @brief Sets the job completion mode of the burst API.
+ *
+ * Jobs of a burst left in the out-of-order managers once all of them
+ * are submitted are, by default, forced to completion one at a time
+ * in array order. Each of these flushes only runs the managers used
+ * by that job, so a manager passing jobs on to another one
+ * (e.g. AES-CBC to HMAC) feeds it in several partially filled rounds.
+ *
+ * With IMB_BURST_MODE_SORTED, the jobs are bucketed by cipher mode,
+ * hash algorithm, key size, direction and chain order. The managers
+ * running the first operation of each bucket are drained first, then
+ * the ones running the second operation, so that each manager is
+ * drained once per burst with all of its jobs in the lanes.
+ * Completion status is still reported per job.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ * @param [in] mode IMB_BURST_MODE_ORDERED (default) or
+ *                  IMB_BURST_MODE_SORTED
+ */
+IMB_DLL_EXPORT void imb_set_burst_mode(IMB_MGR *state,
+                                       const IMB_BURST_MODE mode);
+
+/**
+ * @brief Retrieves jobs completed out of order.
+ *
+ * Returns jobs from the completion ring in order of completion
+ * (see imb_set_completion_mode()). It does not process jobs in flight,
+ * use flush_job() to force their completion.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ * @param [out] jobs array to store pointers of completed jobs
+ * @param [in] max_jobs number of entries in jobs
+ *
+ * @return Number of jobs stored in jobs
+ */
+IMB_DLL_EXPORT uint32_t imb_dequeue_completed(IMB_MGR *state,
+                                              IMB_JOB **jobs,
+                                              const uint32_t max_jobs);
+
+/**
+ * @brief Retrieves counters of the out-of-order managers.
+ *
+ * Counters are available only if the library is built with
+ * IMB_STATS (STATS=y), they are cleared on init_mb_mgr_XXX()
+ * and imb_reset_stats().
+ *
+ * @param [in] state Pointer to IMB_MGR structure
+ * @param [out] stats array of counters, one entry per OOO manager
+ * @param [in] max_stats number of entries in \a stats
+ *
+ * @return Number of entries written to \a stats
+ * @retval 0 if statistics are not enabled (IMB_ERR_NO_STATS)
+ */
+IMB_DLL_EXPORT unsigned imb_get_stats(IMB_MGR *state, IMB_OOO_STATS *stats,
+                                      const unsigned max_stats);
+
+/**
+ * @brief Clears counters of the out-of-order managers.
+ *
+ * Number of jobs in flight is kept.
+ *
+ * @param [in,out] state Pointer to IMB_MGR structure
+ */
+IMB_DLL_EXPORT void imb_reset_stats(IMB_MGR *state);
+
 /**
  * @brief Calculates necessary memory size for IMB_MGR.
  *
@@ -1309,6 +1657,32 @@ IMB_DLL_EXPORT void free_mb_mgr(IMB_MGR *ptr);
  */
 IMB_DLL_EXPORT size_t imb_get_mb_mgr_size(void);
 
+/**
+ * @brief Calculates necessary memory size for IMB_MGR
+ *        with a job ring of given size.
+ *
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ *
+ * @return Size for IMB_MGR (aligned to 64 bytes)
+ * @retval 0 on invalid ring size
+ */
+IMB_DLL_EXPORT size_t imb_get_mb_mgr_size_ex(const unsigned ring_size);
+
+/**
+ * @brief Calculates necessary memory size for IMB_MGR
+ *        with a job ring of given size and a subset of algorithms.
+ *
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ * @param [in] cipher_mask enabled cipher modes (see alloc_mb_mgr_algos())
+ * @param [in] hash_mask enabled hash algorithms (see alloc_mb_mgr_algos())
+ *
+ * @return Size for IMB_MGR (aligned to 64 bytes)
+ * @retval 0 on invalid ring size
+ */
+IMB_DLL_EXPORT size_t imb_get_mb_mgr_size_algos(const unsigned ring_size,
+                                                const uint64_t cipher_mask,
+                                                const uint64_t hash_mask);
+
 /**
  * @brief Initializes IMB_MGR pointers to out-of-order managers with
  *        use of externally allocated memory.
@@ -1332,6 +1706,51 @@ IMB_DLL_EXPORT size_t imb_get_mb_mgr_size(void);
 IMB_DLL_EXPORT IMB_MGR *imb_set_pointers_mb_mgr(void *ptr, const uint64_t flags,
                                                 const unsigned reset_mgr);
 
+/**
+ * @brief Initializes IMB_MGR pointers to out-of-order managers and
+ *        to the job ring with use of externally allocated memory.
+ *
+ * imb_get_mb_mgr_size_ex() should be called to know how much memory
+ * should be allocated externally.
+ *
+ * @param [in] ptr a pointer to allocated memory
+ * @param [in] flags multi-buffer manager flags (see imb_set_pointers_mb_mgr())
+ * @param [in] reset_mgr if 0, IMB_MGR structure is not cleared, else it is.
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ *
+ * @return Pointer to IMB_MGR structure
+ * @retval NULL on invalid ring size
+ */
+IMB_DLL_EXPORT IMB_MGR *imb_set_pointers_mb_mgr_ex(void *ptr,
+                                                   const uint64_t flags,
+                                                   const unsigned reset_mgr,
+                                                   const unsigned ring_size);
+
+/**
+ * @brief Initializes IMB_MGR pointers to out-of-order managers of
+ *        a subset of algorithms and to the job ring with use of
+ *        externally allocated memory.
+ *
+ * imb_get_mb_mgr_size_algos() should be called to know how much memory
+ * should be allocated externally.
+ *
+ * @param [in] ptr a pointer to allocated memory
+ * @param [in] flags multi-buffer manager flags (see imb_set_pointers_mb_mgr())
+ * @param [in] reset_mgr if 0, IMB_MGR structure is not cleared, else it is.
+ * @param [in] ring_size number of jobs in the ring (see alloc_mb_mgr_ex())
+ * @param [in] cipher_mask enabled cipher modes (see alloc_mb_mgr_algos())
+ * @param [in] hash_mask enabled hash algorithms (see alloc_mb_mgr_algos())
+ *
+ * @return Pointer to IMB_MGR structure
+ * @retval NULL on invalid ring size
+ */
+IMB_DLL_EXPORT IMB_MGR *
+imb_set_pointers_mb_mgr_algos(void *ptr, const uint64_t flags,
+                              const unsigned reset_mgr,
+                              const unsigned ring_size,
+                              const uint64_t cipher_mask,
+                              const uint64_t hash_mask);
+
 /**
  * @brief Retrieves the bitmask with the features supported by the library,
  *        without having to allocate/initialize IMB_MGR;
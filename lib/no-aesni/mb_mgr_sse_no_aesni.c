@@ -43,6 +43,8 @@
 #include "include/gcm.h"
 #include "include/noaesni.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 #include "include/arch_noaesni.h"
 #include "include/arch_sse_type1.h"
 
@@ -488,10 +490,12 @@ init_mb_mgr_sse_no_aesni_internal(IMB_MGR *state, const int reset_mgrs)
 
         if (reset_mgrs) {
                 reset_ooo_mgrs(state);
+                reset_ooo_stats(state);
 
                 /* Init "in order" components */
                 state->next_job = 0;
                 state->earliest_job = -1;
+                completion_ring_reset(state);
         }
 
         /* set SSE NO AESNI handlers */
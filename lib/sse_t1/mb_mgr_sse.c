@@ -47,6 +47,8 @@
 #include "include/noaesni.h"
 #include "include/aesni_emu.h"
 #include "include/error.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 
 #include "include/arch_sse_type1.h"
 #include "include/arch_sse_type2.h"
@@ -161,6 +163,64 @@
 #define SUBMIT_JOB_AES_GCM_DEC submit_job_aes_gcm_dec_sse
 #define SUBMIT_JOB_AES_GCM_ENC submit_job_aes_gcm_enc_sse
 
+#define SUBMIT_JOB_AES128_GCM submit_job_aes128_gcm_sse
+#define FLUSH_JOB_AES128_GCM  flush_job_aes128_gcm_sse
+#define SUBMIT_JOB_AES192_GCM submit_job_aes192_gcm_sse
+#define FLUSH_JOB_AES192_GCM  flush_job_aes192_gcm_sse
+#define SUBMIT_JOB_AES256_GCM submit_job_aes256_gcm_sse
+#define FLUSH_JOB_AES256_GCM  flush_job_aes256_gcm_sse
+
+#define SUBMIT_JOB_AES128_XTS_ENC  submit_job_aes128_xts_enc_sse
+#define FLUSH_JOB_AES128_XTS_ENC   flush_job_aes128_xts_enc_sse
+#define SUBMIT_JOB_AES128_XTS_DEC  submit_job_aes128_xts_dec_sse
+#define FLUSH_JOB_AES128_XTS_DEC   flush_job_aes128_xts_dec_sse
+#define SUBMIT_JOB_AES256_XTS_ENC  submit_job_aes256_xts_enc_sse
+#define FLUSH_JOB_AES256_XTS_ENC   flush_job_aes256_xts_enc_sse
+#define SUBMIT_JOB_AES256_XTS_DEC  submit_job_aes256_xts_dec_sse
+#define FLUSH_JOB_AES256_XTS_DEC   flush_job_aes256_xts_dec_sse
+
+#define SUBMIT_JOB_AES128_CFB_ENC  submit_job_aes128_cfb_enc_sse
+#define FLUSH_JOB_AES128_CFB_ENC   flush_job_aes128_cfb_enc_sse
+#define SUBMIT_JOB_AES128_CFB_DEC  submit_job_aes128_cfb_dec_sse
+#define SUBMIT_JOB_AES192_CFB_ENC  submit_job_aes192_cfb_enc_sse
+#define FLUSH_JOB_AES192_CFB_ENC   flush_job_aes192_cfb_enc_sse
+#define SUBMIT_JOB_AES192_CFB_DEC  submit_job_aes192_cfb_dec_sse
+#define SUBMIT_JOB_AES256_CFB_ENC  submit_job_aes256_cfb_enc_sse
+#define FLUSH_JOB_AES256_CFB_ENC   flush_job_aes256_cfb_enc_sse
+#define SUBMIT_JOB_AES256_CFB_DEC  submit_job_aes256_cfb_dec_sse
+
+#define SUBMIT_JOB_DES_CBC_ENC submit_job_des_cbc_enc_sse
+#define FLUSH_JOB_DES_CBC_ENC  flush_job_des_cbc_enc_sse
+
+#define SUBMIT_JOB_DES_CBC_DEC submit_job_des_cbc_dec_sse
+#define FLUSH_JOB_DES_CBC_DEC  flush_job_des_cbc_dec_sse
+
+#define SUBMIT_JOB_3DES_CBC_ENC submit_job_3des_cbc_enc_sse
+#define FLUSH_JOB_3DES_CBC_ENC  flush_job_3des_cbc_enc_sse
+
+#define SUBMIT_JOB_3DES_CBC_DEC submit_job_3des_cbc_dec_sse
+#define FLUSH_JOB_3DES_CBC_DEC  flush_job_3des_cbc_dec_sse
+
+#define SUBMIT_JOB_DOCSIS_DES_ENC submit_job_docsis_des_enc_sse
+#define FLUSH_JOB_DOCSIS_DES_ENC  flush_job_docsis_des_enc_sse
+
+#define SUBMIT_JOB_DOCSIS_DES_DEC submit_job_docsis_des_dec_sse
+#define FLUSH_JOB_DOCSIS_DES_DEC  flush_job_docsis_des_dec_sse
+
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_1   submit_job_aes_cbc_hmac_sha_1_sse
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_1    flush_job_aes_cbc_hmac_sha_1_sse
+#define SUBMIT_JOB_AES_CBC_HMAC_SHA_256 submit_job_aes_cbc_hmac_sha_256_sse
+#define FLUSH_JOB_AES_CBC_HMAC_SHA_256  flush_job_aes_cbc_hmac_sha_256_sse
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_1   submit_job_aes_ctr_hmac_sha_1_sse
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_1    flush_job_aes_ctr_hmac_sha_1_sse
+#define SUBMIT_JOB_AES_CTR_HMAC_SHA_256 submit_job_aes_ctr_hmac_sha_256_sse
+#define FLUSH_JOB_AES_CTR_HMAC_SHA_256  flush_job_aes_ctr_hmac_sha_256_sse
+#define SUBMIT_JOB_AES_CTR_CMAC         submit_job_aes_ctr_cmac_sse
+#define FLUSH_JOB_AES_CTR_CMAC          flush_job_aes_ctr_cmac_sse
+
+#define SUBMIT_JOB_CRC                  submit_job_crc_sse
+#define FLUSH_JOB_CRC                   flush_job_crc_sse
+
 /* ====================================================================== */
 
 #define SUBMIT_JOB         submit_job_sse
@@ -189,6 +249,8 @@
 
 #define AES_CFB_128_ONE    aes_cfb_128_one_sse
 #define AES_CFB_256_ONE    aes_cfb_256_one_sse
+#define AES_CBC_ENC_128_MB aes_cbc_enc_128_mb_ptr
+#define AES_CBC_ENC_256_MB aes_cbc_enc_256_mb_ptr
 
 #define FLUSH_JOB_AES128_CCM_AUTH     flush_job_aes128_ccm_auth_ptr
 #define SUBMIT_JOB_AES128_CCM_AUTH    submit_job_aes128_ccm_auth_ptr
@@ -214,6 +276,13 @@
 #define SUBMIT_JOB_CHACHA20_POLY1305_SGL aead_chacha20_poly1305_sgl_sse
 #define POLY1305_MAC poly1305_mac_scalar
 
+#define SUBMIT_JOB_CHACHA20_MB submit_job_chacha20_mb_sse
+#define FLUSH_JOB_CHACHA20_MB  flush_job_chacha20_mb_sse
+#define SUBMIT_JOB_CHACHA20_POLY1305_MB submit_job_chacha20_poly1305_mb_sse
+#define FLUSH_JOB_CHACHA20_POLY1305_MB  flush_job_chacha20_poly1305_mb_sse
+#define SUBMIT_JOB_POLY1305_MB submit_job_poly1305_mb_sse
+#define FLUSH_JOB_POLY1305_MB  flush_job_poly1305_mb_sse
+
 #define SUBMIT_JOB_SNOW_V snow_v_sse
 #define SUBMIT_JOB_SNOW_V_AEAD snow_v_aead_init_sse
 
@@ -272,6 +341,11 @@ static aes_flush_job_t flush_job_aes128_enc_ptr = flush_job_aes128_enc_sse;
 static aes_flush_job_t flush_job_aes192_enc_ptr = flush_job_aes192_enc_sse;
 static aes_flush_job_t flush_job_aes256_enc_ptr = flush_job_aes256_enc_sse;
 
+typedef void (*aes_cbc_enc_mb_t)(AES_ARGS *, uint64_t);
+
+static aes_cbc_enc_mb_t aes_cbc_enc_128_mb_ptr = aes_cbc_enc_128_x4;
+static aes_cbc_enc_mb_t aes_cbc_enc_256_mb_ptr = aes_cbc_enc_256_x4;
+
 /* ====================================================================== */
 
 /*
@@ -611,6 +685,8 @@ reset_ooo_mgrs(IMB_MGR *state)
                 ooo_mgr_docsis_aes_reset(state->docsis128_crc32_sec_ooo, 8);
                 ooo_mgr_docsis_aes_reset(state->docsis256_sec_ooo, 8);
                 ooo_mgr_docsis_aes_reset(state->docsis256_crc32_sec_ooo, 8);
+                aes_cbc_enc_128_mb_ptr = aes_cbc_enc_128_x8_sse;
+                aes_cbc_enc_256_mb_ptr = aes_cbc_enc_256_x8_sse;
         } else {
                 ooo_mgr_docsis_aes_reset(state->docsis128_sec_ooo, 4);
                 ooo_mgr_docsis_aes_reset(state->docsis128_crc32_sec_ooo, 4);
@@ -691,6 +767,53 @@ reset_ooo_mgrs(IMB_MGR *state)
                 ooo_mgr_ccm_reset(state->aes256_ccm_ooo, 4);
         }
 
+        /* Init AES-GCM out-of-order fields */
+        ooo_mgr_gcm_reset(state->aes128_gcm_ooo, SSE_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes192_gcm_ooo, SSE_NUM_GCM_LANES);
+        ooo_mgr_gcm_reset(state->aes256_gcm_ooo, SSE_NUM_GCM_LANES);
+
+        /* Init AES-XTS out-of-order fields */
+        ooo_mgr_aes_xts_reset(state->aes128_xts_enc_ooo, SSE_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes128_xts_dec_ooo, SSE_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_enc_ooo, SSE_NUM_XTS_LANES);
+        ooo_mgr_aes_xts_reset(state->aes256_xts_dec_ooo, SSE_NUM_XTS_LANES);
+
+        /* Init AES-CFB out-of-order fields */
+        ooo_mgr_aes_cfb_reset(state->aes128_cfb_ooo, SSE_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes192_cfb_ooo, SSE_NUM_CFB_LANES);
+        ooo_mgr_aes_cfb_reset(state->aes256_cfb_ooo, SSE_NUM_CFB_LANES);
+
+        /* DES, 3DES and DOCSIS DES (DES CBC + DES CFB for partial block) */
+        ooo_mgr_des_reset(state->des_enc_ooo, SSE_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des_dec_ooo, SSE_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_enc_ooo, SSE_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->des3_dec_ooo, SSE_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_enc_ooo, SSE_NUM_DES_LANES);
+        ooo_mgr_des_reset(state->docsis_des_dec_ooo, SSE_NUM_DES_LANES);
+
+        /* Stitched AES-CBC/CTR + HMAC-SHA1/SHA256 and AES-CTR + AES-CMAC */
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_1_ooo,
+                                   SSE_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_cbc_hmac_sha_256_ooo,
+                                   SSE_NUM_SHA256_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_1_ooo,
+                                   SSE_NUM_SHA1_LANES);
+        ooo_mgr_aes_cbc_hmac_reset(state->aes_ctr_hmac_sha_256_ooo,
+                                   SSE_NUM_SHA256_LANES);
+        ooo_mgr_aes_ctr_cmac_reset(state->aes_ctr_cmac_ooo,
+                                   SSE_NUM_CTR_CMAC_LANES);
+
+        /* CRC */
+        ooo_mgr_crc_reset(state->crc_ooo, SSE_NUM_CRC_LANES);
+
+        /* Init ChaCha20, ChaCha20-Poly1305 and Poly1305 out-of-order fields */
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_ooo,
+                                        SSE_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->chacha20_poly1305_ooo,
+                                        SSE_NUM_CHACHA20_LANES);
+        ooo_mgr_chacha20_poly1305_reset(state->poly1305_ooo,
+                                        SSE_NUM_CHACHA20_LANES);
+
         /* Init AES-CMAC auth out-of-order fields */
         if (state->features & IMB_FEATURE_GFNI) {
                 submit_job_aes128_cmac_auth_ptr =
@@ -798,10 +921,12 @@ init_mb_mgr_sse_internal(IMB_MGR *state, const int reset_mgrs)
 
         if (reset_mgrs) {
                 reset_ooo_mgrs(state);
+                reset_ooo_stats(state);
 
                 /* Init "in order" components */
                 state->next_job = 0;
                 state->earliest_job = -1;
+                completion_ring_reset(state);
         }
 
         /* set SSE handlers */
@@ -32,6 +32,8 @@
 #                           when DEBUG is used
 # AESNI_EMU=y   - this option will enable AESNI emulation support"
 # AESNI_EMU=n   - this option will disable AESNI emulation support (default)"
+# STATS=y       - this option will enable OOO manager statistics
+# STATS=n       - this option will disable OOO manager statistics (default)
 # SHARED=y  	- this option will produce shared library (DLL) (default)
 # SHARED=n  	- this option will produce static library (lib)
 # SAFE_DATA=y   - this option will clear memory and registers containing
@@ -110,6 +112,10 @@ DCFLAGS = $(DCFLAGS) /DAESNI_EMU
 DAFLAGS = $(DAFLAGS) -DAESNI_EMU
 !endif
 
+!if "$(STATS)" == "y"
+DCFLAGS = $(DCFLAGS) /DIMB_STATS
+!endif
+
 CC = cl
 
 CFLAGS_ALL = $(EXTRA_CFLAGS) /DNO_COMPAT_IMB_API_053 /I. /Iinclude /Ino-aesni \
@@ -165,6 +171,14 @@ lib_objs1 = \
 	$(OBJ_DIR)\aes128_ecb_vaes_avx2.obj \
 	$(OBJ_DIR)\aes192_ecb_vaes_avx2.obj \
 	$(OBJ_DIR)\aes256_ecb_vaes_avx2.obj \
+	$(OBJ_DIR)\aes128_cbc_dec_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes192_cbc_dec_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes256_cbc_dec_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes128_cntr_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes192_cntr_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes256_cntr_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes128_cntr_ccm_by16_vaes_avx2.obj \
+	$(OBJ_DIR)\aes256_cntr_ccm_by16_vaes_avx2.obj \
 	$(OBJ_DIR)\aes_ecb_vaes_avx512.obj \
 	$(OBJ_DIR)\pon_by8_sse.obj \
 	$(OBJ_DIR)\aes128_cntr_by8_sse.obj \
@@ -226,6 +240,12 @@ lib_objs1 = \
 	$(OBJ_DIR)\sha1_one_block_sse.obj \
 	$(OBJ_DIR)\sha1_x8_avx2.obj \
 	$(OBJ_DIR)\sha1_x16_avx512.obj \
+	$(OBJ_DIR)\md5_x16x2_avx512.obj \
+	$(OBJ_DIR)\kasumi_x16_avx512.obj \
+	$(OBJ_DIR)\snow_v_x4_vaes_avx2.obj \
+	$(OBJ_DIR)\snow_v_x4_vaes_avx512.obj \
+	$(OBJ_DIR)\aes_xts_x8_vaes_avx2.obj \
+	$(OBJ_DIR)\aes_xts_x16_vaes_avx512.obj \
 	$(OBJ_DIR)\sha224_one_block_avx.obj \
 	$(OBJ_DIR)\sha224_one_block_sse.obj \
 	$(OBJ_DIR)\sha256_oct_avx2.obj \
@@ -255,6 +275,7 @@ lib_objs1 = \
 	$(OBJ_DIR)\zuc_x4_gfni_sse.obj \
 	$(OBJ_DIR)\zuc_x4_avx.obj \
 	$(OBJ_DIR)\zuc_x8_avx2.obj \
+	$(OBJ_DIR)\zuc_x8_gfni_avx2.obj \
 	$(OBJ_DIR)\zuc_x16_avx512.obj \
 	$(OBJ_DIR)\zuc_x16_vaes_avx512.obj \
 	$(OBJ_DIR)\zuc_iv.obj \
@@ -281,6 +302,33 @@ lib_objs1 = \
 	$(OBJ_DIR)\sha_mb_avx.obj \
 	$(OBJ_DIR)\sha_mb_avx2.obj \
 	$(OBJ_DIR)\sha_mb_avx512.obj \
+	$(OBJ_DIR)\gcm_mb_sse.obj \
+	$(OBJ_DIR)\gcm_mb_avx.obj \
+	$(OBJ_DIR)\gcm_mb_avx2.obj \
+	$(OBJ_DIR)\chacha20_poly1305_mb_sse.obj \
+	$(OBJ_DIR)\chacha20_poly1305_mb_avx.obj \
+	$(OBJ_DIR)\chacha20_poly1305_mb_avx2.obj \
+	$(OBJ_DIR)\chacha20_poly1305_mb_avx512.obj \
+	$(OBJ_DIR)\chacha20_poly1305_mb_fma_avx512.obj \
+	$(OBJ_DIR)\kasumi_mb_avx512.obj \
+	$(OBJ_DIR)\snow_v_mb_avx2.obj \
+	$(OBJ_DIR)\snow_v_mb_avx512.obj \
+	$(OBJ_DIR)\aes_xts_mb_sse.obj \
+	$(OBJ_DIR)\aes_xts_mb_avx.obj \
+	$(OBJ_DIR)\aes_xts_mb_avx2.obj \
+	$(OBJ_DIR)\aes_xts_mb_avx512.obj \
+	$(OBJ_DIR)\aes_cfb_mb_sse.obj \
+	$(OBJ_DIR)\aes_cfb_mb_avx.obj \
+	$(OBJ_DIR)\des_mb_sse.obj \
+	$(OBJ_DIR)\des_mb_avx.obj \
+	$(OBJ_DIR)\aes_cbc_hmac_mb_sse.obj \
+	$(OBJ_DIR)\aes_cbc_hmac_mb_avx.obj \
+	$(OBJ_DIR)\aes_cbc_hmac_mb_avx2.obj \
+	$(OBJ_DIR)\aes_ctr_cmac_mb_sse.obj \
+	$(OBJ_DIR)\aes_ctr_cmac_mb_avx.obj \
+	$(OBJ_DIR)\crc_mb_sse.obj \
+	$(OBJ_DIR)\crc_mb_avx.obj \
+	$(OBJ_DIR)\crc_mb_avx512.obj \
 	$(OBJ_DIR)\des_key.obj \
 	$(OBJ_DIR)\des_basic.obj \
 	$(OBJ_DIR)\chacha20_sse.obj \
@@ -394,9 +442,11 @@ lib_objs2 = \
 	$(OBJ_DIR)\mb_mgr_hmac_sha1_flush_avx512.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_flush_avx.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_flush_avx2.obj \
+	$(OBJ_DIR)\mb_mgr_hmac_md5_flush_avx512.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_flush_sse.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_submit_avx.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_submit_avx2.obj \
+	$(OBJ_DIR)\mb_mgr_hmac_md5_submit_avx512.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_md5_submit_sse.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_sha224_flush_avx.obj \
 	$(OBJ_DIR)\mb_mgr_hmac_sha224_flush_avx2.obj \
@@ -443,6 +493,7 @@ lib_objs2 = \
 	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_gfni_sse.obj \
 	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_avx.obj \
 	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_avx2.obj \
+	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_gfni_avx2.obj \
 	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_avx512.obj \
 	$(OBJ_DIR)\mb_mgr_zuc_submit_flush_gfni_avx512.obj \
 	$(OBJ_DIR)\mb_mgr_avx.obj \
@@ -528,18 +579,21 @@ gcm_objs = \
 	$(OBJ_DIR)\gcm.obj \
 	$(OBJ_DIR)\aes128_gcm_by8_avx.obj \
 	$(OBJ_DIR)\aes128_gcm_by8_avx2.obj \
+	$(OBJ_DIR)\aes128_gcm_by8_vaes_avx2.obj \
 	$(OBJ_DIR)\aes128_gcm_by8_avx512.obj \
 	$(OBJ_DIR)\aes128_gcm_by48_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes128_gcm_by48_sgl_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes128_gmac_by48_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes192_gcm_by8_avx.obj \
 	$(OBJ_DIR)\aes192_gcm_by8_avx2.obj \
+	$(OBJ_DIR)\aes192_gcm_by8_vaes_avx2.obj \
 	$(OBJ_DIR)\aes192_gcm_by8_avx512.obj \
 	$(OBJ_DIR)\aes192_gcm_by48_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes192_gcm_by48_sgl_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes192_gmac_by48_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes256_gcm_by8_avx.obj \
 	$(OBJ_DIR)\aes256_gcm_by8_avx2.obj \
+	$(OBJ_DIR)\aes256_gcm_by8_vaes_avx2.obj \
 	$(OBJ_DIR)\aes256_gcm_by8_avx512.obj \
 	$(OBJ_DIR)\aes256_gcm_by48_api_vaes_avx512.obj \
 	$(OBJ_DIR)\aes256_gcm_by48_sgl_api_vaes_avx512.obj \
@@ -28,13 +28,19 @@
 #include <stdint.h>
 #ifdef LINUX
 #include <stdlib.h> /* posix_memalign() and free() */
+#include <unistd.h> /* sysconf() and syscall() */
+#include <sys/mman.h> /* mmap(), munmap() and madvise() */
+#include <sys/syscall.h> /* SYS_mbind */
 #else
 #include <malloc.h> /* _aligned_malloc() and aligned_free() */
+#include <windows.h> /* VirtualAlloc(), VirtualAllocExNuma() */
 #endif
 #include <string.h>
 #include <stddef.h> /* offsetof() */
 #include "intel-ipsec-mb.h"
 #include "ipsec_ooo_mgr.h"
+#include "include/mb_mgr_stats.h"
+#include "include/job_completion.h"
 #include "cpu_feature.h"
 #include "error.h"
 
@@ -43,71 +49,269 @@
 #define ALIGNMENT 64
 #define ALIGN(x, y) ((x + (y - 1)) & (~(y - 1)))
 
-#define OOO_INFO(imb_mgr_ooo_ptr_name__, ooo_mgr_type__) \
+#define HUGEPAGE_SIZE (2 * 1024 * 1024)
+#define MAX_NUMA_NODES 1024
+#define NUMA_MPOL_BIND 2 /* MPOL_BIND from numaif.h */
+
+#define OOO_INFO(imb_mgr_ooo_ptr_name__, ooo_mgr_type__, cipher__, hash__) \
         { offsetof(IMB_MGR, imb_mgr_ooo_ptr_name__), \
           ALIGN(sizeof(ooo_mgr_type__), ALIGNMENT),      \
-          offsetof(ooo_mgr_type__, road_block) }
+          offsetof(ooo_mgr_type__, road_block),          \
+          #imb_mgr_ooo_ptr_name__, cipher__, hash__ }
+
+#define CIPH(mode__) IMB_CIPHER_MASK(IMB_CIPHER_##mode__)
+#define HASH(alg__)  IMB_HASH_MASK(IMB_AUTH_##alg__)
 
+/*
+ * An OOO manager is allocated if one of its cipher modes (if any)
+ * and one of its hash algorithms (if any) are enabled
+ */
 const struct {
         size_t ooo_ptr_offset;
         size_t ooo_aligned_size;
         size_t road_block_offset;
+        const char *name;
+        uint64_t cipher_mask;
+        uint64_t hash_mask;
 } ooo_mgr_table[] = {
-        OOO_INFO(aes128_ooo, MB_MGR_AES_OOO),
-        OOO_INFO(aes192_ooo, MB_MGR_AES_OOO),
-        OOO_INFO(aes256_ooo, MB_MGR_AES_OOO),
-        OOO_INFO(docsis128_sec_ooo, MB_MGR_DOCSIS_AES_OOO),
-        OOO_INFO(docsis128_crc32_sec_ooo, MB_MGR_DOCSIS_AES_OOO),
-        OOO_INFO(docsis256_sec_ooo, MB_MGR_DOCSIS_AES_OOO),
-        OOO_INFO(docsis256_crc32_sec_ooo, MB_MGR_DOCSIS_AES_OOO),
-        OOO_INFO(des_enc_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(des_dec_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(des3_enc_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(des3_dec_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(docsis_des_enc_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(docsis_des_dec_ooo, MB_MGR_DES_OOO),
-        OOO_INFO(hmac_sha_1_ooo, MB_MGR_HMAC_SHA_1_OOO),
-        OOO_INFO(hmac_sha_224_ooo, MB_MGR_HMAC_SHA_256_OOO),
-        OOO_INFO(hmac_sha_256_ooo, MB_MGR_HMAC_SHA_256_OOO),
-        OOO_INFO(hmac_sha_384_ooo, MB_MGR_HMAC_SHA_512_OOO),
-        OOO_INFO(hmac_sha_512_ooo, MB_MGR_HMAC_SHA_512_OOO),
-        OOO_INFO(hmac_md5_ooo, MB_MGR_HMAC_MD5_OOO),
-        OOO_INFO(aes_xcbc_ooo, MB_MGR_AES_XCBC_OOO),
-        OOO_INFO(aes_ccm_ooo, MB_MGR_CCM_OOO),
-        OOO_INFO(aes_cmac_ooo, MB_MGR_CMAC_OOO),
-        OOO_INFO(aes128_cbcs_ooo, MB_MGR_AES_OOO),
-        OOO_INFO(zuc_eea3_ooo, MB_MGR_ZUC_OOO),
-        OOO_INFO(zuc_eia3_ooo, MB_MGR_ZUC_OOO),
-        OOO_INFO(zuc256_eea3_ooo, MB_MGR_ZUC_OOO),
-        OOO_INFO(zuc256_eia3_ooo, MB_MGR_ZUC_OOO),
-        OOO_INFO(aes256_ccm_ooo, MB_MGR_CCM_OOO),
-	OOO_INFO(aes256_cmac_ooo, MB_MGR_CMAC_OOO),
-        OOO_INFO(snow3g_uea2_ooo, MB_MGR_SNOW3G_OOO),
-        OOO_INFO(snow3g_uia2_ooo, MB_MGR_SNOW3G_OOO),
-        OOO_INFO(sha_1_ooo, MB_MGR_SHA_1_OOO),
-        OOO_INFO(sha_224_ooo, MB_MGR_SHA_256_OOO),
-        OOO_INFO(sha_256_ooo, MB_MGR_SHA_256_OOO),
-        OOO_INFO(sha_384_ooo, MB_MGR_SHA_512_OOO),
-        OOO_INFO(sha_512_ooo, MB_MGR_SHA_512_OOO)
+        OOO_INFO(aes128_ooo, MB_MGR_AES_OOO,
+                 CIPH(CBC), 0),
+        OOO_INFO(aes192_ooo, MB_MGR_AES_OOO,
+                 CIPH(CBC), 0),
+        OOO_INFO(aes256_ooo, MB_MGR_AES_OOO,
+                 CIPH(CBC), 0),
+        OOO_INFO(docsis128_sec_ooo, MB_MGR_DOCSIS_AES_OOO,
+                 CIPH(DOCSIS_SEC_BPI), 0),
+        OOO_INFO(docsis128_crc32_sec_ooo, MB_MGR_DOCSIS_AES_OOO,
+                 CIPH(DOCSIS_SEC_BPI), HASH(DOCSIS_CRC32)),
+        OOO_INFO(docsis256_sec_ooo, MB_MGR_DOCSIS_AES_OOO,
+                 CIPH(DOCSIS_SEC_BPI), 0),
+        OOO_INFO(docsis256_crc32_sec_ooo, MB_MGR_DOCSIS_AES_OOO,
+                 CIPH(DOCSIS_SEC_BPI), HASH(DOCSIS_CRC32)),
+        OOO_INFO(des_enc_ooo, MB_MGR_DES_OOO,
+                 CIPH(DES), 0),
+        OOO_INFO(des_dec_ooo, MB_MGR_DES_OOO,
+                 CIPH(DES), 0),
+        OOO_INFO(des3_enc_ooo, MB_MGR_DES_OOO,
+                 CIPH(DES3), 0),
+        OOO_INFO(des3_dec_ooo, MB_MGR_DES_OOO,
+                 CIPH(DES3), 0),
+        OOO_INFO(docsis_des_enc_ooo, MB_MGR_DES_OOO,
+                 CIPH(DOCSIS_DES), 0),
+        OOO_INFO(docsis_des_dec_ooo, MB_MGR_DES_OOO,
+                 CIPH(DOCSIS_DES), 0),
+        OOO_INFO(hmac_sha_1_ooo, MB_MGR_HMAC_SHA_1_OOO,
+                 0, HASH(HMAC_SHA_1)),
+        OOO_INFO(hmac_sha_224_ooo, MB_MGR_HMAC_SHA_256_OOO,
+                 0, HASH(HMAC_SHA_224)),
+        OOO_INFO(hmac_sha_256_ooo, MB_MGR_HMAC_SHA_256_OOO,
+                 0, HASH(HMAC_SHA_256)),
+        OOO_INFO(hmac_sha_384_ooo, MB_MGR_HMAC_SHA_512_OOO,
+                 0, HASH(HMAC_SHA_384)),
+        OOO_INFO(hmac_sha_512_ooo, MB_MGR_HMAC_SHA_512_OOO,
+                 0, HASH(HMAC_SHA_512)),
+        OOO_INFO(hmac_md5_ooo, MB_MGR_HMAC_MD5_OOO,
+                 0, HASH(MD5)),
+        OOO_INFO(aes_xcbc_ooo, MB_MGR_AES_XCBC_OOO,
+                 0, HASH(AES_XCBC)),
+        OOO_INFO(aes_ccm_ooo, MB_MGR_CCM_OOO,
+                 CIPH(CCM), HASH(AES_CCM)),
+        OOO_INFO(aes_cmac_ooo, MB_MGR_CMAC_OOO,
+                 0, HASH(AES_CMAC) | HASH(AES_CMAC_BITLEN)),
+        OOO_INFO(aes128_cbcs_ooo, MB_MGR_AES_OOO,
+                 CIPH(CBCS_1_9), 0),
+        OOO_INFO(zuc_eea3_ooo, MB_MGR_ZUC_OOO,
+                 CIPH(ZUC_EEA3), 0),
+        OOO_INFO(zuc_eia3_ooo, MB_MGR_ZUC_OOO,
+                 0, HASH(ZUC_EIA3_BITLEN)),
+        OOO_INFO(zuc256_eea3_ooo, MB_MGR_ZUC_OOO,
+                 CIPH(ZUC_EEA3), 0),
+        OOO_INFO(zuc256_eia3_ooo, MB_MGR_ZUC_OOO,
+                 0, HASH(ZUC256_EIA3_BITLEN)),
+        OOO_INFO(aes256_ccm_ooo, MB_MGR_CCM_OOO,
+                 CIPH(CCM), HASH(AES_CCM)),
+        OOO_INFO(aes256_cmac_ooo, MB_MGR_CMAC_OOO,
+                 0, HASH(AES_CMAC_256)),
+        OOO_INFO(snow3g_uea2_ooo, MB_MGR_SNOW3G_OOO,
+                 CIPH(SNOW3G_UEA2_BITLEN), 0),
+        OOO_INFO(snow3g_uia2_ooo, MB_MGR_SNOW3G_OOO,
+                 0, HASH(SNOW3G_UIA2_BITLEN)),
+        OOO_INFO(sha_1_ooo, MB_MGR_SHA_1_OOO,
+                 0, HASH(SHA_1)),
+        OOO_INFO(sha_224_ooo, MB_MGR_SHA_256_OOO,
+                 0, HASH(SHA_224)),
+        OOO_INFO(sha_256_ooo, MB_MGR_SHA_256_OOO,
+                 0, HASH(SHA_256)),
+        OOO_INFO(sha_384_ooo, MB_MGR_SHA_512_OOO,
+                 0, HASH(SHA_384)),
+        OOO_INFO(sha_512_ooo, MB_MGR_SHA_512_OOO,
+                 0, HASH(SHA_512)),
+        OOO_INFO(aes128_gcm_ooo, MB_MGR_GCM_OOO,
+                 CIPH(GCM), HASH(AES_GMAC)),
+        OOO_INFO(aes192_gcm_ooo, MB_MGR_GCM_OOO,
+                 CIPH(GCM), HASH(AES_GMAC)),
+        OOO_INFO(aes256_gcm_ooo, MB_MGR_GCM_OOO,
+                 CIPH(GCM), HASH(AES_GMAC)),
+        OOO_INFO(chacha20_ooo, MB_MGR_CHACHA20_POLY1305_OOO,
+                 CIPH(CHACHA20), 0),
+        OOO_INFO(chacha20_poly1305_ooo, MB_MGR_CHACHA20_POLY1305_OOO,
+                 CIPH(CHACHA20_POLY1305), HASH(CHACHA20_POLY1305)),
+        OOO_INFO(poly1305_ooo, MB_MGR_CHACHA20_POLY1305_OOO,
+                 0, HASH(POLY1305)),
+        OOO_INFO(kasumi_uea1_ooo, MB_MGR_KASUMI_OOO,
+                 CIPH(KASUMI_UEA1_BITLEN), 0),
+        OOO_INFO(kasumi_uia1_ooo, MB_MGR_KASUMI_OOO,
+                 0, HASH(KASUMI_UIA1)),
+        OOO_INFO(snow_v_ooo, MB_MGR_SNOW_V_OOO,
+                 CIPH(SNOW_V), 0),
+        OOO_INFO(snow_v_aead_ooo, MB_MGR_SNOW_V_OOO,
+                 CIPH(SNOW_V_AEAD), HASH(SNOW_V_AEAD)),
+        OOO_INFO(aes128_xts_enc_ooo, MB_MGR_AES_XTS_OOO,
+                 CIPH(XTS), 0),
+        OOO_INFO(aes128_xts_dec_ooo, MB_MGR_AES_XTS_OOO,
+                 CIPH(XTS), 0),
+        OOO_INFO(aes256_xts_enc_ooo, MB_MGR_AES_XTS_OOO,
+                 CIPH(XTS), 0),
+        OOO_INFO(aes256_xts_dec_ooo, MB_MGR_AES_XTS_OOO,
+                 CIPH(XTS), 0),
+        OOO_INFO(aes128_cfb_ooo, MB_MGR_AES_CFB_OOO,
+                 CIPH(CFB), 0),
+        OOO_INFO(aes192_cfb_ooo, MB_MGR_AES_CFB_OOO,
+                 CIPH(CFB), 0),
+        OOO_INFO(aes256_cfb_ooo, MB_MGR_AES_CFB_OOO,
+                 CIPH(CFB), 0),
+        OOO_INFO(aes_cbc_hmac_sha_1_ooo, MB_MGR_AES_CBC_HMAC_OOO,
+                 CIPH(CBC), HASH(HMAC_SHA_1)),
+        OOO_INFO(aes_cbc_hmac_sha_256_ooo, MB_MGR_AES_CBC_HMAC_OOO,
+                 CIPH(CBC), HASH(HMAC_SHA_256)),
+        OOO_INFO(aes_ctr_hmac_sha_1_ooo, MB_MGR_AES_CBC_HMAC_OOO,
+                 CIPH(CNTR), HASH(HMAC_SHA_1)),
+        OOO_INFO(aes_ctr_hmac_sha_256_ooo, MB_MGR_AES_CBC_HMAC_OOO,
+                 CIPH(CNTR), HASH(HMAC_SHA_256)),
+        OOO_INFO(aes_ctr_cmac_ooo, MB_MGR_AES_CTR_CMAC_OOO,
+                 CIPH(CNTR), HASH(AES_CMAC) | HASH(AES_CMAC_BITLEN)),
+        OOO_INFO(crc_ooo, MB_MGR_CRC_OOO, 0,
+                 HASH(CRC32_ETHERNET_FCS) | HASH(CRC32_SCTP) |
+                 HASH(CRC32_WIMAX_OFDMA_DATA) | HASH(CRC24_LTE_A) |
+                 HASH(CRC24_LTE_B) | HASH(CRC16_X25) | HASH(CRC16_FP_DATA) |
+                 HASH(CRC11_FP_HEADER) | HASH(CRC10_IUUP_DATA) |
+                 HASH(CRC8_WIMAX_OFDMA_HCS) | HASH(CRC7_FP_HEADER) |
+                 HASH(CRC6_IUUP_HEADER))
 };
 
-/**
- * @brief Calculates necessary memory size for IMB_MGR.
- *
- * @return Size for IMB_MGR (aligned to 64 bytes)
+/*
+ * Checks the job ring size is a power of 2
+ * between IMB_MIN_JOB_RING_SIZE and IMB_MAX_JOB_RING_SIZE
  */
-size_t imb_get_mb_mgr_size(void)
+static int is_job_ring_size_valid(const unsigned ring_size)
+{
+        if (ring_size < IMB_MIN_JOB_RING_SIZE ||
+            ring_size > IMB_MAX_JOB_RING_SIZE)
+                return 0;
+
+        return (ring_size & (ring_size - 1)) == 0;
+}
+
+/*
+ * Memory placed after the OOO managers for the job ring:
+ * jobs, submit time stamps of the jobs, completion ring
+ * (twice the ring size), completion ring index and delivered flags
+ * of the jobs
+ */
+static size_t get_job_ring_size(const unsigned ring_size)
+{
+        return ring_size * (sizeof(IMB_JOB) + sizeof(uint64_t) +
+                            2 * sizeof(IMB_JOB *) + sizeof(uint32_t) +
+                            sizeof(uint8_t));
+}
+
+/*
+ * Memory placed after the job ring for the OOO manager counters
+ */
+static size_t get_stats_size(void)
+{
+#ifdef IMB_STATS
+        return OOO_STATS_NUM * sizeof(IMB_OOO_STATS);
+#else
+        return 0;
+#endif
+}
+
+static int is_ooo_mgr_used(const unsigned idx, const uint64_t cipher_mask,
+                           const uint64_t hash_mask)
+{
+        const uint64_t ooo_cipher_mask = ooo_mgr_table[idx].cipher_mask;
+        const uint64_t ooo_hash_mask = ooo_mgr_table[idx].hash_mask;
+
+        return (ooo_cipher_mask == 0 || (ooo_cipher_mask & cipher_mask)) &&
+                (ooo_hash_mask == 0 || (ooo_hash_mask & hash_mask));
+}
+
+static size_t get_mb_mgr_base_size(const uint64_t cipher_mask,
+                                   const uint64_t hash_mask)
 {
         size_t ooo_total_size = 0;
         unsigned i;
 
         for (i = 0; i < IMB_DIM(ooo_mgr_table); i++)
-                ooo_total_size += ooo_mgr_table[i].ooo_aligned_size;
+                if (is_ooo_mgr_used(i, cipher_mask, hash_mask))
+                        ooo_total_size += ooo_mgr_table[i].ooo_aligned_size;
         /*
          * Add 64 bytes into the maximum size calculation to
          * make sure there is enough room to align the OOO managers.
          */
-        return (sizeof(IMB_MGR) + ooo_total_size + ALIGNMENT);
+        return (sizeof(IMB_MGR) + ooo_total_size + get_stats_size() +
+                ALIGNMENT);
+}
+
+/**
+ * @brief Calculates necessary memory size for IMB_MGR.
+ *
+ * @return Size for IMB_MGR (aligned to 64 bytes)
+ */
+size_t imb_get_mb_mgr_size(void)
+{
+        return get_mb_mgr_base_size(IMB_CIPHER_MASK_ALL, IMB_HASH_MASK_ALL) +
+                get_job_ring_size(IMB_MAX_JOBS);
+}
+
+/**
+ * @brief Calculates necessary memory size for IMB_MGR
+ *        with a job ring of given size.
+ *
+ * @param ring_size number of jobs in the ring
+ *
+ * @return Size for IMB_MGR (aligned to 64 bytes)
+ * @retval 0 on invalid ring size
+ */
+size_t imb_get_mb_mgr_size_ex(const unsigned ring_size)
+{
+        return imb_get_mb_mgr_size_algos(ring_size, IMB_CIPHER_MASK_ALL,
+                                         IMB_HASH_MASK_ALL);
+}
+
+/**
+ * @brief Calculates necessary memory size for IMB_MGR
+ *        with a job ring of given size and a subset of algorithms.
+ *
+ * @param ring_size number of jobs in the ring
+ * @param cipher_mask IMB_CIPHER_MASK() of the enabled cipher modes
+ * @param hash_mask IMB_HASH_MASK() of the enabled hash algorithms
+ *
+ * @return Size for IMB_MGR (aligned to 64 bytes)
+ * @retval 0 on invalid ring size
+ */
+size_t imb_get_mb_mgr_size_algos(const unsigned ring_size,
+                                 const uint64_t cipher_mask,
+                                 const uint64_t hash_mask)
+{
+        if (!is_job_ring_size_valid(ring_size)) {
+                imb_set_errno(NULL, IMB_ERR_JOB_RING_SIZE);
+                return 0;
+        }
+
+        return get_mb_mgr_base_size(cipher_mask, hash_mask) +
+                get_job_ring_size(ring_size);
 }
 
 static uint8_t *get_ooo_ptr(IMB_MGR *mgr, const size_t offset)
@@ -143,10 +347,14 @@ static void set_ooo_mgr_road_block(IMB_MGR *mgr)
 {
         unsigned n;
 
-        for (n = 0; n < IMB_DIM(ooo_mgr_table); n++)
-                set_road_block(get_ooo_ptr(mgr,
-                                           ooo_mgr_table[n].ooo_ptr_offset),
-                               ooo_mgr_table[n].road_block_offset);
+        for (n = 0; n < IMB_DIM(ooo_mgr_table); n++) {
+                uint8_t *ooo_ptr =
+                        get_ooo_ptr(mgr, ooo_mgr_table[n].ooo_ptr_offset);
+
+                if (ooo_ptr != NULL)
+                        set_road_block(ooo_ptr,
+                                       ooo_mgr_table[n].road_block_offset);
+        }
 }
 
 /**
@@ -172,6 +380,79 @@ static void set_ooo_mgr_road_block(IMB_MGR *mgr)
  */
 IMB_MGR *imb_set_pointers_mb_mgr(void *mem_ptr, const uint64_t flags,
                                  const unsigned reset_mgr)
+{
+        const IMB_MGR *mgr = (const IMB_MGR *) mem_ptr;
+        unsigned ring_size = IMB_MAX_JOBS;
+
+        /* keep the ring of a manager that is not cleared */
+        if (mgr != NULL && !reset_mgr && mgr->job_ring_size != 0)
+                ring_size = mgr->job_ring_size;
+
+        return imb_set_pointers_mb_mgr_ex(mem_ptr, flags, reset_mgr,
+                                          ring_size);
+}
+
+/**
+ * @brief Initializes IMB_MGR pointers to out-of-order managers and
+ *        to the job ring with use of externally allocated memory.
+ *
+ * imb_get_mb_mgr_size_ex() should be called to know how much memory
+ * should be allocated externally.
+ *
+ * @param mem_ptr a pointer to allocated memory
+ * @param flags multi-buffer manager flags (see imb_set_pointers_mb_mgr())
+ * @param reset_mgr if 0, IMB_MGR structure is not cleared, else it is.
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ *
+ * @return Pointer to IMB_MGR structure
+ * @retval NULL on invalid ring size
+ */
+IMB_MGR *imb_set_pointers_mb_mgr_ex(void *mem_ptr, const uint64_t flags,
+                                    const unsigned reset_mgr,
+                                    const unsigned ring_size)
+{
+        const IMB_MGR *mgr = (const IMB_MGR *) mem_ptr;
+        uint64_t cipher_mask = IMB_CIPHER_MASK_ALL;
+        uint64_t hash_mask = IMB_HASH_MASK_ALL;
+
+        /* keep the algorithms of a manager that is not cleared */
+        if (mgr != NULL && !reset_mgr && mgr->cipher_mask != 0) {
+                cipher_mask = mgr->cipher_mask;
+                hash_mask = mgr->hash_mask;
+        }
+
+        return imb_set_pointers_mb_mgr_algos(mem_ptr, flags, reset_mgr,
+                                             ring_size, cipher_mask,
+                                             hash_mask);
+}
+
+/**
+ * @brief Initializes IMB_MGR pointers to out-of-order managers of
+ *        a subset of algorithms and to the job ring with use of
+ *        externally allocated memory.
+ *
+ * imb_get_mb_mgr_size_algos() should be called to know how much memory
+ * should be allocated externally.
+ *
+ * OOO managers of the algorithms that are not enabled are set to NULL.
+ *
+ * @param mem_ptr a pointer to allocated memory
+ * @param flags multi-buffer manager flags (see imb_set_pointers_mb_mgr())
+ * @param reset_mgr if 0, IMB_MGR structure is not cleared, else it is.
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ * @param cipher_mask IMB_CIPHER_MASK() of the enabled cipher modes
+ * @param hash_mask IMB_HASH_MASK() of the enabled hash algorithms
+ *
+ * @return Pointer to IMB_MGR structure
+ * @retval NULL on invalid ring size
+ */
+IMB_MGR *imb_set_pointers_mb_mgr_algos(void *mem_ptr, const uint64_t flags,
+                                       const unsigned reset_mgr,
+                                       const unsigned ring_size,
+                                       const uint64_t cipher_mask,
+                                       const uint64_t hash_mask)
 {
         if (mem_ptr == NULL) {
                 imb_set_errno(mem_ptr, ENOMEM);
@@ -181,9 +462,16 @@ IMB_MGR *imb_set_pointers_mb_mgr(void *mem_ptr, const uint64_t flags,
         IMB_MGR *ptr = (IMB_MGR *) mem_ptr;
         uint8_t *ptr8 = (uint8_t *) ptr;
         uint8_t *free_ptr = &ptr8[ALIGN(sizeof(IMB_MGR), ALIGNMENT)];
-        const size_t mem_size = imb_get_mb_mgr_size();
+        const size_t mem_size = imb_get_mb_mgr_size_algos(ring_size,
+                                                          cipher_mask,
+                                                          hash_mask);
         unsigned i;
 
+        if (mem_size == 0) {
+                imb_set_errno(ptr, IMB_ERR_JOB_RING_SIZE);
+                return NULL;
+        }
+
         /* Check if AESNI_EMU flag is set, needed to support AESNI emulation */
 #ifndef AESNI_EMU
         if (flags & IMB_FLAG_AESNI_OFF) {
@@ -228,15 +516,44 @@ IMB_MGR *imb_set_pointers_mb_mgr(void *mem_ptr, const uint64_t flags,
         imb_set_errno(ptr, 0);
         ptr->flags = flags; /* save the flags for future use in init */
         ptr->features = cpu_feature_adjust(flags, cpu_feature_detect());
+        ptr->cipher_mask = cipher_mask | IMB_CIPHER_MASK(IMB_CIPHER_NULL);
+        ptr->hash_mask = hash_mask | IMB_HASH_MASK(IMB_AUTH_NULL);
 
         /* Set OOO pointers */
         for (i = 0; i < IMB_DIM(ooo_mgr_table); i++) {
+                if (!is_ooo_mgr_used(i, cipher_mask, hash_mask)) {
+                        set_ooo_ptr(ptr, ooo_mgr_table[i].ooo_ptr_offset,
+                                    NULL);
+                        continue;
+                }
                 set_ooo_ptr(ptr, ooo_mgr_table[i].ooo_ptr_offset, free_ptr);
                 free_ptr = &free_ptr[ooo_mgr_table[i].ooo_aligned_size];
                 IMB_ASSERT((uintptr_t)(free_ptr - ptr8) <= mem_size);
         }
         set_ooo_mgr_road_block(ptr);
 
+        /* Set job ring (64 byte aligned, as are the OOO managers) */
+        ptr->job_ring = (IMB_JOB *) free_ptr;
+        free_ptr = &free_ptr[ring_size * sizeof(IMB_JOB)];
+        ptr->job_ring_size = ring_size;
+        ptr->job_tsc = (uint64_t *) free_ptr;
+        free_ptr = &free_ptr[ring_size * sizeof(uint64_t)];
+        ptr->completed_ring = (IMB_JOB **) free_ptr;
+        free_ptr = &free_ptr[2 * ring_size * sizeof(IMB_JOB *)];
+        ptr->completed_pos = (uint32_t *) free_ptr;
+        free_ptr = &free_ptr[ring_size * sizeof(uint32_t)];
+        ptr->job_delivered = free_ptr;
+        free_ptr = &free_ptr[ring_size * sizeof(uint8_t)];
+
+        /* Set OOO manager counters (kept if the manager is not cleared) */
+        if (get_stats_size() != 0) {
+                ptr->ooo_stats = (IMB_OOO_STATS *) free_ptr;
+                free_ptr = &free_ptr[get_stats_size()];
+        } else {
+                ptr->ooo_stats = NULL;
+        }
+        IMB_ASSERT((uintptr_t)(free_ptr - ptr8) <= mem_size);
+
         return ptr;
 }
 
@@ -267,6 +584,254 @@ free_mem(void *ptr)
 #endif
 }
 
+/*
+ * Mapping of imb_alloc_mem() memory,
+ * placed ALIGNMENT bytes before the returned pointer
+ */
+struct mem_map_hdr {
+        void *map_ptr;
+        size_t map_size;
+};
+
+#ifdef LINUX
+static int bind_numa_node(void *ptr, const size_t size, const int numa_node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+        const unsigned bits = 8 * sizeof(unsigned long);
+        unsigned long nodemask[MAX_NUMA_NODES / (8 * sizeof(unsigned long))];
+
+        memset(nodemask, 0, sizeof(nodemask));
+        nodemask[numa_node / bits] = 1UL << (numa_node % bits);
+
+        /* maxnode counts one bit more than the mask holds */
+        return (int) syscall(SYS_mbind, ptr, size, NUMA_MPOL_BIND,
+                             nodemask, MAX_NUMA_NODES + 1, 0);
+#else
+        (void) ptr;
+        (void) size;
+        return numa_node == 0 ? 0 : -1;
+#endif
+}
+
+/*
+ * Transparent hugepages are used for 2 MiB aligned regions only,
+ * map more and trim the unaligned head and tail
+ */
+static void *map_thp(const size_t map_size)
+{
+        const size_t size = map_size + HUGEPAGE_SIZE;
+        uint8_t *ptr, *aligned_ptr;
+        size_t head;
+
+        ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+                return NULL;
+
+        aligned_ptr = (uint8_t *) ALIGN((uintptr_t) ptr, HUGEPAGE_SIZE);
+        head = (size_t) (aligned_ptr - ptr);
+        if (head != 0)
+                (void) munmap(ptr, head);
+        if (head != HUGEPAGE_SIZE)
+                (void) munmap(&aligned_ptr[map_size], HUGEPAGE_SIZE - head);
+#ifdef MADV_HUGEPAGE
+        (void) madvise(aligned_ptr, map_size, MADV_HUGEPAGE);
+#endif
+        return aligned_ptr;
+}
+
+static void *map_mem(const size_t size, const int numa_node,
+                     const uint64_t flags, size_t *map_size)
+{
+        void *ptr = NULL;
+
+        if (flags & IMB_FLAG_HUGEPAGES) {
+                *map_size = ALIGN(size, (size_t) HUGEPAGE_SIZE);
+#ifdef MAP_HUGETLB
+                /* hugetlbfs pool first */
+                ptr = mmap(NULL, *map_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (ptr == MAP_FAILED)
+                        ptr = NULL;
+#endif
+                if (ptr == NULL)
+                        ptr = map_thp(*map_size);
+        } else {
+                *map_size = ALIGN(size, (size_t) sysconf(_SC_PAGESIZE));
+                ptr = mmap(NULL, *map_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (ptr == MAP_FAILED)
+                        ptr = NULL;
+        }
+        if (ptr == NULL)
+                return NULL;
+
+        /* pages are placed on first touch, bind them before */
+        if (numa_node != IMB_NUMA_NODE_ANY &&
+            bind_numa_node(ptr, *map_size, numa_node) != 0) {
+                (void) munmap(ptr, *map_size);
+                return NULL;
+        }
+
+        return ptr;
+}
+
+static void unmap_mem(void *ptr, const size_t map_size)
+{
+        (void) munmap(ptr, map_size);
+}
+#else
+static void *map_mem(const size_t size, const int numa_node,
+                     const uint64_t flags, size_t *map_size)
+{
+        const SIZE_T large_page_size = GetLargePageMinimum();
+        const DWORD alloc_type = MEM_RESERVE | MEM_COMMIT;
+        const DWORD node = (numa_node == IMB_NUMA_NODE_ANY) ?
+                NUMA_NO_PREFERRED_NODE : (DWORD) numa_node;
+        void *ptr = NULL;
+
+        /* large pages require SeLockMemoryPrivilege */
+        if ((flags & IMB_FLAG_HUGEPAGES) && large_page_size != 0) {
+                *map_size = ALIGN(size, (size_t) large_page_size);
+                ptr = VirtualAllocExNuma(GetCurrentProcess(), NULL,
+                                         *map_size,
+                                         alloc_type | MEM_LARGE_PAGES,
+                                         PAGE_READWRITE, node);
+        }
+        if (ptr == NULL) {
+                *map_size = size;
+                ptr = VirtualAllocExNuma(GetCurrentProcess(), NULL,
+                                         *map_size, alloc_type,
+                                         PAGE_READWRITE, node);
+        }
+
+        return ptr;
+}
+
+static void unmap_mem(void *ptr, const size_t map_size)
+{
+        (void) map_size;
+        (void) VirtualFree(ptr, 0, MEM_RELEASE);
+}
+#endif /* LINUX */
+
+/**
+ * @brief Allocates 64 byte aligned memory on a given NUMA node
+ *
+ * @param size number of bytes
+ * @param numa_node NUMA node id or IMB_NUMA_NODE_ANY
+ * @param flags IMB_FLAG_HUGEPAGES or 0
+ *
+ * @return Pointer to allocated memory
+ * @retval NULL on allocation error or invalid NUMA node
+ */
+void *imb_alloc_mem(const size_t size, const int numa_node,
+                    const uint64_t flags)
+{
+        struct mem_map_hdr *hdr;
+        uint8_t *map_ptr;
+        size_t map_size = 0;
+
+        if (size == 0 || numa_node < IMB_NUMA_NODE_ANY ||
+            numa_node >= MAX_NUMA_NODES) {
+                imb_set_errno(NULL, EINVAL);
+                return NULL;
+        }
+
+        map_ptr = map_mem(size + ALIGNMENT, numa_node, flags, &map_size);
+        if (map_ptr == NULL) {
+                imb_set_errno(NULL, ENOMEM);
+                return NULL;
+        }
+
+        hdr = (struct mem_map_hdr *) map_ptr;
+        hdr->map_ptr = map_ptr;
+        hdr->map_size = map_size;
+
+        return &map_ptr[ALIGNMENT];
+}
+
+/**
+ * @brief Frees memory allocated previously by imb_alloc_mem()
+ *
+ * @param ptr pointer to allocated memory
+ */
+void imb_free_mem(void *ptr)
+{
+        const struct mem_map_hdr *hdr;
+
+        if (ptr == NULL)
+                return;
+
+        hdr = (const struct mem_map_hdr *) &((uint8_t *) ptr)[-ALIGNMENT];
+        unmap_mem(hdr->map_ptr, hdr->map_size);
+}
+
+static void *
+numa_mem_alloc(const size_t size, const size_t alignment, void *ctx)
+{
+        const int *numa_node_flags = (const int *) ctx;
+
+        (void) alignment; /* imb_alloc_mem() is 64 byte aligned */
+        return imb_alloc_mem(size, numa_node_flags[0],
+                             numa_node_flags[1] ? IMB_FLAG_HUGEPAGES : 0);
+}
+
+static void
+numa_mem_free(void *ptr, const size_t size, void *ctx)
+{
+        (void) size;
+        (void) ctx;
+        imb_free_mem(ptr);
+}
+
+/*
+ * Allocates IMB_MGR with the default allocator (hooks == NULL)
+ * or with memory allocation hooks
+ */
+static IMB_MGR *
+alloc_mb_mgr_mem(const uint64_t flags, const unsigned ring_size,
+                 const uint64_t cipher_mask, const uint64_t hash_mask,
+                 const IMB_MEM_HOOKS *hooks)
+{
+        IMB_MGR *ptr = NULL;
+        size_t mem_size;
+
+        /* Check if AESNI_EMU flag is set, needed to support AESNI emulation */
+#ifndef AESNI_EMU
+        if (flags & IMB_FLAG_AESNI_OFF) {
+                imb_set_errno(ptr, IMB_ERR_NO_AESNI_EMU);
+                return NULL;
+        }
+#endif
+        mem_size = imb_get_mb_mgr_size_algos(ring_size, cipher_mask,
+                                             hash_mask);
+        if (mem_size == 0) {
+                imb_set_errno(ptr, IMB_ERR_JOB_RING_SIZE);
+                return NULL;
+        }
+
+        if (hooks != NULL) {
+                ptr = hooks->alloc(mem_size, ALIGNMENT, hooks->ctx);
+        } else {
+                ptr = alloc_aligned_mem(mem_size);
+                IMB_ASSERT(ptr != NULL);
+        }
+        if (ptr == NULL) {
+                imb_set_errno(ptr, ENOMEM);
+                return NULL;
+        }
+
+        imb_set_pointers_mb_mgr_algos(ptr, flags, 1, ring_size,
+                                      cipher_mask, hash_mask);
+        if (hooks != NULL) {
+                ptr->mem_hooks = *hooks;
+                ptr->mem_size = mem_size;
+        }
+
+        return ptr;
+}
+
 /**
  * @brief Allocates memory for multi-buffer manager instance
  *
@@ -283,25 +848,299 @@ free_mem(void *ptr)
  */
 IMB_MGR *alloc_mb_mgr(uint64_t flags)
 {
-        IMB_MGR *ptr = NULL;
+        return alloc_mb_mgr_ex(flags, IMB_MAX_JOBS);
+}
 
-        /* Check if AESNI_EMU flag is set, needed to support AESNI emulation */
-#ifndef AESNI_EMU
-        if (flags & IMB_FLAG_AESNI_OFF) {
-                imb_set_errno(ptr, IMB_ERR_NO_AESNI_EMU);
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with a job ring of given size
+ *
+ * @param flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ *
+ * @return Pointer to allocated memory for MB_MGR structure
+ * @retval NULL on allocation error or invalid ring size
+ */
+IMB_MGR *alloc_mb_mgr_ex(uint64_t flags, const unsigned ring_size)
+{
+        return alloc_mb_mgr_algos(flags, ring_size, IMB_CIPHER_MASK_ALL,
+                                  IMB_HASH_MASK_ALL);
+}
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with out-of-order managers for a subset of algorithms only
+ *
+ * @param flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ * @param cipher_mask IMB_CIPHER_MASK() of the enabled cipher modes
+ * @param hash_mask IMB_HASH_MASK() of the enabled hash algorithms
+ *
+ * @return Pointer to allocated memory for MB_MGR structure
+ * @retval NULL on allocation error or invalid ring size
+ */
+IMB_MGR *alloc_mb_mgr_algos(uint64_t flags, const unsigned ring_size,
+                            const uint64_t cipher_mask,
+                            const uint64_t hash_mask)
+{
+        return alloc_mb_mgr_mem(flags, ring_size, cipher_mask, hash_mask,
+                                NULL);
+}
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        on a given NUMA node
+ *
+ * @param flags multi-buffer manager flags (see alloc_mb_mgr())
+ *     IMB_FLAG_HUGEPAGES - use 2 MiB pages
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ * @param numa_node NUMA node id or IMB_NUMA_NODE_ANY
+ *
+ * @return Pointer to allocated memory for MB_MGR structure
+ * @retval NULL on allocation error, invalid ring size or NUMA node
+ */
+IMB_MGR *alloc_mb_mgr_numa(uint64_t flags, const unsigned ring_size,
+                           const int numa_node)
+{
+        int numa_node_flags[2];
+        IMB_MEM_HOOKS hooks;
+        IMB_MGR *ptr;
+
+        numa_node_flags[0] = numa_node;
+        numa_node_flags[1] = (flags & IMB_FLAG_HUGEPAGES) != 0;
+        hooks.alloc = numa_mem_alloc;
+        hooks.free = numa_mem_free;
+        hooks.ctx = numa_node_flags;
+
+        ptr = alloc_mb_mgr_mem(flags, ring_size, IMB_CIPHER_MASK_ALL,
+                               IMB_HASH_MASK_ALL, &hooks);
+        /* context is used for allocation only */
+        if (ptr != NULL)
+                ptr->mem_hooks.ctx = NULL;
+
+        return ptr;
+}
+
+/**
+ * @brief Allocates memory for multi-buffer manager instance
+ *        with user supplied memory allocation hooks
+ *
+ * @param flags multi-buffer manager flags (see alloc_mb_mgr())
+ * @param ring_size number of jobs in the ring, power of 2
+ *                  from IMB_MIN_JOB_RING_SIZE to IMB_MAX_JOB_RING_SIZE
+ * @param hooks memory allocation hooks, copied into IMB_MGR
+ *
+ * @return Pointer to allocated memory for MB_MGR structure
+ * @retval NULL on allocation error, invalid ring size or hooks
+ */
+IMB_MGR *alloc_mb_mgr_hooks(uint64_t flags, const unsigned ring_size,
+                            const IMB_MEM_HOOKS *hooks)
+{
+        if (hooks == NULL || hooks->alloc == NULL || hooks->free == NULL) {
+                imb_set_errno(NULL, EINVAL);
                 return NULL;
         }
+
+        return alloc_mb_mgr_mem(flags, ring_size, IMB_CIPHER_MASK_ALL,
+                                IMB_HASH_MASK_ALL, hooks);
+}
+
+/**
+ * @brief Sets the flush deadline of the multi-buffer manager
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param tsc_cycles maximum age of the earliest job (in TSC cycles),
+ *                   0 disables the deadline
+ */
+void imb_set_flush_deadline(IMB_MGR *state, const uint64_t tsc_cycles)
+{
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return;
+        }
 #endif
-        ptr = alloc_aligned_mem(imb_get_mb_mgr_size());
-        IMB_ASSERT(ptr != NULL);
-        if (ptr != NULL) {
-                imb_set_pointers_mb_mgr(ptr, flags, 1);
-        } else {
-                imb_set_errno(ptr, ENOMEM);
-                return NULL;
+        imb_set_errno(state, 0);
+        state->flush_deadline = tsc_cycles;
+}
+
+/**
+ * @brief Sets the completion mode of the job API
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param mode IMB_COMPLETION_MODE_IN_ORDER or
+ *             IMB_COMPLETION_MODE_OUT_OF_ORDER
+ */
+void imb_set_completion_mode(IMB_MGR *state, const IMB_COMPLETION_MODE mode)
+{
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return;
+        }
+#endif
+        if ((mode != IMB_COMPLETION_MODE_IN_ORDER &&
+             mode != IMB_COMPLETION_MODE_OUT_OF_ORDER) ||
+            state->earliest_job >= 0) {
+                imb_set_errno(state, IMB_ERR_COMPLETION_MODE);
+                return;
         }
+        imb_set_errno(state, 0);
+        completion_ring_reset(state);
+        state->completion_mode = (uint32_t) mode;
+}
 
-        return ptr;
+/**
+ * @brief Sets the job completion mode of the burst API
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param mode IMB_BURST_MODE_ORDERED or IMB_BURST_MODE_SORTED
+ */
+void imb_set_burst_mode(IMB_MGR *state, const IMB_BURST_MODE mode)
+{
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return;
+        }
+#endif
+        if (mode != IMB_BURST_MODE_ORDERED && mode != IMB_BURST_MODE_SORTED) {
+                imb_set_errno(state, IMB_ERR_BURST_MODE);
+                return;
+        }
+        imb_set_errno(state, 0);
+        state->burst_mode = (uint32_t) mode;
+}
+
+/**
+ * @brief Registers a callback for jobs completed out of order
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param cb callback function, NULL to queue completed jobs
+ * @param cb_arg argument passed to the callback
+ */
+void imb_set_completion_callback(IMB_MGR *state, imb_completion_cb_t cb,
+                                 void *cb_arg)
+{
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return;
+        }
+#endif
+        imb_set_errno(state, 0);
+        state->completion_cb = cb;
+        state->completion_cb_arg = cb_arg;
+}
+
+/**
+ * @brief Retrieves jobs completed out of order
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param jobs array to store pointers of completed jobs
+ * @param max_jobs number of entries in jobs
+ *
+ * @return number of jobs stored in jobs
+ */
+uint32_t imb_dequeue_completed(IMB_MGR *state, IMB_JOB **jobs,
+                               const uint32_t max_jobs)
+{
+        uint32_t n;
+
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return 0;
+        }
+        if (jobs == NULL && max_jobs != 0) {
+                imb_set_errno(state, IMB_ERR_NULL_JOB);
+                return 0;
+        }
+#endif
+        imb_set_errno(state, 0);
+
+        for (n = 0; n < max_jobs; n++) {
+                jobs[n] = completion_ring_pop(state);
+                if (jobs[n] == NULL)
+                        break;
+        }
+
+        return n;
+}
+
+/**
+ * @brief Retrieves counters of the out-of-order managers
+ *
+ * @param state pointer to IMB_MGR structure
+ * @param stats array of counters, one entry per OOO manager
+ * @param max_stats number of entries in stats
+ *
+ * @return Number of entries written to stats
+ */
+unsigned imb_get_stats(IMB_MGR *state, IMB_OOO_STATS *stats,
+                       const unsigned max_stats)
+{
+        const size_t first_offset = offsetof(IMB_MGR, aes128_ooo);
+        unsigned i;
+
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return 0;
+        }
+        if (stats == NULL && max_stats != 0) {
+                imb_set_errno(state, IMB_ERR_NULL_DST);
+                return 0;
+        }
+#endif
+        if (state->ooo_stats == NULL) {
+                imb_set_errno(state, IMB_ERR_NO_STATS);
+                return 0;
+        }
+        imb_set_errno(state, 0);
+
+        for (i = 0; i < IMB_DIM(ooo_mgr_table) && i < max_stats; i++) {
+                const size_t idx = (ooo_mgr_table[i].ooo_ptr_offset -
+                                    first_offset) / sizeof(void *);
+
+                stats[i] = state->ooo_stats[idx];
+                stats[i].name = ooo_mgr_table[i].name;
+        }
+
+        return i;
+}
+
+/**
+ * @brief Clears counters of the out-of-order managers
+ *
+ * @param state pointer to IMB_MGR structure
+ */
+void imb_reset_stats(IMB_MGR *state)
+{
+        unsigned i;
+
+#ifdef SAFE_PARAM
+        if (state == NULL) {
+                imb_set_errno(NULL, IMB_ERR_NULL_MBMGR);
+                return;
+        }
+#endif
+        if (state->ooo_stats == NULL) {
+                imb_set_errno(state, IMB_ERR_NO_STATS);
+                return;
+        }
+        imb_set_errno(state, 0);
+
+        /* jobs held by the OOO managers are still in flight */
+        for (i = 0; i < OOO_STATS_NUM; i++) {
+                const uint64_t in_flight = state->ooo_stats[i].in_flight;
+
+                memset(&state->ooo_stats[i], 0, sizeof(IMB_OOO_STATS));
+                state->ooo_stats[i].in_flight = in_flight;
+        }
 }
 
 /**
@@ -315,5 +1154,8 @@ void free_mb_mgr(IMB_MGR *ptr)
         IMB_ASSERT(ptr != NULL);
 
         /* Free IMB_MGR */
-        free_mem(ptr);
+        if (ptr->mem_hooks.free != NULL)
+                ptr->mem_hooks.free(ptr, ptr->mem_size, ptr->mem_hooks.ctx);
+        else
+                free_mem(ptr);
 }
@@ -751,3 +751,166 @@ docsis_des_dec_basic(const void *input, void *output, const int size,
                 iv = in_block;
         }
 }
+
+/* ========================================================================= */
+/* Multi-buffer DES and 3DES CBC kernels                                     */
+/* ========================================================================= */
+
+/*
+ * DES rounds of num_lanes blocks interleaved, so that the s-box
+ * lookups of different lanes are independent of each other.
+ * Input and output are in IP/FP domain.
+ */
+__forceinline
+void des_rounds_mb(uint32_t *l, uint32_t *r, const uint64_t * const *ks,
+                   const unsigned num_lanes, const int enc)
+{
+        unsigned i, lane;
+
+        for (i = 0; i < 16; i += 2) {
+                const unsigned k0 = enc ? i : (15 - i);
+                const unsigned k1 = enc ? (i + 1) : (14 - i);
+
+                for (lane = 0; lane < num_lanes; lane++)
+                        l[lane] ^= fRK(r[lane], ks[lane][k0]);
+                for (lane = 0; lane < num_lanes; lane++)
+                        r[lane] ^= fRK(l[lane], ks[lane][k1]);
+        }
+}
+
+/*
+ * DES/3DES CBC on num_blocks blocks of each lane.
+ * - all lanes are loaded before any lane is stored, as unused lanes
+ *   may be a copy of a lane in use (flush)
+ * - 3DES lanes keep the data in IP/FP domain between the three
+ *   DES operations (FP followed by IP cancel out)
+ */
+__forceinline
+void des_cbc_mb_basic(DES_ARGS_x16 *args, const uint64_t num_blocks,
+                      const unsigned num_lanes, const int enc,
+                      const int is_3des)
+{
+        uint64_t iv[AVX512_NUM_DES_LANES], c[AVX512_NUM_DES_LANES];
+        uint32_t l[AVX512_NUM_DES_LANES], r[AVX512_NUM_DES_LANES];
+        const uint64_t *ks1[AVX512_NUM_DES_LANES];
+        const uint64_t *ks2[AVX512_NUM_DES_LANES];
+        const uint64_t *ks3[AVX512_NUM_DES_LANES];
+        uint64_t n, offset;
+        unsigned lane;
+
+        for (lane = 0; lane < num_lanes; lane++) {
+                memcpy(&iv[lane], &args->IV[lane * 2], sizeof(iv[lane]));
+                if (is_3des) {
+                        const uint64_t * const *ks_ptr =
+                                (const uint64_t * const *) args->keys[lane];
+
+                        ks1[lane] = ks_ptr[0];
+                        ks2[lane] = ks_ptr[1];
+                        ks3[lane] = ks_ptr[2];
+                } else {
+                        ks1[lane] = (const uint64_t *) args->keys[lane];
+                }
+        }
+
+        for (n = 0, offset = 0; n < num_blocks;
+             n++, offset += IMB_DES_BLOCK_SIZE) {
+                for (lane = 0; lane < num_lanes; lane++) {
+                        uint64_t t;
+
+                        memcpy(&c[lane], &args->in[lane][offset],
+                               sizeof(c[lane]));
+                        t = enc ? (c[lane] ^ iv[lane]) : c[lane];
+                        r[lane] = (uint32_t) t;
+                        l[lane] = (uint32_t) (t >> 32);
+                        ip_z(&r[lane], &l[lane]);
+                }
+
+                if (!is_3des) {
+                        des_rounds_mb(l, r, ks1, num_lanes, enc);
+                } else if (enc) {
+                        des_rounds_mb(l, r, ks1, num_lanes, 1);
+                        des_rounds_mb(r, l, ks2, num_lanes, 0);
+                        des_rounds_mb(l, r, ks3, num_lanes, 1);
+                } else {
+                        des_rounds_mb(l, r, ks3, num_lanes, 0);
+                        des_rounds_mb(r, l, ks2, num_lanes, 1);
+                        des_rounds_mb(l, r, ks1, num_lanes, 0);
+                }
+
+                for (lane = 0; lane < num_lanes; lane++) {
+                        uint64_t t;
+
+                        fp_z(&r[lane], &l[lane]);
+                        t = ((uint64_t) l[lane]) |
+                                (((uint64_t) r[lane]) << 32);
+                        if (enc) {
+                                iv[lane] = t;
+                        } else {
+                                t ^= iv[lane];
+                                iv[lane] = c[lane];
+                        }
+                        memcpy(&args->out[lane][offset], &t, sizeof(t));
+                }
+        }
+
+        for (lane = 0; lane < num_lanes; lane++) {
+                memcpy(&args->IV[lane * 2], &iv[lane], sizeof(iv[lane]));
+                args->in[lane] += offset;
+                args->out[lane] += offset;
+        }
+
+#ifdef SAFE_DATA
+        clear_mem(iv, sizeof(iv));
+        clear_mem(c, sizeof(c));
+        clear_mem(l, sizeof(l));
+        clear_mem(r, sizeof(r));
+#endif
+}
+
+IMB_DLL_LOCAL
+void des_cbc_enc_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 4, 1 /* enc */, 0 /* DES */);
+}
+
+IMB_DLL_LOCAL
+void des_cbc_dec_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 4, 0 /* dec */, 0 /* DES */);
+}
+
+IMB_DLL_LOCAL
+void des3_cbc_enc_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 4, 1 /* enc */, 1 /* 3DES */);
+}
+
+IMB_DLL_LOCAL
+void des3_cbc_dec_x4_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 4, 0 /* dec */, 1 /* 3DES */);
+}
+
+IMB_DLL_LOCAL
+void des_cbc_enc_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 8, 1 /* enc */, 0 /* DES */);
+}
+
+IMB_DLL_LOCAL
+void des_cbc_dec_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 8, 0 /* dec */, 0 /* DES */);
+}
+
+IMB_DLL_LOCAL
+void des3_cbc_enc_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 8, 1 /* enc */, 1 /* 3DES */);
+}
+
+IMB_DLL_LOCAL
+void des3_cbc_dec_x8_basic(DES_ARGS_x16 *args, const uint64_t num_blocks)
+{
+        des_cbc_mb_basic(args, num_blocks, 8, 0 /* dec */, 1 /* 3DES */);
+}
@@ -87,7 +87,12 @@ IMB_DLL_LOCAL const int imb_errno_types[] = {
         IMB_ERR_JOB_CIPH_DIR,
         IMB_ERR_JOB_NULL_GHASH_INIT_TAG,
         IMB_ERR_MISSING_CPUFLAGS_INIT_MGR,
-        IMB_ERR_NULL_JOB
+        IMB_ERR_NULL_JOB,
+        IMB_ERR_JOB_RING_SIZE,
+        IMB_ERR_NO_STATS,
+        IMB_ERR_ALGO_NOT_ENABLED,
+        IMB_ERR_COMPLETION_MODE,
+        IMB_ERR_BURST_MODE
 };
 
 #ifdef DEBUG
@@ -211,6 +216,16 @@ imb_get_strerror(int errnum)
                        "required CPU flags";
         case IMB_ERR_NULL_JOB:
                 return "NULL job pointer";
+        case IMB_ERR_JOB_RING_SIZE:
+                return "Invalid job ring size";
+        case IMB_ERR_NO_STATS:
+                return "Statistics not enabled in this build";
+        case IMB_ERR_ALGO_NOT_ENABLED:
+                return "Algorithm not enabled in IMB_MGR";
+        case IMB_ERR_COMPLETION_MODE:
+                return "Invalid completion mode or job ring not empty";
+        case IMB_ERR_BURST_MODE:
+                return "Invalid burst mode";
         default:
                 return strerror(errnum);
         }
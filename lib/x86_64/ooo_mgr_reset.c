@@ -32,11 +32,19 @@
 #include "include/ooo_mgr_reset.h"
 #include <stddef.h> /* offsetof() */
 
+/*
+ * Reset functions skip OOO managers that are not allocated
+ * (see alloc_mb_mgr_algos()), their pointers are NULL
+ */
+
 IMB_DLL_LOCAL
 void ooo_mgr_aes_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_AES_OOO *p_mgr = (MB_MGR_AES_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_AES_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
         if (num_lanes == 4)
@@ -59,6 +67,9 @@ void ooo_mgr_docsis_aes_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_DOCSIS_AES_OOO *p_mgr = (MB_MGR_DOCSIS_AES_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_DOCSIS_AES_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
         if (num_lanes == 4)
@@ -74,6 +85,9 @@ void ooo_mgr_cmac_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_CMAC_OOO *p_mgr = (MB_MGR_CMAC_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_CMAC_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
         if (num_lanes == 4)
@@ -89,6 +103,9 @@ void ooo_mgr_ccm_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_CCM_OOO *p_mgr = (MB_MGR_CCM_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_CCM_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
         if (num_lanes == 4)
@@ -99,12 +116,155 @@ void ooo_mgr_ccm_reset(void *p_ooo_mgr, const unsigned num_lanes)
                 p_mgr->unused_lanes = 0xFEDCBA9876543210;
 }
 
+IMB_DLL_LOCAL
+void ooo_mgr_gcm_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_GCM_OOO *p_mgr = (MB_MGR_GCM_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_GCM_OOO,road_block));
+        if (num_lanes == 4)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_chacha20_poly1305_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_CHACHA20_POLY1305_OOO *p_mgr =
+                (MB_MGR_CHACHA20_POLY1305_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_CHACHA20_POLY1305_OOO,road_block));
+        if (num_lanes == 4)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_kasumi_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_KASUMI_OOO *p_mgr = (MB_MGR_KASUMI_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_KASUMI_OOO, road_block));
+        if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_snow_v_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_SNOW_V_OOO *p_mgr = (MB_MGR_SNOW_V_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_SNOW_V_OOO, road_block));
+        if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_aes_cbc_hmac_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_AES_CBC_HMAC_OOO *p_mgr = (MB_MGR_AES_CBC_HMAC_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_AES_CBC_HMAC_OOO, road_block));
+        if (num_lanes == 4)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_aes_ctr_cmac_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_AES_CTR_CMAC_OOO *p_mgr = (MB_MGR_AES_CTR_CMAC_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_AES_CTR_CMAC_OOO, road_block));
+        if (num_lanes == 4)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_crc_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_CRC_OOO *p_mgr = (MB_MGR_CRC_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_CRC_OOO, road_block));
+        if (num_lanes == 4)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_aes_xts_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_AES_XTS_OOO *p_mgr = (MB_MGR_AES_XTS_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_AES_XTS_OOO, road_block));
+        if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
+IMB_DLL_LOCAL
+void ooo_mgr_aes_cfb_reset(void *p_ooo_mgr, const unsigned num_lanes)
+{
+        MB_MGR_AES_CFB_OOO *p_mgr = (MB_MGR_AES_CFB_OOO *) p_ooo_mgr;
+
+        if (p_mgr == NULL)
+                return;
+
+        memset(p_mgr, 0, offsetof(MB_MGR_AES_CFB_OOO, road_block));
+        if (num_lanes == 8)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
+                p_mgr->unused_lanes = 0xFEDCBA9876543210;
+}
+
 IMB_DLL_LOCAL
 void ooo_mgr_aes_xcbc_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_AES_XCBC_OOO *p_mgr = (MB_MGR_AES_XCBC_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_AES_XCBC_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -125,6 +285,9 @@ void ooo_mgr_hmac_sha1_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_SHA_1_OOO *p_mgr = (MB_MGR_HMAC_SHA_1_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_SHA_1_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -155,6 +318,9 @@ void ooo_mgr_hmac_sha224_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_SHA_256_OOO *p_mgr = (MB_MGR_HMAC_SHA_256_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_SHA_256_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -185,6 +351,9 @@ void ooo_mgr_hmac_sha256_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_SHA_256_OOO *p_mgr = (MB_MGR_HMAC_SHA_256_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_SHA_256_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -215,6 +384,9 @@ void ooo_mgr_hmac_sha384_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_SHA_512_OOO *p_mgr = (MB_MGR_HMAC_SHA_512_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_SHA_512_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -251,6 +423,9 @@ void ooo_mgr_hmac_sha512_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_SHA_512_OOO *p_mgr = (MB_MGR_HMAC_SHA_512_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_SHA_512_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -287,6 +462,9 @@ void ooo_mgr_hmac_md5_reset(void *p_ooo_mgr, const unsigned num_lanes)
         MB_MGR_HMAC_MD5_OOO *p_mgr = (MB_MGR_HMAC_MD5_OOO *) p_ooo_mgr;
         unsigned i;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_HMAC_MD5_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -304,6 +482,8 @@ void ooo_mgr_hmac_md5_reset(void *p_ooo_mgr, const unsigned num_lanes)
                 p_mgr->unused_lanes = 0xF76543210;
         else if (num_lanes == AVX2_NUM_MD5_LANES)
                 p_mgr->unused_lanes = 0xFEDCBA9876543210;
+        else if (num_lanes == AVX512_NUM_MD5_LANES)
+                p_mgr->unused_lanes = 0xFFFFFFFF;
 }
 
 IMB_DLL_LOCAL
@@ -311,6 +491,9 @@ void ooo_mgr_zuc_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_ZUC_OOO *p_mgr = (MB_MGR_ZUC_OOO *) p_ooo_mgr;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_ZUC_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
@@ -331,6 +514,9 @@ void ooo_mgr_sha1_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_SHA_1_OOO *p_mgr = (MB_MGR_SHA_1_OOO *) p_ooo_mgr;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_SHA_1_OOO,road_block));
 
         if (num_lanes == 2)
@@ -348,6 +534,9 @@ void ooo_mgr_sha256_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_SHA_256_OOO *p_mgr = (MB_MGR_SHA_256_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_SHA_256_OOO,road_block));
 
         if (num_lanes == 2)
@@ -365,6 +554,9 @@ void ooo_mgr_sha512_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_SHA_512_OOO *p_mgr = (MB_MGR_SHA_512_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_SHA_512_OOO,road_block));
 
         if (num_lanes == AVX_NUM_SHA512_LANES)
@@ -380,9 +572,16 @@ void ooo_mgr_des_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_DES_OOO *p_mgr = (MB_MGR_DES_OOO *) p_ooo_mgr;
         
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_DES_OOO,road_block));
 
-        if (num_lanes == 16)
+        if (num_lanes == SSE_NUM_DES_LANES)
+                p_mgr->unused_lanes = 0xF3210;
+        else if (num_lanes == AVX_NUM_DES_LANES)
+                p_mgr->unused_lanes = 0xF76543210;
+        else if (num_lanes == 16)
                 p_mgr->unused_lanes = 0xFEDCBA9876543210;
 }
 
@@ -391,6 +590,9 @@ void ooo_mgr_snow3g_reset(void *p_ooo_mgr, const unsigned num_lanes)
 {
         MB_MGR_SNOW3G_OOO *p_mgr = (MB_MGR_SNOW3G_OOO *) p_ooo_mgr;
 
+        if (p_mgr == NULL)
+                return;
+
         memset(p_mgr, 0, offsetof(MB_MGR_SNOW3G_OOO,road_block));
         memset(p_mgr->lens, 0xff, sizeof(p_mgr->lens));
 
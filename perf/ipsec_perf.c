@@ -2156,6 +2156,10 @@ do_test(IMB_MGR *mb_mgr, struct params_s *params,
                 IMB_JOB *jt = &job_template;
                 uint32_t num_jobs = num_iter;
                 uint32_t list_idx;
+                const int aead =
+                        (jt->cipher_mode == IMB_CIPHER_GCM ||
+                         jt->cipher_mode == IMB_CIPHER_CCM ||
+                         jt->cipher_mode == IMB_CIPHER_CHACHA20_POLY1305);
 
                 while (num_jobs && timebox_on) {
                         uint32_t n_jobs =
@@ -2165,6 +2169,18 @@ do_test(IMB_MGR *mb_mgr, struct params_s *params,
                         for (i = 0; i < n_jobs; i++) {
                                 job = &jobs[i];
 
+                                /*
+                                 * AEAD algorithms also need
+                                 * tag and AAD fields set
+                                 */
+                                if (aead) {
+                                        *job = *jt;
+                                        set_job_fields(job, p_buffer, p_keys,
+                                                       i, index);
+                                        index = get_next_index(index);
+                                        continue;
+                                }
+
                                 /* If IMIX testing is being done, set the buffer
                                  * size to cipher going through the
                                  * list of sizes precalculated */
@@ -3904,10 +3920,16 @@ int main(int argc, char *argv[])
         if (test_api != TEST_API_JOB && burst_size == 0)
                 burst_size = DEFAULT_BURST_SIZE;
 
-        /* currently only AES-CBC & CTR supported by cipher-only burst API */
+        /*
+         * currently only AES-CBC, CTR, GCM, CCM & CHACHA20-POLY1305
+         * supported by cipher-only burst API
+         */
         if (test_api == TEST_API_CIPHER_BURST &&
             (custom_job_params.cipher_mode != TEST_CBC &&
-             custom_job_params.cipher_mode != TEST_CNTR)) {
+             custom_job_params.cipher_mode != TEST_CNTR &&
+             custom_job_params.cipher_mode != TEST_GCM &&
+             custom_job_params.cipher_mode != TEST_CCM &&
+             custom_job_params.cipher_mode != TEST_AEAD_CHACHA20)) {
                 fprintf(stderr, "Unsupported cipher-only burst "
                         "API algorithm selected\n");
                 return EXIT_FAILURE;
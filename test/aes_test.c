@@ -610,6 +610,367 @@ static const uint8_t C7[] = {
         0x52, 0x51, 0x69, 0xc8, 0xff, 0x52, 0x8f, 0x44
 };
 
+/*
+ * 192-bit (33 blocks) and 256-bit (49 blocks) keys over more than one
+ * 16 block group, with a remainder (generated with OpenSSL)
+ */
+static const uint8_t K8[] = {
+        0x44, 0x2c, 0xd8, 0x62, 0xbc, 0x0b, 0x5a, 0x71,
+        0x86, 0xf5, 0x24, 0xf3, 0xd5, 0x74, 0x8c, 0x65,
+        0xdd, 0x97, 0x5b, 0xa1, 0x65, 0x90, 0x38, 0xd8
+};
+static const uint8_t IV8[] = {
+        0x11, 0x0e, 0xd5, 0x4f, 0x6d, 0x5b, 0xdb, 0xda,
+        0xb9, 0x35, 0x96, 0x19, 0x77, 0x6e, 0x60, 0x74
+};
+static const uint8_t P8[] = {
+        0xb5, 0x42, 0xcf, 0xd7, 0x1a, 0x7c, 0x9e, 0x2d,
+        0xb3, 0x47, 0x5c, 0x9e, 0x7b, 0xd5, 0xd6, 0x89,
+        0xac, 0xb1, 0x46, 0x40, 0xc8, 0xe5, 0x38, 0x86,
+        0x66, 0xcb, 0x40, 0xc9, 0xbd, 0xb4, 0x5d, 0x20,
+        0xf2, 0x3a, 0x2b, 0x03, 0x21, 0x65, 0xcc, 0xcc,
+        0x2d, 0x80, 0x95, 0xf1, 0x48, 0xb9, 0x78, 0xfe,
+        0x41, 0x7b, 0x34, 0x55, 0x91, 0x8c, 0x3e, 0xa6,
+        0x23, 0xe5, 0x6d, 0x2c, 0xe7, 0x55, 0x69, 0xac,
+        0x15, 0xd4, 0xd2, 0x2f, 0x41, 0xa8, 0x2f, 0x7a,
+        0x24, 0x3a, 0x9d, 0x52, 0x24, 0xb5, 0x34, 0x71,
+        0xa8, 0x64, 0x38, 0x46, 0x1e, 0xc8, 0x04, 0x70,
+        0xc9, 0x7c, 0xb6, 0xf9, 0x4b, 0xca, 0x9b, 0x52,
+        0xf6, 0x09, 0x59, 0x12, 0xd3, 0xbc, 0xdf, 0x6f,
+        0x6e, 0x6c, 0x0d, 0x78, 0x67, 0x41, 0x22, 0x18,
+        0xba, 0x63, 0xe9, 0xcb, 0xc9, 0x13, 0xa3, 0x1d,
+        0x2f, 0x87, 0xb3, 0xe7, 0x43, 0x8a, 0x0c, 0x49,
+        0x6e, 0xd0, 0x5b, 0x66, 0x2d, 0x1a, 0xf3, 0xe2,
+        0xe5, 0x0e, 0x7c, 0x1d, 0x6a, 0xd4, 0x5b, 0x2c,
+        0x4d, 0x70, 0xe1, 0x9c, 0xe9, 0xe2, 0x33, 0xe5,
+        0x2d, 0xff, 0xfc, 0xb0, 0x26, 0x0d, 0xd4, 0xc9,
+        0x54, 0x21, 0x6e, 0xe2, 0xa9, 0x39, 0x84, 0x0d,
+        0x60, 0x19, 0x84, 0xf7, 0x84, 0xe6, 0xf7, 0xe5,
+        0x3b, 0x84, 0xb6, 0x70, 0xd7, 0xaf, 0xcb, 0x00,
+        0x9b, 0xdb, 0x28, 0x0a, 0x4d, 0xcc, 0x0a, 0x09,
+        0x7f, 0xf5, 0x2b, 0x3e, 0x9e, 0x92, 0xaa, 0x27,
+        0xb7, 0x84, 0xbb, 0xc0, 0x0d, 0xf0, 0x0e, 0x7b,
+        0x5b, 0x96, 0x00, 0x01, 0xe9, 0xf1, 0x84, 0xa7,
+        0x51, 0x14, 0xd0, 0xae, 0x0e, 0x3f, 0xc7, 0x43,
+        0xca, 0x44, 0x29, 0x31, 0x64, 0x9c, 0x7d, 0x67,
+        0xc3, 0x48, 0xb9, 0x2e, 0x5d, 0x69, 0xb7, 0x26,
+        0x85, 0x9e, 0x59, 0x05, 0x79, 0x21, 0x76, 0x10,
+        0x27, 0xa0, 0x8b, 0x55, 0xc3, 0xdd, 0x23, 0xad,
+        0x0a, 0x04, 0x01, 0x75, 0x53, 0xd0, 0x14, 0x07,
+        0x5a, 0x5c, 0x18, 0xfa, 0xcc, 0xca, 0x0b, 0x1e,
+        0x92, 0x95, 0x57, 0x36, 0xde, 0xb6, 0xb8, 0x73,
+        0xf6, 0x7a, 0xf2, 0xb5, 0xc3, 0x1e, 0x35, 0x81,
+        0x18, 0x30, 0x4b, 0xc0, 0xc3, 0xa5, 0x87, 0x3d,
+        0x56, 0xb9, 0x6e, 0xdc, 0xb2, 0x8a, 0x22, 0x9b,
+        0x58, 0x73, 0x92, 0x4a, 0x70, 0x29, 0x64, 0x0a,
+        0x95, 0x98, 0x9d, 0x87, 0x66, 0x7b, 0x16, 0xf5,
+        0xcd, 0xbd, 0x9f, 0xcc, 0x0d, 0x93, 0xf0, 0x42,
+        0x8e, 0x56, 0x54, 0x8d, 0x68, 0x21, 0x14, 0xd5,
+        0xb1, 0x2f, 0xa4, 0xfb, 0x87, 0xf1, 0x8f, 0x0c,
+        0xdc, 0xf2, 0x24, 0x83, 0x04, 0x6b, 0xde, 0x42,
+        0x00, 0xa5, 0x94, 0x4f, 0x88, 0x13, 0x65, 0x4f,
+        0xda, 0x2b, 0x61, 0xc3, 0x45, 0x08, 0xf8, 0x04,
+        0x74, 0xc1, 0x23, 0xff, 0x7b, 0x87, 0x54, 0xb1,
+        0xa3, 0x81, 0x1e, 0x61, 0xf6, 0x67, 0xa4, 0xa1,
+        0x89, 0xe0, 0xc3, 0x02, 0x8c, 0x9c, 0xff, 0x9a,
+        0x12, 0x31, 0x2e, 0x37, 0xa1, 0xb6, 0xe6, 0x60,
+        0x79, 0x22, 0xa8, 0x0f, 0xa5, 0x62, 0xc9, 0x31,
+        0xc3, 0x3c, 0x24, 0xd9, 0x92, 0xe6, 0x81, 0x48,
+        0x40, 0x65, 0xc4, 0x9e, 0x71, 0xa7, 0xd5, 0x5c,
+        0x0f, 0x5f, 0x53, 0xa1, 0xd4, 0xa4, 0xf8, 0x20,
+        0x98, 0x49, 0xca, 0xe4, 0x5b, 0xfa, 0x07, 0xc3,
+        0x12, 0x1b, 0xce, 0xa3, 0x32, 0x60, 0x8d, 0x70,
+        0xfd, 0x2c, 0x2e, 0xd9, 0x8f, 0xab, 0x01, 0xcd,
+        0xa8, 0xae, 0x68, 0xb9, 0x37, 0x4a, 0x44, 0x7e,
+        0xaa, 0x2e, 0x22, 0x34, 0xf7, 0xc8, 0x26, 0xa1,
+        0x6a, 0x17, 0xb3, 0x77, 0x2d, 0x4e, 0xe0, 0x51,
+        0x99, 0x2e, 0x9a, 0x6c, 0x3f, 0x21, 0x99, 0x25,
+        0xb4, 0x15, 0x04, 0x36, 0x20, 0x1e, 0xe3, 0xb0,
+        0x86, 0xcb, 0x48, 0xb8, 0xd1, 0x43, 0x3d, 0x01,
+        0xa2, 0x28, 0x6c, 0x0d, 0xdb, 0x28, 0x91, 0x23,
+        0xeb, 0x63, 0xa0, 0x0f, 0xd8, 0x80, 0xb5, 0x9c,
+        0x0d, 0x8d, 0xc0, 0xd2, 0xe9, 0x9a, 0xec, 0xf0
+};
+static const uint8_t C8[] = {
+        0x5c, 0x41, 0xa0, 0x71, 0x4d, 0xad, 0xcc, 0x81,
+        0x24, 0xd6, 0xfc, 0xd0, 0xe4, 0xf2, 0x6d, 0x23,
+        0xa7, 0xd8, 0x10, 0xc9, 0xa7, 0xc5, 0xac, 0xdb,
+        0x08, 0xbe, 0x00, 0x60, 0x5f, 0xd9, 0xd6, 0xe4,
+        0x0b, 0x59, 0x9c, 0xcc, 0x4a, 0xf6, 0x42, 0xce,
+        0x73, 0xaf, 0x72, 0x9a, 0x1d, 0x56, 0x32, 0x31,
+        0xb9, 0xfb, 0xf5, 0xc4, 0xe6, 0xf3, 0xf9, 0x3d,
+        0xe4, 0x82, 0xc5, 0x97, 0xd8, 0x96, 0x83, 0x74,
+        0x4b, 0x2b, 0x06, 0x05, 0xdd, 0xd3, 0x73, 0x8d,
+        0x35, 0xa4, 0xcf, 0x48, 0xbd, 0xef, 0x01, 0x1e,
+        0x30, 0x61, 0xdd, 0x94, 0x99, 0x2e, 0x45, 0xb2,
+        0x88, 0xb6, 0x75, 0x64, 0x95, 0x82, 0x21, 0xf8,
+        0x6a, 0x0b, 0x59, 0x9a, 0x72, 0xb3, 0x29, 0xb0,
+        0x3e, 0x49, 0x3a, 0x06, 0x80, 0x68, 0x84, 0xbd,
+        0x68, 0x35, 0xed, 0x05, 0xb5, 0xcc, 0xd6, 0x40,
+        0xfc, 0x6f, 0x3e, 0x82, 0xd3, 0xa4, 0x8a, 0xf4,
+        0x77, 0xd6, 0xf6, 0xf4, 0x81, 0x05, 0xf1, 0x0e,
+        0x3e, 0x55, 0xa5, 0x39, 0xaf, 0x76, 0x8a, 0x89,
+        0xea, 0x74, 0x24, 0x6d, 0xad, 0xc8, 0xf2, 0x71,
+        0xbc, 0x98, 0x28, 0xc8, 0xee, 0x04, 0xe6, 0x35,
+        0x16, 0x6a, 0x94, 0x75, 0x11, 0x69, 0x19, 0x24,
+        0x54, 0xb4, 0x34, 0x3f, 0x28, 0x86, 0xa7, 0x16,
+        0xbb, 0x56, 0x70, 0x5c, 0xc2, 0xb8, 0x03, 0xed,
+        0x4b, 0xac, 0xcd, 0x35, 0xbf, 0xc4, 0xc1, 0xb5,
+        0x06, 0x94, 0x6f, 0xf5, 0xd5, 0x06, 0x7a, 0x49,
+        0x88, 0xd4, 0xb6, 0x32, 0xe9, 0x55, 0x03, 0x6b,
+        0xfd, 0x6f, 0xa5, 0x0a, 0x3d, 0x81, 0xf0, 0xb3,
+        0x95, 0xac, 0xbe, 0x69, 0xc1, 0x4c, 0xc2, 0xd3,
+        0x6e, 0xb4, 0xce, 0xe0, 0x62, 0x8c, 0x84, 0xfd,
+        0xd9, 0xa4, 0xc2, 0x74, 0xc0, 0x0d, 0xf9, 0xfd,
+        0x4d, 0xcc, 0xee, 0xfd, 0x77, 0x2b, 0x86, 0x22,
+        0x1d, 0x82, 0xd4, 0xa2, 0xf0, 0xbf, 0x22, 0xb2,
+        0x4b, 0x4d, 0x4d, 0xcc, 0x0a, 0x45, 0x1e, 0xa7,
+        0xa0, 0xd1, 0x38, 0xd6, 0x9e, 0x3b, 0xf7, 0x2b,
+        0xb1, 0x06, 0xb8, 0x8f, 0x2a, 0xc5, 0x12, 0x31,
+        0x74, 0xd9, 0x04, 0x0d, 0x76, 0x50, 0xf8, 0xfd,
+        0xb0, 0x31, 0xd3, 0x3f, 0xf9, 0xbd, 0x59, 0x76,
+        0xdd, 0xdb, 0xde, 0xe3, 0x95, 0xa7, 0xfc, 0xb1,
+        0x82, 0xc5, 0x9c, 0x32, 0x96, 0xb8, 0xf5, 0x2e,
+        0x2e, 0x83, 0x29, 0x76, 0xfd, 0xf7, 0x30, 0x4e,
+        0x71, 0xbf, 0xb2, 0x0e, 0xb7, 0x2d, 0x3b, 0x9b,
+        0x62, 0x4f, 0x49, 0x15, 0x38, 0x7f, 0x6a, 0x37,
+        0x3b, 0xb2, 0x54, 0x31, 0x50, 0xed, 0xd1, 0xb1,
+        0xda, 0x7d, 0x03, 0xec, 0x73, 0xfb, 0x25, 0xaa,
+        0xa2, 0xb0, 0xf3, 0xb2, 0x6a, 0x63, 0xe5, 0x79,
+        0xec, 0x33, 0xbd, 0x46, 0x4a, 0x0d, 0x4c, 0x1b,
+        0x97, 0x1e, 0xb2, 0xec, 0xf7, 0xb1, 0x33, 0x28,
+        0x70, 0xec, 0x9f, 0xca, 0xce, 0x09, 0xae, 0x4e,
+        0xde, 0xe1, 0xea, 0xa5, 0x54, 0x0d, 0x6f, 0xce,
+        0x8a, 0xe1, 0xf4, 0x0a, 0x03, 0x43, 0x66, 0x88,
+        0x09, 0x84, 0x4a, 0xe1, 0xc7, 0x8e, 0x1d, 0xbb,
+        0xde, 0x14, 0x64, 0xc3, 0x9d, 0x4d, 0xf8, 0x45,
+        0x2e, 0x4f, 0xcd, 0xab, 0xd2, 0x1f, 0xe3, 0x08,
+        0xfc, 0xe5, 0x9a, 0x51, 0x5a, 0x77, 0x8f, 0x52,
+        0xd5, 0x2c, 0x51, 0xda, 0x81, 0xeb, 0x91, 0x43,
+        0x81, 0x17, 0xc8, 0xee, 0xa9, 0x53, 0xd3, 0x8f,
+        0xff, 0x95, 0xaa, 0xff, 0xd9, 0xde, 0xfe, 0xb5,
+        0x88, 0x76, 0xae, 0x54, 0xbc, 0x2f, 0x03, 0xca,
+        0x35, 0x66, 0x77, 0xb4, 0x58, 0xbd, 0x94, 0x12,
+        0x1f, 0xdb, 0x24, 0x8e, 0xc7, 0x37, 0x47, 0xef,
+        0x1a, 0x1f, 0x64, 0xfe, 0xc7, 0x48, 0x4f, 0xe9,
+        0x58, 0xb4, 0x58, 0xce, 0xc2, 0x38, 0x5e, 0x3b,
+        0x15, 0x97, 0xfc, 0x21, 0xf2, 0xc7, 0x16, 0x54,
+        0x62, 0xd5, 0x21, 0x45, 0xc2, 0xa4, 0x72, 0xcd,
+        0xc6, 0x54, 0x25, 0x84, 0xed, 0xcf, 0x64, 0xcd,
+        0x01, 0xf8, 0xc9, 0x93, 0x9d, 0x60, 0x67, 0xfb
+};
+
+static const uint8_t K9[] = {
+        0x03, 0x15, 0xd4, 0x28, 0x3f, 0xe4, 0x65, 0x1d,
+        0x92, 0x45, 0x91, 0x1d, 0x95, 0x65, 0xb9, 0x1e,
+        0xcb, 0xc1, 0xd7, 0x7a, 0xb1, 0x40, 0x6e, 0x6a,
+        0x8b, 0x0d, 0x33, 0x44, 0xe9, 0x36, 0x79, 0x74
+};
+static const uint8_t IV9[] = {
+        0xfc, 0x06, 0x5d, 0x3c, 0x9a, 0x22, 0xb5, 0x2b,
+        0x12, 0x66, 0xb9, 0x5f, 0xb1, 0x7d, 0x6f, 0x7a
+};
+static const uint8_t P9[] = {
+        0x11, 0x42, 0xd8, 0x65, 0x25, 0xda, 0xdc, 0xc7,
+        0x04, 0x8e, 0xf6, 0x44, 0x78, 0x69, 0xa0, 0x76,
+        0x46, 0x95, 0x7c, 0xac, 0x3b, 0x76, 0x47, 0x65,
+        0xfb, 0x84, 0x7d, 0x8a, 0x89, 0xe9, 0xcc, 0x6f,
+        0x95, 0xde, 0x3b, 0x88, 0x89, 0xc5, 0x17, 0xeb,
+        0x52, 0x07, 0xa1, 0x89, 0xee, 0xab, 0x79, 0x2c,
+        0xba, 0xbb, 0xc9, 0x30, 0x79, 0x57, 0x31, 0x01,
+        0x24, 0x96, 0x75, 0x58, 0x74, 0x20, 0xe8, 0x34,
+        0x30, 0x8c, 0x98, 0x9a, 0x36, 0x7a, 0x36, 0x0e,
+        0x4c, 0x70, 0xcc, 0xcd, 0xa4, 0x75, 0x1d, 0xcf,
+        0x31, 0x6f, 0xdb, 0x7f, 0xac, 0x3e, 0x8b, 0x38,
+        0x65, 0x94, 0x39, 0x7f, 0xca, 0x9b, 0xdb, 0x03,
+        0xb8, 0x45, 0x86, 0x55, 0x85, 0x70, 0x53, 0x67,
+        0xca, 0xc2, 0x0e, 0xc6, 0xf1, 0x3f, 0xa4, 0x97,
+        0x82, 0xaa, 0x4b, 0x53, 0x2c, 0xa1, 0x6f, 0x42,
+        0x96, 0x77, 0x60, 0xb9, 0xe3, 0xd1, 0xbc, 0x13,
+        0x07, 0xff, 0x9d, 0x70, 0xcd, 0x20, 0x83, 0x30,
+        0xa4, 0xf4, 0x00, 0x2e, 0x2d, 0x7f, 0x26, 0xbc,
+        0x85, 0x63, 0xb1, 0x63, 0x52, 0xfb, 0xf3, 0x57,
+        0x8f, 0x37, 0x83, 0xbc, 0x18, 0x3a, 0xa4, 0x9b,
+        0xf4, 0xb5, 0x77, 0xa3, 0x66, 0x01, 0xe1, 0x9f,
+        0xb2, 0xff, 0x3a, 0xbb, 0xb0, 0xb0, 0xba, 0x76,
+        0x12, 0x93, 0xa4, 0x66, 0x74, 0xc2, 0x30, 0xaf,
+        0x28, 0xcb, 0x39, 0x41, 0xbf, 0x4f, 0xab, 0xd5,
+        0x58, 0x5d, 0xaa, 0xa5, 0xa8, 0x8c, 0x83, 0xee,
+        0xcd, 0xda, 0x53, 0x26, 0xd2, 0x47, 0x79, 0xfd,
+        0x01, 0x31, 0xbd, 0x16, 0xec, 0x6e, 0x3d, 0x82,
+        0x3a, 0x2b, 0x1b, 0x01, 0x32, 0x87, 0xe8, 0xf7,
+        0x09, 0xef, 0xcf, 0x30, 0xec, 0x38, 0x82, 0x53,
+        0xcc, 0x7e, 0xe4, 0x27, 0xeb, 0xbe, 0x7b, 0x89,
+        0x2b, 0x35, 0x94, 0x29, 0x11, 0x78, 0x33, 0x08,
+        0x9c, 0x50, 0xc1, 0xb2, 0xc8, 0x5b, 0x74, 0x3b,
+        0xe1, 0x63, 0x7e, 0xfa, 0x88, 0x7d, 0xf5, 0x08,
+        0x86, 0xe2, 0x85, 0x77, 0x54, 0x8d, 0xd7, 0x52,
+        0x66, 0x98, 0xc0, 0x59, 0x3b, 0x57, 0x2a, 0x79,
+        0x26, 0x31, 0xc3, 0x0d, 0xda, 0x42, 0x67, 0xd7,
+        0xb7, 0xb3, 0x4e, 0xbc, 0xd6, 0xd4, 0xf5, 0x43,
+        0xd6, 0xfe, 0xce, 0xcc, 0x64, 0x2b, 0xa7, 0x90,
+        0x8c, 0x52, 0xda, 0x5c, 0xc3, 0x83, 0x3a, 0x0d,
+        0xb0, 0xc7, 0xb8, 0xca, 0xbe, 0xb5, 0xd9, 0x04,
+        0x63, 0xd4, 0xd8, 0x2f, 0x2d, 0xb4, 0x9a, 0x3d,
+        0x91, 0xcb, 0x56, 0xdf, 0x73, 0x10, 0x00, 0x7b,
+        0x74, 0x59, 0x7a, 0xeb, 0xff, 0x75, 0x7a, 0xfb,
+        0x13, 0x09, 0x39, 0xa1, 0xce, 0x2b, 0xe1, 0xfa,
+        0xbd, 0xc0, 0xb4, 0x09, 0xe5, 0x96, 0xfc, 0x2e,
+        0x90, 0x40, 0xb6, 0x68, 0xd9, 0xb5, 0xfd, 0x4a,
+        0xf7, 0xa7, 0x37, 0xbe, 0x49, 0xa5, 0x03, 0x7d,
+        0x25, 0xf0, 0xde, 0x4a, 0x60, 0x1d, 0x98, 0xf1,
+        0x9d, 0x6e, 0x79, 0x03, 0x57, 0xf1, 0x32, 0x4e,
+        0xac, 0x56, 0x85, 0x1f, 0xef, 0x91, 0xb4, 0x37,
+        0xeb, 0x34, 0xab, 0x8e, 0xf8, 0x8a, 0xec, 0xca,
+        0xc0, 0x73, 0x3e, 0x7d, 0xce, 0x02, 0x15, 0x21,
+        0xdc, 0xd7, 0xc0, 0xd5, 0xd9, 0x3e, 0x55, 0xd5,
+        0xbc, 0x04, 0x5c, 0xbb, 0x0b, 0x1d, 0x3e, 0x78,
+        0x2a, 0xf7, 0x6c, 0x11, 0x64, 0x9c, 0x4e, 0x19,
+        0xbb, 0x8a, 0xf2, 0xf2, 0x70, 0x52, 0x71, 0xc2,
+        0x51, 0xf3, 0x21, 0x37, 0xc5, 0xf4, 0x7c, 0xfb,
+        0x98, 0x43, 0xd3, 0xf6, 0x87, 0xd0, 0xb2, 0x47,
+        0x8b, 0xe9, 0x12, 0x00, 0xe6, 0x54, 0x41, 0xa3,
+        0xee, 0x2e, 0x92, 0x60, 0x9c, 0x86, 0xc4, 0x0c,
+        0xd4, 0xb8, 0x33, 0xe1, 0x72, 0x8b, 0xc1, 0xf8,
+        0x18, 0x0a, 0x82, 0x87, 0xba, 0x23, 0x2a, 0xda,
+        0xe6, 0x01, 0x36, 0x13, 0xd4, 0x29, 0xdd, 0xa1,
+        0x32, 0x56, 0xb5, 0x81, 0xac, 0x15, 0x26, 0x37,
+        0x3d, 0x21, 0x8f, 0x8b, 0x38, 0x7c, 0x3a, 0x04,
+        0x15, 0x51, 0x00, 0x26, 0xfc, 0x8d, 0xbb, 0x6b,
+        0x13, 0x37, 0x70, 0x02, 0x88, 0x93, 0x39, 0x49,
+        0x5d, 0xfb, 0xf4, 0x0c, 0xf6, 0x78, 0xae, 0x7b,
+        0x64, 0x23, 0xcd, 0xed, 0x6f, 0x3e, 0xff, 0x57,
+        0x65, 0x11, 0xe6, 0x8a, 0xa5, 0x86, 0x80, 0x30,
+        0xeb, 0x84, 0x58, 0x84, 0x59, 0x0c, 0x6e, 0xd4,
+        0x49, 0x14, 0xe7, 0xb8, 0xd4, 0x26, 0x75, 0x10,
+        0x22, 0xb8, 0x84, 0xbf, 0x70, 0x4a, 0x2a, 0x29,
+        0xe2, 0x42, 0xcb, 0x6d, 0x0e, 0x87, 0x8f, 0x62,
+        0x44, 0xdf, 0x85, 0x53, 0x9f, 0x09, 0x94, 0x7b,
+        0xcd, 0x9a, 0x26, 0x3f, 0x9d, 0x98, 0x92, 0x2d,
+        0x4d, 0xd8, 0x4d, 0xb9, 0x91, 0x17, 0xd1, 0xb1,
+        0x63, 0xdb, 0x49, 0x85, 0x8e, 0x07, 0x01, 0x39,
+        0xf8, 0x41, 0x90, 0x26, 0xb2, 0x04, 0xc2, 0x74,
+        0xc1, 0x84, 0x48, 0x57, 0xaa, 0x45, 0x1f, 0x0c,
+        0xbf, 0x7a, 0xc0, 0x92, 0x2c, 0x1e, 0x0c, 0x29,
+        0xc0, 0xd4, 0xf6, 0x8c, 0x7d, 0x7f, 0xee, 0xed,
+        0xde, 0xa1, 0x11, 0xb5, 0xea, 0x74, 0x12, 0xf8,
+        0xfd, 0xca, 0xe6, 0xba, 0x51, 0xa5, 0x32, 0xe4,
+        0x4f, 0x96, 0x75, 0x04, 0x98, 0xd6, 0xf5, 0xc8,
+        0xd2, 0x26, 0x6a, 0x38, 0x33, 0x66, 0x6d, 0xb6,
+        0xce, 0xf7, 0x9f, 0xb7, 0xa0, 0xd2, 0x99, 0x3f,
+        0x5a, 0x65, 0x97, 0x1e, 0xec, 0x31, 0xe3, 0xec,
+        0xd6, 0x25, 0x03, 0xc5, 0x2d, 0xb8, 0xa2, 0xc5,
+        0x6f, 0xc8, 0x3f, 0x42, 0x08, 0x35, 0x97, 0xcc,
+        0xa0, 0x3c, 0xd3, 0xe6, 0x2b, 0x95, 0x72, 0x81,
+        0xae, 0x4d, 0xf4, 0x3c, 0xd2, 0x61, 0x4c, 0x5e,
+        0x2a, 0x1e, 0x03, 0x8f, 0x44, 0x3b, 0x2c, 0x59,
+        0x71, 0xb2, 0x0b, 0x63, 0x54, 0x63, 0x84, 0x67,
+        0x2d, 0x68, 0x45, 0xf8, 0xe3, 0x36, 0xb3, 0xf6,
+        0xd3, 0x78, 0x95, 0xcc, 0x5b, 0xab, 0x83, 0x70,
+        0x25, 0x7a, 0x0c, 0x18, 0x33, 0xd7, 0xaa, 0xbd,
+        0xaf, 0xdd, 0x67, 0x51, 0x70, 0x69, 0x4b, 0xbf
+};
+static const uint8_t C9[] = {
+        0x28, 0xb4, 0x97, 0xa1, 0xac, 0x5b, 0x05, 0x9c,
+        0xda, 0xca, 0xda, 0x11, 0xda, 0x6e, 0x96, 0x6c,
+        0x69, 0x8c, 0xb8, 0x98, 0x1e, 0x65, 0x7c, 0x8a,
+        0x29, 0x32, 0xa1, 0xc0, 0xb0, 0xef, 0xab, 0x4b,
+        0xf2, 0xa4, 0x48, 0x27, 0xfb, 0xca, 0x2c, 0xb6,
+        0xdc, 0x9c, 0xdf, 0xa7, 0xe3, 0xda, 0xc3, 0x91,
+        0x7f, 0x46, 0x73, 0x1b, 0x3b, 0xce, 0xc9, 0x1b,
+        0x38, 0xb4, 0x31, 0xe6, 0x87, 0xd0, 0xcf, 0x73,
+        0xe1, 0x97, 0x26, 0xf9, 0xc8, 0x54, 0x34, 0xbe,
+        0x12, 0xf2, 0x4d, 0x3b, 0xb1, 0x23, 0xfc, 0x86,
+        0x6d, 0x9f, 0xd7, 0x01, 0x3c, 0xdd, 0x2c, 0xe1,
+        0x2a, 0xce, 0x5a, 0x6b, 0x70, 0x48, 0xb3, 0x36,
+        0x39, 0x4e, 0x47, 0xe5, 0xc9, 0x24, 0x5a, 0x5b,
+        0x91, 0xcd, 0x48, 0xc6, 0x67, 0x48, 0x3f, 0x8e,
+        0x12, 0x78, 0x3d, 0xef, 0xf7, 0x05, 0x02, 0xe2,
+        0x59, 0xf2, 0x28, 0x34, 0xc1, 0x8c, 0xf9, 0x99,
+        0xd0, 0xf3, 0x30, 0x28, 0x75, 0x5e, 0x93, 0xf8,
+        0x3d, 0x18, 0x2a, 0x80, 0xc7, 0xcf, 0xd6, 0x5b,
+        0xe2, 0x7c, 0x72, 0x83, 0x08, 0xf4, 0x13, 0xf9,
+        0x37, 0x45, 0xe8, 0x04, 0x9d, 0x13, 0xc2, 0x0d,
+        0x96, 0x61, 0x3a, 0xe8, 0xf4, 0x6f, 0x17, 0xab,
+        0x31, 0xd0, 0xbf, 0x51, 0x8e, 0x39, 0x44, 0x02,
+        0x62, 0x2a, 0xa1, 0xc4, 0xf6, 0x2b, 0x4c, 0xcb,
+        0x22, 0xf4, 0x6e, 0x67, 0xd2, 0x74, 0xd3, 0x35,
+        0xeb, 0x12, 0x25, 0x09, 0x0a, 0x63, 0x79, 0x5b,
+        0x66, 0xab, 0x52, 0x98, 0xf6, 0x6f, 0x3f, 0x08,
+        0x19, 0x9a, 0xe1, 0xf2, 0x2e, 0x3b, 0x6e, 0xd9,
+        0x8d, 0xba, 0xfd, 0xe9, 0x88, 0x20, 0x0f, 0xc9,
+        0xfb, 0x47, 0x9f, 0x31, 0xd9, 0xb5, 0x98, 0xea,
+        0xac, 0x10, 0xe7, 0x64, 0xc6, 0x4c, 0x3f, 0x4d,
+        0x05, 0x96, 0x77, 0x6c, 0x22, 0x54, 0x89, 0xee,
+        0x9a, 0x65, 0xbf, 0x3e, 0x5e, 0x37, 0x02, 0x04,
+        0xec, 0xd2, 0xae, 0x47, 0x5c, 0x5b, 0x38, 0x1b,
+        0x2a, 0xef, 0xa6, 0x64, 0xf9, 0x79, 0x64, 0x34,
+        0x34, 0xf9, 0x20, 0xa8, 0xa1, 0x8d, 0x7d, 0x16,
+        0xd6, 0x2b, 0xfc, 0x41, 0x91, 0xe7, 0x12, 0xab,
+        0x32, 0x03, 0x64, 0xd8, 0x70, 0xd5, 0x45, 0xea,
+        0x3a, 0x0e, 0x66, 0xfd, 0x22, 0x5e, 0x19, 0x00,
+        0x21, 0x19, 0x56, 0xef, 0x14, 0xa8, 0xf5, 0x0d,
+        0x58, 0x3e, 0x28, 0xd4, 0xe8, 0xcc, 0x7c, 0xdc,
+        0xde, 0x6d, 0x28, 0x03, 0xce, 0xd8, 0xd3, 0xe7,
+        0x07, 0xc6, 0xb0, 0x9d, 0xbc, 0x29, 0x0b, 0x8d,
+        0x28, 0xad, 0x15, 0xfa, 0x7f, 0xdd, 0x93, 0xbb,
+        0x07, 0xa2, 0xd6, 0xf3, 0xc8, 0x89, 0x4c, 0xd6,
+        0xcf, 0xbf, 0x5d, 0x0e, 0xf3, 0x6c, 0x6d, 0x74,
+        0x4a, 0xcc, 0xc4, 0x72, 0x1b, 0x41, 0x7d, 0xa1,
+        0xd5, 0x91, 0x08, 0xff, 0xfe, 0x0f, 0x25, 0x62,
+        0xac, 0x98, 0xfe, 0xd9, 0xe0, 0x2f, 0x5f, 0x03,
+        0xe1, 0xe9, 0x0d, 0x13, 0x2d, 0xcf, 0xcc, 0xe4,
+        0x57, 0xf0, 0xed, 0x7a, 0xe2, 0x8c, 0x52, 0x6d,
+        0x0d, 0xb4, 0xd4, 0x58, 0x6e, 0xdc, 0x4e, 0x3b,
+        0xb9, 0x1d, 0x83, 0x47, 0x88, 0xaa, 0x4f, 0xf8,
+        0xec, 0x39, 0xde, 0xff, 0x76, 0x44, 0x47, 0xae,
+        0x42, 0x7c, 0xba, 0xd8, 0x03, 0xa9, 0x1d, 0x36,
+        0xac, 0xf2, 0x0f, 0x6f, 0x81, 0xfd, 0x19, 0xa9,
+        0xbd, 0x34, 0x42, 0x09, 0xe1, 0xa7, 0xa8, 0x1a,
+        0x9c, 0x52, 0xfb, 0x23, 0xc3, 0xd9, 0xa3, 0x39,
+        0xa3, 0x31, 0xec, 0x6c, 0x0f, 0xc6, 0xbd, 0xec,
+        0xaa, 0x99, 0x99, 0x33, 0xa5, 0x82, 0x35, 0xb3,
+        0x27, 0xd5, 0x34, 0xf7, 0x14, 0x15, 0xc0, 0xa1,
+        0x2f, 0xd9, 0xe0, 0x26, 0x24, 0x9a, 0x86, 0x36,
+        0x4c, 0x7e, 0x10, 0xe9, 0x5a, 0x3e, 0x83, 0xf3,
+        0xda, 0x93, 0x65, 0x0a, 0x2f, 0x30, 0x4f, 0xdd,
+        0x7f, 0x42, 0x1a, 0xc8, 0x53, 0xcf, 0x35, 0xb4,
+        0x43, 0xb8, 0xee, 0xf3, 0x11, 0x72, 0xdf, 0x6e,
+        0x63, 0xa9, 0xb5, 0xde, 0xe8, 0x0f, 0xd3, 0x92,
+        0xac, 0xe5, 0x31, 0xde, 0x85, 0x87, 0x46, 0xc4,
+        0x62, 0x52, 0xc8, 0xba, 0x0c, 0xd9, 0xb9, 0x4d,
+        0x09, 0x11, 0x83, 0xed, 0x65, 0xc4, 0x4f, 0x37,
+        0xa7, 0x35, 0x79, 0x8c, 0x7b, 0x8c, 0xe2, 0x64,
+        0xa0, 0x30, 0x95, 0xe1, 0x44, 0x8a, 0x3e, 0xea,
+        0x3a, 0xc8, 0x0a, 0x01, 0x79, 0xa1, 0xac, 0x63,
+        0xee, 0x75, 0x32, 0xde, 0x60, 0x29, 0xff, 0x51,
+        0x48, 0x1d, 0x37, 0x12, 0x8d, 0x61, 0x68, 0xe5,
+        0x84, 0xf5, 0xb8, 0x38, 0xb8, 0xb2, 0xd4, 0xb9,
+        0x27, 0x59, 0x29, 0x3f, 0x74, 0x8a, 0xbe, 0x36,
+        0x2c, 0xde, 0xc2, 0x5b, 0xce, 0xdd, 0x43, 0x2d,
+        0x3f, 0x88, 0xa4, 0x94, 0xdb, 0xb4, 0x26, 0x75,
+        0xcc, 0xe5, 0x29, 0x6e, 0x41, 0x1d, 0x30, 0x78,
+        0xeb, 0x0c, 0x26, 0xb7, 0x7d, 0x3b, 0xaa, 0x95,
+        0x8b, 0x9b, 0xab, 0x18, 0x14, 0x49, 0xa4, 0x9d,
+        0x41, 0x74, 0xb2, 0x24, 0xfd, 0x48, 0x64, 0xb9,
+        0x4d, 0xdb, 0xa3, 0x6c, 0x32, 0xf6, 0xa2, 0x0a,
+        0xbc, 0x1c, 0x29, 0x08, 0xa3, 0x20, 0x3d, 0x70,
+        0xde, 0x7d, 0xda, 0x1e, 0x53, 0x0f, 0xf6, 0xb3,
+        0xd2, 0x9a, 0xc9, 0x84, 0x5b, 0xfd, 0x3d, 0x17,
+        0xc3, 0x68, 0xe2, 0x60, 0xfb, 0x11, 0x80, 0xde,
+        0x43, 0xed, 0x50, 0xa6, 0xd2, 0x24, 0xa0, 0x14,
+        0x15, 0xdc, 0x5f, 0x1e, 0xb8, 0x64, 0xfd, 0x2c,
+        0xf4, 0x56, 0x3a, 0x32, 0x91, 0x65, 0x9d, 0x92,
+        0x2b, 0x90, 0x45, 0x03, 0x33, 0x31, 0xad, 0x05,
+        0xdc, 0xb1, 0x05, 0x06, 0x67, 0xb5, 0x4e, 0x07,
+        0xe8, 0x80, 0x94, 0x0f, 0x8b, 0x2f, 0xca, 0xf0,
+        0x0c, 0x0a, 0x58, 0x85, 0x38, 0x30, 0x44, 0x8d,
+        0xe2, 0x95, 0x00, 0x74, 0x29, 0xfc, 0xf5, 0x0a,
+        0x1e, 0x8b, 0x48, 0x73, 0xf7, 0xf6, 0x64, 0x8a,
+        0x53, 0x90, 0x70, 0x83, 0x32, 0xb8, 0x6e, 0xf8,
+        0x2c, 0xd3, 0x53, 0x0f, 0xaf, 0x81, 0x4e, 0x64
+};
+
 static const struct aes_vector aes_vectors[] = {
         {K1, IV1, P1, sizeof(P1), C1, sizeof(K1)},
         {K2, IV2, P2, sizeof(P2), C2, sizeof(K2)},
@@ -618,6 +979,8 @@ static const struct aes_vector aes_vectors[] = {
         {K5, IV5, P5, sizeof(P5), C5, sizeof(K5)},
         {K6, IV6, P6, sizeof(P6), C6, sizeof(K6)},
         {K7, IV7, P7, sizeof(P7), C7, sizeof(K7)},
+        {K8, IV8, P8, sizeof(P8), C8, sizeof(K8)},
+        {K9, IV9, P9, sizeof(P9), C9, sizeof(K9)},
 };
 
 /* =================================================================== */
@@ -2248,9 +2611,10 @@ test_aes_vectors(struct IMB_MGR *mb_mgr,
 
                 /**
                  * Test cipher only burst API
-                 * Currently only AES-CBC supported
+                 * Currently only AES-CBC and DOCSIS SEC BPI supported
                  */
-                if (cipher != IMB_CIPHER_CBC)
+                if (cipher != IMB_CIPHER_CBC &&
+                    cipher != IMB_CIPHER_DOCSIS_SEC_BPI)
                         continue;
 
                 if (test_aes_many_burst(mb_mgr, enc_keys, dec_keys,
@@ -29,6 +29,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#ifndef LINUX
+#include <malloc.h> /* _aligned_malloc() and aligned_free() */
+#endif
 
 #include <intel-ipsec-mb.h>
 #include "gcm_ctr_vectors_test.h"
@@ -73,6 +76,26 @@ enum {
       TEST_CIPH_IV_LEN,
       TEST_CIPH_DIR,
       TEST_INVALID_PON_PLI = 300,
+      TEST_JOB_RING_INVALID_SIZE = 400,
+      TEST_JOB_RING_ALLOC,
+      TEST_JOB_RING_WRAP,
+      TEST_FLUSH_DEADLINE = 500,
+      TEST_STATS_GET = 600,
+      TEST_STATS_COUNT,
+      TEST_STATS_RESET,
+      TEST_ALGOS_SIZE = 700,
+      TEST_ALGOS_ALLOC,
+      TEST_ALGOS_JOB,
+      TEST_MEM_HOOKS = 800,
+      TEST_MEM_NUMA,
+      TEST_MEM_ALLOC,
+      TEST_COMPLETION_MODE = 1000,
+      TEST_COMPLETION_DEQUEUE,
+      TEST_COMPLETION_CALLBACK,
+      TEST_COMPLETION_BURST,
+      TEST_BURST_MODE = 1100,
+      TEST_BURST_MODE_JOBS,
+      TEST_BURST_MODE_STATS,
 };
 
 /*
@@ -2229,6 +2252,718 @@ test_reset_api(struct IMB_MGR *mb_mgr)
         return 0;
 }
 
+/*
+ * @brief Initializes the manager for the architecture used by ref_mgr
+ */
+static void
+init_mgr_arch(struct IMB_MGR *mb_mgr, const struct IMB_MGR *ref_mgr)
+{
+        switch (ref_mgr->used_arch) {
+        case IMB_ARCH_AVX:
+                init_mb_mgr_avx(mb_mgr);
+                break;
+        case IMB_ARCH_AVX2:
+                init_mb_mgr_avx2(mb_mgr);
+                break;
+        case IMB_ARCH_AVX512:
+                init_mb_mgr_avx512(mb_mgr);
+                break;
+        default:
+                init_mb_mgr_sse(mb_mgr);
+                break;
+        }
+}
+
+/*
+ * @brief Test managers allocated with different job ring sizes
+ */
+static int
+test_job_ring_api(struct IMB_MGR *mb_mgr)
+{
+        const unsigned invalid_sizes[] = {
+                0, IMB_MIN_JOB_RING_SIZE / 2, IMB_MIN_JOB_RING_SIZE + 8,
+                IMB_MAX_JOB_RING_SIZE * 2
+        };
+        const unsigned valid_sizes[] = {
+                IMB_MIN_JOB_RING_SIZE, IMB_MAX_JOBS, IMB_MAX_JOB_RING_SIZE
+        };
+        unsigned i, j;
+
+	printf("Job ring API test:\n");
+
+        for (i = 0; i < DIM(invalid_sizes); i++) {
+                struct IMB_MGR *p_mgr =
+                        alloc_mb_mgr_ex(mb_mgr->flags, invalid_sizes[i]);
+
+                if (p_mgr != NULL) {
+                        printf("%s: test %d, ring size %u accepted\n",
+                               __func__, TEST_JOB_RING_INVALID_SIZE,
+                               invalid_sizes[i]);
+                        free_mb_mgr(p_mgr);
+                        return 1;
+                }
+                if (imb_get_errno(NULL) != IMB_ERR_JOB_RING_SIZE) {
+                        printf("%s: test %d, unexpected error: %s\n",
+                               __func__, TEST_JOB_RING_INVALID_SIZE,
+                               imb_get_strerror(imb_get_errno(NULL)));
+                        return 1;
+                }
+                printf(".");
+        }
+
+        for (i = 0; i < DIM(valid_sizes); i++) {
+                const unsigned ring_size = valid_sizes[i];
+                struct IMB_MGR *p_mgr =
+                        alloc_mb_mgr_ex(mb_mgr->flags, ring_size);
+                struct IMB_JOB *first_job = NULL;
+
+                if (p_mgr == NULL) {
+                        printf("%s: test %d, ring size %u rejected\n",
+                               __func__, TEST_JOB_RING_ALLOC, ring_size);
+                        return 1;
+                }
+                init_mgr_arch(p_mgr, mb_mgr);
+
+                /*
+                 * Submit jobs completing straight away and
+                 * check that job slots wrap around after ring_size jobs
+                 */
+                for (j = 0; j < (2 * ring_size); j++) {
+                        struct IMB_JOB *job = IMB_GET_NEXT_JOB(p_mgr);
+
+                        if (j == 0)
+                                first_job = job;
+                        else if ((job == first_job) !=
+                                 ((j % ring_size) == 0)) {
+                                printf("%s: test %d, ring size %u, "
+                                       "unexpected job slot %u\n",
+                                       __func__, TEST_JOB_RING_WRAP,
+                                       ring_size, j);
+                                free_mb_mgr(p_mgr);
+                                return 1;
+                        }
+
+                        job->cipher_mode = IMB_CIPHER_NULL;
+                        job->hash_alg = IMB_AUTH_NULL;
+                        job->chain_order = IMB_ORDER_CIPHER_HASH;
+                        if (IMB_SUBMIT_JOB_NOCHECK(p_mgr) != job ||
+                            IMB_QUEUE_SIZE(p_mgr) != 0) {
+                                printf("%s: test %d, ring size %u, "
+                                       "job %u not returned\n",
+                                       __func__, TEST_JOB_RING_WRAP,
+                                       ring_size, j);
+                                free_mb_mgr(p_mgr);
+                                return 1;
+                        }
+                }
+                printf(".");
+
+                free_mb_mgr(p_mgr);
+        }
+
+        printf("\n");
+        return 0;
+}
+
+/*
+ * @brief Submits 2 AES-CBC encrypt jobs (scheduled on the multi-buffer
+ *        manager) and returns the job returned by the second submission
+ */
+static struct IMB_JOB *
+submit_two_cbc_jobs(struct IMB_MGR *mb_mgr, struct IMB_JOB **first_job)
+{
+        struct chacha20_poly1305_context_data chacha_ctx;
+        struct gcm_context_data gcm_ctx;
+        struct IMB_JOB *job;
+
+        job = IMB_GET_NEXT_JOB(mb_mgr);
+        fill_in_job(job, IMB_CIPHER_CBC, IMB_DIR_ENCRYPT, IMB_AUTH_NULL,
+                    IMB_ORDER_CIPHER_HASH, &chacha_ctx, &gcm_ctx);
+        *first_job = job;
+        if (IMB_SUBMIT_JOB(mb_mgr) != NULL)
+                return NULL;
+
+        job = IMB_GET_NEXT_JOB(mb_mgr);
+        fill_in_job(job, IMB_CIPHER_CBC, IMB_DIR_ENCRYPT, IMB_AUTH_NULL,
+                    IMB_ORDER_CIPHER_HASH, &chacha_ctx, &gcm_ctx);
+        return IMB_SUBMIT_JOB(mb_mgr);
+}
+
+/*
+ * @brief Test flush deadline API
+ */
+static int
+test_flush_deadline(struct IMB_MGR *mb_mgr)
+{
+        struct IMB_MGR *p_mgr = alloc_mb_mgr(mb_mgr->flags);
+        struct IMB_JOB *job, *first_job;
+
+	printf("Flush deadline API test:\n");
+
+        if (p_mgr == NULL)
+                return 1;
+        init_mgr_arch(p_mgr, mb_mgr);
+
+        /* no deadline: jobs wait for the lanes to fill */
+        job = submit_two_cbc_jobs(p_mgr, &first_job);
+        if (job != NULL) {
+                printf("%s: test %d, unexpected job returned\n",
+                       __func__, TEST_FLUSH_DEADLINE);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+        while (IMB_FLUSH_JOB(p_mgr) != NULL)
+                ;
+
+        /* 1 cycle deadline: first job is flushed on next submission */
+        imb_set_flush_deadline(p_mgr, 1);
+        job = submit_two_cbc_jobs(p_mgr, &first_job);
+        if (job != first_job || job->status != IMB_STATUS_COMPLETED) {
+                printf("%s: test %d, first job not returned\n",
+                       __func__, TEST_FLUSH_DEADLINE);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+        while (IMB_FLUSH_JOB(p_mgr) != NULL)
+                ;
+
+        free_mb_mgr(p_mgr);
+        printf("\n");
+        return 0;
+}
+
+static void
+count_completed_job(IMB_JOB *job, void *cb_arg)
+{
+        unsigned *count = (unsigned *) cb_arg;
+
+        if (job->status == IMB_STATUS_COMPLETED)
+                (*count)++;
+}
+
+/*
+ * @brief Test out of order completion API
+ */
+static int
+test_completion_api(struct IMB_MGR *mb_mgr)
+{
+        struct IMB_MGR *p_mgr = alloc_mb_mgr(mb_mgr->flags);
+        struct chacha20_poly1305_context_data chacha_ctx;
+        struct gcm_context_data gcm_ctx;
+        struct IMB_JOB *job, *first_job, *ecb_job, *done[4];
+        struct IMB_JOB burst_job;
+        unsigned n, count = 0;
+
+	printf("Out of order completion API test:\n");
+
+        if (p_mgr == NULL)
+                return 1;
+        init_mgr_arch(p_mgr, mb_mgr);
+
+        imb_set_completion_mode(p_mgr, (IMB_COMPLETION_MODE) 100);
+        if (imb_get_errno(p_mgr) != IMB_ERR_COMPLETION_MODE) {
+                printf("%s: test %d, invalid mode accepted\n",
+                       __func__, TEST_COMPLETION_MODE);
+                goto err;
+        }
+        printf(".");
+
+        imb_set_completion_mode(p_mgr, IMB_COMPLETION_MODE_OUT_OF_ORDER);
+        if (imb_get_errno(p_mgr) != 0) {
+                printf("%s: test %d, unexpected error: %s\n",
+                       __func__, TEST_COMPLETION_MODE,
+                       imb_get_strerror(imb_get_errno(p_mgr)));
+                goto err;
+        }
+        printf(".");
+
+        /* CBC jobs wait for the lanes to fill, ECB job completes at once */
+        if (submit_two_cbc_jobs(p_mgr, &first_job) != NULL) {
+                printf("%s: test %d, unexpected job returned\n",
+                       __func__, TEST_COMPLETION_DEQUEUE);
+                goto err;
+        }
+        ecb_job = IMB_GET_NEXT_JOB(p_mgr);
+        fill_in_job(ecb_job, IMB_CIPHER_ECB, IMB_DIR_ENCRYPT, IMB_AUTH_NULL,
+                    IMB_ORDER_CIPHER_HASH, &chacha_ctx, &gcm_ctx);
+        if (IMB_SUBMIT_JOB(p_mgr) != NULL) {
+                printf("%s: test %d, unexpected job returned\n",
+                       __func__, TEST_COMPLETION_DEQUEUE);
+                goto err;
+        }
+
+        /* mode can't be changed with jobs in the ring */
+        imb_set_completion_mode(p_mgr, IMB_COMPLETION_MODE_IN_ORDER);
+        if (imb_get_errno(p_mgr) != IMB_ERR_COMPLETION_MODE) {
+                printf("%s: test %d, mode changed with jobs in the ring\n",
+                       __func__, TEST_COMPLETION_MODE);
+                goto err;
+        }
+        printf(".");
+
+        n = imb_dequeue_completed(p_mgr, done, DIM(done));
+        if (n != 1 || done[0] != ecb_job ||
+            ecb_job->status != IMB_STATUS_COMPLETED) {
+                printf("%s: test %d, ECB job not dequeued first\n",
+                       __func__, TEST_COMPLETION_DEQUEUE);
+                goto err;
+        }
+        printf(".");
+
+        /* flush completes the CBC jobs */
+        n = 0;
+        while ((job = IMB_FLUSH_JOB(p_mgr)) != NULL) {
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("%s: test %d, job not completed\n",
+                               __func__, TEST_COMPLETION_DEQUEUE);
+                        goto err;
+                }
+                n++;
+        }
+        if (n != 2 || IMB_QUEUE_SIZE(p_mgr) != 0) {
+                printf("%s: test %d, %u jobs flushed\n",
+                       __func__, TEST_COMPLETION_DEQUEUE, n);
+                goto err;
+        }
+        printf(".");
+
+        /* burst flush of the shared lanes queues the CBC jobs */
+        if (submit_two_cbc_jobs(p_mgr, &first_job) != NULL) {
+                printf("%s: test %d, unexpected job returned\n",
+                       __func__, TEST_COMPLETION_BURST);
+                goto err;
+        }
+        fill_in_job(&burst_job, IMB_CIPHER_CBC, IMB_DIR_ENCRYPT, IMB_AUTH_NULL,
+                    IMB_ORDER_CIPHER_HASH, &chacha_ctx, &gcm_ctx);
+        if (IMB_SUBMIT_CIPHER_BURST(p_mgr, &burst_job, 1, IMB_CIPHER_CBC,
+                                    IMB_DIR_ENCRYPT, IMB_KEY_128_BYTES) != 1 ||
+            burst_job.status != IMB_STATUS_COMPLETED) {
+                printf("%s: test %d, burst job not completed\n",
+                       __func__, TEST_COMPLETION_BURST);
+                goto err;
+        }
+        n = imb_dequeue_completed(p_mgr, done, DIM(done));
+        if (n != 2 || (done[0] != first_job && done[1] != first_job) ||
+            done[0]->status != IMB_STATUS_COMPLETED ||
+            done[1]->status != IMB_STATUS_COMPLETED ||
+            IMB_QUEUE_SIZE(p_mgr) != 0 || IMB_FLUSH_JOB(p_mgr) != NULL) {
+                printf("%s: test %d, %u jobs dequeued after burst\n",
+                       __func__, TEST_COMPLETION_BURST, n);
+                goto err;
+        }
+        printf(".");
+
+        /* callback gets the jobs instead of the completion ring */
+        imb_set_completion_callback(p_mgr, count_completed_job, &count);
+        (void) submit_two_cbc_jobs(p_mgr, &first_job);
+        if (count != 0 || IMB_FLUSH_JOB(p_mgr) != NULL || count != 2 ||
+            imb_dequeue_completed(p_mgr, done, DIM(done)) != 0) {
+                printf("%s: test %d, %u jobs passed to callback\n",
+                       __func__, TEST_COMPLETION_CALLBACK, count);
+                goto err;
+        }
+        printf(".");
+
+        free_mb_mgr(p_mgr);
+        printf("\n");
+        return 0;
+
+ err:
+        free_mb_mgr(p_mgr);
+        return 1;
+}
+
+/*
+ * @brief Test OOO manager statistics API
+ *        (skipped if the library is built without statistics)
+ */
+static int
+test_stats_api(struct IMB_MGR *mb_mgr)
+{
+        struct IMB_MGR *p_mgr = alloc_mb_mgr(mb_mgr->flags);
+        IMB_OOO_STATS stats[64];
+        const IMB_OOO_STATS *aes128 = NULL;
+        struct IMB_JOB *first_job;
+        unsigned i, num;
+
+	printf("OOO manager statistics API test:\n");
+
+        if (p_mgr == NULL)
+                return 1;
+        init_mgr_arch(p_mgr, mb_mgr);
+
+        num = imb_get_stats(p_mgr, stats, DIM(stats));
+        if (num == 0) {
+                const int err = imb_get_errno(p_mgr);
+
+                free_mb_mgr(p_mgr);
+                if (err != IMB_ERR_NO_STATS) {
+                        printf("%s: test %d, unexpected error: %s\n",
+                               __func__, TEST_STATS_GET,
+                               imb_get_strerror(err));
+                        return 1;
+                }
+                printf("statistics not enabled, skipped\n");
+                return 0;
+        }
+
+        /* 2 AES-128-CBC encrypt jobs and flush */
+        (void) submit_two_cbc_jobs(p_mgr, &first_job);
+        while (IMB_FLUSH_JOB(p_mgr) != NULL)
+                ;
+
+        num = imb_get_stats(p_mgr, stats, DIM(stats));
+        for (i = 0; i < num; i++)
+                if (strcmp(stats[i].name, "aes128_ooo") == 0)
+                        aes128 = &stats[i];
+
+        if (aes128 == NULL || aes128->submits != 2 ||
+            (aes128->dispatches + aes128->flushes) != 2 ||
+            aes128->in_flight != 0 ||
+            aes128->bytes != (2 * first_job->msg_len_to_cipher_in_bytes)) {
+                printf("%s: test %d, unexpected AES-128 counters\n",
+                       __func__, TEST_STATS_COUNT);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        imb_reset_stats(p_mgr);
+        num = imb_get_stats(p_mgr, stats, DIM(stats));
+        for (i = 0; i < num; i++)
+                if (stats[i].submits != 0) {
+                        printf("%s: test %d, %s counters not cleared\n",
+                               __func__, TEST_STATS_RESET, stats[i].name);
+                        free_mb_mgr(p_mgr);
+                        return 1;
+                }
+        printf(".");
+
+        free_mb_mgr(p_mgr);
+        printf("\n");
+        return 0;
+}
+
+#define BURST_MODE_JOBS 16
+
+/*
+ * @brief Fills in AES-CBC-128 and AES-CBC-256 encrypt jobs, in turn,
+ *        both followed by HMAC-SHA1 (out of place, so not stitched)
+ */
+static void
+fill_burst_mode_jobs(struct IMB_JOB *jobs, uint8_t (*dst)[64],
+                     uint8_t (*tag)[12])
+{
+        static DECLARE_ALIGNED(uint8_t src[BURST_MODE_JOBS][64], 16);
+        static DECLARE_ALIGNED(uint8_t enc_keys[15 * 16], 16);
+        static uint8_t iv[16];
+        static uint8_t ipad[20];
+        static uint8_t opad[20];
+        unsigned i;
+
+        for (i = 0; i < sizeof(enc_keys); i++)
+                enc_keys[i] = (uint8_t) (i * 7);
+        memset(ipad, 0x36, sizeof(ipad));
+        memset(opad, 0x5c, sizeof(opad));
+
+        memset(jobs, 0, BURST_MODE_JOBS * sizeof(jobs[0]));
+        for (i = 0; i < BURST_MODE_JOBS; i++) {
+                struct IMB_JOB *job = &jobs[i];
+
+                memset(src[i], (int) i, sizeof(src[i]));
+                job->cipher_mode = IMB_CIPHER_CBC;
+                job->cipher_direction = IMB_DIR_ENCRYPT;
+                job->hash_alg = IMB_AUTH_HMAC_SHA_1;
+                job->chain_order = IMB_ORDER_CIPHER_HASH;
+                job->key_len_in_bytes = (i & 1) ? 32 : 16;
+                job->enc_keys = enc_keys;
+                job->iv = iv;
+                job->iv_len_in_bytes = sizeof(iv);
+                job->src = src[i];
+                job->dst = dst[i];
+                job->msg_len_to_cipher_in_bytes = sizeof(src[i]);
+                job->msg_len_to_hash_in_bytes = sizeof(src[i]);
+                job->u.HMAC._hashed_auth_key_xor_ipad = ipad;
+                job->u.HMAC._hashed_auth_key_xor_opad = opad;
+                job->auth_tag_output = tag[i];
+                job->auth_tag_output_len_in_bytes = 12;
+        }
+}
+
+/*
+ * @brief Test burst API modes
+ *        (manager counters only checked if the library is built
+ *        with statistics)
+ */
+static int
+test_burst_mode_api(struct IMB_MGR *mb_mgr)
+{
+        const IMB_BURST_MODE modes[2] = {
+                IMB_BURST_MODE_ORDERED, IMB_BURST_MODE_SORTED
+        };
+        struct IMB_MGR *p_mgr = alloc_mb_mgr(mb_mgr->flags);
+        struct IMB_JOB jobs[BURST_MODE_JOBS];
+        uint8_t dst[2][BURST_MODE_JOBS][64];
+        uint8_t tag[2][BURST_MODE_JOBS][12];
+        IMB_OOO_STATS stats[64], sha1[2];
+        unsigned i, m, num_stats = 0;
+
+	printf("Burst mode API test:\n");
+
+        if (p_mgr == NULL)
+                return 1;
+        init_mgr_arch(p_mgr, mb_mgr);
+
+        imb_set_burst_mode(p_mgr, (IMB_BURST_MODE) 2);
+        if (imb_get_errno(p_mgr) != IMB_ERR_BURST_MODE) {
+                printf("%s: test %d, invalid mode accepted\n",
+                       __func__, TEST_BURST_MODE);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        memset(sha1, 0, sizeof(sha1));
+        for (m = 0; m < DIM(modes); m++) {
+                imb_set_burst_mode(p_mgr, modes[m]);
+                if (imb_get_errno(p_mgr) != 0) {
+                        printf("%s: test %d, mode %u not accepted\n",
+                               __func__, TEST_BURST_MODE, m);
+                        free_mb_mgr(p_mgr);
+                        return 1;
+                }
+
+                imb_reset_stats(p_mgr);
+                fill_burst_mode_jobs(jobs, dst[m], tag[m]);
+                if (IMB_SUBMIT_BURST(p_mgr, jobs, BURST_MODE_JOBS) !=
+                    BURST_MODE_JOBS) {
+                        printf("%s: test %d, mode %u: jobs not completed\n",
+                               __func__, TEST_BURST_MODE_JOBS, m);
+                        free_mb_mgr(p_mgr);
+                        return 1;
+                }
+                for (i = 0; i < BURST_MODE_JOBS; i++)
+                        if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                                printf("%s: test %d, mode %u: job %u status "
+                                       "%d\n", __func__, TEST_BURST_MODE_JOBS,
+                                       m, i, jobs[i].status);
+                                free_mb_mgr(p_mgr);
+                                return 1;
+                        }
+
+                num_stats = imb_get_stats(p_mgr, stats, DIM(stats));
+                for (i = 0; i < num_stats; i++)
+                        if (strcmp(stats[i].name, "hmac_sha_1_ooo") == 0)
+                                sha1[m] = stats[i];
+        }
+        printf(".");
+
+        /* both modes produce the same output */
+        if (memcmp(dst[0], dst[1], sizeof(dst[0])) != 0 ||
+            memcmp(tag[0], tag[1], sizeof(tag[0])) != 0) {
+                printf("%s: test %d, output differs between modes\n",
+                       __func__, TEST_BURST_MODE_JOBS);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        /*
+         * The sorted mode gets all HMAC-SHA1 jobs in the lanes
+         * before flushing, so at least as many of them complete
+         * on submission (full lanes) and no more by flush
+         */
+        if (num_stats != 0 &&
+            (sha1[0].submits != BURST_MODE_JOBS ||
+             sha1[1].submits != BURST_MODE_JOBS ||
+             sha1[1].dispatches < sha1[0].dispatches ||
+             sha1[1].flushes > sha1[0].flushes ||
+             sha1[1].in_flight != 0)) {
+                printf("%s: test %d, unexpected HMAC-SHA1 counters\n",
+                       __func__, TEST_BURST_MODE_STATS);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        free_mb_mgr(p_mgr);
+        printf("\n");
+        return 0;
+}
+
+/*
+ * @brief Test managers allocated for a subset of algorithms
+ */
+static int
+test_algos_api(struct IMB_MGR *mb_mgr)
+{
+        const uint64_t cipher_mask = IMB_CIPHER_MASK(IMB_CIPHER_CBC);
+        const uint64_t hash_mask = 0;
+        struct chacha20_poly1305_context_data chacha_ctx;
+        struct gcm_context_data gcm_ctx;
+        struct IMB_MGR *p_mgr = NULL;
+        struct IMB_JOB *job, *first_job;
+
+	printf("Algorithm subset API test:\n");
+
+        if (imb_get_mb_mgr_size_algos(IMB_MAX_JOBS, cipher_mask,
+                                      hash_mask) >= imb_get_mb_mgr_size()) {
+                printf("%s: test %d, subset size not reduced\n",
+                       __func__, TEST_ALGOS_SIZE);
+                return 1;
+        }
+        printf(".");
+
+        p_mgr = alloc_mb_mgr_algos(mb_mgr->flags, IMB_MAX_JOBS,
+                                   cipher_mask, hash_mask);
+        if (p_mgr == NULL)
+                return 1;
+        init_mgr_arch(p_mgr, mb_mgr);
+
+        if (p_mgr->aes128_ooo == NULL || p_mgr->hmac_sha_1_ooo != NULL) {
+                printf("%s: test %d, unexpected OOO managers\n",
+                       __func__, TEST_ALGOS_ALLOC);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        /* enabled algorithm */
+        (void) submit_two_cbc_jobs(p_mgr, &first_job);
+        while (IMB_FLUSH_JOB(p_mgr) != NULL)
+                ;
+        if (first_job->status != IMB_STATUS_COMPLETED) {
+                printf("%s: test %d, AES-CBC job not completed\n",
+                       __func__, TEST_ALGOS_JOB);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        /* algorithm not enabled */
+        job = IMB_GET_NEXT_JOB(p_mgr);
+        fill_in_job(job, IMB_CIPHER_NULL, IMB_DIR_ENCRYPT,
+                    IMB_AUTH_HMAC_SHA_1, IMB_ORDER_CIPHER_HASH,
+                    &chacha_ctx, &gcm_ctx);
+        job = IMB_SUBMIT_JOB(p_mgr);
+        if (job == NULL || job->status != IMB_STATUS_INVALID_ARGS ||
+            imb_get_errno(p_mgr) != IMB_ERR_ALGO_NOT_ENABLED) {
+                printf("%s: test %d, HMAC-SHA1 job not rejected\n",
+                       __func__, TEST_ALGOS_JOB);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        printf(".");
+
+        free_mb_mgr(p_mgr);
+        printf("\n");
+        return 0;
+}
+
+static int mem_hooks_allocs;
+static int mem_hooks_frees;
+
+static void *
+test_mem_alloc(const size_t size, const size_t alignment, void *ctx)
+{
+        void *ptr = NULL;
+
+        (void) ctx;
+        mem_hooks_allocs++;
+#ifdef LINUX
+        if (posix_memalign(&ptr, alignment, size) != 0)
+                return NULL;
+#else
+        ptr = _aligned_malloc(size, alignment);
+#endif
+        return ptr;
+}
+
+static void
+test_mem_free(void *ptr, const size_t size, void *ctx)
+{
+        (void) size;
+        (void) ctx;
+        mem_hooks_frees++;
+#ifdef LINUX
+        free(ptr);
+#else
+        _aligned_free(ptr);
+#endif
+}
+
+/*
+ * @brief Test managers allocated with memory hooks and on NUMA nodes
+ */
+static int
+test_mem_api(struct IMB_MGR *mb_mgr)
+{
+        IMB_MEM_HOOKS hooks;
+        struct IMB_MGR *p_mgr;
+        struct IMB_JOB *first_job;
+        uint8_t *mem;
+
+	printf("Memory allocation API test:\n");
+
+        hooks.alloc = test_mem_alloc;
+        hooks.free = test_mem_free;
+        hooks.ctx = NULL;
+        mem_hooks_allocs = 0;
+        mem_hooks_frees = 0;
+        p_mgr = alloc_mb_mgr_hooks(mb_mgr->flags, IMB_MAX_JOBS, &hooks);
+        if (p_mgr == NULL || mem_hooks_allocs != 1) {
+                printf("%s: test %d, allocation hook not used\n",
+                       __func__, TEST_MEM_HOOKS);
+                if (p_mgr != NULL)
+                        free_mb_mgr(p_mgr);
+                return 1;
+        }
+        free_mb_mgr(p_mgr);
+        if (mem_hooks_frees != 1) {
+                printf("%s: test %d, free hook not used\n",
+                       __func__, TEST_MEM_HOOKS);
+                return 1;
+        }
+        printf(".");
+
+        /* hugepages fall back to regular pages if not available */
+        p_mgr = alloc_mb_mgr_numa(mb_mgr->flags | IMB_FLAG_HUGEPAGES,
+                                  IMB_MAX_JOBS, IMB_NUMA_NODE_ANY);
+        if (p_mgr == NULL) {
+                printf("%s: test %d, allocation error\n",
+                       __func__, TEST_MEM_NUMA);
+                return 1;
+        }
+        init_mgr_arch(p_mgr, mb_mgr);
+        (void) submit_two_cbc_jobs(p_mgr, &first_job);
+        while (IMB_FLUSH_JOB(p_mgr) != NULL)
+                ;
+        if (first_job->status != IMB_STATUS_COMPLETED) {
+                printf("%s: test %d, AES-CBC job not completed\n",
+                       __func__, TEST_MEM_NUMA);
+                free_mb_mgr(p_mgr);
+                return 1;
+        }
+        free_mb_mgr(p_mgr);
+        printf(".");
+
+        mem = imb_alloc_mem(15 * 16, IMB_NUMA_NODE_ANY, 0);
+        if (mem == NULL || ((uintptr_t) mem & 63) != 0) {
+                printf("%s: test %d, unaligned memory\n",
+                       __func__, TEST_MEM_ALLOC);
+                imb_free_mem(mem);
+                return 1;
+        }
+        memset(mem, 0, 15 * 16);
+        imb_free_mem(mem);
+        printf(".");
+
+        printf("\n");
+        return 0;
+}
+
 int
 api_test(struct IMB_MGR *mb_mgr)
 {
@@ -2255,6 +2990,27 @@ api_test(struct IMB_MGR *mb_mgr)
         errors += test_reset_api(mb_mgr);
         run++;
 
+        errors += test_job_ring_api(mb_mgr);
+        run++;
+
+        errors += test_flush_deadline(mb_mgr);
+        run++;
+
+        errors += test_completion_api(mb_mgr);
+        run++;
+
+        errors += test_stats_api(mb_mgr);
+        run++;
+
+        errors += test_burst_mode_api(mb_mgr);
+        run++;
+
+        errors += test_algos_api(mb_mgr);
+        run++;
+
+        errors += test_mem_api(mb_mgr);
+        run++;
+
         test_suite_update(&ctx, run - errors, errors);
 
         test_suite_end(&ctx);
@@ -2413,6 +2413,101 @@ test_ccm(struct IMB_MGR *mb_mgr,
                 printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
                 goto end;
         }
+
+        /*
+         * *******************************************
+         * CIPHER BURST API TEST
+         * *******************************************
+         */
+
+        /* create job array */
+        IMB_JOB jobs[32] = {0};
+        uint32_t completed_jobs;
+
+        jobs_rx = 0;
+
+        /* reset buffers */
+        for (i = 0; i < num_jobs; i++) {
+                memset(targets[i], -1, vec->packet_len + (sizeof(padding) * 2));
+                memset(auths[i], -1, 16 + (sizeof(padding) * 2));
+
+                if (in_place) {
+                        if (dir == IMB_DIR_ENCRYPT)
+                                memcpy(targets[i] + sizeof(padding),
+                                       vec->packet_in, vec->packet_len);
+                        else
+                                memcpy(targets[i] + sizeof(padding),
+                                       vec->packet_out, vec->packet_len);
+                }
+        }
+
+        /**
+         * Set all job params before submitting burst
+         */
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+                if (in_place) {
+                        job->dst =
+                                targets[i] + sizeof(padding) + vec->clear_len;
+                        job->src = targets[i] + sizeof(padding);
+                } else {
+                        if (dir == IMB_DIR_ENCRYPT) {
+                                job->dst = targets[i] + sizeof(padding);
+                                job->src = vec->packet_in;
+                        } else {
+                                job->dst = targets[i] + sizeof(padding);
+                                job->src = vec->packet_out;
+                        }
+                }
+                job->enc_keys = expkey;
+                job->dec_keys = expkey;
+                job->iv = vec->nonce;
+                job->iv_len_in_bytes = vec->nonce_len;
+                job->cipher_start_src_offset_in_bytes = vec->clear_len;
+                job->msg_len_to_cipher_in_bytes =
+                        vec->packet_len - vec->clear_len;
+
+                job->hash_start_src_offset_in_bytes = vec->clear_len;
+                job->msg_len_to_hash_in_bytes =
+                        vec->packet_len - vec->clear_len;
+                job->auth_tag_output = auths[i] + sizeof(padding);
+                job->auth_tag_output_len_in_bytes = vec->auth_len;
+
+                job->u.CCM.aad_len_in_bytes = vec->clear_len;
+                job->u.CCM.aad = job->src;
+        }
+
+        completed_jobs = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                 IMB_CIPHER_CCM, dir,
+                                                 key_length);
+        if (completed_jobs != (uint32_t) num_jobs) {
+                int err = imb_get_errno(mb_mgr);
+
+                if (err != 0) {
+                        printf("submit_cipher_burst error %d : '%s'\n", err,
+                               imb_get_strerror(err));
+                        goto end;
+                } else {
+                        printf("submit_cipher_burst error: not enough "
+                               "jobs returned!\n");
+                        goto end;
+                }
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+
+                if (!ccm_job_ok(vec, job, targets[i], padding, auths[i],
+                                sizeof(padding), dir, in_place))
+                        goto end;
+                jobs_rx++;
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs after burst, "
+                       "received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
         ret = 0;
 
  end:
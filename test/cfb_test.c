@@ -0,0 +1,492 @@
+/*****************************************************************************
+ Copyright (c) 2022, Intel Corporation
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+     * Redistributions of source code must retain the above copyright notice,
+       this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of Intel Corporation nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include <intel-ipsec-mb.h>
+
+#include "gcm_ctr_vectors_test.h"
+#include "utils.h"
+
+int cfb_test(struct IMB_MGR *mb_mgr);
+
+struct cfb_vector {
+        const uint8_t *K;          /* key */
+        const uint8_t *IV;         /* initialization vector */
+        const uint8_t *P;          /* plain text */
+        uint64_t       Plen;       /* plain text length */
+        const uint8_t *C;          /* cipher text - same length as plain text */
+        uint32_t       Klen;       /* key length */
+};
+
+/*
+ * Vectors 1 to 3 are from NIST SP 800-38A (F.3.13, F.3.15 and F.3.17,
+ * CFB128-AES128/192/256 encrypt). Vector 4 is longer than 8 blocks and
+ * ends with a partial block.
+ * CFB cipher-text of a message prefix is the prefix of the cipher-text,
+ * so all vectors are also tested truncated to various lengths.
+ */
+
+static const uint8_t K1[] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t IV1[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t P1[] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+        0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+        0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+        0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+        0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t C1[] = {
+        0x3b, 0x3f, 0xd9, 0x2e, 0xb7, 0x2d, 0xad, 0x20,
+        0x33, 0x34, 0x49, 0xf8, 0xe8, 0x3c, 0xfb, 0x4a,
+        0xc8, 0xa6, 0x45, 0x37, 0xa0, 0xb3, 0xa9, 0x3f,
+        0xcd, 0xe3, 0xcd, 0xad, 0x9f, 0x1c, 0xe5, 0x8b,
+        0x26, 0x75, 0x1f, 0x67, 0xa3, 0xcb, 0xb1, 0x40,
+        0xb1, 0x80, 0x8c, 0xf1, 0x87, 0xa4, 0xf4, 0xdf,
+        0xc0, 0x4b, 0x05, 0x35, 0x7c, 0x5d, 0x1c, 0x0e,
+        0xea, 0xc4, 0xc6, 0x6f, 0x9f, 0xf7, 0xf2, 0xe6
+};
+
+static const uint8_t K2[] = {
+        0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+        0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+        0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b
+};
+static const uint8_t IV2[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t P2[] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+        0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+        0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+        0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+        0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t C2[] = {
+        0xcd, 0xc8, 0x0d, 0x6f, 0xdd, 0xf1, 0x8c, 0xab,
+        0x34, 0xc2, 0x59, 0x09, 0xc9, 0x9a, 0x41, 0x74,
+        0x67, 0xce, 0x7f, 0x7f, 0x81, 0x17, 0x36, 0x21,
+        0x96, 0x1a, 0x2b, 0x70, 0x17, 0x1d, 0x3d, 0x7a,
+        0x2e, 0x1e, 0x8a, 0x1d, 0xd5, 0x9b, 0x88, 0xb1,
+        0xc8, 0xe6, 0x0f, 0xed, 0x1e, 0xfa, 0xc4, 0xc9,
+        0xc0, 0x5f, 0x9f, 0x9c, 0xa9, 0x83, 0x4f, 0xa0,
+        0x42, 0xae, 0x8f, 0xba, 0x58, 0x4b, 0x09, 0xff
+};
+
+static const uint8_t K3[] = {
+        0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe,
+        0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+        0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
+        0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+};
+static const uint8_t IV3[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t P3[] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+        0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+        0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+        0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+        0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t C3[] = {
+        0xdc, 0x7e, 0x84, 0xbf, 0xda, 0x79, 0x16, 0x4b,
+        0x7e, 0xcd, 0x84, 0x86, 0x98, 0x5d, 0x38, 0x60,
+        0x39, 0xff, 0xed, 0x14, 0x3b, 0x28, 0xb1, 0xc8,
+        0x32, 0x11, 0x3c, 0x63, 0x31, 0xe5, 0x40, 0x7b,
+        0xdf, 0x10, 0x13, 0x24, 0x15, 0xe5, 0x4b, 0x92,
+        0xa1, 0x3e, 0xd0, 0xa8, 0x26, 0x7a, 0xe2, 0xf9,
+        0x75, 0xa3, 0x85, 0x74, 0x1a, 0xb9, 0xce, 0xf8,
+        0x20, 0x31, 0x62, 0x3d, 0x55, 0xb1, 0xe4, 0x71
+};
+
+static const uint8_t K4[] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t IV4[] = {
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const uint8_t P4[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+        0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+        0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4
+};
+static const uint8_t C4[] = {
+        0xec, 0x8d, 0xdd, 0x70, 0x9c, 0x65, 0x7a, 0xb7,
+        0xfa, 0xdb, 0x1c, 0x7e, 0xe6, 0x93, 0xaf, 0xeb,
+        0x84, 0xfb, 0x3f, 0x08, 0x62, 0x10, 0x6c, 0xd1,
+        0xbc, 0x46, 0xb3, 0x74, 0xcd, 0xc0, 0x09, 0xf1,
+        0x38, 0xac, 0x2e, 0x3b, 0x8e, 0x67, 0x3e, 0x8c,
+        0xf1, 0x6e, 0xba, 0x11, 0x5f, 0x4c, 0xd0, 0xd2,
+        0x08, 0x2c, 0x4b, 0xa7, 0x0b, 0x92, 0x65, 0x09,
+        0x61, 0x9d, 0x12, 0x9b, 0x92, 0x7e, 0x4a, 0x08,
+        0x21, 0x7a, 0x3a, 0xbc, 0x62, 0x9d, 0xdd, 0x25,
+        0x3f, 0x77, 0x17, 0x95, 0x89, 0xe8, 0x08, 0xb8,
+        0x14, 0x1b, 0x44, 0x70, 0x89, 0x93, 0x8c, 0xe0,
+        0x00, 0xd2, 0xa4, 0xf8, 0xa6, 0x0c, 0x54, 0x98,
+        0x01, 0xa3, 0xb5, 0x94, 0x64, 0x00, 0x8d, 0xce,
+        0xae, 0x11, 0x81, 0x6f, 0x28, 0xff, 0xab, 0xef,
+        0x30, 0xf8, 0x22, 0x83, 0x7d, 0x9d, 0x90, 0x9f,
+        0x53, 0xc3, 0x41, 0xd5, 0xab, 0x6f, 0xc7, 0x2b,
+        0x81, 0x8c, 0xc7, 0xd4, 0xf5, 0xe0, 0x30, 0x8e,
+        0xa6, 0x40, 0x84, 0xf0, 0x43, 0x40, 0xbb, 0x95,
+        0xb7, 0xb1, 0xd6, 0x21, 0x7f, 0x9f, 0x75, 0x97,
+        0x67, 0x49, 0x31, 0x1a, 0xfd, 0xbd, 0xc2, 0xdb,
+        0x32, 0x93, 0x5e, 0x42, 0x16, 0x93, 0xc2, 0x28,
+        0x04, 0x13, 0x0f, 0xb3, 0x0b, 0x45, 0xc8, 0xf4,
+        0x9a, 0xa5, 0x50, 0x1f, 0x67
+};
+
+static const struct cfb_vector cfb_vectors[] = {
+        {K1, IV1, P1, sizeof(P1), C1, sizeof(K1)},
+        {K2, IV2, P2, sizeof(P2), C2, sizeof(K2)},
+        {K3, IV3, P3, sizeof(P3), C3, sizeof(K3)},
+        {K4, IV4, P4, sizeof(P4), C4, sizeof(K4)},
+};
+
+static int
+cfb_job_ok(const struct IMB_JOB *job,
+           const uint8_t *out_text,
+           const uint8_t *target,
+           const uint8_t *padding,
+           const size_t sizeof_padding,
+           const unsigned text_len)
+{
+        const int num = (const int)((uint64_t)job->user_data2);
+
+        if (job->status != IMB_STATUS_COMPLETED) {
+                printf("%d error status:%d, job %d",
+                       __LINE__, job->status, num);
+                return 0;
+        }
+        if (memcmp(out_text, target + sizeof_padding,
+                   text_len)) {
+                printf("%d mismatched\n", num);
+                return 0;
+        }
+        if (memcmp(padding, target, sizeof_padding)) {
+                printf("%d overwrite head\n", num);
+                return 0;
+        }
+        if (memcmp(padding,
+                   target + sizeof_padding + text_len,
+                   sizeof_padding)) {
+                printf("%d overwrite tail\n", num);
+                return 0;
+        }
+        return 1;
+}
+
+static void
+cfb_fill_job(struct IMB_JOB *job, const void *enc_keys, const uint8_t *iv,
+             const uint8_t *in_text, uint8_t *target, const size_t pad_len,
+             const unsigned text_len, const int dir, const int in_place,
+             const int key_len, const int num)
+{
+        job->cipher_direction = dir;
+        job->chain_order = (dir == IMB_DIR_ENCRYPT) ?
+                IMB_ORDER_CIPHER_HASH : IMB_ORDER_HASH_CIPHER;
+        job->dst = target + pad_len;
+        job->src = in_place ? (target + pad_len) : in_text;
+        job->cipher_mode = IMB_CIPHER_CFB;
+        job->enc_keys = enc_keys;
+        job->dec_keys = NULL;
+        job->key_len_in_bytes = key_len;
+        job->iv = iv;
+        job->iv_len_in_bytes = 16;
+        job->cipher_start_src_offset_in_bytes = 0;
+        job->msg_len_to_cipher_in_bytes = text_len;
+        job->user_data = target;
+        job->user_data2 = (void *)((uint64_t)num);
+        job->hash_alg = IMB_AUTH_NULL;
+}
+
+static int
+test_cfb_many(struct IMB_MGR *mb_mgr,
+              const void *enc_keys,
+              const uint8_t *iv,
+              const uint8_t *in_text,
+              const uint8_t *out_text,
+              const unsigned text_len,
+              const int dir,
+              const int in_place,
+              const int key_len,
+              const int num_jobs,
+              const int use_burst)
+{
+        struct IMB_JOB *job, jobs[17];
+        uint8_t padding[16];
+        uint8_t **targets = malloc(num_jobs * sizeof(void *));
+        int i, jobs_rx = 0, ret = -1;
+
+        assert(targets != NULL);
+        assert(num_jobs <= (int) DIM(jobs));
+
+        memset(padding, -1, sizeof(padding));
+
+        for (i = 0; i < num_jobs; i++) {
+                targets[i] = malloc(text_len + (sizeof(padding) * 2));
+                memset(targets[i], -1, text_len + (sizeof(padding) * 2));
+                if (in_place) {
+                        /* copy input text to the allocated buffer */
+                        memcpy(targets[i] + sizeof(padding), in_text, text_len);
+                }
+        }
+
+        if (use_burst) {
+                uint32_t completed_jobs;
+
+                for (i = 0; i < num_jobs; i++)
+                        cfb_fill_job(&jobs[i], enc_keys, iv, in_text,
+                                     targets[i], sizeof(padding), text_len,
+                                     dir, in_place, key_len, i);
+
+                completed_jobs = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs,
+                                                         num_jobs,
+                                                         IMB_CIPHER_CFB, dir,
+                                                         key_len);
+                if (completed_jobs != (uint32_t) num_jobs) {
+                        const int err = imb_get_errno(mb_mgr);
+
+                        printf("submit_cipher_burst error %d : '%s'\n", err,
+                               imb_get_strerror(err));
+                        goto end;
+                }
+
+                for (i = 0; i < num_jobs; i++)
+                        if (!cfb_job_ok(&jobs[i], out_text,
+                                        jobs[i].user_data, padding,
+                                        sizeof(padding), text_len))
+                                goto end;
+                ret = 0;
+                goto end;
+        }
+
+        /* flush the scheduler */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+                cfb_fill_job(job, enc_keys, iv, in_text, targets[i],
+                             sizeof(padding), text_len, dir, in_place,
+                             key_len, i);
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                if (job != NULL) {
+                        jobs_rx++;
+                        if (!cfb_job_ok(job, out_text, job->user_data, padding,
+                                        sizeof(padding), text_len))
+                                goto end;
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                jobs_rx++;
+                if (!cfb_job_ok(job, out_text, job->user_data, padding,
+                                sizeof(padding), text_len))
+                        goto end;
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
+        ret = 0;
+
+ end:
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++)
+                free(targets[i]);
+        free(targets);
+        return ret;
+}
+
+static void
+test_cfb_vectors(struct IMB_MGR *mb_mgr, const int vec_cnt,
+                 const struct cfb_vector *vec_tab, const char *banner,
+                 const int num_jobs, const int use_burst,
+                 struct test_suite_context *ts128,
+                 struct test_suite_context *ts192,
+                 struct test_suite_context *ts256)
+{
+        const unsigned len_tab[] = { 1, 15, 16, 17, 33, 64, 127, 128, 181 };
+        int vect;
+        DECLARE_ALIGNED(uint32_t enc_keys[15*4], 16);
+        DECLARE_ALIGNED(uint32_t dec_keys[15*4], 16);
+
+        printf("%s (N jobs = %d):\n", banner, num_jobs);
+        for (vect = 0; vect < vec_cnt; vect++) {
+                struct test_suite_context *ctx = NULL;
+                unsigned i;
+
+#ifdef DEBUG
+                printf("[%d/%d] Standard vector key_len:%d\n",
+                       vect + 1, vec_cnt,
+                       (int) vec_tab[vect].Klen);
+#else
+                printf(".");
+#endif
+
+                if (vec_tab[vect].Klen == 16) {
+                        IMB_AES_KEYEXP_128(mb_mgr, vec_tab[vect].K, enc_keys,
+                                           dec_keys);
+                        ctx = ts128;
+                } else if (vec_tab[vect].Klen == 24) {
+                        IMB_AES_KEYEXP_192(mb_mgr, vec_tab[vect].K, enc_keys,
+                                           dec_keys);
+                        ctx = ts192;
+                } else {
+                        IMB_AES_KEYEXP_256(mb_mgr, vec_tab[vect].K, enc_keys,
+                                           dec_keys);
+                        ctx = ts256;
+                }
+
+                for (i = 0; i < DIM(len_tab); i++) {
+                        const unsigned len = len_tab[i];
+                        int in_place;
+
+                        if (len > vec_tab[vect].Plen)
+                                break;
+
+                        for (in_place = 0; in_place <= 1; in_place++) {
+                                if (test_cfb_many(mb_mgr, enc_keys,
+                                                  vec_tab[vect].IV,
+                                                  vec_tab[vect].P,
+                                                  vec_tab[vect].C, len,
+                                                  IMB_DIR_ENCRYPT, in_place,
+                                                  vec_tab[vect].Klen,
+                                                  num_jobs, use_burst)) {
+                                        printf("error #%d len %u encrypt%s\n",
+                                               vect + 1, len,
+                                               in_place ? " in-place" : "");
+                                        test_suite_update(ctx, 0, 1);
+                                } else {
+                                        test_suite_update(ctx, 1, 0);
+                                }
+
+                                if (test_cfb_many(mb_mgr, enc_keys,
+                                                  vec_tab[vect].IV,
+                                                  vec_tab[vect].C,
+                                                  vec_tab[vect].P, len,
+                                                  IMB_DIR_DECRYPT, in_place,
+                                                  vec_tab[vect].Klen,
+                                                  num_jobs, use_burst)) {
+                                        printf("error #%d len %u decrypt%s\n",
+                                               vect + 1, len,
+                                               in_place ? " in-place" : "");
+                                        test_suite_update(ctx, 0, 1);
+                                } else {
+                                        test_suite_update(ctx, 1, 0);
+                                }
+                        }
+                }
+        }
+        printf("\n");
+}
+
+int
+cfb_test(struct IMB_MGR *mb_mgr)
+{
+        struct test_suite_context ts128, ts192, ts256;
+        const int num_jobs_tab[] = {
+                1, 3, 4, 5, 7, 8, 9, 15, 16, 17
+        };
+        unsigned i;
+        int errors = 0;
+
+        test_suite_start(&ts128, "AES-CFB-128");
+        test_suite_start(&ts192, "AES-CFB-192");
+        test_suite_start(&ts256, "AES-CFB-256");
+
+        /* CFB is not supported by the no-aesni implementation */
+        if (mb_mgr->flags & IMB_FLAG_AESNI_OFF) {
+                printf("AES-CFB not supported without AESNI - skipping\n");
+                goto exit;
+        }
+
+        for (i = 0; i < DIM(num_jobs_tab); i++) {
+                test_cfb_vectors(mb_mgr, DIM(cfb_vectors), cfb_vectors,
+                                 "AES-CFB standard test vectors",
+                                 num_jobs_tab[i], 0, &ts128, &ts192, &ts256);
+                test_cfb_vectors(mb_mgr, DIM(cfb_vectors), cfb_vectors,
+                                 "AES-CFB standard test vectors - burst API",
+                                 num_jobs_tab[i], 1, &ts128, &ts192, &ts256);
+        }
+
+ exit:
+        errors = test_suite_end(&ts128);
+        errors += test_suite_end(&ts192);
+        errors += test_suite_end(&ts256);
+
+        return errors;
+}
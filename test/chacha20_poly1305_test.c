@@ -38,6 +38,11 @@
 #define KEY_SZ 32
 #define DIGEST_SZ 16
 
+typedef enum {
+        BURST_TYPE_GENERIC = 0,
+        BURST_TYPE_CIPHER,
+} BURST_TYPE;
+
 int chacha20_poly1305_test(struct IMB_MGR *mb_mgr);
 
 /*
@@ -445,96 +450,109 @@ test_aead(struct IMB_MGR *mb_mgr,
 
         /* create job array */
         IMB_JOB jobs[32] = {0};
+        BURST_TYPE burst_type;
+        int completed_jobs;
 
-        jobs_rx = 0;
+        for (burst_type = BURST_TYPE_GENERIC;
+             burst_type <= BURST_TYPE_CIPHER; burst_type++) {
+                jobs_rx = 0;
 
-        /* reset buffers */
-        for (i = 0; i < num_jobs; i++) {
-                memset(auths[i], -1, 16 + (sizeof(padding) * 2));
-                memset(targets[i], -1, vec->msg_len + (sizeof(padding) * 2));
+                /* reset buffers */
+                for (i = 0; i < num_jobs; i++) {
+                        memset(auths[i], -1, 16 + (sizeof(padding) * 2));
+                        memset(targets[i], -1,
+                               vec->msg_len + (sizeof(padding) * 2));
+
+                        if (in_place) {
+                                if (dir == IMB_DIR_ENCRYPT)
+                                        memcpy(targets[i] + sizeof(padding),
+                                               vec->plain, vec->msg_len);
+                                else
+                                        memcpy(targets[i] + sizeof(padding),
+                                               vec->cipher, vec->msg_len);
+                        }
+                }
 
-                if (in_place) {
-                        if (dir == IMB_DIR_ENCRYPT)
-                                memcpy(targets[i] + sizeof(padding),
-                                       vec->plain, vec->msg_len);
+                /**
+                 * Set all job params before submitting burst
+                 */
+                for (i = 0; i < num_jobs; i++) {
+                        job = &jobs[i];
+                        job->cipher_direction = dir;
+                        job->chain_order = IMB_ORDER_HASH_CIPHER;
+                        job->cipher_mode = IMB_CIPHER_CHACHA20_POLY1305;
+                        job->hash_alg = IMB_AUTH_CHACHA20_POLY1305;
+                        job->enc_keys = vec->key;
+                        job->dec_keys = vec->key;
+                        job->key_len_in_bytes = 32;
+
+                        job->u.CHACHA20_POLY1305.aad = vec->aad;
+                        job->u.CHACHA20_POLY1305.aad_len_in_bytes =
+                                vec->aad_len;
+
+                        if (in_place)
+                                job->src = targets[i] + sizeof(padding);
                         else
-                                memcpy(targets[i] + sizeof(padding),
-                                       vec->cipher, vec->msg_len);
-                }
-        }
+                                if (dir == IMB_DIR_ENCRYPT)
+                                        job->src = vec->plain;
+                                else
+                                        job->src = vec->cipher;
+                        job->dst = targets[i] + sizeof(padding);
+
+                        job->iv = vec->iv;
+                        job->iv_len_in_bytes = 12;
+                        job->msg_len_to_cipher_in_bytes = vec->msg_len;
+                        job->cipher_start_src_offset_in_bytes = 0;
 
-        /**
-         * Set all job params before submitting burst
-         */
-        for (i = 0; i < num_jobs; i++) {
-                job = &jobs[i];
-                job->cipher_direction = dir;
-                job->chain_order = IMB_ORDER_HASH_CIPHER;
-                job->cipher_mode = IMB_CIPHER_CHACHA20_POLY1305;
-                job->hash_alg = IMB_AUTH_CHACHA20_POLY1305;
-                job->enc_keys = vec->key;
-                job->dec_keys = vec->key;
-                job->key_len_in_bytes = 32;
+                        job->msg_len_to_hash_in_bytes = vec->msg_len;
+                        job->hash_start_src_offset_in_bytes = 0;
+                        job->auth_tag_output = auths[i] + sizeof(padding);
+                        job->auth_tag_output_len_in_bytes = 16;
 
-                job->u.CHACHA20_POLY1305.aad = vec->aad;
-                job->u.CHACHA20_POLY1305.aad_len_in_bytes = vec->aad_len;
+                        job->user_data = auths[i];
+                }
 
-                if (in_place)
-                        job->src = targets[i] + sizeof(padding);
+                if (burst_type == BURST_TYPE_GENERIC)
+                        completed_jobs = IMB_SUBMIT_BURST(mb_mgr, jobs,
+                                                          num_jobs);
                 else
-                        if (dir == IMB_DIR_ENCRYPT)
-                                job->src = vec->plain;
-                        else
-                                job->src = vec->cipher;
-                job->dst = targets[i] + sizeof(padding);
+                        completed_jobs = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs,
+                                num_jobs, IMB_CIPHER_CHACHA20_POLY1305,
+                                dir, IMB_KEY_256_BYTES);
 
-                job->iv = vec->iv;
-                job->iv_len_in_bytes = 12;
-                job->msg_len_to_cipher_in_bytes = vec->msg_len;
-                job->cipher_start_src_offset_in_bytes = 0;
-
-                job->msg_len_to_hash_in_bytes = vec->msg_len;
-                job->hash_start_src_offset_in_bytes = 0;
-                job->auth_tag_output = auths[i] + sizeof(padding);
-                job->auth_tag_output_len_in_bytes = 16;
+                if (completed_jobs != num_jobs) {
+                        int err = imb_get_errno(mb_mgr);
 
-                job->user_data = auths[i];
-        }
+                        if (err != 0) {
+                                printf("submit_burst error %d : '%s'\n", err,
+                                       imb_get_strerror(err));
+                                goto end;
+                        } else {
+                                printf("submit_burst error: not enough "
+                                       "jobs returned!\n");
+                                goto end;
+                        }
+                }
 
-        int completed_jobs = IMB_SUBMIT_BURST(mb_mgr, jobs, num_jobs);
+                for (i = 0; i < num_jobs; i++) {
+                        job = &jobs[i];
 
-        if (completed_jobs != num_jobs) {
-                int err = imb_get_errno(mb_mgr);
+                        if (job->status != IMB_STATUS_COMPLETED) {
+                                printf("job %d status not complete!\n", i+1);
+                                goto end;
+                        }
 
-                if (err != 0) {
-                        printf("submit_burst error %d : '%s'\n", err,
-                               imb_get_strerror(err));
-                        goto end;
-                } else {
-                        printf("submit_burst error: not enough "
-                               "jobs returned!\n");
-                        goto end;
+                        if (!aead_job_ok(mb_mgr, vec, job, job->user_data,
+                                         padding, sizeof(padding)))
+                                goto end;
+                        jobs_rx++;
                 }
-        }
-
-        for (i = 0; i < num_jobs; i++) {
-                job = &jobs[i];
 
-                if (job->status != IMB_STATUS_COMPLETED) {
-                        printf("job %d status not complete!\n", i+1);
+                if (jobs_rx != num_jobs) {
+                        printf("Expected %d jobs after burst, "
+                               "received %d\n", num_jobs, jobs_rx);
                         goto end;
                 }
-
-                if (!aead_job_ok(mb_mgr, vec, job, job->user_data,
-                                 padding, sizeof(padding)))
-                        goto end;
-                jobs_rx++;
-        }
-
-        if (jobs_rx != num_jobs) {
-                printf("Expected %d jobs after burst, "
-                       "received %d\n", num_jobs, jobs_rx);
-                goto end;
         }
 
         /*
@@ -739,6 +757,8 @@ test_single_job_sgl(struct IMB_MGR *mb_mgr,
         job->auth_tag_output_len_in_bytes = DIGEST_SZ;
 
         job = IMB_SUBMIT_JOB(mb_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(mb_mgr);
 
         if (job->status == IMB_STATUS_COMPLETED)
                 test_suite_update(ctx, 1, 0);
@@ -940,6 +960,8 @@ test_sgl(struct IMB_MGR *mb_mgr,
         job->auth_tag_output_len_in_bytes = DIGEST_SZ;
 
         job = IMB_SUBMIT_JOB(mb_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(mb_mgr);
 
         if (job->status == IMB_STATUS_COMPLETED)
                 test_suite_update(ctx, 1, 0);
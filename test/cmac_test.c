@@ -1128,15 +1128,19 @@ test_cmac(struct IMB_MGR *mb_mgr,
         struct IMB_JOB *job;
         uint8_t padding[16];
         uint8_t **auths = malloc(num_jobs * sizeof(void *));
+        struct IMB_JOB *jobs = malloc(num_jobs * sizeof(*jobs));
+        IMB_HASH_ALG hash_alg;
+        uint32_t completed_jobs;
         int i = 0, jobs_rx = 0, ret = -1;
 
-        if (auths == NULL) {
+        if (auths == NULL || jobs == NULL) {
 		fprintf(stderr, "Can't allocate buffer memory\n");
 		goto end2;
         }
 
         memset(padding, -1, sizeof(padding));
         memset(auths, 0, num_jobs * sizeof(void *));
+        memset(jobs, 0, num_jobs * sizeof(*jobs));
 
         for (i = 0; i < num_jobs; i++) {
                 auths[i] = malloc(16 + (sizeof(padding) * 2));
@@ -1303,6 +1307,59 @@ test_cmac(struct IMB_MGR *mb_mgr,
                 }
         }
 
+        /**
+         * Submit all jobs through the hash burst API
+         */
+        switch (type) {
+        case CMAC_128:
+                hash_alg = IMB_AUTH_AES_CMAC;
+                break;
+        case CMAC_128_BITLEN:
+                hash_alg = IMB_AUTH_AES_CMAC_BITLEN;
+                break;
+        default: /* CMAC_256 */
+                hash_alg = IMB_AUTH_AES_CMAC_256;
+                break;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+
+                memset(auths[i], -1, 16 + (sizeof(padding) * 2));
+
+                job->cipher_direction = dir;
+                job->chain_order = IMB_ORDER_HASH_CIPHER;
+                job->cipher_mode = IMB_CIPHER_NULL;
+                if (type != CMAC_128_BITLEN)
+                        job->msg_len_to_hash_in_bytes = vec->len;
+                else if (vec->type == CMAC_128)
+                        job->msg_len_to_hash_in_bits = vec->len * 8;
+                else
+                        job->msg_len_to_hash_in_bits = vec->len;
+                job->u.CMAC._key_expanded = expkey;
+                job->u.CMAC._skey1 = skey1;
+                job->u.CMAC._skey2 = skey2;
+                job->src = vec->M;
+                job->hash_start_src_offset_in_bytes = 0;
+                job->auth_tag_output = auths[i] + sizeof(padding);
+                job->auth_tag_output_len_in_bytes = vec->T_len;
+                job->user_data = auths[i];
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(mb_mgr, jobs, num_jobs,
+                                               hash_alg);
+        if (completed_jobs != (uint32_t) num_jobs) {
+                printf("Expected %d jobs from burst, received %u, "
+                       "error %d\n", num_jobs, completed_jobs,
+                       imb_get_errno(mb_mgr));
+                goto end;
+        }
+
+        for (i = 0; i < num_jobs; i++)
+                if (!cmac_job_ok(vec, &jobs[i], jobs[i].user_data, padding,
+                                 sizeof(padding)))
+                        goto end;
+
         ret = 0;
 
  end:
@@ -1317,6 +1374,8 @@ test_cmac(struct IMB_MGR *mb_mgr,
  end2:
         if (auths != NULL)
                 free(auths);
+        if (jobs != NULL)
+                free(jobs);
 
         return ret;
 }
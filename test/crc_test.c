@@ -220,8 +220,11 @@ test_crc_polynomial(void (*fn_crc_setup)(void),
                 test_suite_update(ctx, 1, 0);
         }
 
-        for (job_api = 0; job_api <= 1; job_api++) {
-                if (job_api)
+        for (job_api = 0; job_api <= 2; job_api++) {
+                if (job_api == 2)
+                        printf("Starting CRC Test (hash burst API): %s\n",
+                               title);
+                else if (job_api)
                         printf("Starting CRC Test (job API): %s\n", title);
                 else
                         printf("Starting CRC Test (direct API): %s\n", title);
@@ -276,13 +279,56 @@ crc32_ethernet_fcs_ref_calc(const void *p, uint64_t len)
         return ~crc32_ref_calc_lut(p, len, 0xffffffffUL, m_lut);
 }
 
+#define CRC_BURST_JOBS 16
+
+static uint32_t
+crc_hash_burst(const void *p, const uint64_t len, IMB_HASH_ALG hash_alg)
+{
+        IMB_JOB jobs[CRC_BURST_JOBS];
+        uint32_t auth_tags[CRC_BURST_JOBS];
+        uint32_t i, completed_jobs;
+
+        memset(jobs, 0, sizeof(jobs));
+        memset(auth_tags, 0, sizeof(auth_tags));
+
+        /* same buffer in all jobs to fill the CRC lanes */
+        for (i = 0; i < CRC_BURST_JOBS; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->cipher_mode                    = IMB_CIPHER_NULL;
+                job->hash_alg                       = hash_alg;
+                job->src                            = p;
+                job->msg_len_to_hash_in_bytes       = len;
+                job->hash_start_src_offset_in_bytes = UINT64_C(0);
+                job->auth_tag_output                = (uint8_t *) &auth_tags[i];
+                job->auth_tag_output_len_in_bytes   = sizeof(auth_tags[i]);
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(p_mgr, jobs, CRC_BURST_JOBS,
+                                               hash_alg);
+        if (completed_jobs != CRC_BURST_JOBS)
+                fprintf(stderr, "hash burst failed, completed %u, error %d\n",
+                        completed_jobs, imb_get_errno(p_mgr));
+
+        for (i = 1; i < CRC_BURST_JOBS; i++)
+                if (auth_tags[i] != auth_tags[0])
+                        fprintf(stderr, "hash burst job %u, CRC mismatch\n",
+                                i);
+
+        return auth_tags[0];
+}
+
 static uint32_t
-crc_job(const void *p, const uint64_t len, IMB_HASH_ALG hash_alg)
+crc_job(const void *p, const uint64_t len, IMB_HASH_ALG hash_alg,
+        const unsigned job_api)
 {
         uint32_t auth_tag = 0;
 
         IMB_JOB *job;
 
+        if (job_api == 2)
+                return crc_hash_burst(p, len, hash_alg);
+
         job = IMB_GET_NEXT_JOB(p_mgr);
         if (!job) {
                 fprintf(stderr, "failed to get job\n");
@@ -325,7 +371,7 @@ crc32_ethernet_fcs_tested_calc(const void *p, uint64_t len,
                                const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC32_ETHERNET_FCS);
+                return crc_job(p, len, IMB_AUTH_CRC32_ETHERNET_FCS, job_api);
         else
                 return IMB_CRC32_ETHERNET_FCS(p_mgr, p, len);
 }
@@ -365,7 +411,7 @@ static uint32_t
 crc16_x25_tested_calc(const void *p, const uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC16_X25);
+                return crc_job(p, len, IMB_AUTH_CRC16_X25, job_api);
         else
                 return IMB_CRC16_X25(p_mgr, p, len);
 }
@@ -405,7 +451,7 @@ static uint32_t
 crc32_sctp_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC32_SCTP);
+                return crc_job(p, len, IMB_AUTH_CRC32_SCTP, job_api);
         else
                 return IMB_CRC32_SCTP(p_mgr, p, len);
 }
@@ -448,7 +494,7 @@ static uint32_t
 crc32_lte24a_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC24_LTE_A);
+                return crc_job(p, len, IMB_AUTH_CRC24_LTE_A, job_api);
         else
                 return IMB_CRC24_LTE_A(p_mgr, p, len);
 }
@@ -491,7 +537,7 @@ static uint32_t
 crc32_lte24b_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC24_LTE_B);
+                return crc_job(p, len, IMB_AUTH_CRC24_LTE_B, job_api);
         else
                return IMB_CRC24_LTE_B(p_mgr, p, len);
 }
@@ -535,7 +581,7 @@ static uint32_t
 crc16_fp_data_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC16_FP_DATA);
+                return crc_job(p, len, IMB_AUTH_CRC16_FP_DATA, job_api);
         else
                 return IMB_CRC16_FP_DATA(p_mgr, p, len);
 }
@@ -579,7 +625,7 @@ static uint32_t
 crc11_fp_header_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC11_FP_HEADER);
+                return crc_job(p, len, IMB_AUTH_CRC11_FP_HEADER, job_api);
         else
                 return IMB_CRC11_FP_HEADER(p_mgr, p, len);
 }
@@ -623,7 +669,7 @@ static uint32_t
 crc7_fp_header_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC7_FP_HEADER);
+                return crc_job(p, len, IMB_AUTH_CRC7_FP_HEADER, job_api);
         else
                return IMB_CRC7_FP_HEADER(p_mgr, p, len);
 }
@@ -667,7 +713,7 @@ static uint32_t
 crc10_iuup_data_tested_calc(const void *p, uint64_t len, const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC10_IUUP_DATA);
+                return crc_job(p, len, IMB_AUTH_CRC10_IUUP_DATA, job_api);
         else
                 return IMB_CRC10_IUUP_DATA(p_mgr, p, len);
 }
@@ -712,7 +758,7 @@ crc6_iuup_header_tested_calc(const void *p, uint64_t len,
                              const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC6_IUUP_HEADER);
+                return crc_job(p, len, IMB_AUTH_CRC6_IUUP_HEADER, job_api);
         else
                return IMB_CRC6_IUUP_HEADER(p_mgr, p, len);
 }
@@ -755,7 +801,8 @@ crc32_wimax_ofdma_data_tested_calc(const void *p, uint64_t len,
                                    const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC32_WIMAX_OFDMA_DATA);
+                return crc_job(p, len, IMB_AUTH_CRC32_WIMAX_OFDMA_DATA,
+                               job_api);
         else
                 return IMB_CRC32_WIMAX_OFDMA_DATA(p_mgr, p, len);
 }
@@ -798,11 +845,125 @@ crc8_wimax_ofdma_hcs_tested_calc(const void *p, uint64_t len,
                                  const unsigned job_api)
 {
         if (job_api)
-                return crc_job(p, len, IMB_AUTH_CRC8_WIMAX_OFDMA_HCS);
+                return crc_job(p, len, IMB_AUTH_CRC8_WIMAX_OFDMA_HCS, job_api);
         else
                 return IMB_CRC8_WIMAX_OFDMA_HCS(p_mgr, p, len);
 }
 
+/*
+ * Lengths around the AVX512 CRC manager range (10 to 200 bytes),
+ * mixed so that queued and directly computed jobs interleave
+ */
+static const uint64_t crc_boundary_lens[] = {
+        9, 10, 200, 201, 0, 11, 199, 1024, 10, 9, 201, 200, 1, 100, 255, 10
+};
+
+#define CRC_BOUNDARY_JOBS DIM(crc_boundary_lens)
+
+/**
+ * @brief Tests mixed length CRC32 Ethernet FCS jobs around
+ *        the CRC manager length limits
+ *
+ * @param ctx test suite context
+ * @param job_api 1 - job API, 2 - hash burst API
+ *
+ * @return test status
+ * @retval 0 OK
+ * @retval 1 error
+ */
+static int
+test_crc_boundaries(struct test_suite_context *ctx, const unsigned job_api)
+{
+        uint8_t buffer[1024];
+        IMB_JOB burst_jobs[CRC_BOUNDARY_JOBS];
+        uint32_t auth_tags[CRC_BOUNDARY_JOBS];
+        IMB_JOB *job;
+        unsigned i, completed = 0;
+
+        printf("Starting CRC Test (%s API): length boundaries\n",
+               (job_api == 2) ? "hash burst" : "job");
+
+        crc32_ethernet_fcs_setup();
+        randomize_buffer(buffer, sizeof(buffer));
+        memset(auth_tags, 0, sizeof(auth_tags));
+        memset(burst_jobs, 0, sizeof(burst_jobs));
+
+        for (i = 0; i < CRC_BOUNDARY_JOBS; i++) {
+                job = (job_api == 2) ? &burst_jobs[i] :
+                        IMB_GET_NEXT_JOB(p_mgr);
+
+                job->cipher_mode                    = IMB_CIPHER_NULL;
+                job->hash_alg                       =
+                        IMB_AUTH_CRC32_ETHERNET_FCS;
+                job->src                            = buffer;
+                job->dst                            = NULL;
+                job->msg_len_to_hash_in_bytes       = crc_boundary_lens[i];
+                job->hash_start_src_offset_in_bytes = UINT64_C(0);
+                job->auth_tag_output                = (uint8_t *) &auth_tags[i];
+                job->auth_tag_output_len_in_bytes   = sizeof(auth_tags[i]);
+                job->user_data                      = &auth_tags[i];
+
+                if (job_api == 2)
+                        continue;
+
+                /* jobs have to come back in submission order */
+                job = IMB_SUBMIT_JOB(p_mgr);
+                while (job != NULL) {
+                        if (job->status != IMB_STATUS_COMPLETED ||
+                            job->user_data != &auth_tags[completed]) {
+                                printf("! CRC job %u out of order\n",
+                                       completed);
+                                test_suite_update(ctx, 0, 1);
+                                return 1;
+                        }
+                        completed++;
+                        job = IMB_GET_COMPLETED_JOB(p_mgr);
+                }
+        }
+
+        if (job_api == 2)
+                completed = IMB_SUBMIT_HASH_BURST(p_mgr, burst_jobs,
+                                                  CRC_BOUNDARY_JOBS,
+                                                  IMB_AUTH_CRC32_ETHERNET_FCS);
+        else
+                while ((job = IMB_FLUSH_JOB(p_mgr)) != NULL) {
+                        if (job->status != IMB_STATUS_COMPLETED ||
+                            job->user_data != &auth_tags[completed]) {
+                                printf("! CRC job %u out of order\n",
+                                       completed);
+                                test_suite_update(ctx, 0, 1);
+                                return 1;
+                        }
+                        completed++;
+                }
+
+        if (completed != CRC_BOUNDARY_JOBS) {
+                printf("! %u of %u CRC jobs completed\n",
+                       completed, (unsigned) CRC_BOUNDARY_JOBS);
+                test_suite_update(ctx, 0, 1);
+                return 1;
+        }
+
+        for (i = 0; i < CRC_BOUNDARY_JOBS; i++) {
+                const uint32_t reference_crc =
+                        crc32_ethernet_fcs_ref_calc(buffer,
+                                                    crc_boundary_lens[i]);
+
+                if (reference_crc != auth_tags[i]) {
+                        printf("! CRC mismatch for buffer size %lu, "
+                               "received = 0x%lx, expected = 0x%lx\n",
+                               (unsigned long) crc_boundary_lens[i],
+                               (unsigned long) auth_tags[i],
+                               (unsigned long) reference_crc);
+                        test_suite_update(ctx, 0, 1);
+                        return 1;
+                }
+                test_suite_update(ctx, 1, 0);
+        }
+
+        return 0;
+}
+
 int
 crc_test(struct IMB_MGR *mb_mgr)
 {
@@ -820,6 +981,8 @@ crc_test(struct IMB_MGR *mb_mgr)
                             crc32_ethernet_fcs_ref_calc,
                             crc32_ethernet_fcs_tested_calc,
                             "CRC32 ETHERNET FCS 0x04c11db7", &ctx);
+        test_crc_boundaries(&ctx, 1);
+        test_crc_boundaries(&ctx, 2);
         errors += test_suite_end(&ctx);
 
         test_suite_start(&ctx, "X25-CRC16");
@@ -859,6 +859,255 @@ static const uint8_t T15_CTR[] = { 0 };
 static const uint8_t A15_CTR[] = { 0 };
 #define A15_CTR_len 0
 
+/*
+   Test Vectors #16 and #17 (generated with OpenSSL):
+   300 octets with 192-bit key and 12 byte IV (nonce + IV),
+   527 octets with 256-bit key and 16 byte IV,
+   both over more than one 16 block group with a partial last block
+*/
+static const uint8_t K16_CTR[] = {
+        0x2d, 0x17, 0xa2, 0xb9, 0x2e, 0x4d, 0x86, 0xe9,
+        0xe3, 0x7c, 0x8c, 0xae, 0x1f, 0x1d, 0x2a, 0x9d,
+        0x78, 0xf8, 0x27, 0x76, 0x59, 0x0a, 0x1c, 0xf0
+};
+static const uint8_t IV16_CTR[] = {
+        0xe5, 0x31, 0xae, 0x3e, 0x92, 0x9d, 0x88, 0x65,
+        0x82, 0xf7, 0x1b, 0x3d
+};
+static const uint8_t P16_CTR[] = {
+        0xa0, 0x4e, 0x15, 0x48, 0x7f, 0xc6, 0xa2, 0x36,
+        0xf3, 0xff, 0x65, 0x34, 0x6b, 0x46, 0x35, 0xf8,
+        0x15, 0x7e, 0x98, 0x8e, 0xaf, 0xcd, 0x00, 0xdf,
+        0x2e, 0x06, 0xc7, 0x06, 0x12, 0xd9, 0xec, 0x53,
+        0x84, 0xbc, 0x8b, 0x1b, 0x35, 0x98, 0x1e, 0x46,
+        0xf5, 0x34, 0x76, 0x96, 0x15, 0x62, 0x77, 0xb7,
+        0x7e, 0xec, 0x96, 0x0c, 0x8e, 0x3c, 0x14, 0x34,
+        0xb6, 0xcd, 0xf7, 0x5e, 0xd4, 0x55, 0xcd, 0x51,
+        0x51, 0xaf, 0x20, 0x3a, 0xfa, 0x8a, 0xb8, 0x34,
+        0x9f, 0xd4, 0x93, 0x9a, 0x6e, 0xe4, 0xa5, 0x0c,
+        0x0d, 0x6a, 0x50, 0x42, 0x79, 0x16, 0xa1, 0x93,
+        0xa1, 0x0b, 0x50, 0x44, 0xc1, 0x02, 0x76, 0x91,
+        0x80, 0x3e, 0x0c, 0x7d, 0xc8, 0x34, 0x28, 0x5a,
+        0x69, 0xf6, 0xf6, 0x18, 0x6d, 0x63, 0x77, 0x4d,
+        0x39, 0x10, 0xfc, 0x08, 0x68, 0xf5, 0x61, 0x56,
+        0x67, 0xd8, 0x0a, 0x90, 0xd0, 0x79, 0x9f, 0x6b,
+        0x87, 0x82, 0x87, 0xbd, 0x97, 0x2d, 0x25, 0x10,
+        0xca, 0xb3, 0xd5, 0xe8, 0x0a, 0x78, 0xa5, 0xd4,
+        0x7a, 0xf8, 0xd3, 0x37, 0x54, 0x6f, 0x0b, 0xd3,
+        0x81, 0x4b, 0x5d, 0x1a, 0xfa, 0x52, 0x00, 0x35,
+        0xe1, 0x93, 0xc9, 0xd0, 0x5e, 0x0e, 0x69, 0xac,
+        0x3a, 0x22, 0x69, 0xe2, 0x3e, 0xbb, 0xe7, 0xf8,
+        0x4a, 0x38, 0x0e, 0xa5, 0x34, 0x1d, 0x56, 0x64,
+        0x66, 0x7d, 0x81, 0xbb, 0x36, 0x25, 0x51, 0x48,
+        0x04, 0x88, 0x09, 0x90, 0x15, 0x6f, 0xaa, 0x87,
+        0x32, 0x5d, 0xea, 0xdf, 0x00, 0xc3, 0xf4, 0x11,
+        0x1e, 0xe8, 0xe3, 0x2c, 0x01, 0x96, 0xfc, 0x60,
+        0x8f, 0x85, 0xad, 0x4a, 0x7c, 0x89, 0x49, 0xfd,
+        0x68, 0x7a, 0x81, 0xd4, 0xb5, 0xe7, 0xa2, 0xfa,
+        0x2a, 0x7a, 0x91, 0xb6, 0x49, 0x29, 0x86, 0x77,
+        0x70, 0x22, 0x8b, 0xa3, 0xb2, 0x73, 0xb3, 0x20,
+        0x73, 0x7d, 0x1b, 0x9e, 0xc5, 0x17, 0xa2, 0xab,
+        0x85, 0x81, 0x68, 0x74, 0x35, 0x0f, 0x07, 0x5c,
+        0x98, 0x91, 0x94, 0x3f, 0x10, 0x85, 0x54, 0x83,
+        0xb7, 0xfc, 0x3e, 0xe3, 0x3f, 0x4c, 0x35, 0xfa,
+        0x8a, 0x7b, 0x02, 0x92, 0x09, 0x66, 0x13, 0xaa,
+        0xd5, 0xb4, 0xf5, 0x49, 0x8e, 0x7f, 0x93, 0x05,
+        0xf7, 0xbc, 0x2c, 0x52
+};
+static const uint8_t C16_CTR[] = {
+        0x37, 0x6b, 0xe3, 0x7e, 0xd5, 0x8b, 0x65, 0x16,
+        0x4c, 0x27, 0xf6, 0xf8, 0xde, 0x7b, 0xb5, 0xbd,
+        0x72, 0x07, 0x9f, 0x6b, 0x9c, 0xf0, 0x92, 0x39,
+        0x0f, 0x02, 0x56, 0xf8, 0x32, 0xa1, 0xa9, 0x1a,
+        0x5d, 0x8f, 0xe1, 0x08, 0x51, 0xe1, 0x61, 0x00,
+        0x83, 0x25, 0xe2, 0x86, 0xe4, 0x8c, 0x9c, 0x36,
+        0xe9, 0x79, 0x97, 0xc1, 0x80, 0x86, 0x1c, 0xe9,
+        0xb8, 0xd9, 0x14, 0x86, 0x9e, 0x9e, 0x57, 0xd8,
+        0xef, 0x62, 0xaf, 0xd8, 0x0b, 0x60, 0xa6, 0xe7,
+        0xbf, 0x51, 0x1b, 0x07, 0xdd, 0x3e, 0x04, 0x84,
+        0xa8, 0x48, 0xa1, 0xc3, 0x87, 0xc4, 0x51, 0xdf,
+        0x9b, 0xfe, 0xbb, 0x83, 0x63, 0x58, 0xd9, 0xeb,
+        0x8c, 0x09, 0xd8, 0x75, 0x35, 0x96, 0x12, 0x51,
+        0xaf, 0x11, 0x2c, 0x35, 0x24, 0xdc, 0x5f, 0x06,
+        0x7b, 0x11, 0xd0, 0x43, 0x7c, 0xae, 0x6a, 0xb5,
+        0x09, 0xaa, 0xef, 0xda, 0x11, 0xe5, 0xee, 0xf4,
+        0x95, 0x20, 0xdb, 0x60, 0xf0, 0x3a, 0x05, 0xc2,
+        0xf4, 0x36, 0x88, 0xb1, 0xc0, 0x7e, 0x36, 0xd3,
+        0xfd, 0xb1, 0x4a, 0xac, 0xd9, 0x55, 0x0c, 0x7a,
+        0x49, 0xdf, 0x2f, 0x86, 0x5b, 0x56, 0xc3, 0xef,
+        0x58, 0xf5, 0x1e, 0xfb, 0x26, 0x29, 0x34, 0x4b,
+        0xd2, 0x23, 0x46, 0x82, 0xdd, 0x96, 0xb4, 0x9e,
+        0xa5, 0x65, 0x93, 0x38, 0xe4, 0x25, 0x46, 0xc5,
+        0xac, 0x80, 0xfc, 0xd9, 0x77, 0x83, 0x14, 0x63,
+        0xdf, 0x10, 0x9b, 0xeb, 0xc8, 0x82, 0xa3, 0xbd,
+        0xe3, 0xcf, 0xf4, 0xfa, 0x73, 0xbe, 0x1b, 0x74,
+        0x4b, 0xbb, 0x51, 0xa8, 0x46, 0x90, 0x48, 0x5b,
+        0xfd, 0x5c, 0xfc, 0x8e, 0xed, 0x9a, 0xa4, 0xa2,
+        0x53, 0xce, 0xe6, 0x63, 0x5c, 0x48, 0x41, 0x8c,
+        0xbf, 0x22, 0x8c, 0xb9, 0xc7, 0x0f, 0x9c, 0xa2,
+        0x56, 0xcf, 0xd8, 0x6c, 0x1b, 0xf6, 0x9e, 0x9e,
+        0xe9, 0x87, 0x13, 0x39, 0x5a, 0xc5, 0x2d, 0x5b,
+        0xaf, 0x4d, 0x99, 0x46, 0x79, 0x8d, 0xbe, 0xfc,
+        0x38, 0x44, 0xc7, 0xd5, 0x67, 0x26, 0x55, 0xd2,
+        0x60, 0xff, 0xdb, 0x0d, 0x58, 0x76, 0x2d, 0x1e,
+        0x49, 0x55, 0x47, 0xe4, 0x19, 0xe7, 0xee, 0xca,
+        0xc5, 0xf3, 0x0e, 0x8d, 0xd4, 0x05, 0x3f, 0x17,
+        0x5f, 0x8e, 0x26, 0xea
+};
+static const uint8_t T16_CTR[] = { 0 };
+static const uint8_t A16_CTR[] = { 0 };
+#define A16_CTR_len 0
+
+static const uint8_t K17_CTR[] = {
+        0x4e, 0x6e, 0x15, 0x8b, 0x6c, 0x8e, 0x34, 0xc2,
+        0xa1, 0xb9, 0x38, 0x48, 0x4d, 0x97, 0x99, 0xfb,
+        0x3e, 0x0f, 0x53, 0x52, 0xcd, 0x2d, 0x62, 0x29,
+        0xb7, 0xce, 0xfc, 0x4d, 0xbc, 0x11, 0x91, 0xc7
+};
+static const uint8_t IV17_CTR[] = {
+        0xfa, 0x7d, 0x83, 0xe9, 0x06, 0xf2, 0xa5, 0x1a,
+        0xcf, 0x51, 0x75, 0x61, 0x00, 0x00, 0x00, 0xb2
+};
+static const uint8_t P17_CTR[] = {
+        0x5f, 0xaa, 0x1c, 0xfc, 0xe7, 0x01, 0xe5, 0xee,
+        0xa9, 0x95, 0xfb, 0x8d, 0x61, 0xa8, 0xfb, 0x77,
+        0x0c, 0x4a, 0x54, 0xf4, 0xfe, 0x3e, 0xc9, 0xc2,
+        0xc2, 0xad, 0xa4, 0x9d, 0xb5, 0x8d, 0xbb, 0x90,
+        0x61, 0xcf, 0x24, 0xfe, 0x9a, 0x4b, 0xb7, 0x6f,
+        0x5b, 0x6c, 0x48, 0x1c, 0x5e, 0x9b, 0xa1, 0x39,
+        0x7d, 0x6c, 0x42, 0x04, 0xcb, 0x8b, 0xd8, 0x92,
+        0x71, 0x64, 0x7e, 0x54, 0x4a, 0x95, 0xb5, 0x6c,
+        0x3e, 0x15, 0x24, 0xb2, 0x5f, 0x21, 0x11, 0x84,
+        0xc5, 0xea, 0x9b, 0x51, 0x2a, 0x00, 0xbd, 0xe5,
+        0x44, 0x7c, 0x03, 0x72, 0xe6, 0xf0, 0x09, 0x62,
+        0xd5, 0x10, 0xb9, 0xde, 0x6b, 0x1d, 0x40, 0x1e,
+        0xee, 0x15, 0xd5, 0x6f, 0xae, 0x9c, 0x29, 0x06,
+        0xe0, 0xa8, 0xac, 0x86, 0x3d, 0xf0, 0x86, 0x53,
+        0x5a, 0x12, 0x50, 0x94, 0xc6, 0x87, 0x96, 0x0a,
+        0xe5, 0x47, 0x0e, 0x94, 0x8f, 0x3b, 0x95, 0x7e,
+        0x68, 0x67, 0xed, 0x8d, 0xfd, 0xd3, 0x38, 0xcb,
+        0xa3, 0x3e, 0x33, 0x13, 0x10, 0x82, 0x34, 0x5b,
+        0xb6, 0xc6, 0xe2, 0xc4, 0xe3, 0x65, 0xb6, 0x63,
+        0x9a, 0xa1, 0x35, 0xcd, 0x2f, 0x08, 0xea, 0x64,
+        0xa4, 0xa2, 0x25, 0x64, 0xc6, 0xe0, 0x76, 0xad,
+        0x07, 0x44, 0xe8, 0x4e, 0x1a, 0xcf, 0xfe, 0xd5,
+        0x51, 0x2f, 0x6f, 0x59, 0xb6, 0xa5, 0xa0, 0x44,
+        0xeb, 0xb8, 0xe5, 0xe1, 0xc2, 0x9b, 0x78, 0xa9,
+        0x9b, 0x5f, 0x35, 0x4d, 0x81, 0xd9, 0x1b, 0x83,
+        0x03, 0x51, 0x83, 0x91, 0xd4, 0xef, 0x1e, 0x9a,
+        0x22, 0xe6, 0xb0, 0xab, 0xb6, 0x5d, 0x8e, 0x85,
+        0xd0, 0x22, 0xd8, 0x28, 0xc0, 0x0d, 0x77, 0x24,
+        0x44, 0x36, 0xd5, 0x9f, 0xa5, 0xd6, 0x5f, 0x25,
+        0x90, 0xfe, 0xbc, 0x32, 0xb5, 0xfa, 0xca, 0x81,
+        0x21, 0x82, 0x5d, 0x13, 0x5c, 0xa6, 0xb6, 0xfe,
+        0x42, 0x77, 0xc5, 0xfa, 0xa2, 0x76, 0x1f, 0xad,
+        0x98, 0xbe, 0xbd, 0xb2, 0xab, 0xf0, 0x7a, 0x6b,
+        0xa5, 0xe2, 0x4b, 0x8b, 0x36, 0x07, 0x3c, 0x62,
+        0x47, 0x9c, 0x2e, 0xe7, 0x1f, 0x98, 0x52, 0x87,
+        0x38, 0x51, 0x64, 0xb0, 0xdf, 0xee, 0xa8, 0x1c,
+        0x8e, 0x90, 0xa5, 0xde, 0x09, 0x3f, 0xa4, 0x2d,
+        0x3b, 0x96, 0xe7, 0xf4, 0xce, 0x2f, 0xaa, 0x15,
+        0x8c, 0xcc, 0xdb, 0x81, 0x78, 0x4a, 0x98, 0xf9,
+        0xab, 0x46, 0x6c, 0xa1, 0xf0, 0x8c, 0x49, 0x49,
+        0x1f, 0x44, 0x45, 0x7b, 0x3a, 0xdb, 0x15, 0x44,
+        0x49, 0xb2, 0x4a, 0xc3, 0xf5, 0x89, 0x4d, 0x73,
+        0xe7, 0xaa, 0x1b, 0x38, 0xde, 0xd5, 0xc1, 0x2a,
+        0x92, 0xef, 0x97, 0x25, 0x4c, 0x69, 0x3c, 0x0d,
+        0x42, 0x71, 0x55, 0xe2, 0xb4, 0xdb, 0x05, 0x87,
+        0xc7, 0xce, 0x2a, 0x51, 0x24, 0x2f, 0x5d, 0x52,
+        0x50, 0xcd, 0xa8, 0x64, 0xca, 0x51, 0x06, 0xf4,
+        0xe6, 0xe3, 0x9b, 0x94, 0x6c, 0x9d, 0xb8, 0x3e,
+        0xef, 0xb0, 0x8d, 0x69, 0xef, 0x58, 0xab, 0xce,
+        0xae, 0x81, 0x41, 0xf7, 0xd2, 0x37, 0x13, 0x8c,
+        0xc0, 0xce, 0x39, 0x5d, 0xb2, 0xd5, 0x9d, 0x2e,
+        0x9e, 0xbb, 0x32, 0x46, 0xc7, 0x3f, 0xf4, 0xb6,
+        0x1f, 0x99, 0xa4, 0x6a, 0x63, 0x6a, 0x41, 0xf1,
+        0xf5, 0x64, 0x45, 0x0c, 0x78, 0xb9, 0xa5, 0xf8,
+        0x2e, 0x45, 0x86, 0x7b, 0x11, 0x7a, 0xbf, 0xb1,
+        0xb2, 0x0f, 0x12, 0x94, 0xd5, 0x68, 0x2a, 0x4c,
+        0xca, 0xc4, 0x54, 0x3c, 0x8a, 0x29, 0xfd, 0xc8,
+        0x95, 0x0f, 0xf0, 0xe8, 0x8d, 0xcf, 0x4c, 0x6e,
+        0x92, 0xc9, 0x46, 0x17, 0x5d, 0x58, 0xa4, 0x53,
+        0x1b, 0x77, 0xf5, 0xd4, 0x0f, 0x30, 0x91, 0xd9,
+        0xe6, 0xc8, 0x53, 0x37, 0xd9, 0xac, 0x19, 0x2c,
+        0x85, 0x19, 0xf8, 0xe3, 0x8a, 0x8f, 0x40, 0xc7,
+        0xe5, 0xf3, 0x33, 0x88, 0x0e, 0x87, 0x84, 0xee,
+        0xd1, 0x8a, 0x91, 0x60, 0xed, 0xae, 0x60, 0x33,
+        0x6e, 0x3e, 0x5b, 0xb4, 0xca, 0x0c, 0xcb, 0xf4,
+        0xbe, 0x1b, 0x16, 0x56, 0xe6, 0x11, 0xb9
+};
+static const uint8_t C17_CTR[] = {
+        0x46, 0x5d, 0x5c, 0x96, 0x6c, 0xd2, 0x8f, 0xe5,
+        0x0d, 0x30, 0x0b, 0x8c, 0xb7, 0x68, 0xc3, 0x6c,
+        0x76, 0x0c, 0x0f, 0x9b, 0xf7, 0x02, 0x54, 0xbc,
+        0x93, 0x2c, 0x25, 0x7e, 0x72, 0xd3, 0x62, 0x2b,
+        0x1f, 0x0d, 0xf8, 0x75, 0xd5, 0x32, 0x17, 0x14,
+        0x90, 0x7e, 0x43, 0x3b, 0x62, 0x33, 0x85, 0x7c,
+        0x6e, 0x29, 0x95, 0x50, 0xbb, 0x20, 0x08, 0xe7,
+        0x30, 0xf9, 0xac, 0x7c, 0x71, 0xd5, 0x52, 0xf1,
+        0xb3, 0x85, 0x07, 0x53, 0x11, 0xc4, 0x74, 0x2d,
+        0x51, 0x87, 0xf1, 0xff, 0xa9, 0x84, 0x45, 0x00,
+        0xe6, 0x7e, 0x93, 0xb2, 0x18, 0x34, 0x76, 0x3e,
+        0xfd, 0x74, 0xa8, 0x4d, 0x05, 0xb5, 0xb7, 0xce,
+        0xf2, 0xb6, 0x8c, 0xba, 0xc6, 0x30, 0xc4, 0xe2,
+        0xa4, 0x93, 0x3c, 0x1b, 0x06, 0x23, 0x00, 0x3a,
+        0x88, 0x96, 0xf2, 0x4e, 0x84, 0x1c, 0xea, 0x98,
+        0x81, 0x1f, 0xfd, 0x3d, 0xc8, 0xc2, 0x19, 0xff,
+        0x2d, 0x9b, 0x51, 0x68, 0x1f, 0xed, 0xaf, 0x2f,
+        0xe8, 0x97, 0x7e, 0x3a, 0x9a, 0x53, 0x73, 0x48,
+        0x49, 0x85, 0x84, 0xed, 0x5e, 0xe9, 0x9e, 0x2a,
+        0x49, 0x77, 0x01, 0xe6, 0x21, 0xa7, 0x19, 0x91,
+        0x12, 0x6c, 0xad, 0xc3, 0x15, 0x31, 0x28, 0x2a,
+        0xc8, 0xf7, 0x1a, 0x65, 0xe5, 0xdc, 0xf2, 0xd3,
+        0x28, 0x34, 0x0c, 0x2f, 0x87, 0xf8, 0xda, 0x67,
+        0xdc, 0x5c, 0x78, 0x67, 0x87, 0xe3, 0x09, 0x1f,
+        0xbf, 0x9c, 0xd7, 0x47, 0x56, 0x55, 0x51, 0xb6,
+        0x70, 0xdf, 0x38, 0xc1, 0xd5, 0x20, 0xa0, 0xf8,
+        0xf5, 0x62, 0x4f, 0xca, 0x49, 0x62, 0xf0, 0x9e,
+        0xae, 0xb3, 0x44, 0x6d, 0x3f, 0x41, 0xb2, 0x4e,
+        0xa9, 0x57, 0xfc, 0xe4, 0xaf, 0x3c, 0x9e, 0x72,
+        0xa0, 0xb7, 0xcc, 0x87, 0x4d, 0x45, 0x84, 0xe5,
+        0x05, 0x77, 0x34, 0x06, 0xb4, 0x4b, 0x53, 0xf5,
+        0xb1, 0x9f, 0x56, 0x00, 0xd1, 0xfd, 0xf9, 0x60,
+        0xee, 0xa8, 0x5d, 0x82, 0x39, 0x5e, 0xc5, 0x67,
+        0xb7, 0x30, 0xcb, 0x12, 0xca, 0xf0, 0x25, 0x2c,
+        0x80, 0x97, 0x1d, 0x50, 0xcc, 0xb1, 0x55, 0xab,
+        0x2c, 0x6e, 0x76, 0x86, 0x2d, 0x57, 0x7b, 0x63,
+        0xcb, 0xdb, 0x0d, 0x70, 0x90, 0x8a, 0xed, 0xaf,
+        0x92, 0x8b, 0x9c, 0x8a, 0x6f, 0x1d, 0x07, 0x05,
+        0xa3, 0x41, 0x1c, 0x89, 0x77, 0xd9, 0x2c, 0x5f,
+        0xe7, 0x73, 0x02, 0xa1, 0xdf, 0x3c, 0xe2, 0x4a,
+        0xd8, 0x4f, 0x41, 0x7c, 0x3c, 0xb8, 0xea, 0x78,
+        0xbe, 0x62, 0x54, 0xc6, 0x15, 0xd4, 0x4b, 0xd0,
+        0x67, 0xcc, 0x57, 0x3f, 0x95, 0x04, 0x20, 0xa2,
+        0xa5, 0x40, 0xc0, 0x64, 0x1c, 0x07, 0x63, 0xa1,
+        0xcd, 0xa5, 0x74, 0x5d, 0xad, 0x17, 0x30, 0xc4,
+        0xa4, 0xa1, 0xd3, 0x82, 0xe9, 0xa8, 0x8b, 0xc2,
+        0x4e, 0x98, 0x3b, 0xa0, 0x04, 0x7c, 0xb4, 0x2d,
+        0xf1, 0x06, 0xe6, 0x51, 0xf7, 0x4e, 0x38, 0x74,
+        0xb3, 0xe9, 0x70, 0x87, 0x13, 0x58, 0x8c, 0xe0,
+        0x32, 0x88, 0x1e, 0x56, 0xa7, 0x19, 0xe3, 0x54,
+        0xf7, 0xd1, 0x6b, 0x4d, 0xa3, 0xfe, 0x9d, 0x1a,
+        0xab, 0xda, 0x9f, 0xd2, 0x8e, 0x36, 0x5a, 0x42,
+        0xae, 0xa8, 0x27, 0x6f, 0x94, 0xbd, 0x5f, 0x4f,
+        0xe7, 0x5b, 0x0a, 0x8c, 0x1c, 0x17, 0x27, 0xf4,
+        0xea, 0xd9, 0xb0, 0x06, 0x39, 0xa7, 0x1a, 0xda,
+        0x29, 0x1a, 0x6f, 0xfc, 0x11, 0xcb, 0x95, 0x1f,
+        0xfb, 0xea, 0x42, 0xf2, 0x3a, 0xe1, 0x4b, 0x83,
+        0x72, 0x72, 0xe6, 0x25, 0x0b, 0x45, 0xb4, 0x0b,
+        0xa1, 0xee, 0x21, 0x84, 0x39, 0x43, 0x39, 0xc5,
+        0xfa, 0x07, 0xe2, 0xd4, 0x7b, 0x5e, 0x06, 0xde,
+        0x4d, 0x12, 0x9d, 0x33, 0xd6, 0x4d, 0xc8, 0x0a,
+        0x12, 0x41, 0xe1, 0x9a, 0x25, 0xb9, 0x94, 0x21,
+        0x62, 0x7c, 0x94, 0xdd, 0x7d, 0x54, 0x40, 0xdd,
+        0x03, 0x00, 0xf1, 0xbf, 0xc6, 0x7a, 0xb4, 0xd0,
+        0x2b, 0x7f, 0xe9, 0xbd, 0x0a, 0x49, 0x9f, 0x9e,
+        0x2c, 0xc2, 0x42, 0x68, 0x08, 0x5c, 0x93
+};
+static const uint8_t T17_CTR[] = { 0 };
+static const uint8_t A17_CTR[] = { 0 };
+#define A17_CTR_len 0
+
 #define bit_vector(N)                                                 \
         {K##N, (KBITS(K##N)), IV##N, sizeof(IV##N), A##N, A##N##_len, \
                         P##N, P##N##_len, C##N, T##N, sizeof(T##N)}
@@ -1334,7 +1583,9 @@ static const struct gcm_ctr_vector ctr_vectors[] = {
 	vector(12_CTR),
 	vector(13_CTR),
 	vector(14_CTR),
-	vector(15_CTR)
+	vector(15_CTR),
+	vector(16_CTR),
+	vector(17_CTR)
 };
 
 static const struct gcm_ctr_vector ctr_bit_vectors[] = {
@@ -533,6 +533,214 @@ test_des_vectors(struct IMB_MGR *mb_mgr,
 	printf("\n");
 }
 
+/*
+ * Mixed vector sets for multi-lane tests: each lane of a burst picks
+ * a different vector, so keys, IVs and lengths differ across lanes.
+ * DES-CBC vectors are also valid DOCSIS-DES vectors (full blocks only),
+ * which mixes the DOCSIS partial block cases with other keys.
+ */
+static struct des3_vector des_mixed_vectors[] = {
+        { K1, K1, K1, IV1, P1, sizeof(P1), C1 },
+        { K2, K2, K2, IV2, P2, sizeof(P2), C2 },
+};
+
+static struct des3_vector docsis_mixed_vectors[] = {
+        { DK2, DK2, DK2, DIV2, DP2, sizeof(DP2), DC2 },
+        { K1, K1, K1, IV1, P1, sizeof(P1), C1 },
+        { DK3, DK3, DK3, DIV3, DP3, sizeof(DP3), DC3 },
+        { K2, K2, K2, IV2, P2, sizeof(P2), C2 },
+        { DK1, DK1, DK1, DIV1, DP1, sizeof(DP1), DC1 },
+};
+
+static struct des3_vector des3_mixed_vectors[] = {
+        { D3K1_1, D3K2_1, D3K3_1, D3IV_1, D3PT_1, D3PT_LEN_1, D3CT_1 },
+        { K2, K2, K2, IV2, P2, sizeof(P2), C2 },
+        { D3K1_2, D3K2_2, D3K3_2, D3IV_2, D3PT_2, D3PT_LEN_2, D3CT_2 },
+        { D3K1_3, D3K2_3, D3K3_3, D3IV_3, D3PT_3, D3PT_LEN_3, D3CT_3 },
+        { K1, K1, K1, IV1, P1, sizeof(P1), C1 },
+        { D3K1_4, D3K2_4, D3K3_4, D3IV_4, D3PT_4, D3PT_LEN_4, D3CT_4 },
+};
+
+static int
+test_des_mixed_check(const struct IMB_JOB *job,
+                     const struct des3_vector *vec_tab,
+                     const int vec_cnt,
+                     uint8_t **targets,
+                     const uint8_t *padding,
+                     const size_t pad_len,
+                     const int dir)
+{
+        const int num = (const int)((uint64_t)job->user_data);
+        const struct des3_vector *v = &vec_tab[num % vec_cnt];
+        const uint8_t *out_text = (dir == IMB_DIR_ENCRYPT) ? v->C : v->P;
+
+        if (job->status != IMB_STATUS_COMPLETED) {
+                printf("%d error status:%d, job %d",
+                       __LINE__, job->status, num);
+                return -1;
+        }
+        if (memcmp(out_text, targets[num] + pad_len, v->Plen)) {
+                printf("%d mismatched\n", num);
+                return -1;
+        }
+        if (memcmp(padding, targets[num], pad_len)) {
+                printf("%d overwrite head\n", num);
+                return -1;
+        }
+        if (memcmp(padding, targets[num] + pad_len + v->Plen, pad_len)) {
+                printf("%d overwrite tail\n", num);
+                return -1;
+        }
+        return 0;
+}
+
+/*
+ * Submits num_jobs jobs where job i uses vector (i % vec_cnt), so that
+ * the lanes of the DES OOO manager hold different keys and lengths.
+ */
+static int
+test_des_mixed(struct IMB_MGR *mb_mgr,
+               const int vec_cnt,
+               const struct des3_vector *vec_tab,
+               const IMB_CIPHER_MODE cipher,
+               const int dir,
+               const int num_jobs)
+{
+        uint64_t (*ks)[3][16] = malloc(vec_cnt * sizeof(*ks));
+        const void *(*ks_ptr)[3] = malloc(vec_cnt * sizeof(*ks_ptr));
+        uint8_t **targets = malloc(num_jobs * sizeof(void *));
+        struct IMB_JOB *job;
+        uint8_t padding[16];
+        int i, jobs_rx = 0, ret = -1;
+
+        assert(ks != NULL);
+        assert(ks_ptr != NULL);
+        assert(targets != NULL);
+
+        memset(padding, -1, sizeof(padding));
+
+        for (i = 0; i < vec_cnt; i++) {
+                des_key_schedule(ks[i][0], vec_tab[i].K1);
+                des_key_schedule(ks[i][1], vec_tab[i].K2);
+                des_key_schedule(ks[i][2], vec_tab[i].K3);
+                ks_ptr[i][0] = ks[i][0];
+                ks_ptr[i][1] = ks[i][1];
+                ks_ptr[i][2] = ks[i][2];
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const size_t len = vec_tab[i % vec_cnt].Plen +
+                        (sizeof(padding) * 2);
+
+                targets[i] = malloc(len);
+                memset(targets[i], -1, len);
+        }
+
+        /* flush the scheduler */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                const int v = i % vec_cnt;
+
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+                job->cipher_direction = dir;
+                job->chain_order = (dir == IMB_DIR_ENCRYPT) ?
+                        IMB_ORDER_CIPHER_HASH : IMB_ORDER_HASH_CIPHER;
+                job->dst = targets[i] + sizeof(padding);
+                job->src = (dir == IMB_DIR_ENCRYPT) ?
+                        vec_tab[v].P : vec_tab[v].C;
+                job->cipher_mode = cipher;
+                if (cipher == IMB_CIPHER_DES3) {
+                        job->enc_keys = (const void *) ks_ptr[v];
+                        job->dec_keys = (const void *) ks_ptr[v];
+                        job->key_len_in_bytes = 24;
+                } else {
+                        job->enc_keys = ks[v][0];
+                        job->dec_keys = ks[v][0];
+                        job->key_len_in_bytes = 8;
+                }
+                job->iv = vec_tab[v].IV;
+                job->iv_len_in_bytes = 8;
+                job->cipher_start_src_offset_in_bytes = 0;
+                job->msg_len_to_cipher_in_bytes = vec_tab[v].Plen;
+                job->user_data = (void *)((uint64_t)i);
+
+                job->hash_alg = IMB_AUTH_NULL;
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                if (job != NULL) {
+                        jobs_rx++;
+                        if (test_des_mixed_check(job, vec_tab, vec_cnt,
+                                                 targets, padding,
+                                                 sizeof(padding), dir))
+                                goto end;
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                jobs_rx++;
+                if (test_des_mixed_check(job, vec_tab, vec_cnt, targets,
+                                         padding, sizeof(padding), dir))
+                        goto end;
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
+        ret = 0;
+
+ end:
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++)
+                free(targets[i]);
+        free(targets);
+        free(ks_ptr);
+        free(ks);
+        return ret;
+}
+
+static void
+test_des_mixed_vectors(struct IMB_MGR *mb_mgr,
+                       const int vec_cnt,
+                       const struct des3_vector *vec_tab,
+                       const char *banner,
+                       const IMB_CIPHER_MODE cipher,
+                       struct test_suite_context *ctx)
+{
+        /* 4 lanes (SSE), 8 lanes (AVX/AVX2) and more than 16 lanes */
+        static const int num_jobs_tab[] = { 4, 8, 17 };
+        unsigned i;
+
+        printf("%s:\n", banner);
+        for (i = 0; i < DIM(num_jobs_tab); i++) {
+#ifdef DEBUG
+                printf("Mixed vectors, %d jobs\n", num_jobs_tab[i]);
+#else
+                printf(".");
+#endif
+                if (test_des_mixed(mb_mgr, vec_cnt, vec_tab, cipher,
+                                   IMB_DIR_ENCRYPT, num_jobs_tab[i])) {
+                        printf("error %d jobs encrypt\n", num_jobs_tab[i]);
+                        test_suite_update(ctx, 0, 1);
+                } else {
+                        test_suite_update(ctx, 1, 0);
+                }
+
+                if (test_des_mixed(mb_mgr, vec_cnt, vec_tab, cipher,
+                                   IMB_DIR_DECRYPT, num_jobs_tab[i])) {
+                        printf("error %d jobs decrypt\n", num_jobs_tab[i]);
+                        test_suite_update(ctx, 0, 1);
+                } else {
+                        test_suite_update(ctx, 1, 0);
+                }
+        }
+        printf("\n");
+}
+
 static void
 test_des3_vectors(struct IMB_MGR *mb_mgr,
                   const int vec_cnt,
@@ -618,12 +826,20 @@ des_test(struct IMB_MGR *mb_mgr)
         test_suite_start(&ctx, "DES-CBC-64");
         test_des_vectors(mb_mgr, DIM(vectors), vectors,
                          "DES standard test vectors", IMB_CIPHER_DES, &ctx);
+        test_des_mixed_vectors(mb_mgr, DIM(des_mixed_vectors),
+                               des_mixed_vectors,
+                               "DES multi-lane mixed vectors",
+                               IMB_CIPHER_DES, &ctx);
         errors = test_suite_end(&ctx);
 
         test_suite_start(&ctx, "DOCSIS-DES-64");
         test_des_vectors(mb_mgr, DIM(docsis_vectors), docsis_vectors,
                          "DOCSIS DES standard test vectors",
                          IMB_CIPHER_DOCSIS_DES, &ctx);
+        test_des_mixed_vectors(mb_mgr, DIM(docsis_mixed_vectors),
+                               docsis_mixed_vectors,
+                               "DOCSIS DES multi-lane mixed vectors",
+                               IMB_CIPHER_DOCSIS_DES, &ctx);
         errors += test_suite_end(&ctx);
 
         test_suite_start(&ctx, "3DES-CBC-192");
@@ -632,6 +848,10 @@ des_test(struct IMB_MGR *mb_mgr)
                          IMB_CIPHER_DES3, &ctx);
         test_des3_vectors(mb_mgr, DIM(des3_vectors), des3_vectors,
                           "3DES (multiple keys) test vectors", &ctx);
+        test_des_mixed_vectors(mb_mgr, DIM(des3_mixed_vectors),
+                               des3_mixed_vectors,
+                               "3DES multi-lane mixed vectors",
+                               IMB_CIPHER_DES3, &ctx);
         errors += test_suite_end(&ctx);
 
 	return errors;
@@ -704,6 +704,83 @@ test_ecb_many(struct IMB_MGR *mb_mgr,
         return ret;
 }
 
+static int
+test_ecb_many_burst(struct IMB_MGR *mb_mgr,
+                    void *enc_keys,
+                    void *dec_keys,
+                    const uint8_t *in_text,
+                    const uint8_t *out_text,
+                    const unsigned text_len,
+                    const int dir,
+                    const IMB_CIPHER_MODE cipher,
+                    const int in_place,
+                    const int key_len,
+                    const int num_jobs)
+{
+        struct IMB_JOB *job, jobs[24];
+        uint8_t padding[16];
+        uint8_t **targets = malloc(num_jobs * sizeof(void *));
+        int i, completed_jobs, ret = -1;
+
+        assert(targets != NULL);
+        assert(num_jobs <= (int) DIM(jobs));
+
+        memset(padding, -1, sizeof(padding));
+
+        for (i = 0; i < num_jobs; i++) {
+                targets[i] = malloc(text_len + (sizeof(padding) * 2));
+                memset(targets[i], -1, text_len + (sizeof(padding) * 2));
+                if (in_place) {
+                        /* copy input text to the allocated buffer */
+                        memcpy(targets[i] + sizeof(padding), in_text, text_len);
+                }
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+
+                if (!in_place) {
+                        job->dst = targets[i] + sizeof(padding);
+                        job->src = in_text;
+                } else {
+                        job->dst = targets[i] + sizeof(padding);
+                        job->src = targets[i] + sizeof(padding);
+                }
+                job->enc_keys = enc_keys;
+                job->dec_keys = dec_keys;
+                job->iv_len_in_bytes = 0;
+                job->cipher_start_src_offset_in_bytes = 0;
+                job->msg_len_to_cipher_in_bytes = text_len;
+                job->user_data = targets[i];
+                job->user_data2 = (void *)((uint64_t)i);
+        }
+
+        completed_jobs = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                 cipher, dir, key_len);
+        if (completed_jobs != num_jobs) {
+                const int err = imb_get_errno(mb_mgr);
+
+                printf("submit_cipher_burst error %d : '%s'\n", err,
+                       imb_get_strerror(err));
+                goto end;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+
+                if (!ecb_job_ok(job, out_text, job->user_data, padding,
+                                sizeof(padding), text_len))
+                        goto end;
+        }
+        ret = 0;
+
+ end:
+        for (i = 0; i < num_jobs; i++)
+                free(targets[i]);
+        free(targets);
+        return ret;
+}
+
 static void
 test_ecb_vectors(struct IMB_MGR *mb_mgr, const int vec_cnt,
                  const struct ecb_vector *vec_tab, const char *banner,
@@ -790,6 +867,29 @@ test_ecb_vectors(struct IMB_MGR *mb_mgr, const int vec_cnt,
                 } else {
                         test_suite_update(ctx, 1, 0);
                 }
+
+                if (test_ecb_many_burst(mb_mgr, enc_keys, dec_keys,
+                                        vec_tab[vect].P, vec_tab[vect].C,
+                                        (unsigned) vec_tab[vect].Plen,
+                                        IMB_DIR_ENCRYPT, cipher, 0,
+                                        vec_tab[vect].Klen, num_jobs)) {
+                        printf("error #%d encrypt burst\n", vect + 1);
+                        test_suite_update(ctx, 0, 1);
+                } else {
+                        test_suite_update(ctx, 1, 0);
+                }
+
+                if (test_ecb_many_burst(mb_mgr, enc_keys, dec_keys,
+                                        vec_tab[vect].C, vec_tab[vect].P,
+                                        (unsigned) vec_tab[vect].Plen,
+                                        IMB_DIR_DECRYPT, cipher, 1,
+                                        vec_tab[vect].Klen, num_jobs)) {
+                        printf("error #%d decrypt in-place burst\n",
+                               vect + 1);
+                        test_suite_update(ctx, 0, 1);
+                } else {
+                        test_suite_update(ctx, 1, 0);
+                }
 	}
 	printf("\n");
 }
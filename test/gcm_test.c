@@ -45,6 +45,11 @@
 #define MAX_KEY_SZ 32
 #define GCM_MAX_JOBS 32
 
+typedef enum {
+        BURST_TYPE_GENERIC = 0,
+        BURST_TYPE_CIPHER,
+} BURST_TYPE;
+
 /*
  * 60-Byte Packet Encryption Using GCM-AES-128
  *    http://www.ieee802.org/1/files/public/
@@ -1255,6 +1260,323 @@ static uint8_t T32[] =  {
 #define A32 NULL
 #define A32_len 0
 
+/*
+ * Test Cases 35 to 37 -- messages long enough for the 8 block parallel
+ * loops, with partial last blocks and AAD (generated with OpenSSL)
+ */
+static uint8_t K35[] = {
+        0x45, 0xad, 0x50, 0xc4, 0xa0, 0xf2, 0x17, 0xb3,
+        0xb5, 0x5c, 0xec, 0x18, 0xc6, 0xae, 0x9a, 0x85
+};
+static uint8_t IV35[] = {
+        0xbf, 0xdf, 0x79, 0x44, 0x22, 0x95, 0x33, 0x37,
+        0xb6, 0x62, 0x54, 0x70
+};
+static uint8_t A35[] = {
+        0xef, 0xc1, 0x93, 0x90, 0x1c, 0xcf, 0xe2, 0xe0,
+        0x53, 0xc9, 0x37, 0x31, 0x1c, 0x49, 0x18, 0x74
+};
+#define A35_len sizeof(A35)
+static uint8_t P35[] = {
+        0xe0, 0x40, 0xe9, 0x18, 0x10, 0xb2, 0xf5, 0x27,
+        0x15, 0x35, 0x3e, 0x1f, 0xfa, 0x27, 0x05, 0x91,
+        0xdb, 0xb2, 0x18, 0x7b, 0x0d, 0x81, 0xde, 0x66,
+        0x0a, 0x3f, 0x23, 0x40, 0x23, 0xd4, 0xa4, 0xf7,
+        0xe4, 0x5e, 0x5a, 0xd9, 0x46, 0xf1, 0x87, 0xae,
+        0x98, 0x0f, 0x81, 0x93, 0x2a, 0xe6, 0x41, 0x95,
+        0xbe, 0x4c, 0xab, 0x11, 0xaf, 0x7b, 0x9b, 0xce,
+        0xdf, 0x8c, 0xb3, 0xd7, 0x62, 0xb5, 0xe7, 0x19,
+        0xec, 0x42, 0xc5, 0xc1, 0xfa, 0x54, 0x85, 0x53,
+        0xc3, 0x5d, 0xd5, 0x8b, 0xdd, 0x57, 0x61, 0xf4,
+        0xb0, 0xc7, 0x24, 0x49, 0x9b, 0x75, 0x71, 0x8f,
+        0xe8, 0xe8, 0xc0, 0xee, 0x70, 0xa3, 0x39, 0x53,
+        0x0e, 0x22, 0x02, 0xc8, 0xc4, 0x93, 0x49, 0x8e,
+        0xaf, 0x55, 0x10, 0x00, 0xad, 0x31, 0xbb, 0x27,
+        0xc8, 0x5b, 0x5b, 0x1c, 0x69, 0x27, 0xb8, 0x21,
+        0x3d, 0x8b, 0x21, 0x7e, 0xe6, 0x58, 0xf3, 0x1d
+};
+static uint8_t C35[] = {
+        0xce, 0x70, 0x12, 0xb6, 0x3b, 0xb0, 0x22, 0x90,
+        0x76, 0xa1, 0xfa, 0x97, 0x64, 0xd4, 0x77, 0xb0,
+        0x55, 0xd5, 0x47, 0x7b, 0xc2, 0xfe, 0x7b, 0xde,
+        0x14, 0x67, 0x52, 0x3a, 0xd9, 0xb8, 0xdc, 0xdc,
+        0xfb, 0x27, 0x17, 0x80, 0xbf, 0x8a, 0x68, 0xf9,
+        0xaf, 0xac, 0xc0, 0x6e, 0x29, 0xe9, 0x1d, 0x2d,
+        0x54, 0xba, 0x41, 0x82, 0x73, 0x50, 0x14, 0x69,
+        0x22, 0x43, 0x70, 0xb2, 0xa4, 0x9c, 0xac, 0xd5,
+        0x64, 0x18, 0x12, 0x8c, 0x4c, 0x37, 0xa2, 0x7e,
+        0x55, 0x47, 0xab, 0xbd, 0xc8, 0x32, 0xe9, 0x3d,
+        0x60, 0xc4, 0xb3, 0x33, 0x64, 0x95, 0x1c, 0x87,
+        0xac, 0xc0, 0xa7, 0x11, 0xb4, 0x37, 0x60, 0xc8,
+        0x71, 0x6d, 0xac, 0x83, 0x8b, 0xe2, 0x19, 0xe1,
+        0xe7, 0xc4, 0x16, 0x74, 0xce, 0x28, 0x9b, 0xfc,
+        0xa1, 0xed, 0x7f, 0x70, 0x1c, 0x2f, 0x8d, 0x57,
+        0xb9, 0x22, 0x7f, 0xc8, 0xbf, 0x1f, 0x5f, 0xf4
+};
+static uint8_t T35[] = {
+        0x4a, 0x70, 0x3d, 0xbb, 0x20, 0x44, 0x8a, 0x54,
+        0xfe, 0x4c, 0xfe, 0xae, 0xb1, 0x27, 0x2d, 0xb9
+};
+
+static uint8_t K36[] = {
+        0x62, 0x37, 0xea, 0xe4, 0x3c, 0x66, 0x2a, 0xd6,
+        0x74, 0x30, 0x0c, 0xe9, 0x2f, 0x2e, 0xa9, 0xa5,
+        0x1f, 0x3f, 0x29, 0x81, 0xb0, 0x48, 0xc9, 0xfd
+};
+static uint8_t IV36[] = {
+        0xf8, 0xac, 0xad, 0x7e, 0x5c, 0x8a, 0x6b, 0xee,
+        0x01, 0xba, 0x53, 0x10
+};
+static uint8_t A36[] = {
+        0xf9, 0x85, 0x80, 0xa4, 0x2a, 0x26, 0xa0, 0x3e,
+        0xfe, 0x04, 0x83, 0xe6, 0xcd, 0xad, 0x64, 0x70,
+        0x0a, 0x92, 0xfa, 0x9a
+};
+#define A36_len sizeof(A36)
+static uint8_t P36[] = {
+        0x2f, 0x85, 0x3e, 0xe7, 0x69, 0xf3, 0xfb, 0x3e,
+        0x03, 0xe1, 0x17, 0x41, 0x94, 0xa7, 0xa3, 0x6f,
+        0xe9, 0x6f, 0xa4, 0xf8, 0xb0, 0x6d, 0x9f, 0x63,
+        0xe9, 0xdc, 0xe6, 0xe2, 0x0c, 0xbc, 0xa5, 0x71,
+        0xfb, 0x4d, 0xac, 0xb1, 0xa6, 0x49, 0xfa, 0x86,
+        0x80, 0xe5, 0x0d, 0x72, 0xa5, 0x86, 0xec, 0xaf,
+        0xc8, 0x43, 0xf0, 0x0f, 0xde, 0x1f, 0x56, 0x94,
+        0x8c, 0x03, 0x86, 0xcf, 0x51, 0x7d, 0x21, 0xf9,
+        0x73, 0x3b, 0xcd, 0xd2, 0xab, 0x46, 0xc0, 0x3d,
+        0x8f, 0xfe, 0x0d, 0x98, 0xc3, 0xd9, 0xb1, 0xdd,
+        0xdf, 0xdb, 0x5d, 0x7a, 0x1f, 0xd4, 0x01, 0xf0,
+        0xce, 0x5c, 0x1d, 0x2d, 0x6f, 0x8f, 0xc7, 0xaa,
+        0xb0, 0x89, 0x7a, 0x44, 0x0f, 0xa0, 0xa5, 0xdc,
+        0x49, 0x64, 0xf0, 0xad, 0x87, 0x57, 0x4c, 0x70,
+        0x48, 0x6c, 0xc1, 0x31, 0x0d, 0x42, 0xf7, 0xef,
+        0xc6, 0x1d, 0x81, 0xf7, 0xff, 0xa8, 0xed, 0xfd,
+        0xca, 0x6d, 0x8c, 0xff, 0x6b, 0x10, 0x02, 0xda,
+        0xc6, 0x4f, 0x8c, 0xa9, 0x89, 0xba, 0x14, 0xe1,
+        0x19, 0x31, 0xf6, 0x2d, 0x3d, 0x22, 0x90, 0x0a,
+        0x8d, 0x80, 0x8c, 0x22, 0x99, 0x82, 0xed, 0x6a,
+        0xd8, 0x20, 0xda, 0xfa, 0x57, 0x4e, 0x2d, 0xaf,
+        0x1d, 0xf7, 0xbb, 0x82, 0x61, 0xb8, 0x61, 0xa7,
+        0x6b, 0x61, 0xd3, 0x65, 0x4a, 0x2c, 0x24, 0xb8,
+        0x3b, 0xbb, 0x15, 0xa8, 0xd4, 0xd3, 0x1d, 0x67,
+        0xf3, 0xdb, 0x3c, 0x2e, 0x6a, 0x12, 0x80, 0xd4,
+        0x68, 0x93, 0x54, 0x33, 0xa6, 0x0a, 0x8c, 0x3a,
+        0x55, 0x34, 0x30, 0xd2, 0xca, 0x18, 0x0c, 0x72,
+        0xe7, 0x07, 0xf4, 0x81, 0x49, 0x55, 0xd7, 0x6f,
+        0x33, 0xd4, 0x8b, 0x91, 0x3d, 0x14, 0x52, 0xc1,
+        0xbc, 0x5d, 0x2f, 0xb2, 0xf0, 0x69, 0xeb, 0x13,
+        0xf1, 0xe2, 0xe6, 0x6b, 0x56, 0x9e, 0x9e, 0xaf,
+        0xaa, 0x9c, 0x01, 0xa4, 0x8f, 0xbe, 0x72, 0xf7,
+        0xb0, 0x44, 0x9d, 0x1e, 0x68, 0x0c, 0xfb, 0xec,
+        0x34, 0x8c, 0x24, 0xf7, 0xd9, 0x8b, 0xd8, 0xaa,
+        0x54, 0xa2, 0xcb, 0x29, 0x86, 0x76, 0x34, 0xe8,
+        0x9c, 0xb2, 0x14, 0x09, 0x40, 0xc7, 0x47, 0x7a,
+        0x81, 0x63, 0x4c, 0xcb, 0x83, 0xb2, 0xd4, 0xd0,
+        0xe6, 0x57, 0x0c, 0xfa
+};
+static uint8_t C36[] = {
+        0x5a, 0x55, 0x2a, 0x9c, 0x81, 0x7e, 0x88, 0x18,
+        0x4b, 0x37, 0x44, 0xf1, 0xfd, 0xa1, 0xec, 0xbe,
+        0xdf, 0x66, 0xb1, 0x06, 0xaf, 0x5b, 0x86, 0x3a,
+        0x7f, 0x48, 0xc5, 0x39, 0x99, 0x2a, 0xcb, 0x89,
+        0x8f, 0xfc, 0x21, 0xc8, 0x2c, 0xd0, 0xc5, 0x13,
+        0x0e, 0xcd, 0x61, 0xd3, 0x29, 0xac, 0x19, 0x89,
+        0xc9, 0xd4, 0x0e, 0x88, 0x64, 0x9b, 0x22, 0x54,
+        0x77, 0xd8, 0xfd, 0x36, 0xc8, 0x96, 0x26, 0xc4,
+        0x90, 0x2a, 0xee, 0x9c, 0x11, 0x57, 0x1f, 0xa2,
+        0x20, 0xd7, 0x99, 0xde, 0x4b, 0x61, 0xd0, 0xbc,
+        0xdb, 0x85, 0x32, 0x96, 0xae, 0xbd, 0x7a, 0xbb,
+        0x79, 0x6f, 0x11, 0x07, 0x85, 0xfa, 0xf4, 0xc1,
+        0x49, 0xb3, 0x17, 0x17, 0xa6, 0x65, 0xdd, 0xd6,
+        0xaa, 0x70, 0x28, 0x4b, 0xf4, 0x02, 0x6e, 0x7c,
+        0x79, 0x0f, 0xa3, 0x4a, 0xbb, 0x91, 0x7e, 0xd0,
+        0x23, 0xba, 0x1c, 0x07, 0x07, 0xe7, 0x6a, 0xd4,
+        0x6a, 0x5e, 0xc3, 0xc0, 0x44, 0xd1, 0x18, 0x20,
+        0x2c, 0x8a, 0xee, 0xf5, 0x76, 0xea, 0x3c, 0xaa,
+        0x80, 0xcc, 0x64, 0xc5, 0xdb, 0xc8, 0x36, 0x9f,
+        0xbd, 0x7d, 0x14, 0x00, 0x3f, 0x58, 0x13, 0x8b,
+        0x0f, 0xa1, 0x3c, 0xfc, 0x6b, 0xf0, 0x51, 0x0f,
+        0xa0, 0xbf, 0x6e, 0xaf, 0xb4, 0x64, 0x42, 0x3f,
+        0xbc, 0x64, 0x85, 0xb6, 0x24, 0xdd, 0x8f, 0x0a,
+        0x2f, 0x4f, 0xf2, 0x97, 0x31, 0x9a, 0x24, 0x65,
+        0x3d, 0x85, 0x69, 0x49, 0x24, 0x00, 0x2c, 0x90,
+        0x71, 0x03, 0xb1, 0xec, 0x8a, 0xad, 0xf7, 0x06,
+        0xac, 0x95, 0xad, 0x04, 0x30, 0x43, 0xde, 0xb7,
+        0x6a, 0x0f, 0x48, 0x31, 0xd8, 0x5d, 0xf2, 0x56,
+        0x47, 0x2f, 0x51, 0x64, 0x48, 0x27, 0xe5, 0xf9,
+        0xbb, 0x39, 0xe7, 0x07, 0xdb, 0x13, 0x9e, 0x80,
+        0x9e, 0x13, 0x86, 0x79, 0xb6, 0x26, 0x55, 0x37,
+        0x5d, 0xf7, 0x2e, 0x7b, 0xc8, 0x5d, 0xa5, 0x24,
+        0xe2, 0xbf, 0xa3, 0x9b, 0x4d, 0x6a, 0x7a, 0xf2,
+        0x7b, 0x44, 0xe6, 0x84, 0xba, 0x92, 0x5d, 0x89,
+        0xf0, 0x46, 0x0a, 0xa2, 0x0d, 0x75, 0xaa, 0x35,
+        0x6e, 0xe5, 0xda, 0x52, 0xbc, 0x78, 0xaa, 0x35,
+        0xe0, 0xd9, 0x2d, 0x61, 0x67, 0xda, 0x8f, 0xc0,
+        0x5a, 0xe0, 0x7a, 0x4f
+};
+static uint8_t T36[] = {
+        0xce, 0x2f, 0xb0, 0x27, 0x9d, 0x8c, 0xab, 0x0f,
+        0x1b, 0x09, 0xbb, 0x5d, 0x39, 0xa3, 0x79, 0x85
+};
+
+static uint8_t K37[] = {
+        0xf7, 0x29, 0xaa, 0x76, 0x99, 0xae, 0xb9, 0x03,
+        0xf1, 0x58, 0x25, 0x94, 0xd5, 0x82, 0x06, 0xa9,
+        0xf2, 0x28, 0xac, 0x6d, 0xbf, 0x69, 0x6f, 0x90,
+        0x25, 0xbe, 0x33, 0xe2, 0xeb, 0xf8, 0xbd, 0xb4
+};
+static uint8_t IV37[] = {
+        0xe3, 0xfb, 0xb9, 0xef, 0xd6, 0x3c, 0x87, 0xf1,
+        0x30, 0xfc, 0xc9, 0x2b
+};
+static uint8_t A37[] = {
+        0x6c, 0x41, 0xae, 0x7b, 0x3d, 0x99, 0xfb, 0x4a,
+        0x82, 0x8e, 0xde, 0x65, 0xe7, 0xe8, 0x72, 0x9d,
+        0x5a, 0xa5, 0x11, 0x1d, 0x34, 0xb9, 0x5d, 0x8e,
+        0x24, 0x86, 0x0d, 0xec, 0xdb, 0x1a, 0x79, 0x26,
+        0x7a, 0x2a, 0xe4
+};
+#define A37_len sizeof(A37)
+static uint8_t P37[] = {
+        0x78, 0xbb, 0xd2, 0x8b, 0x89, 0xe1, 0x0a, 0x71,
+        0x43, 0x60, 0xe8, 0xe8, 0x76, 0x4d, 0x98, 0xdf,
+        0x2c, 0x84, 0x1b, 0xef, 0xca, 0x9b, 0xc2, 0x24,
+        0xeb, 0x89, 0x69, 0x8b, 0xfc, 0x16, 0x74, 0x80,
+        0x97, 0x02, 0x8b, 0xb4, 0xa1, 0xf5, 0x15, 0x00,
+        0x22, 0x2a, 0x75, 0xed, 0xe7, 0xd9, 0x07, 0x00,
+        0xd9, 0x69, 0xd9, 0xc6, 0x1c, 0x52, 0x2a, 0xa2,
+        0xe7, 0xd4, 0xa3, 0x59, 0x26, 0x59, 0x57, 0x5a,
+        0xd1, 0xab, 0x7c, 0xce, 0x0a, 0xd6, 0xe7, 0x64,
+        0xf9, 0xdb, 0x49, 0xda, 0x68, 0x19, 0x2b, 0x4a,
+        0x1d, 0x7b, 0xab, 0x3a, 0xfb, 0x62, 0xf4, 0x61,
+        0xd7, 0x51, 0x7e, 0x3a, 0x1b, 0x5b, 0x0b, 0x4b,
+        0x1d, 0x4d, 0x5d, 0x32, 0x3d, 0x9b, 0xb8, 0x74,
+        0xc0, 0x0b, 0x1a, 0x05, 0x6f, 0x23, 0x3d, 0x97,
+        0xef, 0x54, 0x49, 0xa3, 0xdf, 0xe3, 0x59, 0x38,
+        0xb4, 0x9b, 0xb4, 0x86, 0x54, 0x34, 0xc8, 0x29,
+        0x73, 0x81, 0xe5, 0x37, 0xb1, 0x5d, 0xbf, 0x08,
+        0x70, 0x53, 0xa2, 0xc8, 0x77, 0x10, 0x73, 0xbd,
+        0x48, 0x8a, 0x6a, 0x59, 0x41, 0xec, 0x91, 0xff,
+        0x75, 0x48, 0xfb, 0x95, 0x48, 0xfb, 0xc5, 0xce,
+        0xcc, 0xdf, 0xce, 0x34, 0xdf, 0x34, 0x36, 0xf8,
+        0x00, 0x4b, 0x97, 0x7a, 0xf6, 0xf8, 0x06, 0x96,
+        0x1f, 0xb5, 0xc8, 0xb4, 0x98, 0x96, 0xd4, 0x8e,
+        0x12, 0xf1, 0x0d, 0xc0, 0x6f, 0xc9, 0x3c, 0x11,
+        0x20, 0xff, 0xcf, 0x83, 0x3e, 0x37, 0x53, 0x1c,
+        0x69, 0x8b, 0xb3, 0x73, 0x64, 0xf2, 0x2e, 0xfa,
+        0x6d, 0x6f, 0x1a, 0x0d, 0x5d, 0xf9, 0x5a, 0xbe,
+        0x84, 0x2d, 0xa0, 0x5d, 0x42, 0xb6, 0x63, 0xca,
+        0x65, 0x78, 0x9f, 0x7c, 0x46, 0x7f, 0x50, 0x4d,
+        0xa2, 0xab, 0xac, 0x0b, 0x39, 0x17, 0x23, 0xbf,
+        0x29, 0x4e, 0x17, 0xbb, 0x08, 0x2d, 0x5b, 0x65,
+        0xc3, 0x96, 0x6d, 0xc6, 0x38, 0xd9, 0x74, 0xd2,
+        0x96, 0xe3, 0xf8, 0x75, 0x70, 0x24, 0x63, 0x62,
+        0xa4, 0x42, 0x3b, 0x9a, 0xee, 0x7f, 0x1d, 0xbe,
+        0x4b, 0xea, 0x78, 0x16, 0x0f, 0x49, 0x0f, 0x5d,
+        0xc5, 0xc1, 0x2d, 0x52, 0xca, 0x4b, 0xa5, 0x00,
+        0xa8, 0xd7, 0x90, 0xc8, 0x34, 0x3d, 0xc6, 0x33,
+        0x66, 0xe8, 0x18, 0x79, 0xfb, 0x41, 0x54, 0xd0,
+        0xcc, 0xdd, 0xf6, 0x76, 0xec, 0x65, 0xae, 0x7d,
+        0x85, 0x49, 0x96, 0x5a, 0x70, 0x24, 0x2f, 0x2b,
+        0x95, 0xee, 0x21, 0xcc, 0x08, 0xe4, 0xaf, 0x98,
+        0xe0, 0x37, 0xfb, 0xff, 0xd7, 0x76, 0xff, 0xcc,
+        0xa3, 0xbd, 0x47, 0x33, 0x17, 0x9b, 0x70, 0x9e,
+        0xf8, 0xc4, 0x61, 0x34, 0xa0, 0x7c, 0x4b, 0x2d,
+        0x55, 0xbe, 0x61, 0xd9, 0x67, 0x2e, 0x57, 0x69,
+        0x0b, 0xc5, 0x9c, 0x84, 0xfa, 0x36, 0x58, 0x8a,
+        0xc9, 0x23, 0x24, 0xa6, 0x07, 0x01, 0x8c, 0x96,
+        0x18, 0xcb, 0x46, 0x3a, 0xd4, 0x6a, 0x2f, 0xde,
+        0xdf, 0xdf, 0x09, 0x47, 0xc6, 0x36, 0xf6, 0x7f,
+        0xdf, 0x2b, 0xb3, 0x60, 0xdd, 0x99, 0x96, 0xe3,
+        0x35, 0xa6, 0x46, 0x26, 0x34, 0xb0, 0x3c, 0x3f,
+        0xdd, 0xf6, 0xfd, 0xc3, 0x84, 0x06, 0x14, 0x14,
+        0x2b, 0xeb, 0xd1, 0x6e, 0xa0, 0x12, 0xc4, 0xb0,
+        0x52, 0x00, 0xf8, 0xec, 0xf7, 0xb6, 0xf0, 0xad,
+        0xe0, 0xdf, 0x63, 0x0b, 0x17, 0xc0, 0xb7, 0x6f,
+        0x3e, 0xdc, 0x3e, 0x27, 0x27, 0x6a, 0x32, 0xa9,
+        0x32, 0x78, 0x71, 0xa7, 0x6a, 0xdb, 0xf9, 0xd6,
+        0x5f, 0xdd, 0x23, 0x7e, 0xc1, 0xa6, 0xa0, 0xc2,
+        0xc1, 0x66, 0x34, 0xad, 0x28, 0x48, 0x34, 0x00,
+        0x33, 0x16, 0xc0, 0xbe, 0x35, 0xac, 0xc1, 0x73,
+        0xeb, 0x1e, 0xa1, 0x48, 0x9e, 0xa9, 0xcd, 0xc8,
+        0xfb, 0x5a, 0xec, 0x70, 0xb2, 0x80, 0xdc, 0xf9,
+        0xd1, 0xd3, 0x71, 0x64, 0xdd, 0x61, 0xec, 0xc9,
+        0xb5, 0x3c, 0x3d, 0xe0, 0x27, 0xe5, 0xf9, 0x4c,
+        0x4f, 0x77, 0x19, 0xab, 0xb4, 0x93, 0x78, 0x5f,
+        0x20, 0x0f, 0x0b, 0x19, 0x43, 0x5d, 0xde
+};
+static uint8_t C37[] = {
+        0x18, 0x42, 0xd2, 0xa1, 0x03, 0xe7, 0x8b, 0xb7,
+        0x65, 0x45, 0x14, 0x50, 0xb2, 0x27, 0x7d, 0x14,
+        0x02, 0x7e, 0x5b, 0x7f, 0xc9, 0xd1, 0x3c, 0x76,
+        0x0e, 0x6e, 0x5a, 0x3b, 0xd9, 0x9d, 0x40, 0x28,
+        0x63, 0x3c, 0x62, 0xa9, 0xfc, 0x0e, 0x03, 0x5e,
+        0xb8, 0xf3, 0xaa, 0x73, 0x7b, 0x12, 0x7a, 0x1b,
+        0x64, 0xb5, 0x27, 0x64, 0xe6, 0xe7, 0xa8, 0xca,
+        0xf8, 0x4e, 0x4b, 0xfa, 0x73, 0xc2, 0x51, 0xba,
+        0x1a, 0x3c, 0x62, 0x17, 0x2c, 0xe5, 0xee, 0xbf,
+        0xe2, 0xe1, 0x8a, 0xf6, 0xc2, 0x4d, 0xb4, 0xd1,
+        0x41, 0x69, 0x71, 0x09, 0xbd, 0x44, 0xb7, 0xd4,
+        0x77, 0xd4, 0xbc, 0xf5, 0xbe, 0xe9, 0x38, 0x0e,
+        0x2a, 0x2a, 0x4e, 0x26, 0x74, 0xa7, 0xf9, 0x9b,
+        0x87, 0x44, 0xf6, 0x3b, 0xb6, 0x2a, 0x07, 0xc3,
+        0x70, 0x05, 0xc8, 0xcb, 0x8a, 0x55, 0x6a, 0x6b,
+        0x3e, 0xb4, 0x85, 0xc2, 0x3e, 0x65, 0xa6, 0x87,
+        0x37, 0x77, 0x79, 0x8f, 0x76, 0xfb, 0x18, 0x72,
+        0x7e, 0xb4, 0x2d, 0x8e, 0xf7, 0x10, 0x0a, 0x20,
+        0x8d, 0x11, 0x08, 0x66, 0x86, 0xf2, 0x23, 0xfd,
+        0xab, 0xa1, 0xd5, 0xcb, 0x4d, 0xb0, 0xe3, 0x6c,
+        0x0c, 0xae, 0x97, 0x89, 0x9f, 0x1a, 0xda, 0xaa,
+        0x48, 0x53, 0x0e, 0xee, 0x43, 0x5d, 0x14, 0xdf,
+        0x83, 0x08, 0x8d, 0x4d, 0xbf, 0x4b, 0x9c, 0xa5,
+        0xe7, 0x80, 0x71, 0x48, 0xc7, 0x2a, 0x5d, 0x18,
+        0x8b, 0x02, 0xd6, 0x0b, 0x10, 0x9c, 0x77, 0xad,
+        0x78, 0x80, 0xad, 0xdc, 0xce, 0xfe, 0x22, 0x2b,
+        0xfd, 0x6b, 0x62, 0xa8, 0xe5, 0x17, 0xe0, 0x62,
+        0x1d, 0x2e, 0xf7, 0xc9, 0xef, 0x1e, 0x2e, 0x17,
+        0x30, 0xd6, 0xdb, 0xcb, 0xef, 0x2b, 0x47, 0x82,
+        0xb7, 0x9f, 0xa3, 0x50, 0xdc, 0x11, 0x28, 0xa5,
+        0x3b, 0x4f, 0xeb, 0xe4, 0xe9, 0x1c, 0x0a, 0xc3,
+        0x43, 0xb6, 0xcd, 0xb7, 0xdf, 0x10, 0x35, 0x44,
+        0x9d, 0x99, 0x23, 0x94, 0xcd, 0x84, 0x71, 0x28,
+        0x21, 0xb6, 0x7c, 0xc2, 0xc5, 0x19, 0xc3, 0x25,
+        0x70, 0x92, 0x9e, 0x05, 0x72, 0xf6, 0x66, 0xbe,
+        0xd5, 0xe6, 0xb1, 0x5f, 0xf3, 0x35, 0x84, 0x61,
+        0x96, 0xed, 0xfc, 0x95, 0x45, 0xa0, 0x48, 0x96,
+        0x69, 0x37, 0x6c, 0xab, 0x83, 0x76, 0x83, 0x2a,
+        0xe8, 0x32, 0xa4, 0xeb, 0x0f, 0xac, 0x6a, 0x53,
+        0xc3, 0x05, 0x77, 0x2d, 0x4b, 0x9c, 0x67, 0xa5,
+        0x88, 0xe8, 0x65, 0xb4, 0xb2, 0xcf, 0x45, 0x11,
+        0x5f, 0x26, 0xb5, 0x88, 0x32, 0x0b, 0xd4, 0x53,
+        0xb1, 0x63, 0x34, 0x9c, 0x11, 0x52, 0xfb, 0xe7,
+        0x27, 0x28, 0x2b, 0x69, 0xaf, 0xf8, 0x3d, 0x00,
+        0xb4, 0xda, 0x5e, 0x26, 0xe8, 0x22, 0x4c, 0xc7,
+        0xb1, 0x3d, 0x8f, 0xd6, 0x27, 0x4b, 0xa6, 0x33,
+        0x6b, 0xc2, 0x5a, 0x98, 0x82, 0x89, 0x21, 0x88,
+        0x66, 0xc0, 0x90, 0xff, 0x0c, 0xb6, 0x06, 0x6e,
+        0xb9, 0x50, 0xdb, 0x05, 0xd7, 0xfb, 0x7d, 0xcf,
+        0x89, 0xcb, 0x3d, 0x5f, 0x66, 0x70, 0xeb, 0x93,
+        0x5d, 0x2c, 0xfd, 0x52, 0x39, 0x39, 0xc3, 0x00,
+        0x54, 0x08, 0x19, 0xdf, 0xfd, 0x4a, 0xb5, 0xeb,
+        0xdb, 0x32, 0xd5, 0xed, 0x78, 0xd6, 0x03, 0x3f,
+        0xc0, 0xca, 0xe1, 0x3e, 0xd9, 0x6a, 0x0a, 0xe5,
+        0x84, 0x1e, 0x2d, 0x64, 0x6f, 0x2a, 0x49, 0xe4,
+        0x86, 0x4f, 0xc6, 0x13, 0xf3, 0x48, 0xe4, 0xf5,
+        0x78, 0xba, 0x5f, 0x68, 0xc5, 0x1d, 0x34, 0x7a,
+        0xc3, 0xd5, 0x3d, 0x1d, 0x38, 0x6b, 0x6d, 0xc8,
+        0xab, 0x5e, 0x95, 0xe4, 0x05, 0x6a, 0xda, 0x57,
+        0xe6, 0x84, 0x66, 0x2c, 0x38, 0x86, 0x24, 0x72,
+        0x50, 0x8d, 0x71, 0x6d, 0x45, 0x18, 0xc3, 0xae,
+        0x43, 0x78, 0x55, 0x1b, 0xdf, 0x5a, 0xf1, 0x7e,
+        0xd9, 0x8d, 0xba, 0x25, 0xac, 0x26, 0x63, 0xfc,
+        0x01, 0x57, 0x4e, 0xbe, 0xcd, 0xbb, 0xa1, 0x07,
+        0xd4, 0xac, 0xc6, 0xf5, 0x6f, 0xf5, 0xa6, 0x2e,
+        0x53, 0x2f, 0xb0, 0x35, 0x46, 0xed, 0xd2
+};
+static uint8_t T37[] = {
+        0x6d, 0xe0, 0xdd, 0x05, 0x1d, 0x72, 0xe7, 0xbb,
+        0x4e, 0x41, 0xd5, 0x21, 0xab, 0xbe, 0x77, 0x96
+};
+
 static const struct gcm_ctr_vector gcm_vectors[] = {
 	/*
          * field order {K, Klen, IV, IVlen, A, Alen, P, Plen, C, T, Tlen};
@@ -1281,6 +1603,9 @@ static const struct gcm_ctr_vector gcm_vectors[] = {
         extra_vector(20),
         vector(21),
         extra_vector(22),
+        vector(35),
+        vector(36),
+        vector(37),
 };
 
 /* Variable IV vectrors (not 12 bytes) */
@@ -1642,7 +1967,7 @@ aes_gcm_burst(IMB_MGR *mb_mgr,
               const uint64_t aad_len, uint8_t **auth_tag,
               const uint64_t auth_tag_len, struct gcm_context_data **ctx,
               const IMB_CIPHER_MODE cipher_mode, const IMB_SGL_STATE sgl_state,
-              const uint32_t num_jobs)
+              const uint32_t num_jobs, const BURST_TYPE burst_type)
 {
         IMB_JOB *job, jobs[GCM_MAX_JOBS];
         uint32_t i;
@@ -1677,8 +2002,15 @@ aes_gcm_burst(IMB_MGR *mb_mgr,
                         job->hash_alg = IMB_AUTH_AES_GMAC;
         }
 
-        const uint32_t completed_jobs =
-                IMB_SUBMIT_BURST(mb_mgr, jobs, num_jobs);
+        uint32_t completed_jobs;
+
+        if (burst_type == BURST_TYPE_GENERIC)
+                completed_jobs = IMB_SUBMIT_BURST(mb_mgr, jobs, num_jobs);
+        else
+                completed_jobs = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                         cipher_mode,
+                                                         cipher_dir,
+                                                         key_len);
 
         if (completed_jobs != num_jobs) {
                 int err = imb_get_errno(mb_mgr);
@@ -1719,7 +2051,7 @@ burst_aes_gcm_enc(IMB_MGR *p_mgr,
         return aes_gcm_burst(p_mgr, IMB_DIR_ENCRYPT, key,
                              key_len, out, in, len, iv, iv_len, aad, aad_len,
                              auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM, 0,
-                             num_jobs);
+                             num_jobs, BURST_TYPE_GENERIC);
 }
 
 static int
@@ -1735,7 +2067,41 @@ burst_aes_gcm_dec(IMB_MGR *p_mgr,
         return aes_gcm_burst(p_mgr, IMB_DIR_DECRYPT, key,
                              key_len, out, in, len, iv, iv_len, aad, aad_len,
                              auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM, 0,
-                             num_jobs);
+                             num_jobs, BURST_TYPE_GENERIC);
+}
+
+static int
+cipher_burst_aes_gcm_enc(IMB_MGR *p_mgr,
+                         const struct gcm_key_data *key,
+                         struct gcm_context_data **ctx, uint8_t **out,
+                         const uint8_t *in, const uint64_t len,
+                         const uint8_t *iv, const uint64_t iv_len,
+                         const uint8_t *aad, const uint64_t aad_len,
+                         uint8_t **auth_tag, const uint64_t auth_tag_len,
+                         const IMB_KEY_SIZE_BYTES key_len,
+                         const uint32_t num_jobs)
+{
+        return aes_gcm_burst(p_mgr, IMB_DIR_ENCRYPT, key,
+                             key_len, out, in, len, iv, iv_len, aad, aad_len,
+                             auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM, 0,
+                             num_jobs, BURST_TYPE_CIPHER);
+}
+
+static int
+cipher_burst_aes_gcm_dec(IMB_MGR *p_mgr,
+                         const struct gcm_key_data *key,
+                         struct gcm_context_data **ctx, uint8_t **out,
+                         const uint8_t *in, const uint64_t len,
+                         const uint8_t *iv, const uint64_t iv_len,
+                         const uint8_t *aad, const uint64_t aad_len,
+                         uint8_t **auth_tag, const uint64_t auth_tag_len,
+                         const IMB_KEY_SIZE_BYTES key_len,
+                         const uint32_t num_jobs)
+{
+        return aes_gcm_burst(p_mgr, IMB_DIR_DECRYPT, key,
+                             key_len, out, in, len, iv, iv_len, aad, aad_len,
+                             auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM, 0,
+                             num_jobs, BURST_TYPE_CIPHER);
 }
 
 static int
@@ -1752,17 +2118,20 @@ burst_sgl_aes_gcm(IMB_MGR *p_mgr,
         if (aes_gcm_burst(p_mgr, cipher_dir, key,
                           key_len, out, in, len, iv, iv_len, aad, aad_len,
                           auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM_SGL,
-                          IMB_SGL_INIT, num_jobs) < 0)
+                          IMB_SGL_INIT, num_jobs,
+                          BURST_TYPE_GENERIC) < 0)
                 return -1;
         if (aes_gcm_burst(p_mgr, cipher_dir, key,
                           key_len, out, in, len, iv, iv_len, aad, aad_len,
                           auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM_SGL,
-                          IMB_SGL_UPDATE, num_jobs) < 0)
+                          IMB_SGL_UPDATE, num_jobs,
+                          BURST_TYPE_GENERIC) < 0)
                 return -1;
         if (aes_gcm_burst(p_mgr, cipher_dir, key,
                           key_len, out, in, len, iv, iv_len, aad, aad_len,
                           auth_tag, auth_tag_len, ctx, IMB_CIPHER_GCM_SGL,
-                          IMB_SGL_COMPLETE, num_jobs) < 0)
+                          IMB_SGL_COMPLETE, num_jobs,
+                          BURST_TYPE_GENERIC) < 0)
                 return -1;
 
         return 0;
@@ -1798,6 +2167,110 @@ burst_sgl_aes_gcm_dec(IMB_MGR *p_mgr,
                                  auth_tag_len, key_len, num_jobs);
 }
 
+/*****************************************************************************
+ * job API - multiple jobs in flight
+ *****************************************************************************/
+static int
+aes_gcm_multi_job(IMB_MGR *mb_mgr,
+                  const IMB_CIPHER_DIRECTION cipher_dir,
+                  const struct gcm_key_data *key,
+                  const uint64_t key_len,
+                  uint8_t **out, const uint8_t *in, const uint64_t len,
+                  const uint8_t *iv, const uint64_t iv_len, const uint8_t *aad,
+                  const uint64_t aad_len, uint8_t **auth_tag,
+                  const uint64_t auth_tag_len, const uint32_t num_jobs)
+{
+        IMB_JOB *job;
+        uint32_t i, completed_jobs = 0;
+
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+
+                job->cipher_mode                      = IMB_CIPHER_GCM;
+                job->hash_alg                         = IMB_AUTH_AES_GMAC;
+                job->chain_order                      =
+                        (cipher_dir == IMB_DIR_ENCRYPT) ?
+                        IMB_ORDER_CIPHER_HASH :
+                        IMB_ORDER_HASH_CIPHER;
+                job->enc_keys                         = key;
+                job->dec_keys                         = key;
+                job->key_len_in_bytes                 = key_len;
+                job->src                              = in;
+                job->dst                              = out[i];
+                job->msg_len_to_cipher_in_bytes       = len;
+                job->cipher_start_src_offset_in_bytes = UINT64_C(0);
+                job->iv                               = iv;
+                job->iv_len_in_bytes                  = iv_len;
+                job->u.GCM.aad                        = aad;
+                job->u.GCM.aad_len_in_bytes           = aad_len;
+                job->auth_tag_output                  = auth_tag[i];
+                job->auth_tag_output_len_in_bytes     = auth_tag_len;
+                job->cipher_direction                 = cipher_dir;
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                while (job != NULL) {
+                        if (job->status != IMB_STATUS_COMPLETED) {
+                                printf("job %u status not complete!\n",
+                                       completed_jobs + 1);
+                                return -1;
+                        }
+                        completed_jobs++;
+                        job = IMB_GET_COMPLETED_JOB(mb_mgr);
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("job %u status not complete!\n",
+                               completed_jobs + 1);
+                        return -1;
+                }
+                completed_jobs++;
+        }
+
+        if (completed_jobs != num_jobs) {
+                printf("multi-job error: not enough jobs returned!\n");
+                return -1;
+        }
+
+        return 0;
+}
+
+static int
+multi_job_aes_gcm_enc(IMB_MGR *p_mgr,
+                      const struct gcm_key_data *key,
+                      struct gcm_context_data **ctx, uint8_t **out,
+                      const uint8_t *in, const uint64_t len,
+                      const uint8_t *iv, const uint64_t iv_len,
+                      const uint8_t *aad, const uint64_t aad_len,
+                      uint8_t **auth_tag, const uint64_t auth_tag_len,
+                      const IMB_KEY_SIZE_BYTES key_len, const uint32_t num_jobs)
+{
+        (void) ctx;
+        return aes_gcm_multi_job(p_mgr, IMB_DIR_ENCRYPT, key,
+                                 key_len, out, in, len, iv, iv_len, aad,
+                                 aad_len, auth_tag, auth_tag_len, num_jobs);
+}
+
+static int
+multi_job_aes_gcm_dec(IMB_MGR *p_mgr,
+                      const struct gcm_key_data *key,
+                      struct gcm_context_data **ctx, uint8_t **out,
+                      const uint8_t *in, const uint64_t len,
+                      const uint8_t *iv, const uint64_t iv_len,
+                      const uint8_t *aad, const uint64_t aad_len,
+                      uint8_t **auth_tag, const uint64_t auth_tag_len,
+                      const IMB_KEY_SIZE_BYTES key_len, const uint32_t num_jobs)
+{
+        (void) ctx;
+        return aes_gcm_multi_job(p_mgr, IMB_DIR_DECRYPT, key,
+                                 key_len, out, in, len, iv, iv_len, aad,
+                                 aad_len, auth_tag, auth_tag_len, num_jobs);
+}
+
 /*****************************************************************************
  * job API
  *****************************************************************************/
@@ -1844,6 +2317,12 @@ aes_gcm_job(IMB_MGR *mb_mgr,
         } else
                 job->hash_alg = IMB_AUTH_AES_GMAC;
         job = IMB_SUBMIT_JOB(mb_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(mb_mgr);
+        if (job == NULL) {
+                fprintf(stderr, "no job returned\n");
+                return -1;
+        }
 
         if (job->status != IMB_STATUS_COMPLETED) {
                 fprintf(stderr, "failed job, status:%d\n", job->status);
@@ -2354,6 +2833,14 @@ test_gcm_std_vectors(struct test_suite_context *ts128,
                                                        burst_aes_gcm_enc,
                                                        burst_aes_gcm_dec,
                                                        ts128);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                       cipher_burst_aes_gcm_enc,
+                                                       cipher_burst_aes_gcm_dec,
+                                                       ts128);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                       multi_job_aes_gcm_enc,
+                                                       multi_job_aes_gcm_dec,
+                                                       ts128);
                         }
                         break;
                 case IMB_KEY_192_BYTES:
@@ -2383,6 +2870,14 @@ test_gcm_std_vectors(struct test_suite_context *ts128,
                                                        burst_aes_gcm_enc,
                                                        burst_aes_gcm_dec,
                                                        ts192);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                       cipher_burst_aes_gcm_enc,
+                                                       cipher_burst_aes_gcm_dec,
+                                                       ts192);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                       multi_job_aes_gcm_enc,
+                                                       multi_job_aes_gcm_dec,
+                                                       ts192);
                         }
                         break;
                 case IMB_KEY_256_BYTES:
@@ -2413,6 +2908,14 @@ test_gcm_std_vectors(struct test_suite_context *ts128,
                                                  burst_aes_gcm_enc,
                                                  burst_aes_gcm_dec,
                                                  ts256);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                 cipher_burst_aes_gcm_enc,
+                                                 cipher_burst_aes_gcm_dec,
+                                                 ts256);
+                                test_gcm_vectors_burst(&vectors[vect],
+                                                 multi_job_aes_gcm_enc,
+                                                 multi_job_aes_gcm_dec,
+                                                 ts256);
 
                         }
                         break;
@@ -2646,6 +3149,76 @@ test_gmac_vector(const struct gcm_ctr_vector *vector,
                 test_suite_update(ts, 1, 0);
 }
 
+#define GMAC_BURST_JOBS 8
+static void
+test_gmac_burst_vector(const struct gcm_ctr_vector *vector,
+                       struct test_suite_context *ts128,
+                       struct test_suite_context *ts192,
+                       struct test_suite_context *ts256)
+{
+        struct gcm_key_data key;
+        IMB_JOB jobs[GMAC_BURST_JOBS];
+        uint8_t T_test[GMAC_BURST_JOBS][16];
+        IMB_HASH_ALG hash_alg;
+        struct test_suite_context *ts = ts128;
+        uint32_t i, completed_jobs;
+        int ok = 1;
+
+        memset(&key, 0, sizeof(struct gcm_key_data));
+        memset(jobs, 0, sizeof(jobs));
+        memset(T_test, 0, sizeof(T_test));
+
+        if (vector->Klen == IMB_KEY_128_BYTES) {
+                IMB_AES128_GCM_PRE(p_gcm_mgr, vector->K, &key);
+                hash_alg = IMB_AUTH_AES_GMAC_128;
+        } else if (vector->Klen == IMB_KEY_192_BYTES) {
+                IMB_AES192_GCM_PRE(p_gcm_mgr, vector->K, &key);
+                hash_alg = IMB_AUTH_AES_GMAC_192;
+                ts = ts192;
+        } else { /* IMB_KEY_256_BYTES */
+                IMB_AES256_GCM_PRE(p_gcm_mgr, vector->K, &key);
+                hash_alg = IMB_AUTH_AES_GMAC_256;
+                ts = ts256;
+        }
+
+        for (i = 0; i < GMAC_BURST_JOBS; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->cipher_mode = IMB_CIPHER_NULL;
+                job->u.GMAC._key = &key;
+                job->u.GMAC._iv = vector->IV;
+                job->u.GMAC.iv_len_in_bytes = vector->IVlen;
+                job->src = vector->P;
+                job->msg_len_to_hash_in_bytes = vector->Plen;
+                job->hash_start_src_offset_in_bytes = UINT64_C(0);
+                job->auth_tag_output = T_test[i];
+                job->auth_tag_output_len_in_bytes = vector->Tlen;
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(p_gcm_mgr, jobs,
+                                               GMAC_BURST_JOBS, hash_alg);
+        if (completed_jobs != GMAC_BURST_JOBS) {
+                fprintf(stderr, "hash burst completed %u jobs, error %d\n",
+                        completed_jobs, imb_get_errno(p_gcm_mgr));
+                ok = 0;
+        }
+
+        for (i = 0; ok && i < GMAC_BURST_JOBS; i++) {
+                if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                        fprintf(stderr, "failed job, status:%d\n",
+                                jobs[i].status);
+                        ok = 0;
+                } else if (check_data(T_test[i], vector->T, vector->Tlen,
+                                      "generated tag (T)"))
+                        ok = 0;
+        }
+
+        if (ok)
+                test_suite_update(ts, 1, 0);
+        else
+                test_suite_update(ts, 0, 1);
+}
+
 static void
 test_gmac(struct test_suite_context *ts128,
           struct test_suite_context *ts192,
@@ -2667,6 +3240,9 @@ test_gmac(struct test_suite_context *ts128,
                 /* Using job API */
                 test_gmac_vector(vector, vector->Plen, 1,
                                  ts128, ts192, ts256);
+
+                /* Using hash burst API */
+                test_gmac_burst_vector(vector, ts128, ts192, ts256);
         }
 }
 
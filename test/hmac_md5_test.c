@@ -40,6 +40,9 @@ int hmac_md5_test(struct IMB_MGR *mb_mgr);
 #define digest_size   16
 #define digest96_size 12
 
+/* AVX512 runs 32 lanes, one more job makes the manager reuse a lane */
+#define max_md5_jobs  33
+
 /*
  * Test vectors from https://tools.ietf.org/html/rfc2202
  */
@@ -498,6 +501,106 @@ test_hmac_md5(struct IMB_MGR *mb_mgr,
         return ret;
 }
 
+/*
+ * Submits num_jobs jobs, job i using vector (i % number of vectors),
+ * so lanes of the same manager hash messages of different lengths
+ */
+static int
+test_hmac_md5_mixed(struct IMB_MGR *mb_mgr, const int num_jobs)
+{
+        const int vectors_cnt = DIM(hmac_md5_vectors);
+        DECLARE_ALIGNED(uint8_t ipad_hash[DIM(hmac_md5_vectors)][digest_size],
+                        16);
+        DECLARE_ALIGNED(uint8_t opad_hash[DIM(hmac_md5_vectors)][digest_size],
+                        16);
+        uint8_t auths[max_md5_jobs][digest_size + (16 * 2)];
+        uint8_t padding[16];
+        uint8_t buf[block_size];
+        struct IMB_JOB *job;
+        int i, j, jobs_rx = 0, ret = -1;
+
+        if (num_jobs > max_md5_jobs)
+                return -1;
+
+        memset(padding, -1, sizeof(padding));
+        memset(auths, -1, sizeof(auths));
+
+        /* all vectors have keys shorter than the block size */
+        for (i = 0; i < vectors_cnt; i++) {
+                const struct hmac_md5_rfc2202_vector *vec =
+                        &hmac_md5_vectors[i];
+
+                memset(buf, 0x36, sizeof(buf));
+                for (j = 0; j < (int) vec->key_len; j++)
+                        buf[j] ^= vec->key[j];
+                IMB_MD5_ONE_BLOCK(mb_mgr, buf, ipad_hash[i]);
+
+                memset(buf, 0x5c, sizeof(buf));
+                for (j = 0; j < (int) vec->key_len; j++)
+                        buf[j] ^= vec->key[j];
+                IMB_MD5_ONE_BLOCK(mb_mgr, buf, opad_hash[i]);
+        }
+
+        /* empty the manager */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                const int idx = i % vectors_cnt;
+                const struct hmac_md5_rfc2202_vector *vec =
+                        &hmac_md5_vectors[idx];
+
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+                memset(job, 0, sizeof(*job));
+                job->cipher_direction = IMB_DIR_ENCRYPT;
+                job->chain_order = IMB_ORDER_HASH_CIPHER;
+                job->auth_tag_output = auths[i] + sizeof(padding);
+                job->auth_tag_output_len_in_bytes = vec->digest_len;
+                job->src = vec->data;
+                job->msg_len_to_hash_in_bytes = vec->data_len;
+                job->u.HMAC._hashed_auth_key_xor_ipad = ipad_hash[idx];
+                job->u.HMAC._hashed_auth_key_xor_opad = opad_hash[idx];
+                job->cipher_mode = IMB_CIPHER_NULL;
+                job->hash_alg = IMB_AUTH_MD5;
+                job->user_data = auths[i];
+                job->user_data2 = (void *) (uintptr_t) idx;
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                if (job) {
+                        const int rx_idx = (int) (uintptr_t) job->user_data2;
+
+                        jobs_rx++;
+                        if (!hmac_md5_job_ok(&hmac_md5_vectors[rx_idx], job,
+                                             job->user_data, padding,
+                                             sizeof(padding)))
+                                goto end;
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                const int idx = (int) (uintptr_t) job->user_data2;
+
+                jobs_rx++;
+                if (!hmac_md5_job_ok(&hmac_md5_vectors[idx], job,
+                                     job->user_data, padding,
+                                     sizeof(padding)))
+                        goto end;
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
+        ret = 0;
+
+ end:
+        /* empty the manager before next tests */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        return ret;
+}
+
 static void
 test_hmac_md5_std_vectors(struct IMB_MGR *mb_mgr,
                           const int num_jobs,
@@ -538,8 +641,20 @@ hmac_md5_test(struct IMB_MGR *mb_mgr)
         int num_jobs, errors = 0;
 
         test_suite_start(&ts, "HMAC-MD5");
-        for (num_jobs = 1; num_jobs <= 17; num_jobs++)
+        for (num_jobs = 1; num_jobs <= max_md5_jobs; num_jobs++)
                 test_hmac_md5_std_vectors(mb_mgr, num_jobs, &ts);
+
+        printf("HMAC-MD5 mixed length jobs:\n");
+        for (num_jobs = 1; num_jobs <= max_md5_jobs; num_jobs++) {
+                printf(".");
+                if (test_hmac_md5_mixed(mb_mgr, num_jobs)) {
+                        printf("error - %d mixed length jobs\n", num_jobs);
+                        test_suite_update(&ts, 0, 1);
+                } else {
+                        test_suite_update(&ts, 1, 0);
+                }
+        }
+        printf("\n");
         errors = test_suite_end(&ts);
 
 	return errors;
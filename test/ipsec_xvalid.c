@@ -1708,6 +1708,13 @@ perform_safe_checks(IMB_MGR *mgr, const IMB_ARCH arch, const char *dir)
                 return -1;
         }
 
+        if (search_patterns(mgr->job_ring,
+                            mgr->job_ring_size * sizeof(IMB_JOB)) == 0) {
+                fprintf(stderr, "Pattern found in job ring after %s data\n",
+                        dir);
+                return -1;
+        }
+
         /* search OOO managers */
         for (ooo_ptr = &mgr->aes128_ooo, i = 0;
              ooo_ptr < &mgr->end_ooo;
@@ -1731,6 +1738,17 @@ perform_safe_checks(IMB_MGR *mgr, const IMB_ARCH arch, const char *dir)
                         "snow3g_uea2_ooo", "snow3g_uia2_ooo",
                         "sha_1_ooo", "sha_224_ooo", "sha_256_ooo",
                         "sha_384_ooo", "sha_512_ooo",
+                        "aes128_gcm_ooo", "aes192_gcm_ooo", "aes256_gcm_ooo",
+                        "chacha20_ooo", "chacha20_poly1305_ooo",
+                        "poly1305_ooo",
+                        "kasumi_uea1_ooo", "kasumi_uia1_ooo",
+                        "snow_v_ooo", "snow_v_aead_ooo",
+                        "aes128_xts_enc_ooo", "aes128_xts_dec_ooo",
+                        "aes256_xts_enc_ooo", "aes256_xts_dec_ooo",
+                        "aes128_cfb_ooo", "aes192_cfb_ooo", "aes256_cfb_ooo",
+                        "aes_cbc_hmac_sha_1_ooo", "aes_cbc_hmac_sha_256_ooo",
+                        "aes_ctr_hmac_sha_1_ooo", "aes_ctr_hmac_sha_256_ooo",
+                        "aes_ctr_cmac_ooo", "crc_ooo",
                         "end_ooo" /* add new ooo manager above this line */
                 };
                 void *ooo_mgr_p = *ooo_ptr;
@@ -43,6 +43,13 @@
 #define KASUMIIVLEN 8
 #define PAD_LEN 16
 
+/* job_api argument of the validate functions */
+enum api_type {
+        TEST_DIRECT_API,
+        TEST_JOB_API,
+        TEST_BURST_API
+};
+
 int kasumi_test(struct IMB_MGR *mb_mgr);
 static int
 validate_kasumi_f8_1_block(struct IMB_MGR *mb_mgr, const unsigned job_api);
@@ -60,8 +67,12 @@ validate_kasumi_f8_4_blocks(struct IMB_MGR *mb_mgr, const unsigned job_api);
 static int
 validate_kasumi_f8_n_blocks(struct IMB_MGR *mb_mgr, const unsigned job_api);
 static int
+validate_kasumi_f8_n_vectors(struct IMB_MGR *mb_mgr, const unsigned job_api);
+static int
 validate_kasumi_f9(IMB_MGR *mgr, const unsigned job_api);
 static int
+validate_kasumi_f9_n_vectors(IMB_MGR *mgr, const unsigned job_api);
+static int
 validate_kasumi_f9_user(IMB_MGR *mgr, const unsigned job_api);
 
 struct kasumi_test_case {
@@ -78,12 +89,14 @@ struct kasumi_test_case kasumi_f8_func_tab[] = {
         {validate_kasumi_f8_2_blocks, "validate_kasumi_f8_2_blocks"},
         {validate_kasumi_f8_3_blocks, "validate_kasumi_f8_3_blocks"},
         {validate_kasumi_f8_4_blocks, "validate_kasumi_f8_4_blocks"},
-        {validate_kasumi_f8_n_blocks, "validate_kasumi_f8_n_blocks"}
+        {validate_kasumi_f8_n_blocks, "validate_kasumi_f8_n_blocks"},
+        {validate_kasumi_f8_n_vectors, "validate_kasumi_f8_n_vectors"}
 };
 
 /* kasumi f9 validation function pointer table */
 struct kasumi_test_case kasumi_f9_func_tab[] = {
         {validate_kasumi_f9, "validate_kasumi_f9"},
+        {validate_kasumi_f9_n_vectors, "validate_kasumi_f9_n_vectors"},
         {validate_kasumi_f9_user, "validate_kasumi_f9_user"}
 };
 
@@ -91,13 +104,25 @@ static int
 submit_kasumi_f8_jobs(struct IMB_MGR *mb_mgr, kasumi_key_sched_t **keys,
                       uint64_t **ivs, uint8_t **src, uint8_t **dst,
                       const uint32_t *bitlens, const uint32_t *bit_offsets,
-                      int dir, const unsigned int num_jobs)
+                      int dir, const unsigned int num_jobs,
+                      const unsigned int job_api)
 {
         unsigned int i;
         unsigned int jobs_rx = 0;
+        IMB_JOB *job;
+        IMB_JOB jobs[NUM_SUPPORTED_BUFFERS];
+
+        if (job_api == TEST_BURST_API) {
+                if (num_jobs > NUM_SUPPORTED_BUFFERS)
+                        return -1;
+                memset(jobs, 0, sizeof(jobs));
+        }
 
         for (i = 0; i < num_jobs; i++) {
-                IMB_JOB *job = IMB_GET_NEXT_JOB(mb_mgr);
+                if (job_api == TEST_BURST_API)
+                        job = &jobs[i];
+                else
+                        job = IMB_GET_NEXT_JOB(mb_mgr);
 
                 job->cipher_direction = dir;
                 job->chain_order = IMB_ORDER_CIPHER_HASH;
@@ -113,6 +138,9 @@ submit_kasumi_f8_jobs(struct IMB_MGR *mb_mgr, kasumi_key_sched_t **keys,
                 job->msg_len_to_cipher_in_bits = bitlens[i];
                 job->hash_alg = IMB_AUTH_NULL;
 
+                if (job_api == TEST_BURST_API)
+                        continue;
+
                 job = IMB_SUBMIT_JOB(mb_mgr);
                 if (job != NULL) {
                         jobs_rx++;
@@ -121,8 +149,27 @@ submit_kasumi_f8_jobs(struct IMB_MGR *mb_mgr, kasumi_key_sched_t **keys,
                                        __LINE__, job->status, i);
                                 return -1;
                         }
-                } else {
-                        printf("Expected returned job, but got nothing\n");
+                }
+        }
+
+        if (job_api == TEST_BURST_API) {
+                jobs_rx = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                  IMB_CIPHER_KASUMI_UEA1_BITLEN,
+                                                  dir, IMB_KEY_128_BYTES);
+                for (i = 0; i < jobs_rx; i++) {
+                        if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d, job %u",
+                                       __LINE__, jobs[i].status, i);
+                                return -1;
+                        }
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                jobs_rx++;
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("%d error status:%d, job %u",
+                               __LINE__, job->status, i);
                         return -1;
                 }
         }
@@ -154,6 +201,8 @@ submit_kasumi_f9_job(struct IMB_MGR *mb_mgr, kasumi_key_sched_t *key,
         job->auth_tag_output_len_in_bytes = 4;
 
         job = IMB_SUBMIT_JOB(mb_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(mb_mgr);
         if (job != NULL) {
                 if (job->status != IMB_STATUS_COMPLETED) {
                         printf("%d error status:%d",
@@ -231,7 +280,7 @@ static int validate_kasumi_f8_1_block(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &pSrcBuff,
                                               &pSrcBuff, &bitLen, &bitOffset,
-                                              IMB_DIR_ENCRYPT, 1);
+                                              IMB_DIR_ENCRYPT, 1, job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER(mgr, pKeySched, IV, srcBuff,
                                                srcBuff, byteLen);
@@ -259,7 +308,8 @@ static int validate_kasumi_f8_1_block(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &pSrcBuff,
                                               &pSrcBuff, &bitLen,
-                                              &bitOffset, IMB_DIR_DECRYPT, 1);
+                                              &bitOffset, IMB_DIR_DECRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER(mgr, pKeySched, IV, srcBuff,
                                                srcBuff, byteLen);
@@ -390,7 +440,8 @@ static int validate_kasumi_f8_1_bitblock(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &plainBufAftPad,
                                               &wrkBufAftPad, &bit_len,
-                                              &bit_offset, IMB_DIR_ENCRYPT, 1);
+                                              &bit_offset, IMB_DIR_ENCRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV,
                                                    plainBufAftPad, wrkBufAftPad,
@@ -424,7 +475,8 @@ static int validate_kasumi_f8_1_bitblock(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &ciphBufAftPad,
                                               &wrkBufAftPad, &bit_len,
-                                              &bit_offset, IMB_DIR_DECRYPT, 1);
+                                              &bit_offset, IMB_DIR_DECRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV,
                                                    ciphBufAftPad, wrkBufAftPad,
@@ -453,7 +505,8 @@ static int validate_kasumi_f8_1_bitblock(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &plainBufAftPad,
                                               &wrkBufAftPad, &bit_len,
-                                              &bit_offset, IMB_DIR_ENCRYPT, 1);
+                                              &bit_offset, IMB_DIR_ENCRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV,
                                                    plainBufAftPad, wrkBufAftPad,
@@ -473,7 +526,8 @@ static int validate_kasumi_f8_1_bitblock(IMB_MGR *mgr, const unsigned job_api)
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &ciphBufAftPad,
                                               &wrkBufAftPad, &bit_len,
-                                              &bit_offset, IMB_DIR_DECRYPT, 1);
+                                              &bit_offset, IMB_DIR_DECRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV,
                                                    ciphBufAftPad, wrkBufAftPad,
@@ -571,7 +625,8 @@ static int validate_kasumi_f8_1_bitblock_offset(IMB_MGR *mgr,
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &pSrcBuff,
                                               &pWrkBuff, &bit_len,
-                                              &offset, IMB_DIR_ENCRYPT, 1);
+                                              &offset, IMB_DIR_ENCRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV, srcBuff,
                                                    wrkbuf, bit_len, offset);
@@ -618,7 +673,8 @@ static int validate_kasumi_f8_1_bitblock_offset(IMB_MGR *mgr,
                         submit_kasumi_f8_jobs(mgr, &pKeySched,
                                               &pIV, &pDstBuff,
                                               &pWrkBuff, &bit_len,
-                                              &offset, IMB_DIR_DECRYPT, 1);
+                                              &offset, IMB_DIR_DECRYPT, 1,
+                                              job_api);
                 else
                         IMB_KASUMI_F8_1_BUFFER_BIT(mgr, pKeySched, IV, dstBuff,
                                                    wrkbuf, bit_len, offset);
@@ -731,7 +787,7 @@ static int validate_kasumi_f8_2_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&srcBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_ENCRYPT, 2);
+                                      IMB_DIR_ENCRYPT, 2, job_api);
         else
                 IMB_KASUMI_F8_2_BUFFER(mgr, keySched[0], iv[0], iv[1],
                                        srcBuff[0], srcBuff[0], packetLen[0],
@@ -808,7 +864,7 @@ static int validate_kasumi_f8_2_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&dstBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_DECRYPT, 2);
+                                      IMB_DIR_DECRYPT, 2, job_api);
         else
                 IMB_KASUMI_F8_2_BUFFER(mgr, keySched[0], iv[0], iv[1],
                                        dstBuff[0], dstBuff[0], packetLen[0],
@@ -948,7 +1004,7 @@ static int validate_kasumi_f8_3_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&srcBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_ENCRYPT, 3);
+                                      IMB_DIR_ENCRYPT, 3, job_api);
         else
                 IMB_KASUMI_F8_3_BUFFER(mgr, keySched[0], iv[0], iv[1], iv[2],
                                        srcBuff[0], srcBuff[0], srcBuff[1],
@@ -975,7 +1031,7 @@ static int validate_kasumi_f8_3_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&dstBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_DECRYPT, 3);
+                                      IMB_DIR_DECRYPT, 3, job_api);
         else
                 IMB_KASUMI_F8_3_BUFFER(mgr, keySched[0], iv[0], iv[1], iv[2],
                                        dstBuff[0], dstBuff[0], dstBuff[1],
@@ -1090,7 +1146,7 @@ static int validate_kasumi_f8_4_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&srcBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_ENCRYPT, 4);
+                                      IMB_DIR_ENCRYPT, 4, job_api);
         else
                 IMB_KASUMI_F8_4_BUFFER(mgr, keySched[0], iv[0], iv[1], iv[2],
                                        iv[3], srcBuff[0], srcBuff[0],
@@ -1118,7 +1174,7 @@ static int validate_kasumi_f8_4_blocks(IMB_MGR *mgr, const unsigned job_api)
                                       (uint8_t **)&dstBuff,
                                       (uint32_t *)&bitLens,
                                       (uint32_t *)&bitOffsets,
-                                      IMB_DIR_DECRYPT, 4);
+                                      IMB_DIR_DECRYPT, 4, job_api);
         else
                 IMB_KASUMI_F8_4_BUFFER(mgr, keySched[0], iv[0], iv[1], iv[2],
                                        iv[3], dstBuff[0], dstBuff[0],
@@ -1227,7 +1283,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_ENCRYPT, i + 1);
+                                              IMB_DIR_ENCRYPT, i + 1, job_api);
                 else
                         /* All buffers share the same key */
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
@@ -1247,7 +1303,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_DECRYPT, i + 1);
+                                              IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         /* All buffers share the same key */
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
@@ -1296,7 +1352,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_DECRYPT, i + 1);
+                                              IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         /* All buffers share the same key */
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
@@ -1316,7 +1372,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_DECRYPT, i + 1);
+                                              IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         /* All buffers share the same key */
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
@@ -1367,7 +1423,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_DECRYPT, i + 1);
+                                              IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
                                                (const void * const *)srcBuff,
@@ -1386,7 +1442,7 @@ static int validate_kasumi_f8_n_blocks(IMB_MGR *mgr, const unsigned job_api)
                                               (uint8_t **)srcBuff,
                                               (uint32_t *)bitLens,
                                               (uint32_t *)bitOffsets,
-                                              IMB_DIR_DECRYPT, i + 1);
+                                              IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         IMB_KASUMI_F8_N_BUFFER(mgr, pKeySched[i], IV,
                                                (const void * const *)srcBuff,
@@ -1426,6 +1482,94 @@ exit:
         return ret;
 }
 
+/*
+ * Submits all KASUMI-F8 vectors at once, each job with its own key,
+ * so that every lane of the multi-buffer managers is used
+ * (one more job than lanes through the job API)
+ */
+static int validate_kasumi_f8_n_vectors(IMB_MGR *mgr, const unsigned job_api)
+{
+        const unsigned num_vectors = numCipherTestVectors[0];
+        const unsigned num_jobs = (job_api == TEST_BURST_API) ?
+                NUM_SUPPORTED_BUFFERS : NUM_SUPPORTED_BUFFERS + 1;
+        kasumi_key_sched_t *pKeySched[NUM_SUPPORTED_BUFFERS + 1] = {NULL};
+        uint64_t IV[NUM_SUPPORTED_BUFFERS + 1];
+        uint64_t *pIV[NUM_SUPPORTED_BUFFERS + 1];
+        uint8_t *buff[NUM_SUPPORTED_BUFFERS + 1] = {NULL};
+        uint32_t bitLens[NUM_SUPPORTED_BUFFERS + 1];
+        uint32_t bitOffsets[NUM_SUPPORTED_BUFFERS + 1];
+        unsigned i;
+        int dir, ret = 1;
+
+        /* direct API processes a single key at a time */
+        if (!job_api)
+                return 0;
+
+        printf("Testing KASUMI-F8 %u vectors in %u jobs (%s):\n",
+               num_vectors, num_jobs,
+               job_api == TEST_BURST_API ? "Burst API" : "Job API");
+
+        for (i = 0; i < num_jobs; i++) {
+                const cipher_test_vector_t *vec =
+                        &kasumi_f8_vectors[i % num_vectors];
+
+                pKeySched[i] = malloc(IMB_KASUMI_KEY_SCHED_SIZE(mgr));
+                buff[i] = malloc(MAX_DATA_LEN);
+                if (!pKeySched[i] || !buff[i]) {
+                        printf("malloc(%u): failed !\n", i);
+                        goto exit;
+                }
+                if (IMB_KASUMI_INIT_F8_KEY_SCHED(mgr, vec->key,
+                                                 pKeySched[i])) {
+                        printf("IMB_KASUMI_INIT_F8_KEY_SCHED() error\n");
+                        goto exit;
+                }
+                memcpy(&IV[i], vec->iv, vec->ivLenInBytes);
+                pIV[i] = &IV[i];
+                bitLens[i] = vec->dataLenInBytes * 8;
+                bitOffsets[i] = 0;
+                memcpy(buff[i], vec->plaintext, vec->dataLenInBytes);
+        }
+
+        for (dir = 0; dir < 2; dir++) {
+                const int enc = (dir == 0);
+
+                if (submit_kasumi_f8_jobs(mgr, pKeySched, pIV, buff, buff,
+                                          bitLens, bitOffsets,
+                                          enc ? IMB_DIR_ENCRYPT :
+                                          IMB_DIR_DECRYPT,
+                                          num_jobs, job_api))
+                        goto exit;
+
+                for (i = 0; i < num_jobs; i++) {
+                        const cipher_test_vector_t *vec =
+                                &kasumi_f8_vectors[i % num_vectors];
+                        const uint8_t *expected = enc ? vec->ciphertext :
+                                vec->plaintext;
+
+                        if (memcmp(buff[i], expected,
+                                   vec->dataLenInBytes) != 0) {
+                                printf("kasumi_f8_n_vectors(%s) job:%u\n",
+                                       enc ? "Enc" : "Dec", i);
+                                hexdump(stdout, "Actual:", buff[i],
+                                        vec->dataLenInBytes);
+                                hexdump(stdout, "Expected:", expected,
+                                        vec->dataLenInBytes);
+                                goto exit;
+                        }
+                }
+        }
+
+        ret = 0;
+        printf("[%s]: PASS, for %u buffers.\n", __FUNCTION__, num_jobs);
+exit:
+        for (i = 0; i < num_jobs; i++) {
+                free(pKeySched[i]);
+                free(buff[i]);
+        }
+        return ret;
+}
+
 static int validate_kasumi_f9(IMB_MGR *mgr, const unsigned job_api)
 {
         kasumi_key_sched_t *pKeySched = NULL;
@@ -1468,8 +1612,7 @@ static int validate_kasumi_f9(IMB_MGR *mgr, const unsigned job_api)
 
                 memcpy(srcBuff, kasumiF9_test_vectors[i].input, byteLen);
 
-                memcpy(digest, kasumiF9_test_vectors[i].exp_out,
-                       IMB_KASUMI_DIGEST_SIZE);
+                memset(digest, 0, IMB_KASUMI_DIGEST_SIZE);
 
                 if (IMB_KASUMI_INIT_F9_KEY_SCHED(mgr, pKey, pKeySched)) {
                         printf("IMB_KASUMI_INIT_F9_KEY_SCHED()error\n");
@@ -1506,6 +1649,109 @@ exit:
         return ret;
 }
 
+/*
+ * Submits all KASUMI-F9 vectors through the job API before flushing,
+ * each job with its own key (one more job than lanes)
+ */
+static int validate_kasumi_f9_n_vectors(IMB_MGR *mgr, const unsigned job_api)
+{
+        const unsigned num_vectors = numHashTestVectors[0];
+        const unsigned num_jobs = NUM_SUPPORTED_BUFFERS + 1;
+        kasumi_key_sched_t *pKeySched[NUM_SUPPORTED_BUFFERS + 1] = {NULL};
+        uint8_t digest[NUM_SUPPORTED_BUFFERS + 1][IMB_KASUMI_DIGEST_SIZE];
+        unsigned i, jobs_rx = 0;
+        IMB_JOB *job;
+        int ret = 1;
+
+        /* direct API processes a single buffer at a time */
+        if (!job_api)
+                return 0;
+
+        printf("Testing KASUMI-F9 %u vectors in %u jobs (Job API):\n",
+               num_vectors, num_jobs);
+
+        memset(digest, 0, sizeof(digest));
+        for (i = 0; i < num_jobs; i++) {
+                const hash_test_vector_t *vec =
+                        &kasumi_f9_vectors[i % num_vectors];
+
+                pKeySched[i] = malloc(IMB_KASUMI_KEY_SCHED_SIZE(mgr));
+                if (!pKeySched[i]) {
+                        printf("malloc(%u): failed !\n", i);
+                        goto exit;
+                }
+                if (IMB_KASUMI_INIT_F9_KEY_SCHED(mgr, vec->key,
+                                                 pKeySched[i])) {
+                        printf("IMB_KASUMI_INIT_F9_KEY_SCHED() error\n");
+                        goto exit;
+                }
+        }
+
+        while (IMB_FLUSH_JOB(mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                const hash_test_vector_t *vec =
+                        &kasumi_f9_vectors[i % num_vectors];
+
+                job = IMB_GET_NEXT_JOB(mgr);
+                job->chain_order = IMB_ORDER_CIPHER_HASH;
+                job->cipher_mode = IMB_CIPHER_NULL;
+                job->src = vec->input;
+                job->u.KASUMI_UIA1._key = pKeySched[i];
+                job->hash_start_src_offset_in_bytes = 0;
+                job->msg_len_to_hash_in_bytes = vec->lengthInBytes;
+                job->hash_alg = IMB_AUTH_KASUMI_UIA1;
+                job->auth_tag_output = digest[i];
+                job->auth_tag_output_len_in_bytes = IMB_KASUMI_DIGEST_SIZE;
+
+                job = IMB_SUBMIT_JOB(mgr);
+                if (job != NULL) {
+                        jobs_rx++;
+                        if (job->status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d\n",
+                                       __LINE__, job->status);
+                                goto exit;
+                        }
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mgr)) != NULL) {
+                jobs_rx++;
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("%d error status:%d\n", __LINE__, job->status);
+                        goto exit;
+                }
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %u jobs, received %u\n", num_jobs, jobs_rx);
+                goto exit;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const hash_test_vector_t *vec =
+                        &kasumi_f9_vectors[i % num_vectors];
+
+                if (memcmp(digest[i], vec->exp_out,
+                           IMB_KASUMI_DIGEST_SIZE) != 0) {
+                        hexdump(stdout, "Actual", digest[i],
+                                IMB_KASUMI_DIGEST_SIZE);
+                        hexdump(stdout, "Expected", vec->exp_out,
+                                IMB_KASUMI_DIGEST_SIZE);
+                        printf("F9 integrity job %u Failed\n", i);
+                        goto exit;
+                }
+        }
+
+        ret = 0;
+        printf("[%s]: PASS, for %u buffers.\n", __FUNCTION__, num_jobs);
+exit:
+        for (i = 0; i < num_jobs; i++)
+                free(pKeySched[i]);
+        return ret;
+}
+
 static int validate_kasumi_f9_user(IMB_MGR *mgr, const unsigned job_api)
 {
         int numKasumiF9IV_TestVectors = 0, i = 0;
@@ -1610,6 +1856,14 @@ int kasumi_test(struct IMB_MGR *mb_mgr)
                 } else {
                         test_suite_update(&ts, 1, 0);
                 }
+
+                /* validate burst api */
+                if (kasumi_f8_func_tab[i].func(mb_mgr, TEST_BURST_API)) {
+                        printf("%s: FAIL\n", kasumi_f8_func_tab[i].func_name);
+                        test_suite_update(&ts, 0, 1);
+                } else {
+                        test_suite_update(&ts, 1, 0);
+                }
         }
         errors += test_suite_end(&ts);
 
@@ -43,6 +43,8 @@ extern int hmac_sha256_sha512_test(struct IMB_MGR *mb_mgr);
 extern int hmac_md5_test(struct IMB_MGR *mb_mgr);
 extern int aes_test(struct IMB_MGR *mb_mgr);
 extern int ecb_test(struct IMB_MGR *mb_mgr);
+extern int xts_test(struct IMB_MGR *mb_mgr);
+extern int cfb_test(struct IMB_MGR *mb_mgr);
 extern int sha_test(struct IMB_MGR *mb_mgr);
 extern int chained_test(struct IMB_MGR *mb_mgr);
 extern int api_test(struct IMB_MGR *mb_mgr);
@@ -170,6 +172,16 @@ struct imb_test tests[] = {
                 .fn = ecb_test,
                 .enabled = 1
         },
+        {
+                .str = "XTS",
+                .fn = xts_test,
+                .enabled = 1
+        },
+        {
+                .str = "CFB",
+                .fn = cfb_test,
+                .enabled = 1
+        },
         {
                 .str = "SHA",
                 .fn = sha_test,
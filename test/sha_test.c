@@ -432,6 +432,24 @@ sha_job_ok(const struct sha_vector *vec,
         return 1;
 }
 
+static IMB_HASH_ALG
+sha_hash_alg(const struct sha_vector *vec)
+{
+        switch (vec->sha_type) {
+        case 1:
+                return IMB_AUTH_SHA_1;
+        case 224:
+                return IMB_AUTH_SHA_224;
+        case 256:
+                return IMB_AUTH_SHA_256;
+        case 384:
+                return IMB_AUTH_SHA_384;
+        case 512:
+        default:
+                return IMB_AUTH_SHA_512;
+        }
+}
+
 static int
 test_sha(struct IMB_MGR *mb_mgr,
          const struct sha_vector *vec,
@@ -477,24 +495,7 @@ test_sha(struct IMB_MGR *mb_mgr,
                 job->src = vec->data;
                 job->msg_len_to_hash_in_bytes = vec->data_len;
                 job->cipher_mode = IMB_CIPHER_NULL;
-                switch (vec->sha_type) {
-                case 1:
-                        job->hash_alg = IMB_AUTH_SHA_1;
-                        break;
-                case 224:
-                        job->hash_alg = IMB_AUTH_SHA_224;
-                        break;
-                case 256:
-                        job->hash_alg = IMB_AUTH_SHA_256;
-                        break;
-                case 384:
-                        job->hash_alg = IMB_AUTH_SHA_384;
-                        break;
-                case 512:
-                default:
-                        job->hash_alg = IMB_AUTH_SHA_512;
-                        break;
-                }
+                job->hash_alg = sha_hash_alg(vec);
 
                 job->user_data = auths[i];
 
@@ -537,6 +538,73 @@ test_sha(struct IMB_MGR *mb_mgr,
         return ret;
 }
 
+static int
+test_sha_burst(struct IMB_MGR *mb_mgr,
+               const struct sha_vector *vec,
+               const int num_jobs)
+{
+        struct IMB_JOB *jobs = malloc(num_jobs * sizeof(*jobs));
+        uint8_t padding[16];
+        uint8_t **auths = malloc(num_jobs * sizeof(void *));
+        int i = 0, ret = -1;
+        uint32_t completed_jobs;
+
+        if (auths == NULL || jobs == NULL) {
+                fprintf(stderr, "Can't allocate buffer memory\n");
+                goto end2;
+        }
+
+        memset(padding, -1, sizeof(padding));
+        memset(auths, 0, num_jobs * sizeof(void *));
+        memset(jobs, 0, num_jobs * sizeof(*jobs));
+
+        for (i = 0; i < num_jobs; i++) {
+                const size_t alloc_len =
+                        vec->digest_len + (sizeof(padding) * 2);
+                struct IMB_JOB *job = &jobs[i];
+
+                auths[i] = malloc(alloc_len);
+                if (auths[i] == NULL) {
+                        fprintf(stderr, "Can't allocate buffer memory\n");
+                        goto end;
+                }
+                memset(auths[i], -1, alloc_len);
+
+                job->auth_tag_output = auths[i] + sizeof(padding);
+                job->auth_tag_output_len_in_bytes = vec->digest_len;
+                job->src = vec->data;
+                job->msg_len_to_hash_in_bytes = vec->data_len;
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(mb_mgr, jobs, num_jobs,
+                                               sha_hash_alg(vec));
+        if (completed_jobs != (uint32_t) num_jobs) {
+                printf("Expected %d jobs, received %u, error %d\n",
+                       num_jobs, completed_jobs, imb_get_errno(mb_mgr));
+                goto end;
+        }
+
+        for (i = 0; i < num_jobs; i++)
+                if (!sha_job_ok(vec, &jobs[i], auths[i],
+                                padding, sizeof(padding)))
+                        goto end;
+        ret = 0;
+
+ end:
+        for (i = 0; i < num_jobs; i++) {
+                if (auths[i] != NULL)
+                        free(auths[i]);
+        }
+
+ end2:
+        if (auths != NULL)
+                free(auths);
+        if (jobs != NULL)
+                free(jobs);
+
+        return ret;
+}
+
 static void
 test_sha_vectors(struct IMB_MGR *mb_mgr,
                  struct test_suite_context *sha1_ctx,
@@ -588,6 +656,13 @@ test_sha_vectors(struct IMB_MGR *mb_mgr,
                 } else {
                         test_suite_update(ctx, 1, 0);
                 }
+
+                if (test_sha_burst(mb_mgr, &sha_vectors[idx], num_jobs)) {
+                        printf("error #%d (hash burst)\n", vect);
+                        test_suite_update(ctx, 0, 1);
+                } else {
+                        test_suite_update(ctx, 1, 0);
+                }
 	}
 }
 
@@ -40,6 +40,13 @@
 #define SNOW3GIVLEN 8
 #define PAD_LEN 16
 
+/* job_api argument of the validate functions */
+enum api_type {
+        TEST_DIRECT_API,
+        TEST_JOB_API,
+        TEST_BURST_API
+};
+
 int snow3g_test(struct IMB_MGR *mb_mgr);
 static void
 validate_snow3g_f8_1_block(struct IMB_MGR *mb_mgr, unsigned int job_api,
@@ -144,14 +151,24 @@ static inline int
 submit_uea2_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                  uint8_t **src, uint8_t **dst, const uint32_t *bitlens,
                  const uint32_t *bit_offsets, int dir,
-                 const unsigned int num_jobs)
+                 const unsigned int num_jobs, const unsigned int job_api)
 {
         IMB_JOB *job;
+        IMB_JOB jobs[NUM_SUPPORTED_BUFFERS];
         unsigned int i;
         unsigned int jobs_rx = 0;
 
+        if (job_api == TEST_BURST_API) {
+                if (num_jobs > NUM_SUPPORTED_BUFFERS)
+                        return -1;
+                memset(jobs, 0, sizeof(jobs));
+        }
+
         for (i = 0; i < num_jobs; i++) {
-                job = IMB_GET_NEXT_JOB(mb_mgr);
+                if (job_api == TEST_BURST_API)
+                        job = &jobs[i];
+                else
+                        job = IMB_GET_NEXT_JOB(mb_mgr);
                 job->cipher_direction = dir;
                 job->chain_order = IMB_ORDER_CIPHER_HASH;
                 job->cipher_mode = IMB_CIPHER_SNOW3G_UEA2_BITLEN;
@@ -166,6 +183,9 @@ submit_uea2_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                 job->msg_len_to_cipher_in_bits = bitlens[i];
                 job->hash_alg = IMB_AUTH_NULL;
 
+                if (job_api == TEST_BURST_API)
+                        continue;
+
                 job = IMB_SUBMIT_JOB(mb_mgr);
                 if (job != NULL) {
                         jobs_rx++;
@@ -177,6 +197,19 @@ submit_uea2_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                 }
         }
 
+        if (job_api == TEST_BURST_API) {
+                jobs_rx = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                  IMB_CIPHER_SNOW3G_UEA2_BITLEN,
+                                                  dir, IMB_KEY_128_BYTES);
+                for (i = 0; i < jobs_rx; i++) {
+                        if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d, job %u",
+                                       __LINE__, jobs[i].status, i);
+                                return -1;
+                        }
+                }
+        }
+
         while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
                 jobs_rx++;
                 if (job->status != IMB_STATUS_COMPLETED) {
@@ -283,6 +316,68 @@ submit_uia2_job(struct IMB_MGR *mb_mgr, uint8_t *key, uint8_t *iv,
         return -1;
 }
 
+#define UIA2_MAX_BURST_JOBS 32
+static inline int
+submit_uia2_burst(struct IMB_MGR *mb_mgr, uint8_t *key, uint8_t *iv,
+                  uint8_t *src, const uint32_t bitlen,
+                  uint8_t *exp_out, const int num_jobs)
+{
+        IMB_JOB jobs[UIA2_MAX_BURST_JOBS];
+        uint8_t tags[UIA2_MAX_BURST_JOBS][DIGEST_LEN];
+        uint32_t completed_jobs;
+        int i;
+
+        if (num_jobs > UIA2_MAX_BURST_JOBS)
+                return -1;
+
+        memset(jobs, 0, sizeof(jobs));
+        memset(tags, 0, sizeof(tags));
+
+        for (i = 0; i < num_jobs; i++) {
+                IMB_JOB *job = &jobs[i];
+
+                job->chain_order = IMB_ORDER_CIPHER_HASH;
+                job->cipher_mode = IMB_CIPHER_NULL;
+                job->src = src;
+                job->u.SNOW3G_UIA2._iv = iv;
+                job->u.SNOW3G_UIA2._key = key;
+
+                job->hash_start_src_offset_in_bytes = 0;
+                job->msg_len_to_hash_in_bits = bitlen;
+                job->auth_tag_output = tags[i];
+                job->auth_tag_output_len_in_bytes = 4;
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(mb_mgr, jobs, num_jobs,
+                                               IMB_AUTH_SNOW3G_UIA2_BITLEN);
+        if (completed_jobs != (uint32_t) num_jobs) {
+                const int err = imb_get_errno(mb_mgr);
+
+                printf("Expected %d jobs from burst, received %u\n",
+                       num_jobs, completed_jobs);
+                if (err != 0)
+                        printf("Error: %s!\n", imb_get_strerror(err));
+                return -1;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                        printf("%d error status:%d", __LINE__, jobs[i].status);
+                        return -1;
+                }
+                /*Compare the digest with the expected in the vectors*/
+                if (memcmp(tags[i], exp_out, DIGEST_LEN) != 0) {
+                        printf("IMB_AUTH_SNOW3G_UIA2_BITLEN "
+                               "burst job num:%d\n", i);
+                        snow3g_hexdump("Actual:", tags[i], DIGEST_LEN);
+                        snow3g_hexdump("Expected:", exp_out, DIGEST_LEN);
+                        return -1;
+                }
+        }
+
+        return 0;
+}
+
 static void
 validate_snow3g_f8_1_block(struct IMB_MGR *mb_mgr, uint32_t job_api,
                            struct test_suite_context *uea2_ctx,
@@ -364,7 +459,7 @@ validate_snow3g_f8_1_block(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          &pIV, &pSrcBuff, &pSrcBuff,
                                          &bit_len, &bit_offset,
-                                         IMB_DIR_ENCRYPT, 1);
+                                         IMB_DIR_ENCRYPT, 1, job_api);
                 } else
                         IMB_SNOW3G_F8_1_BUFFER(mb_mgr, pKeySched, pIV, srcBuff,
                                                srcBuff, length);
@@ -388,7 +483,7 @@ validate_snow3g_f8_1_block(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          &pIV, &pSrcBuff, &pSrcBuff,
                                          &bit_len, &bit_offset,
-                                         IMB_DIR_ENCRYPT, 1);
+                                         IMB_DIR_ENCRYPT, 1, job_api);
                 } else
                         IMB_SNOW3G_F8_1_BUFFER(mb_mgr, pKeySched, pIV, srcBuff,
                                                srcBuff, length);
@@ -579,7 +674,7 @@ validate_snow3g_f8_1_bitblock(struct IMB_MGR *mb_mgr,
                                                  &pIV, &srcBufAftPad,
                                                  &midBufAftPad,
                                                  &bit_len, &head_offset,
-                                                 IMB_DIR_ENCRYPT, 1);
+                                                 IMB_DIR_ENCRYPT, 1, job_api);
                         else
                                 IMB_SNOW3G_F8_1_BUFFER_BIT(mb_mgr, pKeySched,
                                                            pIV, srcBufAftPad,
@@ -637,7 +732,7 @@ validate_snow3g_f8_1_bitblock(struct IMB_MGR *mb_mgr,
                                                  &pIV, &dstBufAftPad,
                                                  &midBufAftPad,
                                                  &bit_len, &head_offset,
-                                                 IMB_DIR_DECRYPT, 1);
+                                                 IMB_DIR_DECRYPT, 1, job_api);
                         else
                                 IMB_SNOW3G_F8_1_BUFFER_BIT(mb_mgr, pKeySched,
                                                            pIV, dstBufAftPad,
@@ -804,7 +899,7 @@ validate_snow3g_f8_2_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, 2);
+                                         IMB_DIR_ENCRYPT, 2, job_api);
                 else
                         IMB_SNOW3G_F8_2_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pSrcBuff[0], pSrcBuff[0],
@@ -836,7 +931,7 @@ validate_snow3g_f8_2_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, 2);
+                                         IMB_DIR_DECRYPT, 2, job_api);
                 else
                         IMB_SNOW3G_F8_2_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pSrcBuff[0], pSrcBuff[0],
@@ -864,7 +959,7 @@ validate_snow3g_f8_2_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, 2);
+                                         IMB_DIR_ENCRYPT, 2, job_api);
                 else
                         IMB_SNOW3G_F8_2_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pSrcBuff[0], pDstBuff[0],
@@ -898,7 +993,7 @@ validate_snow3g_f8_2_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, 2);
+                                         IMB_DIR_DECRYPT, 2, job_api);
                 else
                         IMB_SNOW3G_F8_2_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pSrcBuff[0], pDstBuff[0],
@@ -1070,7 +1165,7 @@ validate_snow3g_f8_4_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, 4);
+                                         IMB_DIR_ENCRYPT, 4, job_api);
                 else
                         IMB_SNOW3G_F8_4_BUFFER(mb_mgr, pKeySched[0],
                                                pIV[0], pIV[1], pIV[2], pIV[3],
@@ -1106,7 +1201,7 @@ validate_snow3g_f8_4_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, 4);
+                                         IMB_DIR_DECRYPT, 4, job_api);
                 else
                         IMB_SNOW3G_F8_4_BUFFER(mb_mgr, pKeySched[0],
                                                pIV[0], pIV[1], pIV[2], pIV[3],
@@ -1137,7 +1232,7 @@ validate_snow3g_f8_4_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, 4);
+                                         IMB_DIR_ENCRYPT, 4, job_api);
                 else
                         IMB_SNOW3G_F8_4_BUFFER(mb_mgr, pKeySched[0],
                                                pIV[0], pIV[1], pIV[2], pIV[3],
@@ -1174,7 +1269,7 @@ validate_snow3g_f8_4_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, 4);
+                                         IMB_DIR_DECRYPT, 4, job_api);
                 else
                         IMB_SNOW3G_F8_4_BUFFER(mb_mgr, pKeySched[0],
                                                pIV[0], pIV[1], pIV[2], pIV[3],
@@ -1279,7 +1374,8 @@ validate_snow3g_f8_4_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
         if (job_api)
                 submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                  pIV, pSrcBuff, pDstBuff,
-                                 bitLens, bitOffsets, IMB_DIR_ENCRYPT, 4);
+                                 bitLens, bitOffsets, IMB_DIR_ENCRYPT, 4,
+                                 job_api);
         else
                 IMB_SNOW3G_F8_4_BUFFER(mb_mgr, pKeySched[0], pIV[0], pIV[1],
                                        pIV[2], pIV[3], pSrcBuff[0], pDstBuff[0],
@@ -1426,7 +1522,7 @@ validate_snow3g_f8_8_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, 8);
+                                         IMB_DIR_ENCRYPT, 8, job_api);
                 else
                         IMB_SNOW3G_F8_8_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pIV[2], pIV[3], pIV[4],
@@ -1464,7 +1560,7 @@ validate_snow3g_f8_8_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pDstBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, 8);
+                                         IMB_DIR_DECRYPT, 8, job_api);
                 else
                         IMB_SNOW3G_F8_8_BUFFER(mb_mgr, pKeySched[0], pIV[0],
                                                pIV[1], pIV[2], pIV[3], pIV[4],
@@ -1576,7 +1672,8 @@ validate_snow3g_f8_8_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
         if (job_api)
                 submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                  pIV, pSrcBuff, pDstBuff,
-                                 bitLens, bitOffsets, IMB_DIR_ENCRYPT, 8);
+                                 bitLens, bitOffsets, IMB_DIR_ENCRYPT, 8,
+                                 job_api);
         else
                 IMB_SNOW3G_F8_8_BUFFER(mb_mgr, pKeySched[0], pIV[0], pIV[1],
                                        pIV[2], pIV[3], pIV[4], pIV[5], pIV[6],
@@ -1726,7 +1823,7 @@ validate_snow3g_f8_8_blocks_multi_key(struct IMB_MGR *mb_mgr,
         if (job_api)
                 submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched, pIV, pSrcBuff,
                                  pDstBuff, bitLens, bitOffsets,
-                                 IMB_DIR_ENCRYPT, 8);
+                                 IMB_DIR_ENCRYPT, 8, job_api);
         else
                 IMB_SNOW3G_F8_8_BUFFER_MULTIKEY(mb_mgr,
                                         (const snow3g_key_schedule_t * const *)
@@ -1755,7 +1852,7 @@ validate_snow3g_f8_8_blocks_multi_key(struct IMB_MGR *mb_mgr,
         if (job_api)
                 submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched, pIV, pSrcBuff,
                                  pDstBuff, bitLens, bitOffsets,
-                                 IMB_DIR_DECRYPT, 8);
+                                 IMB_DIR_DECRYPT, 8, job_api);
         else
                 IMB_SNOW3G_F8_8_BUFFER_MULTIKEY(mb_mgr,
                         (const snow3g_key_schedule_t * const *) pKeySched,
@@ -1903,7 +2000,7 @@ validate_snow3g_f8_n_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, i + 1);
+                                         IMB_DIR_ENCRYPT, i + 1, job_api);
                 } else {
                         IMB_SNOW3G_F8_N_BUFFER(mb_mgr, *pKeySched,
                                                (const void * const *)pIV,
@@ -1931,7 +2028,7 @@ validate_snow3g_f8_n_blocks(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, i + 1);
+                                         IMB_DIR_DECRYPT, i + 1, job_api);
                 } else {
                         IMB_SNOW3G_F8_N_BUFFER(mb_mgr, *pKeySched,
                                                (const void * const *)pIV,
@@ -2115,7 +2212,8 @@ validate_snow3g_f8_n_blocks_linear(struct IMB_MGR *mb_mgr, uint32_t job_api,
                 if (job_api) {
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched, pIV,
                                          pSrcBuff_const, pDstBuff, bitLens,
-                                         bitOffsets, IMB_DIR_ENCRYPT, i + 1);
+                                         bitOffsets, IMB_DIR_ENCRYPT, i + 1,
+                                         job_api);
                 } else {
                         IMB_SNOW3G_F8_N_BUFFER(mb_mgr, *pKeySched,
                                                (const void *const *)pIV,
@@ -2148,7 +2246,8 @@ validate_snow3g_f8_n_blocks_linear(struct IMB_MGR *mb_mgr, uint32_t job_api,
                 if (job_api) {
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched, pIV,
                                          pDstBuff_const, pSrcBuff, bitLens,
-                                         bitOffsets, IMB_DIR_DECRYPT, i + 1);
+                                         bitOffsets, IMB_DIR_DECRYPT, i + 1,
+                                         job_api);
                 } else {
                         IMB_SNOW3G_F8_N_BUFFER(mb_mgr, *pKeySched,
                                                (const void *const *)pIV,
@@ -2369,7 +2468,8 @@ validate_snow3g_f8_n_blocks_linear_mkeys(struct IMB_MGR *mb_mgr,
                                                  &pSrcBuff_const[idx],
                                                  &pDstBuff[idx], &bitLens[idx],
                                                  &bitOffsets[idx],
-                                                 IMB_DIR_ENCRYPT, nb_elem);
+                                                 IMB_DIR_ENCRYPT, nb_elem,
+                                                 job_api);
                         } else {
                                 IMB_SNOW3G_F8_N_BUFFER_MULTIKEY(
                                     mb_mgr,
@@ -2422,7 +2522,8 @@ validate_snow3g_f8_n_blocks_linear_mkeys(struct IMB_MGR *mb_mgr,
                                                  &pDstBuff_const[idx],
                                                  &pSrcBuff[idx], &bitLens[idx],
                                                  &bitOffsets[idx],
-                                                 IMB_DIR_DECRYPT, nb_elem);
+                                                 IMB_DIR_DECRYPT, nb_elem,
+                                                 job_api);
                         } else {
                                 IMB_SNOW3G_F8_N_BUFFER_MULTIKEY(
                                     mb_mgr,
@@ -2597,7 +2698,7 @@ validate_snow3g_f8_n_blocks_multi(struct IMB_MGR *mb_mgr,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pSrcBuff, pDstBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_ENCRYPT, i + 1);
+                                         IMB_DIR_ENCRYPT, i + 1, job_api);
                 else
                         IMB_SNOW3G_F8_N_BUFFER_MULTIKEY(mb_mgr,
                                 (const snow3g_key_schedule_t * const *)
@@ -2627,7 +2728,7 @@ validate_snow3g_f8_n_blocks_multi(struct IMB_MGR *mb_mgr,
                         submit_uea2_jobs(mb_mgr, (uint8_t **)&pKeySched,
                                          pIV, pDstBuff, pSrcBuff,
                                          bitLens, bitOffsets,
-                                         IMB_DIR_DECRYPT, i + 1);
+                                         IMB_DIR_DECRYPT, i + 1, job_api);
                 else
                         IMB_SNOW3G_F8_N_BUFFER_MULTIKEY(mb_mgr,
                                 (const snow3g_key_schedule_t * const *)
@@ -2749,15 +2850,27 @@ validate_snow3g_f9(struct IMB_MGR *mb_mgr, uint32_t job_api,
                         };
 
                         for (j = 0; j < DIM(num_jobs_tab); j++) {
-                                int ret = submit_uia2_job(mb_mgr,
+                                int ret;
+
+                                if (job_api == TEST_BURST_API)
+                                        ret = submit_uia2_burst(mb_mgr,
+                                                    (uint8_t *)pKeySched,
+                                                    pIV, srcBuff,
+                                                    testVectors[i].lengthInBits,
+                                                    testVectors[i].exp_out,
+                                                    num_jobs_tab[j]);
+                                else
+                                        ret = submit_uia2_job(mb_mgr,
                                                     (uint8_t *)pKeySched,
                                                     pIV, srcBuff, digest,
                                                     testVectors[i].lengthInBits,
                                                     testVectors[i].exp_out,
                                                     num_jobs_tab[j]);
                                 if (ret < 0) {
-                                        printf("IMB_SNOW3G_F9 JOB API "
-                                               "vector num:%d\n", i);
+                                        printf("IMB_SNOW3G_F9 %s "
+                                               "vector num:%d\n",
+                                               job_api == TEST_BURST_API ?
+                                               "BURST API" : "JOB API", i);
                                         goto snow3g_f9_1_buffer_exit;
                                 }
                         }
@@ -2893,6 +3006,11 @@ int snow3g_test(struct IMB_MGR *mb_mgr)
         for (i = 0; i < DIM(snow3g_func_tab); i++)
                 snow3g_func_tab[i].func(mb_mgr, 1, &uea2_ctx, &uia2_ctx);
 
+        /* validate burst api */
+        for (i = 0; i < DIM(snow3g_func_tab); i++)
+                snow3g_func_tab[i].func(mb_mgr, TEST_BURST_API, &uea2_ctx,
+                                        &uia2_ctx);
+
         errors += test_suite_end(&uea2_ctx);
         errors += test_suite_end(&uia2_ctx);
 
@@ -981,6 +981,8 @@ snow_v_single_test(IMB_MGR *p_mgr,
         job->msg_len_to_cipher_in_bytes = size;
 
         job = IMB_SUBMIT_JOB(p_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(p_mgr);
         if (job == NULL) {
                 const int err = imb_get_errno(p_mgr);
 
@@ -1065,6 +1067,8 @@ snow_v_aead_single_test(IMB_MGR *p_mgr,
         job->u.SNOW_V_AEAD.aad_len_in_bytes = aad_len;
 
         job = IMB_SUBMIT_JOB(p_mgr);
+        if (job == NULL)
+                job = IMB_FLUSH_JOB(p_mgr);
         if (job == NULL) {
                 const int err = imb_get_errno(p_mgr);
 
@@ -1094,6 +1098,211 @@ snow_v_aead_single_test(IMB_MGR *p_mgr,
         free(output);
 }
 
+/* number of AEAD jobs submitted at once (more than the max lane count) */
+#define SNOW_V_AEAD_MULTI_JOBS 17
+
+/*
+ * Submits all SNOW-V (or SNOW-V-AEAD) jobs before the first flush,
+ * so the multi-buffer managers run them side by side in all lanes.
+ * Completed jobs are only checked for status here; outputs are compared
+ * once all jobs are back.
+ */
+static uint32_t
+snow_v_multi_submit(IMB_MGR *p_mgr, uint32_t *jobs_rx)
+{
+        struct IMB_JOB *job;
+        uint32_t fail = 0;
+
+        job = IMB_SUBMIT_JOB(p_mgr);
+        while (job != NULL) {
+                (*jobs_rx)++;
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("job %u: status %d\n",
+                               (unsigned) (uintptr_t) job->user_data,
+                               (int) job->status);
+                        fail++;
+                }
+                job = IMB_GET_COMPLETED_JOB(p_mgr);
+        }
+        return fail;
+}
+
+static uint32_t
+snow_v_multi_flush(IMB_MGR *p_mgr, uint32_t *jobs_rx)
+{
+        struct IMB_JOB *job;
+        uint32_t fail = 0;
+
+        while ((job = IMB_FLUSH_JOB(p_mgr)) != NULL) {
+                (*jobs_rx)++;
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("job %u: status %d\n",
+                               (unsigned) (uintptr_t) job->user_data,
+                               (int) job->status);
+                        fail++;
+                }
+        }
+        return fail;
+}
+
+static void
+snow_v_multi_test(IMB_MGR *p_mgr, struct test_suite_context *ts)
+{
+        const uint32_t num_jobs = DIM(snow_v_vectors_cov);
+        const size_t pad_size = 16;
+        const int pad_pattern = 0xa5;
+        uint8_t *output[DIM(snow_v_vectors_cov)];
+        uint32_t i, jobs_rx = 0, fail = 0;
+        struct IMB_JOB *job;
+
+        for (i = 0; i < num_jobs; i++) {
+                const size_t alloc_size =
+                        snow_v_vectors_cov[i].length_in_bytes + 2 * pad_size;
+
+                output[i] = malloc(alloc_size);
+                if (output[i] == NULL) {
+                        fprintf(stderr, "Error allocating %lu bytes!\n",
+                                (unsigned long) alloc_size);
+                        exit(EXIT_FAILURE);
+                }
+                memset(output[i], pad_pattern, alloc_size);
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                job = IMB_GET_NEXT_JOB(p_mgr);
+
+                job->cipher_direction = IMB_DIR_ENCRYPT;
+                job->chain_order = IMB_ORDER_HASH_CIPHER;
+                job->cipher_mode = IMB_CIPHER_SNOW_V;
+                job->hash_alg = IMB_AUTH_NULL;
+                job->key_len_in_bytes = 32;
+                job->iv_len_in_bytes = 16;
+                job->cipher_start_src_offset_in_bytes = 0;
+
+                job->enc_keys = snow_v_vectors_cov[i].KEY;
+                job->iv = snow_v_vectors_cov[i].IV;
+                job->dst = &output[i][pad_size];
+                job->src = snow_v_vectors_cov[i].plaintext;
+                job->msg_len_to_cipher_in_bytes =
+                        snow_v_vectors_cov[i].length_in_bytes;
+                job->user_data = (void *) (uintptr_t) i;
+
+                fail += snow_v_multi_submit(p_mgr, &jobs_rx);
+        }
+        fail += snow_v_multi_flush(p_mgr, &jobs_rx);
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %u jobs, received %u\n", num_jobs, jobs_rx);
+                fail++;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const size_t size = snow_v_vectors_cov[i].length_in_bytes;
+                uint32_t fail_found;
+
+                fail_found = compare(&output[i][pad_size],
+                                     snow_v_vectors_cov[i].ciphertext, size);
+                fail_found += check_buffer_over_under_write(
+                                output[i], pad_pattern,
+                                pad_size, size + 2 * pad_size);
+                if (fail_found) {
+                        printf("SNOW-V multi-buffer vector %u failed\n", i);
+                        fail++;
+                }
+                free(output[i]);
+        }
+
+        test_suite_update(ts, fail == 0, fail != 0);
+}
+
+static void
+snow_v_aead_multi_test(IMB_MGR *p_mgr, struct test_suite_context *ts,
+                       const int dir_encrypt)
+{
+        const uint32_t num_jobs = SNOW_V_AEAD_MULTI_JOBS;
+        const size_t pad_size = 16;
+        const int pad_pattern = 0xa5;
+        uint8_t *output[SNOW_V_AEAD_MULTI_JOBS];
+        uint32_t i, jobs_rx = 0, fail = 0;
+        struct IMB_JOB *job;
+
+        for (i = 0; i < num_jobs; i++) {
+                const snow_v_aead_test_vectors_t *vec =
+                        &snow_v_aead_test_vectors[i %
+                                DIM(snow_v_aead_test_vectors)];
+                /* alloc space for auth tag after output */
+                const size_t alloc_size =
+                        vec->length_in_bytes + 16 + 2 * pad_size;
+
+                output[i] = malloc(alloc_size);
+                if (output[i] == NULL) {
+                        fprintf(stderr, "Error allocating %lu bytes!\n",
+                                (unsigned long) alloc_size);
+                        exit(EXIT_FAILURE);
+                }
+                memset(output[i], pad_pattern, alloc_size);
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const snow_v_aead_test_vectors_t *vec =
+                        &snow_v_aead_test_vectors[i %
+                                DIM(snow_v_aead_test_vectors)];
+                uint8_t *dst_ptr = &output[i][pad_size];
+
+                job = IMB_GET_NEXT_JOB(p_mgr);
+
+                job->chain_order = IMB_ORDER_HASH_CIPHER;
+                job->hash_alg = IMB_AUTH_SNOW_V_AEAD;
+                job->cipher_mode = IMB_CIPHER_SNOW_V_AEAD;
+                job->key_len_in_bytes = 32;
+                job->iv_len_in_bytes = 16;
+                job->cipher_start_src_offset_in_bytes = 0;
+                job->enc_keys = vec->KEY;
+                job->iv = vec->IV;
+                job->cipher_direction = dir_encrypt ? IMB_DIR_ENCRYPT :
+                        IMB_DIR_DECRYPT;
+                job->src = dir_encrypt ? vec->plaintext : vec->ciphertext;
+                job->dst = dst_ptr;
+                job->auth_tag_output = dst_ptr + vec->length_in_bytes;
+                job->auth_tag_output_len_in_bytes = 16;
+                job->msg_len_to_cipher_in_bytes = vec->length_in_bytes;
+                job->u.SNOW_V_AEAD.aad = vec->aad;
+                job->u.SNOW_V_AEAD.aad_len_in_bytes = vec->aad_length_in_bytes;
+                job->user_data = (void *) (uintptr_t) i;
+
+                fail += snow_v_multi_submit(p_mgr, &jobs_rx);
+        }
+        fail += snow_v_multi_flush(p_mgr, &jobs_rx);
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %u jobs, received %u\n", num_jobs, jobs_rx);
+                fail++;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const snow_v_aead_test_vectors_t *vec =
+                        &snow_v_aead_test_vectors[i %
+                                DIM(snow_v_aead_test_vectors)];
+                const size_t size = vec->length_in_bytes;
+                const uint8_t *dst_ptr = &output[i][pad_size];
+                uint32_t fail_found;
+
+                fail_found = compare(dst_ptr + size, vec->ciphertext + size,
+                                     16);
+                fail_found += compare(dst_ptr, dir_encrypt ?
+                                      vec->ciphertext : vec->plaintext, size);
+                fail_found += check_buffer_over_under_write(
+                                output[i], pad_pattern,
+                                pad_size, size + 16 + 2 * pad_size);
+                if (fail_found) {
+                        printf("SNOW-V-AEAD multi-buffer job %u failed\n", i);
+                        fail++;
+                }
+                free(output[i]);
+        }
+
+        test_suite_update(ts, fail == 0, fail != 0);
+}
 
 int snow_v_test(IMB_MGR *p_mgr)
 {
@@ -1117,6 +1326,9 @@ int snow_v_test(IMB_MGR *p_mgr)
                         snow_v_vectors_cov[i].length_in_bytes,
                         snow_v_vectors_cov[i].ciphertext);
 
+        printf("SNOW-V test vectors - all jobs in flight\n");
+        snow_v_multi_test(p_mgr, &ts_snow_v);
+
         errors += test_suite_end(&ts_snow_v);
 
         /* Test SNOW-V-GCM */
@@ -1143,6 +1355,10 @@ int snow_v_test(IMB_MGR *p_mgr)
                         snow_v_aead_test_vectors[i].length_in_bytes,
                         snow_v_aead_test_vectors[i].aad_length_in_bytes,
                         snow_v_aead_test_vectors[i].ciphertext, 0);
+
+        printf("SNOW-V-AEAD test vectors - all jobs in flight\n");
+        snow_v_aead_multi_test(p_mgr, &ts_snow_v_aead, 1);
+        snow_v_aead_multi_test(p_mgr, &ts_snow_v_aead, 0);
         errors += test_suite_end(&ts_snow_v_aead);
 
 
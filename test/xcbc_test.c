@@ -354,15 +354,18 @@ test_xcbc(struct IMB_MGR *mb_mgr,
         struct IMB_JOB *job;
         uint8_t padding[16];
         uint8_t **auths = malloc(num_jobs * sizeof(void *));
+        struct IMB_JOB *jobs = malloc(num_jobs * sizeof(*jobs));
+        uint32_t completed_jobs;
         int i = 0, jobs_rx = 0, ret = -1;
 
-        if (auths == NULL) {
+        if (auths == NULL || jobs == NULL) {
 		fprintf(stderr, "Can't allocate buffer memory\n");
 		goto end2;
         }
 
         memset(padding, -1, sizeof(padding));
         memset(auths, 0, num_jobs * sizeof(void *));
+        memset(jobs, 0, num_jobs * sizeof(*jobs));
 
         for (i = 0; i < num_jobs; i++) {
                 auths[i] = malloc(16 + (sizeof(padding) * 2));
@@ -467,6 +470,42 @@ test_xcbc(struct IMB_MGR *mb_mgr,
                 }
         }
 
+        /**
+         * Submit all jobs through the hash burst API
+         */
+        for (i = 0; i < num_jobs; i++) {
+                job = &jobs[i];
+
+                memset(auths[i], -1, 16 + (sizeof(padding) * 2));
+
+                job->cipher_direction = dir;
+                job->chain_order = IMB_ORDER_HASH_CIPHER;
+                job->cipher_mode = IMB_CIPHER_NULL;
+                job->msg_len_to_hash_in_bytes = vec->len;
+                job->u.XCBC._k1_expanded = k1_exp;
+                job->u.XCBC._k2 = k2;
+                job->u.XCBC._k3 = k3;
+                job->src = vec->M;
+                job->hash_start_src_offset_in_bytes = 0;
+                job->auth_tag_output = auths[i] + sizeof(padding);
+                job->auth_tag_output_len_in_bytes = vec->T_len;
+                job->user_data = auths[i];
+        }
+
+        completed_jobs = IMB_SUBMIT_HASH_BURST(mb_mgr, jobs, num_jobs,
+                                               IMB_AUTH_AES_XCBC);
+        if (completed_jobs != (uint32_t) num_jobs) {
+                printf("Expected %d jobs from burst, received %u, "
+                       "error %d\n", num_jobs, completed_jobs,
+                       imb_get_errno(mb_mgr));
+                goto end;
+        }
+
+        for (i = 0; i < num_jobs; i++)
+                if (!xcbc_job_ok(vec, &jobs[i], jobs[i].user_data, padding,
+                                 sizeof(padding)))
+                        goto end;
+
         ret = 0;
 
  end:
@@ -481,6 +520,8 @@ test_xcbc(struct IMB_MGR *mb_mgr,
  end2:
         if (auths != NULL)
                 free(auths);
+        if (jobs != NULL)
+                free(jobs);
 
         return ret;
 }
@@ -0,0 +1,908 @@
+/*****************************************************************************
+ Copyright (c) 2022, Intel Corporation
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+     * Redistributions of source code must retain the above copyright notice,
+       this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of Intel Corporation nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include <intel-ipsec-mb.h>
+
+#include "gcm_ctr_vectors_test.h"
+#include "utils.h"
+
+int xts_test(struct IMB_MGR *mb_mgr);
+
+struct xts_vector {
+        const uint8_t *K;          /* data key (Key1) */
+        const uint8_t *TK;         /* tweak key (Key2) */
+        const uint8_t *IV;         /* tweak (data unit sequence number) */
+        const uint8_t *P;          /* plain text */
+        uint64_t       Plen;       /* plain text length */
+        const uint8_t *C;          /* cipher text - same length as plain text */
+        uint32_t       Klen;       /* key length */
+};
+
+/*
+ * Vectors 1 to 4 are from IEEE P1619/D16 (XTS-AES-128 vectors 1, 2, 4
+ * and 15), vector 6 is XTS-AES-256 vector 10.
+ * Vectors 5 and 7 exercise ciphertext stealing with partial last blocks.
+ */
+static const uint8_t K1[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t TK1[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t IV1[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P1[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t C1[] = {
+        0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec,
+        0x9b, 0x9f, 0xe9, 0xa3, 0xea, 0xdd, 0xa6, 0x92,
+        0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98, 0xed, 0x85,
+        0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e
+};
+
+static const uint8_t K2[] = {
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+};
+static const uint8_t TK2[] = {
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22
+};
+static const uint8_t IV2[] = {
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P2[] = {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
+};
+static const uint8_t C2[] = {
+        0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e,
+        0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+        0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4,
+        0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0
+};
+
+static const uint8_t K3[] = {
+        0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+        0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26
+};
+static const uint8_t TK3[] = {
+        0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+        0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95
+};
+static const uint8_t IV3[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P3[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+        0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+        0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+        0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+        0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+        0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+        0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+        0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+        0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+        0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+        0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+        0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+        0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+        0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+        0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const uint8_t C3[] = {
+        0x27, 0xa7, 0x47, 0x9b, 0xef, 0xa1, 0xd4, 0x76,
+        0x48, 0x9f, 0x30, 0x8c, 0xd4, 0xcf, 0xa6, 0xe2,
+        0xa9, 0x6e, 0x4b, 0xbe, 0x32, 0x08, 0xff, 0x25,
+        0x28, 0x7d, 0xd3, 0x81, 0x96, 0x16, 0xe8, 0x9c,
+        0xc7, 0x8c, 0xf7, 0xf5, 0xe5, 0x43, 0x44, 0x5f,
+        0x83, 0x33, 0xd8, 0xfa, 0x7f, 0x56, 0x00, 0x00,
+        0x05, 0x27, 0x9f, 0xa5, 0xd8, 0xb5, 0xe4, 0xad,
+        0x40, 0xe7, 0x36, 0xdd, 0xb4, 0xd3, 0x54, 0x12,
+        0x32, 0x80, 0x63, 0xfd, 0x2a, 0xab, 0x53, 0xe5,
+        0xea, 0x1e, 0x0a, 0x9f, 0x33, 0x25, 0x00, 0xa5,
+        0xdf, 0x94, 0x87, 0xd0, 0x7a, 0x5c, 0x92, 0xcc,
+        0x51, 0x2c, 0x88, 0x66, 0xc7, 0xe8, 0x60, 0xce,
+        0x93, 0xfd, 0xf1, 0x66, 0xa2, 0x49, 0x12, 0xb4,
+        0x22, 0x97, 0x61, 0x46, 0xae, 0x20, 0xce, 0x84,
+        0x6b, 0xb7, 0xdc, 0x9b, 0xa9, 0x4a, 0x76, 0x7a,
+        0xae, 0xf2, 0x0c, 0x0d, 0x61, 0xad, 0x02, 0x65,
+        0x5e, 0xa9, 0x2d, 0xc4, 0xc4, 0xe4, 0x1a, 0x89,
+        0x52, 0xc6, 0x51, 0xd3, 0x31, 0x74, 0xbe, 0x51,
+        0xa1, 0x0c, 0x42, 0x11, 0x10, 0xe6, 0xd8, 0x15,
+        0x88, 0xed, 0xe8, 0x21, 0x03, 0xa2, 0x52, 0xd8,
+        0xa7, 0x50, 0xe8, 0x76, 0x8d, 0xef, 0xff, 0xed,
+        0x91, 0x22, 0x81, 0x0a, 0xae, 0xb9, 0x9f, 0x91,
+        0x72, 0xaf, 0x82, 0xb6, 0x04, 0xdc, 0x4b, 0x8e,
+        0x51, 0xbc, 0xb0, 0x82, 0x35, 0xa6, 0xf4, 0x34,
+        0x13, 0x32, 0xe4, 0xca, 0x60, 0x48, 0x2a, 0x4b,
+        0xa1, 0xa0, 0x3b, 0x3e, 0x65, 0x00, 0x8f, 0xc5,
+        0xda, 0x76, 0xb7, 0x0b, 0xf1, 0x69, 0x0d, 0xb4,
+        0xea, 0xe2, 0x9c, 0x5f, 0x1b, 0xad, 0xd0, 0x3c,
+        0x5c, 0xcf, 0x2a, 0x55, 0xd7, 0x05, 0xdd, 0xcd,
+        0x86, 0xd4, 0x49, 0x51, 0x1c, 0xeb, 0x7e, 0xc3,
+        0x0b, 0xf1, 0x2b, 0x1f, 0xa3, 0x5b, 0x91, 0x3f,
+        0x9f, 0x74, 0x7a, 0x8a, 0xfd, 0x1b, 0x13, 0x0e,
+        0x94, 0xbf, 0xf9, 0x4e, 0xff, 0xd0, 0x1a, 0x91,
+        0x73, 0x5c, 0xa1, 0x72, 0x6a, 0xcd, 0x0b, 0x19,
+        0x7c, 0x4e, 0x5b, 0x03, 0x39, 0x36, 0x97, 0xe1,
+        0x26, 0x82, 0x6f, 0xb6, 0xbb, 0xde, 0x8e, 0xcc,
+        0x1e, 0x08, 0x29, 0x85, 0x16, 0xe2, 0xc9, 0xed,
+        0x03, 0xff, 0x3c, 0x1b, 0x78, 0x60, 0xf6, 0xde,
+        0x76, 0xd4, 0xce, 0xcd, 0x94, 0xc8, 0x11, 0x98,
+        0x55, 0xef, 0x52, 0x97, 0xca, 0x67, 0xe9, 0xf3,
+        0xe7, 0xff, 0x72, 0xb1, 0xe9, 0x97, 0x85, 0xca,
+        0x0a, 0x7e, 0x77, 0x20, 0xc5, 0xb3, 0x6d, 0xc6,
+        0xd7, 0x2c, 0xac, 0x95, 0x74, 0xc8, 0xcb, 0xbc,
+        0x2f, 0x80, 0x1e, 0x23, 0xe5, 0x6f, 0xd3, 0x44,
+        0xb0, 0x7f, 0x22, 0x15, 0x4b, 0xeb, 0xa0, 0xf0,
+        0x8c, 0xe8, 0x89, 0x1e, 0x64, 0x3e, 0xd9, 0x95,
+        0xc9, 0x4d, 0x9a, 0x69, 0xc9, 0xf1, 0xb5, 0xf4,
+        0x99, 0x02, 0x7a, 0x78, 0x57, 0x2a, 0xee, 0xbd,
+        0x74, 0xd2, 0x0c, 0xc3, 0x98, 0x81, 0xc2, 0x13,
+        0xee, 0x77, 0x0b, 0x10, 0x10, 0xe4, 0xbe, 0xa7,
+        0x18, 0x84, 0x69, 0x77, 0xae, 0x11, 0x9f, 0x7a,
+        0x02, 0x3a, 0xb5, 0x8c, 0xca, 0x0a, 0xd7, 0x52,
+        0xaf, 0xe6, 0x56, 0xbb, 0x3c, 0x17, 0x25, 0x6a,
+        0x9f, 0x6e, 0x9b, 0xf1, 0x9f, 0xdd, 0x5a, 0x38,
+        0xfc, 0x82, 0xbb, 0xe8, 0x72, 0xc5, 0x53, 0x9e,
+        0xdb, 0x60, 0x9e, 0xf4, 0xf7, 0x9c, 0x20, 0x3e,
+        0xbb, 0x14, 0x0f, 0x2e, 0x58, 0x3c, 0xb2, 0xad,
+        0x15, 0xb4, 0xaa, 0x5b, 0x65, 0x50, 0x16, 0xa8,
+        0x44, 0x92, 0x77, 0xdb, 0xd4, 0x77, 0xef, 0x2c,
+        0x8d, 0x6c, 0x01, 0x7d, 0xb7, 0x38, 0xb1, 0x8d,
+        0xeb, 0x4a, 0x42, 0x7d, 0x19, 0x23, 0xce, 0x3f,
+        0xf2, 0x62, 0x73, 0x57, 0x79, 0xa4, 0x18, 0xf2,
+        0x0a, 0x28, 0x2d, 0xf9, 0x20, 0x14, 0x7b, 0xea,
+        0xbe, 0x42, 0x1e, 0xe5, 0x31, 0x9d, 0x05, 0x68
+};
+
+static const uint8_t K4[] = {
+        0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8,
+        0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xf1, 0xf0
+};
+static const uint8_t TK4[] = {
+        0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8,
+        0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0
+};
+static const uint8_t IV4[] = {
+        0x9a, 0x78, 0x56, 0x34, 0x12, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P4[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10
+};
+static const uint8_t C4[] = {
+        0x6c, 0x16, 0x25, 0xdb, 0x46, 0x71, 0x52, 0x2d,
+        0x3d, 0x75, 0x99, 0x60, 0x1d, 0xe7, 0xca, 0x09,
+        0xed
+};
+
+static const uint8_t K5[] = {
+        0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8,
+        0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xf1, 0xf0
+};
+static const uint8_t TK5[] = {
+        0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8,
+        0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0
+};
+static const uint8_t IV5[] = {
+        0x9a, 0x78, 0x56, 0x34, 0x12, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P5[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13
+};
+static const uint8_t C5[] = {
+        0x9d, 0x84, 0xc8, 0x13, 0xf7, 0x19, 0xaa, 0x2c,
+        0x7b, 0xe3, 0xf6, 0x61, 0x71, 0xc7, 0xc5, 0xc2,
+        0xed, 0xbf, 0x9d, 0xac
+};
+
+static const uint8_t K6[] = {
+        0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+        0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+        0x62, 0x49, 0x77, 0x57, 0x24, 0x70, 0x93, 0x69,
+        0x99, 0x59, 0x57, 0x49, 0x66, 0x96, 0x76, 0x27
+};
+static const uint8_t TK6[] = {
+        0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+        0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95,
+        0x02, 0x88, 0x41, 0x97, 0x16, 0x93, 0x99, 0x37,
+        0x51, 0x05, 0x82, 0x09, 0x74, 0x94, 0x45, 0x92
+};
+static const uint8_t IV6[] = {
+        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P6[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+        0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+        0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+        0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+        0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+        0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+        0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+        0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+        0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+        0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+        0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+        0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+        0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+        0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+        0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const uint8_t C6[] = {
+        0x1c, 0x3b, 0x3a, 0x10, 0x2f, 0x77, 0x03, 0x86,
+        0xe4, 0x83, 0x6c, 0x99, 0xe3, 0x70, 0xcf, 0x9b,
+        0xea, 0x00, 0x80, 0x3f, 0x5e, 0x48, 0x23, 0x57,
+        0xa4, 0xae, 0x12, 0xd4, 0x14, 0xa3, 0xe6, 0x3b,
+        0x5d, 0x31, 0xe2, 0x76, 0xf8, 0xfe, 0x4a, 0x8d,
+        0x66, 0xb3, 0x17, 0xf9, 0xac, 0x68, 0x3f, 0x44,
+        0x68, 0x0a, 0x86, 0xac, 0x35, 0xad, 0xfc, 0x33,
+        0x45, 0xbe, 0xfe, 0xcb, 0x4b, 0xb1, 0x88, 0xfd,
+        0x57, 0x76, 0x92, 0x6c, 0x49, 0xa3, 0x09, 0x5e,
+        0xb1, 0x08, 0xfd, 0x10, 0x98, 0xba, 0xec, 0x70,
+        0xaa, 0xa6, 0x69, 0x99, 0xa7, 0x2a, 0x82, 0xf2,
+        0x7d, 0x84, 0x8b, 0x21, 0xd4, 0xa7, 0x41, 0xb0,
+        0xc5, 0xcd, 0x4d, 0x5f, 0xff, 0x9d, 0xac, 0x89,
+        0xae, 0xba, 0x12, 0x29, 0x61, 0xd0, 0x3a, 0x75,
+        0x71, 0x23, 0xe9, 0x87, 0x0f, 0x8a, 0xcf, 0x10,
+        0x00, 0x02, 0x08, 0x87, 0x89, 0x14, 0x29, 0xca,
+        0x2a, 0x3e, 0x7a, 0x7d, 0x7d, 0xf7, 0xb1, 0x03,
+        0x55, 0x16, 0x5c, 0x8b, 0x9a, 0x6d, 0x0a, 0x7d,
+        0xe8, 0xb0, 0x62, 0xc4, 0x50, 0x0d, 0xc4, 0xcd,
+        0x12, 0x0c, 0x0f, 0x74, 0x18, 0xda, 0xe3, 0xd0,
+        0xb5, 0x78, 0x1c, 0x34, 0x80, 0x3f, 0xa7, 0x54,
+        0x21, 0xc7, 0x90, 0xdf, 0xe1, 0xde, 0x18, 0x34,
+        0xf2, 0x80, 0xd7, 0x66, 0x7b, 0x32, 0x7f, 0x6c,
+        0x8c, 0xd7, 0x55, 0x7e, 0x12, 0xac, 0x3a, 0x0f,
+        0x93, 0xec, 0x05, 0xc5, 0x2e, 0x04, 0x93, 0xef,
+        0x31, 0xa1, 0x2d, 0x3d, 0x92, 0x60, 0xf7, 0x9a,
+        0x28, 0x9d, 0x6a, 0x37, 0x9b, 0xc7, 0x0c, 0x50,
+        0x84, 0x14, 0x73, 0xd1, 0xa8, 0xcc, 0x81, 0xec,
+        0x58, 0x3e, 0x96, 0x45, 0xe0, 0x7b, 0x8d, 0x96,
+        0x70, 0x65, 0x5b, 0xa5, 0xbb, 0xcf, 0xec, 0xc6,
+        0xdc, 0x39, 0x66, 0x38, 0x0a, 0xd8, 0xfe, 0xcb,
+        0x17, 0xb6, 0xba, 0x02, 0x46, 0x9a, 0x02, 0x0a,
+        0x84, 0xe1, 0x8e, 0x8f, 0x84, 0x25, 0x20, 0x70,
+        0xc1, 0x3e, 0x9f, 0x1f, 0x28, 0x9b, 0xe5, 0x4f,
+        0xbc, 0x48, 0x14, 0x57, 0x77, 0x8f, 0x61, 0x60,
+        0x15, 0xe1, 0x32, 0x7a, 0x02, 0xb1, 0x40, 0xf1,
+        0x50, 0x5e, 0xb3, 0x09, 0x32, 0x6d, 0x68, 0x37,
+        0x8f, 0x83, 0x74, 0x59, 0x5c, 0x84, 0x9d, 0x84,
+        0xf4, 0xc3, 0x33, 0xec, 0x44, 0x23, 0x88, 0x51,
+        0x43, 0xcb, 0x47, 0xbd, 0x71, 0xc5, 0xed, 0xae,
+        0x9b, 0xe6, 0x9a, 0x2f, 0xfe, 0xce, 0xb1, 0xbe,
+        0xc9, 0xde, 0x24, 0x4f, 0xbe, 0x15, 0x99, 0x2b,
+        0x11, 0xb7, 0x7c, 0x04, 0x0f, 0x12, 0xbd, 0x8f,
+        0x6a, 0x97, 0x5a, 0x44, 0xa0, 0xf9, 0x0c, 0x29,
+        0xa9, 0xab, 0xc3, 0xd4, 0xd8, 0x93, 0x92, 0x72,
+        0x84, 0xc5, 0x87, 0x54, 0xcc, 0xe2, 0x94, 0x52,
+        0x9f, 0x86, 0x14, 0xdc, 0xd2, 0xab, 0xa9, 0x91,
+        0x92, 0x5f, 0xed, 0xc4, 0xae, 0x74, 0xff, 0xac,
+        0x6e, 0x33, 0x3b, 0x93, 0xeb, 0x4a, 0xff, 0x04,
+        0x79, 0xda, 0x9a, 0x41, 0x0e, 0x44, 0x50, 0xe0,
+        0xdd, 0x7a, 0xe4, 0xc6, 0xe2, 0x91, 0x09, 0x00,
+        0x57, 0x5d, 0xa4, 0x01, 0xfc, 0x07, 0x05, 0x9f,
+        0x64, 0x5e, 0x8b, 0x7e, 0x9b, 0xfd, 0xef, 0x33,
+        0x94, 0x30, 0x54, 0xff, 0x84, 0x01, 0x14, 0x93,
+        0xc2, 0x7b, 0x34, 0x29, 0xea, 0xed, 0xb4, 0xed,
+        0x53, 0x76, 0x44, 0x1a, 0x77, 0xed, 0x43, 0x85,
+        0x1a, 0xd7, 0x7f, 0x16, 0xf5, 0x41, 0xdf, 0xd2,
+        0x69, 0xd5, 0x0d, 0x6a, 0x5f, 0x14, 0xfb, 0x0a,
+        0xab, 0x1c, 0xbb, 0x4c, 0x15, 0x50, 0xbe, 0x97,
+        0xf7, 0xab, 0x40, 0x66, 0x19, 0x3c, 0x4c, 0xaa,
+        0x77, 0x3d, 0xad, 0x38, 0x01, 0x4b, 0xd2, 0x09,
+        0x2f, 0xa7, 0x55, 0xc8, 0x24, 0xbb, 0x5e, 0x54,
+        0xc4, 0xf3, 0x6f, 0xfd, 0xa9, 0xfc, 0xea, 0x70,
+        0xb9, 0xc6, 0xe6, 0x93, 0xe1, 0x48, 0xc1, 0x51
+};
+
+static const uint8_t K7[] = {
+        0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+        0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+        0x62, 0x49, 0x77, 0x57, 0x24, 0x70, 0x93, 0x69,
+        0x99, 0x59, 0x57, 0x49, 0x66, 0x96, 0x76, 0x27
+};
+static const uint8_t TK7[] = {
+        0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+        0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95,
+        0x02, 0x88, 0x41, 0x97, 0x16, 0x93, 0x99, 0x37,
+        0x51, 0x05, 0x82, 0x09, 0x74, 0x94, 0x45, 0x92
+};
+static const uint8_t IV7[] = {
+        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t P7[] = {
+        0x03, 0x0a, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34,
+        0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c,
+        0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4,
+        0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc,
+        0xe3, 0xea, 0xf1, 0xf8, 0xff, 0x06, 0x0d, 0x14,
+        0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c,
+        0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84,
+        0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc,
+        0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xed, 0xf4,
+        0xfb, 0x02, 0x09, 0x10, 0x17, 0x1e, 0x25, 0x2c,
+        0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64,
+        0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c,
+        0xa3, 0xaa, 0xb1, 0xb8
+};
+static const uint8_t C7[] = {
+        0x51, 0x69, 0x20, 0x17, 0x48, 0x14, 0xda, 0xbb,
+        0x65, 0x35, 0xda, 0x84, 0x93, 0x05, 0x7f, 0x3a,
+        0x35, 0xfd, 0x78, 0x03, 0x42, 0x40, 0xd1, 0x97,
+        0xed, 0xa0, 0x75, 0xa6, 0x2b, 0xc0, 0x82, 0xf4,
+        0xfa, 0xb0, 0x2b, 0x1c, 0x0a, 0xdd, 0x55, 0x77,
+        0xe1, 0xd6, 0xc9, 0xc7, 0x67, 0x4b, 0xf7, 0x40,
+        0xdd, 0x49, 0x5e, 0xc7, 0x7d, 0x51, 0x45, 0x19,
+        0x45, 0xa6, 0xd3, 0xc4, 0x3b, 0xa5, 0x0e, 0xd7,
+        0xe5, 0xed, 0xb2, 0xbc, 0x96, 0x43, 0x5d, 0x1d,
+        0x66, 0x59, 0xaf, 0x52, 0x3c, 0xd6, 0xad, 0x62,
+        0xff, 0xba, 0x76, 0xfa, 0x12, 0xef, 0x1b, 0x7a,
+        0xdf, 0x98, 0x8c, 0x9f, 0xf8, 0x4e, 0xce, 0x75,
+        0xfd, 0x23, 0xf8, 0x57
+};
+
+static const struct xts_vector xts_vectors[] = {
+        {K1, TK1, IV1, P1, sizeof(P1), C1, sizeof(K1)},
+        {K2, TK2, IV2, P2, sizeof(P2), C2, sizeof(K2)},
+        {K3, TK3, IV3, P3, sizeof(P3), C3, sizeof(K3)},
+        {K4, TK4, IV4, P4, sizeof(P4), C4, sizeof(K4)},
+        {K5, TK5, IV5, P5, sizeof(P5), C5, sizeof(K5)},
+        {K6, TK6, IV6, P6, sizeof(P6), C6, sizeof(K6)},
+        {K7, TK7, IV7, P7, sizeof(P7), C7, sizeof(K7)},
+};
+
+static int
+xts_job_ok(const struct IMB_JOB *job,
+           const uint8_t *out_text,
+           const uint8_t *target,
+           const uint8_t *padding,
+           const size_t sizeof_padding,
+           const unsigned text_len)
+{
+        const int num = (const int)((uint64_t)job->user_data2);
+
+        if (job->status != IMB_STATUS_COMPLETED) {
+                printf("%d error status:%d, job %d",
+                       __LINE__, job->status, num);
+                return 0;
+        }
+        if (memcmp(out_text, target + sizeof_padding,
+                   text_len)) {
+                printf("%d mismatched\n", num);
+                return 0;
+        }
+        if (memcmp(padding, target, sizeof_padding)) {
+                printf("%d overwrite head\n", num);
+                return 0;
+        }
+        if (memcmp(padding,
+                   target + sizeof_padding + text_len,
+                   sizeof_padding)) {
+                printf("%d overwrite tail\n", num);
+                return 0;
+        }
+        return 1;
+}
+
+static int
+test_xts_many(struct IMB_MGR *mb_mgr,
+              void *enc_keys,
+              void *dec_keys,
+              void *tweak_keys,
+              const uint8_t *iv,
+              const uint8_t *in_text,
+              const uint8_t *out_text,
+              unsigned text_len,
+              int dir,
+              int order,
+              const int in_place,
+              const int key_len,
+              const int num_jobs)
+{
+        struct IMB_JOB *job;
+        uint8_t padding[16];
+        uint8_t **targets = malloc(num_jobs * sizeof(void *));
+        int i, jobs_rx = 0, ret = -1;
+
+        assert(targets != NULL);
+
+        memset(padding, -1, sizeof(padding));
+
+        for (i = 0; i < num_jobs; i++) {
+                targets[i] = malloc(text_len + (sizeof(padding) * 2));
+                memset(targets[i], -1, text_len + (sizeof(padding) * 2));
+                if (in_place) {
+                        /* copy input text to the allocated buffer */
+                        memcpy(targets[i] + sizeof(padding), in_text, text_len);
+                }
+        }
+
+        /* flush the scheduler */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+                job->cipher_direction = dir;
+                job->chain_order = order;
+                if (!in_place) {
+                        job->dst = targets[i] + sizeof(padding);
+                        job->src = in_text;
+                } else {
+                        job->dst = targets[i] + sizeof(padding);
+                        job->src = targets[i] + sizeof(padding);
+                }
+                job->cipher_mode = IMB_CIPHER_XTS;
+                job->enc_keys = enc_keys;
+                job->dec_keys = dec_keys;
+                job->cipher_fields.XTS.tweak_keys = tweak_keys;
+                job->key_len_in_bytes = key_len;
+
+                job->iv = iv;
+                job->iv_len_in_bytes = 16;
+                job->cipher_start_src_offset_in_bytes = 0;
+                job->msg_len_to_cipher_in_bytes = text_len;
+                job->user_data = targets[i];
+                job->user_data2 = (void *)((uint64_t)i);
+
+                job->hash_alg = IMB_AUTH_NULL;
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                if (job != NULL) {
+                        jobs_rx++;
+                        if (!xts_job_ok(job, out_text, job->user_data, padding,
+                                        sizeof(padding), text_len))
+                                goto end;
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                jobs_rx++;
+                if (!xts_job_ok(job, out_text, job->user_data, padding,
+                                sizeof(padding), text_len))
+                        goto end;
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
+        ret = 0;
+
+ end:
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++)
+                free(targets[i]);
+        free(targets);
+        return ret;
+}
+
+static void
+test_xts_vectors(struct IMB_MGR *mb_mgr, const int vec_cnt,
+                 const struct xts_vector *vec_tab, const char *banner,
+                 const int num_jobs,
+                 struct test_suite_context *ts128,
+                 struct test_suite_context *ts256)
+{
+        int vect;
+        DECLARE_ALIGNED(uint32_t enc_keys[15*4], 16);
+        DECLARE_ALIGNED(uint32_t dec_keys[15*4], 16);
+        DECLARE_ALIGNED(uint32_t tweak_keys[15*4], 16);
+        DECLARE_ALIGNED(uint32_t dust[15*4], 16);
+
+        printf("%s (N jobs = %d):\n", banner, num_jobs);
+        for (vect = 0; vect < vec_cnt; vect++) {
+                struct test_suite_context *ctx = NULL;
+                int in_place;
+
+#ifdef DEBUG
+                printf("[%d/%d] Standard vector key_len:%d\n",
+                       vect + 1, vec_cnt,
+                       (int) vec_tab[vect].Klen);
+#else
+                printf(".");
+#endif
+
+                if (vec_tab[vect].Klen == 16) {
+                        IMB_AES_KEYEXP_128(mb_mgr, vec_tab[vect].K, enc_keys,
+                                           dec_keys);
+                        IMB_AES_KEYEXP_128(mb_mgr, vec_tab[vect].TK,
+                                           tweak_keys, dust);
+                        ctx = ts128;
+                } else {
+                        IMB_AES_KEYEXP_256(mb_mgr, vec_tab[vect].K, enc_keys,
+                                           dec_keys);
+                        IMB_AES_KEYEXP_256(mb_mgr, vec_tab[vect].TK,
+                                           tweak_keys, dust);
+                        ctx = ts256;
+                }
+
+                for (in_place = 0; in_place <= 1; in_place++) {
+                        if (test_xts_many(mb_mgr, enc_keys, dec_keys,
+                                          tweak_keys, vec_tab[vect].IV,
+                                          vec_tab[vect].P, vec_tab[vect].C,
+                                          (unsigned) vec_tab[vect].Plen,
+                                          IMB_DIR_ENCRYPT,
+                                          IMB_ORDER_CIPHER_HASH, in_place,
+                                          vec_tab[vect].Klen, num_jobs)) {
+                                printf("error #%d encrypt%s\n", vect + 1,
+                                       in_place ? " in-place" : "");
+                                test_suite_update(ctx, 0, 1);
+                        } else {
+                                test_suite_update(ctx, 1, 0);
+                        }
+
+                        if (test_xts_many(mb_mgr, enc_keys, dec_keys,
+                                          tweak_keys, vec_tab[vect].IV,
+                                          vec_tab[vect].C, vec_tab[vect].P,
+                                          (unsigned) vec_tab[vect].Plen,
+                                          IMB_DIR_DECRYPT,
+                                          IMB_ORDER_HASH_CIPHER, in_place,
+                                          vec_tab[vect].Klen, num_jobs)) {
+                                printf("error #%d decrypt%s\n", vect + 1,
+                                       in_place ? " in-place" : "");
+                                test_suite_update(ctx, 0, 1);
+                        } else {
+                                test_suite_update(ctx, 1, 0);
+                        }
+                }
+        }
+        printf("\n");
+}
+
+/*
+ * Submits jobs for all vectors of the given key length before flushing,
+ * so that lanes of the same manager run different keys, tweaks and
+ * lengths (including ciphertext stealing) side by side
+ */
+static int
+test_xts_mixed(struct IMB_MGR *mb_mgr, const int dir, const int key_len,
+               const int num_jobs)
+{
+        DECLARE_ALIGNED(uint32_t enc_keys[DIM(xts_vectors)][15*4], 16);
+        DECLARE_ALIGNED(uint32_t dec_keys[DIM(xts_vectors)][15*4], 16);
+        DECLARE_ALIGNED(uint32_t tweak_keys[DIM(xts_vectors)][15*4], 16);
+        DECLARE_ALIGNED(uint32_t dust[15*4], 16);
+        int vec_idx[DIM(xts_vectors)];
+        uint8_t **targets = malloc(num_jobs * sizeof(void *));
+        uint8_t padding[16];
+        struct IMB_JOB *job;
+        int i, num_vecs = 0, jobs_rx = 0, ret = -1;
+
+        assert(targets != NULL);
+
+        memset(padding, -1, sizeof(padding));
+
+        for (i = 0; i < (int) DIM(xts_vectors); i++) {
+                const struct xts_vector *vec = &xts_vectors[i];
+
+                if ((int) vec->Klen != key_len)
+                        continue;
+                if (key_len == 16) {
+                        IMB_AES_KEYEXP_128(mb_mgr, vec->K, enc_keys[num_vecs],
+                                           dec_keys[num_vecs]);
+                        IMB_AES_KEYEXP_128(mb_mgr, vec->TK,
+                                           tweak_keys[num_vecs], dust);
+                } else {
+                        IMB_AES_KEYEXP_256(mb_mgr, vec->K, enc_keys[num_vecs],
+                                           dec_keys[num_vecs]);
+                        IMB_AES_KEYEXP_256(mb_mgr, vec->TK,
+                                           tweak_keys[num_vecs], dust);
+                }
+                vec_idx[num_vecs++] = i;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const struct xts_vector *vec =
+                        &xts_vectors[vec_idx[i % num_vecs]];
+                const size_t alloc_len = vec->Plen + (sizeof(padding) * 2);
+
+                targets[i] = malloc(alloc_len);
+                assert(targets[i] != NULL);
+                memset(targets[i], -1, alloc_len);
+        }
+
+        /* flush the scheduler */
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++) {
+                const int k = i % num_vecs;
+                const struct xts_vector *vec = &xts_vectors[vec_idx[k]];
+
+                job = IMB_GET_NEXT_JOB(mb_mgr);
+                job->cipher_direction = dir;
+                job->chain_order = (dir == IMB_DIR_ENCRYPT) ?
+                        IMB_ORDER_CIPHER_HASH : IMB_ORDER_HASH_CIPHER;
+                job->dst = targets[i] + sizeof(padding);
+                job->src = (dir == IMB_DIR_ENCRYPT) ? vec->P : vec->C;
+                job->cipher_mode = IMB_CIPHER_XTS;
+                job->enc_keys = enc_keys[k];
+                job->dec_keys = dec_keys[k];
+                job->cipher_fields.XTS.tweak_keys = tweak_keys[k];
+                job->key_len_in_bytes = key_len;
+
+                job->iv = vec->IV;
+                job->iv_len_in_bytes = 16;
+                job->cipher_start_src_offset_in_bytes = 0;
+                job->msg_len_to_cipher_in_bytes = vec->Plen;
+                job->user_data = targets[i];
+                job->user_data2 = (void *)((uint64_t)i);
+
+                job->hash_alg = IMB_AUTH_NULL;
+
+                job = IMB_SUBMIT_JOB(mb_mgr);
+                if (job != NULL)
+                        jobs_rx++;
+                while (job != NULL) {
+                        if (job->status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d\n",
+                                       __LINE__, job->status);
+                                goto end;
+                        }
+                        job = IMB_GET_COMPLETED_JOB(mb_mgr);
+                        if (job != NULL)
+                                jobs_rx++;
+                }
+        }
+
+        while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
+                jobs_rx++;
+                if (job->status != IMB_STATUS_COMPLETED) {
+                        printf("%d error status:%d\n", __LINE__, job->status);
+                        goto end;
+                }
+        }
+
+        if (jobs_rx != num_jobs) {
+                printf("Expected %d jobs, received %d\n", num_jobs, jobs_rx);
+                goto end;
+        }
+
+        for (i = 0; i < num_jobs; i++) {
+                const struct xts_vector *vec =
+                        &xts_vectors[vec_idx[i % num_vecs]];
+                const uint8_t *out_text =
+                        (dir == IMB_DIR_ENCRYPT) ? vec->C : vec->P;
+                const unsigned text_len = (unsigned) vec->Plen;
+
+                if (memcmp(out_text, targets[i] + sizeof(padding),
+                           text_len)) {
+                        printf("%d mismatched\n", i);
+                        goto end;
+                }
+                if (memcmp(padding, targets[i], sizeof(padding)) ||
+                    memcmp(padding,
+                           targets[i] + sizeof(padding) + text_len,
+                           sizeof(padding))) {
+                        printf("%d overwrite\n", i);
+                        goto end;
+                }
+        }
+        ret = 0;
+
+ end:
+        while (IMB_FLUSH_JOB(mb_mgr) != NULL)
+                ;
+
+        for (i = 0; i < num_jobs; i++)
+                free(targets[i]);
+        free(targets);
+        return ret;
+}
+
+static void
+test_xts_mixed_vectors(struct IMB_MGR *mb_mgr, const int num_jobs,
+                       struct test_suite_context *ts128,
+                       struct test_suite_context *ts256)
+{
+        const int dirs[2] = { IMB_DIR_ENCRYPT, IMB_DIR_DECRYPT };
+        unsigned d;
+
+        printf("AES-XTS mixed vectors (N jobs = %d):\n", num_jobs);
+        for (d = 0; d < DIM(dirs); d++) {
+                printf(".");
+                if (test_xts_mixed(mb_mgr, dirs[d], 16, num_jobs)) {
+                        printf("error - mixed AES-XTS-128 %s\n",
+                               d == 0 ? "encrypt" : "decrypt");
+                        test_suite_update(ts128, 0, 1);
+                } else {
+                        test_suite_update(ts128, 1, 0);
+                }
+
+                if (test_xts_mixed(mb_mgr, dirs[d], 32, num_jobs)) {
+                        printf("error - mixed AES-XTS-256 %s\n",
+                               d == 0 ? "encrypt" : "decrypt");
+                        test_suite_update(ts256, 0, 1);
+                } else {
+                        test_suite_update(ts256, 1, 0);
+                }
+        }
+        printf("\n");
+}
+
+int
+xts_test(struct IMB_MGR *mb_mgr)
+{
+        struct test_suite_context ts128, ts256;
+        const int num_jobs_tab[] = {
+                1, 3, 4, 5, 7, 8, 9, 15, 16, 17
+        };
+        unsigned i;
+        int errors = 0;
+
+        test_suite_start(&ts128, "AES-XTS-128");
+        test_suite_start(&ts256, "AES-XTS-256");
+
+        /* XTS is not supported by the no-aesni implementation */
+        if (mb_mgr->flags & IMB_FLAG_AESNI_OFF) {
+                printf("AES-XTS not supported without AESNI - skipping\n");
+                goto exit;
+        }
+
+        for (i = 0; i < DIM(num_jobs_tab); i++)
+                test_xts_vectors(mb_mgr, DIM(xts_vectors), xts_vectors,
+                                 "AES-XTS standard test vectors",
+                                 num_jobs_tab[i], &ts128, &ts256);
+
+        /* fill all lanes (16 on AVX512) with different vectors */
+        test_xts_mixed_vectors(mb_mgr, 17, &ts128, &ts256);
+        test_xts_mixed_vectors(mb_mgr, 33, &ts128, &ts256);
+
+ exit:
+        errors = test_suite_end(&ts128);
+        errors += test_suite_end(&ts256);
+
+        return errors;
+}
@@ -55,6 +55,13 @@ enum test_type {
         TEST_N_BUFFER
 };
 
+/* job_api argument of the validate functions */
+enum api_type {
+        TEST_DIRECT_API,
+        TEST_JOB_API,
+        TEST_BURST_API
+};
+
 int zuc_test(struct IMB_MGR *mb_mgr);
 
 int validate_zuc_algorithm(struct IMB_MGR *mb_mgr, uint8_t *pSrcData,
@@ -77,10 +84,10 @@ int validate_zuc_EIA_n_block(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                              const unsigned int job_api);
 int validate_zuc256_EEA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                          uint8_t **pDstData, uint8_t **pKeys, uint8_t **pIV,
-                         uint32_t numBuffs);
+                         uint32_t numBuffs, const unsigned int job_api);
 int validate_zuc256_EIA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                          uint8_t **pDstData, uint8_t **pKeys, uint8_t **pIV,
-                         uint32_t numBuffs);
+                         uint32_t numBuffs, const unsigned int job_api);
 
 static void byte_hexdump(const char *message, const uint8_t *ptr, int len);
 
@@ -316,10 +323,51 @@ int zuc_test(struct IMB_MGR *mb_mgr)
                         test_suite_update(&eia3_ctx, 1, 0);
         }
 
+        /* Burst API tests */
+        if (validate_zuc_EEA_1_block(mb_mgr, pSrcData[0], pDstData[0], pKeys[0],
+                                     pIV[0], TEST_BURST_API))
+                test_suite_update(&eea3_ctx, 0, 1);
+        else
+                test_suite_update(&eea3_ctx, 1, 0);
+
+        if (validate_zuc_EEA_4_block(mb_mgr, pSrcData, pDstData, pKeys, pIV,
+                                     TEST_BURST_API))
+                test_suite_update(&eea3_ctx, 0, 1);
+        else
+                test_suite_update(&eea3_ctx, 1, 0);
+
+        for (i = 0; i < DIM(numBuffs); i++) {
+                if (validate_zuc_EEA_n_block(mb_mgr, pSrcData, pDstData, pKeys,
+                                             pIV, numBuffs[i], TEST_BURST_API))
+                        test_suite_update(&eea3_ctx, 0, 1);
+                else
+                        test_suite_update(&eea3_ctx, 1, 0);
+        }
+
+        if (validate_zuc_EIA_1_block(mb_mgr, pSrcData[0], pDstData[0], pKeys[0],
+                                     pIV[0], TEST_BURST_API))
+                test_suite_update(&eia3_ctx, 0, 1);
+        else
+                test_suite_update(&eia3_ctx, 1, 0);
+
+        for (i = 0; i < DIM(numBuffs); i++) {
+                if (validate_zuc_EIA_n_block(mb_mgr, pSrcData, pDstData, pKeys,
+                                             pIV, numBuffs[i], TEST_BURST_API))
+                        test_suite_update(&eia3_ctx, 0, 1);
+                else
+                        test_suite_update(&eia3_ctx, 1, 0);
+        }
+
         /* ZUC-EEA3-256 tests */
         for (i = 0; i < DIM(numBuffs); i++) {
                 if (validate_zuc256_EEA3(mb_mgr, pSrcData, pDstData, pKeys,
-                                         pIV, numBuffs[i]))
+                                         pIV, numBuffs[i], TEST_JOB_API))
+                        test_suite_update(&eea3_256_ctx, 0, 1);
+                else
+                        test_suite_update(&eea3_256_ctx, 1, 0);
+
+                if (validate_zuc256_EEA3(mb_mgr, pSrcData, pDstData, pKeys,
+                                         pIV, numBuffs[i], TEST_BURST_API))
                         test_suite_update(&eea3_256_ctx, 0, 1);
                 else
                         test_suite_update(&eea3_256_ctx, 1, 0);
@@ -328,7 +376,13 @@ int zuc_test(struct IMB_MGR *mb_mgr)
         /* ZUC-EIA3-256 tests */
         for (i = 0; i < DIM(numBuffs); i++) {
                 if (validate_zuc256_EIA3(mb_mgr, pSrcData, pDstData, pKeys,
-                                         pIV, numBuffs[i]))
+                                         pIV, numBuffs[i], TEST_JOB_API))
+                        test_suite_update(&eia3_256_ctx, 0, 1);
+                else
+                        test_suite_update(&eia3_256_ctx, 1, 0);
+
+                if (validate_zuc256_EIA3(mb_mgr, pSrcData, pDstData, pKeys,
+                                         pIV, numBuffs[i], TEST_BURST_API))
                         test_suite_update(&eia3_256_ctx, 0, 1);
                 else
                         test_suite_update(&eia3_256_ctx, 1, 0);
@@ -354,14 +408,22 @@ submit_eea3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                  uint8_t **src, uint8_t **dst, const uint32_t *lens,
                  int dir, const unsigned int num_jobs,
                  const unsigned int key_len,
-                 const unsigned int *iv_lens)
+                 const unsigned int *iv_lens,
+                 const unsigned int job_api)
 {
         IMB_JOB *job;
+        IMB_JOB jobs[MAXBUFS];
         unsigned int i;
         unsigned int jobs_rx = 0;
 
+        if (job_api == TEST_BURST_API)
+                memset(jobs, 0, sizeof(jobs));
+
         for (i = 0; i < num_jobs; i++) {
-                job = IMB_GET_NEXT_JOB(mb_mgr);
+                if (job_api == TEST_BURST_API)
+                        job = &jobs[i];
+                else
+                        job = IMB_GET_NEXT_JOB(mb_mgr);
                 job->cipher_direction = dir;
                 job->chain_order = IMB_ORDER_CIPHER_HASH;
                 job->cipher_mode = IMB_CIPHER_ZUC_EEA3;
@@ -376,6 +438,9 @@ submit_eea3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                 job->msg_len_to_cipher_in_bytes = lens[i];
                 job->hash_alg = IMB_AUTH_NULL;
 
+                if (job_api == TEST_BURST_API)
+                        continue;
+
                 job = IMB_SUBMIT_JOB(mb_mgr);
                 if (job != NULL) {
                         jobs_rx++;
@@ -387,6 +452,19 @@ submit_eea3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **ivs,
                 }
         }
 
+        if (job_api == TEST_BURST_API) {
+                jobs_rx = IMB_SUBMIT_CIPHER_BURST(mb_mgr, jobs, num_jobs,
+                                                  IMB_CIPHER_ZUC_EEA3, dir,
+                                                  key_len);
+                for (i = 0; i < jobs_rx; i++) {
+                        if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d, job %u",
+                                       __LINE__, jobs[i].status, i);
+                                return -1;
+                        }
+                }
+        }
+
         while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
                 jobs_rx++;
                 if (job->status != IMB_STATUS_COMPLETED) {
@@ -410,14 +488,22 @@ submit_eia3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **iv,
                  const unsigned int num_jobs,
                  const unsigned int key_sz,
                  const unsigned int tag_sz,
-                 const unsigned int *iv_lens)
+                 const unsigned int *iv_lens,
+                 const unsigned int job_api)
 {
         IMB_JOB *job;
+        IMB_JOB jobs[MAXBUFS];
         unsigned int i;
         unsigned int jobs_rx = 0;
 
+        if (job_api == TEST_BURST_API)
+                memset(jobs, 0, sizeof(jobs));
+
         for (i = 0; i < num_jobs; i++) {
-                job = IMB_GET_NEXT_JOB(mb_mgr);
+                if (job_api == TEST_BURST_API)
+                        job = &jobs[i];
+                else
+                        job = IMB_GET_NEXT_JOB(mb_mgr);
                 job->chain_order = IMB_ORDER_CIPHER_HASH;
                 job->cipher_mode = IMB_CIPHER_NULL;
                 job->src = src[i];
@@ -439,6 +525,9 @@ submit_eia3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **iv,
                 job->auth_tag_output = tags[i];
                 job->auth_tag_output_len_in_bytes = tag_sz;
 
+                if (job_api == TEST_BURST_API)
+                        continue;
+
                 job = IMB_SUBMIT_JOB(mb_mgr);
                 if (job != NULL) {
                         jobs_rx++;
@@ -450,6 +539,18 @@ submit_eia3_jobs(struct IMB_MGR *mb_mgr, uint8_t **keys, uint8_t **iv,
                 }
         }
 
+        if (job_api == TEST_BURST_API) {
+                jobs_rx = IMB_SUBMIT_HASH_BURST(mb_mgr, jobs, num_jobs,
+                                                jobs[0].hash_alg);
+                for (i = 0; i < jobs_rx; i++) {
+                        if (jobs[i].status != IMB_STATUS_COMPLETED) {
+                                printf("%d error status:%d, job %u",
+                                       __LINE__, jobs[i].status, i);
+                                return -1;
+                        }
+                }
+        }
+
         while ((job = IMB_FLUSH_JOB(mb_mgr)) != NULL) {
                 jobs_rx++;
                 if (job->status != IMB_STATUS_COMPLETED) {
@@ -543,7 +644,7 @@ validate_zuc_EEA_1_block(struct IMB_MGR *mb_mgr, uint8_t *pSrcData,
                                          &pDstData, &byteLength,
                                          IMB_DIR_ENCRYPT, 1,
                                          ZUC_KEY_LEN_IN_BYTES,
-                                         &iv_len);
+                                         &iv_len, job_api);
                 else
                         IMB_ZUC_EEA3_1_BUFFER(mb_mgr, pKeys, pIV, pSrcData,
                                               pDstData, byteLength);
@@ -589,7 +690,7 @@ submit_and_verify(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
         if (job_api)
                 submit_eea3_jobs(mb_mgr, pKeys, pIV, pSrcData,
                                  pDstData, packetLen, dir, num_buffers,
-                                 ZUC_KEY_LEN_IN_BYTES, iv_lens);
+                                 ZUC_KEY_LEN_IN_BYTES, iv_lens, job_api);
         else {
                 if (type == TEST_4_BUFFER)
                         IMB_ZUC_EEA3_4_BUFFER(mb_mgr,
@@ -647,7 +748,7 @@ submit_and_verify(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
 static int
 submit_and_verify_zuc256(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                          uint8_t **pDstData, uint8_t **pKeys, uint8_t **pIV,
-                         IMB_CIPHER_DIRECTION dir,
+                         const unsigned int job_api, IMB_CIPHER_DIRECTION dir,
                          const unsigned int var_bufs,
                          const unsigned int num_buffers,
                          const uint32_t *buf_idx)
@@ -672,7 +773,7 @@ submit_and_verify_zuc256(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
 
         submit_eea3_jobs(mb_mgr, pKeys, pIV, pSrcData,
                          pDstData, packetLen, dir, num_buffers,
-                         ZUC256_KEY_LEN_IN_BYTES, iv_lens);
+                         ZUC256_KEY_LEN_IN_BYTES, iv_lens, job_api);
 
         for (i = 0; i < num_buffers; i++) {
                 uint8_t *pDst8 = (uint8_t *)pDstData[i];
@@ -805,7 +906,7 @@ int validate_zuc_EEA_n_block(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
 
 int validate_zuc256_EEA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                          uint8_t **pDstData, uint8_t **pKeys, uint8_t **pIV,
-                         uint32_t numBuffs)
+                         uint32_t numBuffs, const unsigned int job_api)
 {
         uint32_t i, j;
         int ret = 0;
@@ -818,13 +919,15 @@ int validate_zuc256_EEA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                         buf_idx[j] = i;
 
                 retTmp = submit_and_verify_zuc256(mb_mgr, pSrcData, pDstData,
-                                                  pKeys, pIV, IMB_DIR_ENCRYPT,
+                                                  pKeys, pIV, job_api,
+                                                  IMB_DIR_ENCRYPT,
                                                   0, numBuffs, buf_idx);
                 if (retTmp < 0)
                         ret = retTmp;
 
                 retTmp = submit_and_verify_zuc256(mb_mgr, pSrcData, pDstData,
-                                                  pKeys, pIV, IMB_DIR_DECRYPT,
+                                                  pKeys, pIV, job_api,
+                                                  IMB_DIR_DECRYPT,
                                                   0, numBuffs, buf_idx);
                 if (retTmp < 0)
                         ret = retTmp;
@@ -835,13 +938,13 @@ int validate_zuc256_EEA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                 buf_idx[i] = i % NUM_ZUC_256_EEA3_TESTS;
 
         retTmp = submit_and_verify_zuc256(mb_mgr, pSrcData, pDstData, pKeys,
-                                          pIV, IMB_DIR_ENCRYPT,
+                                          pIV, job_api, IMB_DIR_ENCRYPT,
                                           1, numBuffs, buf_idx);
         if (retTmp < 0)
                 ret = retTmp;
 
         retTmp = submit_and_verify_zuc256(mb_mgr, pSrcData, pDstData, pKeys,
-                                          pIV, IMB_DIR_DECRYPT,
+                                          pIV, job_api, IMB_DIR_DECRYPT,
                                           1, numBuffs, buf_idx);
         if (retTmp < 0)
                 ret = retTmp;
@@ -875,7 +978,7 @@ int validate_zuc_EIA_1_block(struct IMB_MGR *mb_mgr, uint8_t *pSrcData,
                         submit_eia3_jobs(mb_mgr, &pKeys, &pIV,
                                          &pSrcData, &pDstData,
                                          &bitLength, 1, ZUC_KEY_LEN_IN_BYTES,
-                                         ZUC_DIGEST_LEN, &iv_len);
+                                         ZUC_DIGEST_LEN, &iv_len, job_api);
                 else
                         IMB_ZUC_EIA3_1_BUFFER(mb_mgr, pKeys, pIV, pSrcData,
                                               bitLength, (uint32_t *)pDstData);
@@ -929,7 +1032,7 @@ int validate_zuc_EIA_n_block(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                                          pSrcData, pDstData,
                                          bitLength, numBuffs,
                                          ZUC_KEY_LEN_IN_BYTES, ZUC_DIGEST_LEN,
-                                         iv_lens);
+                                         iv_lens, job_api);
                 else
                         IMB_ZUC_EIA3_N_BUFFER(mb_mgr,
                                               (const void * const *)pKeys,
@@ -972,7 +1075,7 @@ int validate_zuc_EIA_n_block(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                 bitLength[i] = vector.length_in_bits;
                 byteLength = (bitLength[i] + 7) / 8;
                 memcpy(pSrcData[i], vector.message, byteLength);
-                iv_lens[j] = ZUC_IV_LEN_IN_BYTES;
+                iv_lens[i] = ZUC_IV_LEN_IN_BYTES;
         }
 
         if (job_api)
@@ -980,7 +1083,7 @@ int validate_zuc_EIA_n_block(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                                  pSrcData, pDstData,
                                  bitLength, numBuffs,
                                  ZUC_KEY_LEN_IN_BYTES, ZUC_DIGEST_LEN,
-                                 iv_lens);
+                                 iv_lens, job_api);
         else
                 IMB_ZUC_EIA3_N_BUFFER(mb_mgr,
                                       (const void * const *)pKeys,
@@ -1068,7 +1171,7 @@ verify_tag_256(void *mac, const struct test256EIA3_vectors_t *vector,
 
 int validate_zuc256_EIA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                          uint8_t **pDstData, uint8_t **pKeys, uint8_t **pIV,
-                         uint32_t numBuffs)
+                         uint32_t numBuffs, const unsigned int job_api)
 {
         uint32_t i, j;
         int retTmp, ret = 0;
@@ -1093,7 +1196,7 @@ int validate_zuc256_EIA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                                          pSrcData, pDstData,
                                          bitLength, numBuffs,
                                          ZUC256_KEY_LEN_IN_BYTES, tag_sz,
-                                         iv_lens);
+                                         iv_lens, job_api);
 
                         for (j = 0; j < numBuffs; j++) {
                                 retTmp = verify_tag_256(pDstData[j], vector,
@@ -1122,7 +1225,7 @@ int validate_zuc256_EIA3(struct IMB_MGR *mb_mgr, uint8_t **pSrcData,
                                  pSrcData, pDstData,
                                  bitLength, numBuffs,
                                  ZUC256_KEY_LEN_IN_BYTES, tag_sz,
-                                 iv_lens);
+                                 iv_lens, job_api);
 
                 for (i = 0; i < numBuffs; i++) {
                         const uint32_t vector_idx = i % NUM_ZUC_256_EIA3_TESTS;